@@ -8,6 +8,7 @@ import android.graphics.Bitmap
 import android.graphics.BitmapFactory
 import android.net.Uri
 import android.os.Build
+import android.os.SystemClock
 import android.util.Log
 import io.flutter.embedding.engine.plugins.FlutterPlugin
 import java.io.ByteArrayOutputStream
@@ -24,15 +25,28 @@ class FlutterPasteInputPlugin : FlutterPlugin, PasteInputHostApi {
     private lateinit var context: Context
     private var clipboardManager: ClipboardManager? = null
     private var flutterApi: PasteInputFlutterApi? = null
+    private var changeCount = 0L
+    private val clipChangedListener = ClipboardManager.OnPrimaryClipChangedListener {
+        changeCount++
+    }
+
+    // Last content read, reused by repeated pastes within the coalescing
+    // window while the clipboard is unchanged.
+    private var cachedContent: ClipboardContent? = null
+    private var cachedChangeCount = 0L
+    private var cachedAt = 0L
+    private var coalesceWindowMs = DEFAULT_COALESCE_WINDOW_MS
 
     companion object {
         private const val TAG = "FlutterPasteInput"
         private const val TEMP_FILE_PREFIX = "paste_"
+        private const val DEFAULT_COALESCE_WINDOW_MS = 250L
     }
 
     override fun onAttachedToEngine(flutterPluginBinding: FlutterPlugin.FlutterPluginBinding) {
         context = flutterPluginBinding.applicationContext
         clipboardManager = context.getSystemService(Context.CLIPBOARD_SERVICE) as? ClipboardManager
+        clipboardManager?.addPrimaryClipChangedListener(clipChangedListener)
 
         // Set up Pigeon APIs
         PasteInputHostApi.setUp(flutterPluginBinding.binaryMessenger, this)
@@ -41,12 +55,149 @@ class FlutterPasteInputPlugin : FlutterPlugin, PasteInputHostApi {
 
     override fun onDetachedFromEngine(binding: FlutterPlugin.FlutterPluginBinding) {
         PasteInputHostApi.setUp(binding.binaryMessenger, null)
+        clipboardManager?.removePrimaryClipChangedListener(clipChangedListener)
         flutterApi = null
     }
 
     // MARK: - PasteInputHostApi Implementation
 
-    override fun getClipboardContent(): ClipboardContent {
+    override fun getClipboardContent(requestId: Long, callback: (Result<ClipboardContent>) -> Unit) {
+        callback(Result.success(readClipboardContentCoalesced()))
+    }
+
+    override fun clearTempFiles() {
+        try {
+            val cacheDir = context.cacheDir
+            cacheDir.listFiles()?.filter {
+                it.name.startsWith(TEMP_FILE_PREFIX)
+            }?.forEach { file ->
+                file.delete()
+            }
+        } catch (e: Exception) {
+            Log.e(TAG, "Failed to clear temp files: ${e.message}")
+        }
+    }
+
+    override fun getPlatformVersion(): String {
+        return "Android ${Build.VERSION.RELEASE}"
+    }
+
+    override fun configure(config: PasteInputConfig) {
+        config.coalesceWindowMs?.let {
+            require(it >= 0) { "coalesceWindowMs must not be negative" }
+            coalesceWindowMs = it
+        }
+        // Reads are synchronous on Android, so nothing ever waits on one and
+        // maxPendingReads does not apply.
+    }
+
+    override fun prefetchClipboard() {
+        // Reading the clip ahead of a paste would show the clipboard access
+        // notification, so nothing is prefetched.
+    }
+
+    override fun cancelPaste(requestId: Long) {
+        // Reads complete synchronously, before a cancellation can arrive.
+    }
+
+    override fun trimMemory(level: Long, callback: (Result<Long>) -> Unit) {
+        if (level !in 0L..2L) {
+            callback(Result.failure(IllegalArgumentException("level must be 0, 1 or 2")))
+            return
+        }
+        // The coalescing cache is the only native cache; it is cheap to
+        // rebuild, so every level drops it.
+        val released = cachedContent?.items?.sumOf { it.data.size.toLong() } ?: 0L
+        cachedContent = null
+        callback(Result.success(released))
+    }
+
+    override fun setClipboardContent(content: ClipboardWrite, callback: (Result<Unit>) -> Unit) {
+        if (content.image != null) {
+            // Images can only be shared through a content URI, which needs a
+            // FileProvider declared by the app.
+            callback(Result.failure(FlutterError("unsupported-format", "Copying images is not supported on Android.")))
+            return
+        }
+        val text = content.text
+        if (text == null) {
+            callback(Result.failure(FlutterError("invalid-argument", "Nothing to copy.")))
+            return
+        }
+        val manager = clipboardManager
+        if (manager == null) {
+            callback(Result.failure(FlutterError("unavailable", "The clipboard service is not available.")))
+            return
+        }
+        manager.setPrimaryClip(ClipData.newPlainText(null, text))
+        callback(Result.success(Unit))
+    }
+
+    // Only Linux keeps a clipboard history.
+    override fun listClipboardHistory(callback: (Result<List<ClipboardHistoryEntry>>) -> Unit) {
+        callback(Result.success(emptyList()))
+    }
+
+    override fun getClipboardHistoryEntry(id: Long, callback: (Result<ClipboardContent>) -> Unit) {
+        callback(Result.failure(FlutterError("not-found", "No such clipboard history entry.")))
+    }
+
+    override fun searchClipboardHistory(query: String, maxResults: Long, callback: (Result<List<ClipboardHistoryMatch>>) -> Unit) {
+        callback(Result.success(emptyList()))
+    }
+
+    override fun getPasteStats(callback: (Result<List<PasteStageStats>>) -> Unit) {
+        // Only Linux instruments its paste pipeline.
+        callback(Result.success(emptyList()))
+    }
+
+    override fun resetPasteStats(callback: (Result<Unit>) -> Unit) {
+        callback(Result.success(Unit))
+    }
+
+    override fun getPasteLatencies(callback: (Result<List<PasteLatencyStats>>) -> Unit) {
+        callback(Result.success(emptyList()))
+    }
+
+    override fun dumpPasteTrace(path: String, callback: (Result<Long>) -> Unit) {
+        // Only Linux records a trace.
+        callback(Result.success(0L))
+    }
+
+    override fun probeClipboard(callback: (Result<ClipboardProbe>) -> Unit) {
+        // The description is available without reading the clip itself,
+        // so this does not trigger the clipboard access notification.
+        val mimeTypes = mutableListOf<String>()
+        val description = clipboardManager?.primaryClipDescription
+        if (description != null) {
+            for (i in 0 until description.mimeTypeCount) {
+                val mimeType = description.getMimeType(i)
+                if (mimeType !in mimeTypes) {
+                    mimeTypes.add(mimeType)
+                }
+            }
+        }
+        callback(Result.success(ClipboardProbe(changeCount = changeCount, mimeTypes = mimeTypes)))
+    }
+
+    // MARK: - Helper Methods
+
+    private fun readClipboardContentCoalesced(): ClipboardContent {
+        val now = SystemClock.elapsedRealtime()
+        val cached = cachedContent
+        if (cached != null && cachedChangeCount == changeCount &&
+            now - cachedAt <= coalesceWindowMs) {
+            return cached
+        }
+
+        val content = readClipboardContent()
+        cachedContent = content
+        cachedChangeCount = changeCount
+        cachedAt = SystemClock.elapsedRealtime()
+        return content
+    }
+
+    private fun readClipboardContent(): ClipboardContent {
         val items = mutableListOf<ClipboardItem>()
         val clipData = clipboardManager?.primaryClip
 
@@ -70,25 +221,6 @@ class FlutterPasteInputPlugin : FlutterPlugin, PasteInputHostApi {
         return ClipboardContent(items = items)
     }
 
-    override fun clearTempFiles() {
-        try {
-            val cacheDir = context.cacheDir
-            cacheDir.listFiles()?.filter {
-                it.name.startsWith(TEMP_FILE_PREFIX)
-            }?.forEach { file ->
-                file.delete()
-            }
-        } catch (e: Exception) {
-            Log.e(TAG, "Failed to clear temp files: ${e.message}")
-        }
-    }
-
-    override fun getPlatformVersion(): String {
-        return "Android ${Build.VERSION.RELEASE}"
-    }
-
-    // MARK: - Helper Methods
-
     private fun hasImages(clipData: ClipData): Boolean {
         val description = clipData.description
         if (description.hasMimeType(ClipDescription.MIMETYPE_TEXT_URILIST)) {
@@ -194,7 +326,7 @@ class FlutterPasteInputPlugin : FlutterPlugin, PasteInputHostApi {
      * Call this from swizzled paste handlers or clipboard listeners.
      */
     fun notifyPasteDetected() {
-        val content = getClipboardContent()
+        val content = readClipboardContentCoalesced()
         flutterApi?.onPasteDetected(content) { result ->
             result.onFailure { error ->
                 Log.e(TAG, "Failed to notify paste: ${error.message}")
@@ -75,20 +75,62 @@ data class ClipboardItem (
    * - "image/gif" for GIF images
    * - "image/webp" for WebP images
    */
-  val mimeType: String
+  val mimeType: String,
+  /**
+   * Width of the image in pixels.
+   *
+   * Only set for image items, and only when the platform knows the
+   * dimensions without decoding the bytes on the Dart side.
+   */
+  val width: Long? = null,
+  /**
+   * Height of the image in pixels.
+   *
+   * Only set for image items, see [width].
+   */
+  val height: Long? = null,
+  /**
+   * Whether the image has an alpha channel.
+   *
+   * Only set for image items.
+   */
+  val hasAlpha: Boolean? = null,
+  /**
+   * Number of frames in the image (greater than 1 for animations).
+   *
+   * Only set for image items.
+   */
+  val frameCount: Long? = null,
+  /**
+   * Size in bytes of the clipboard representation the item was read from.
+   *
+   * For images that are re-encoded natively (e.g. a bitmap converted to
+   * PNG), this is the size of the source data rather than [data].
+   */
+  val originalByteSize: Long? = null
 )
  {
   companion object {
     fun fromList(pigeonVar_list: List<Any?>): ClipboardItem {
       val data = pigeonVar_list[0] as ByteArray
       val mimeType = pigeonVar_list[1] as String
-      return ClipboardItem(data, mimeType)
+      val width = pigeonVar_list[2] as Long?
+      val height = pigeonVar_list[3] as Long?
+      val hasAlpha = pigeonVar_list[4] as Boolean?
+      val frameCount = pigeonVar_list[5] as Long?
+      val originalByteSize = pigeonVar_list[6] as Long?
+      return ClipboardItem(data, mimeType, width, height, hasAlpha, frameCount, originalByteSize)
     }
   }
   fun toList(): List<Any?> {
     return listOf(
       data,
       mimeType,
+      width,
+      height,
+      hasAlpha,
+      frameCount,
+      originalByteSize,
     )
   }
 }
@@ -107,18 +149,512 @@ data class ClipboardContent (
    *
    * May be empty if the clipboard is empty or contains unsupported content.
    */
-  val items: List<ClipboardItem>
+  val items: List<ClipboardItem>,
+  /**
+   * Most bytes the platform held at once while reading, converting and
+   * sending this content (Linux).
+   */
+  val peakMemoryBytes: Long? = null
 )
  {
   companion object {
     fun fromList(pigeonVar_list: List<Any?>): ClipboardContent {
       val items = pigeonVar_list[0] as List<ClipboardItem>
-      return ClipboardContent(items)
+      val peakMemoryBytes = pigeonVar_list[1] as Long?
+      return ClipboardContent(items, peakMemoryBytes)
     }
   }
   fun toList(): List<Any?> {
     return listOf(
       items,
+      peakMemoryBytes,
+    )
+  }
+}
+
+/**
+ * Cheap summary of the clipboard state, obtained without reading any data.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class ClipboardProbe (
+  /**
+   * Counter that increases every time the clipboard contents change.
+   *
+   * Only meaningful when compared with an earlier value from the same
+   * process; the absolute value is platform specific.
+   */
+  val changeCount: Long,
+  /**
+   * MIME types currently offered by the clipboard owner.
+   *
+   * Text formats are reported as "text/plain" regardless of the
+   * platform's native name for them.
+   */
+  val mimeTypes: List<String>
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): ClipboardProbe {
+      val changeCount = pigeonVar_list[0] as Long
+      val mimeTypes = pigeonVar_list[1] as List<String>
+      return ClipboardProbe(changeCount, mimeTypes)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      changeCount,
+      mimeTypes,
+    )
+  }
+}
+
+/**
+ * Tuning options for the native paste pipeline.
+ *
+ * Every field is optional; null leaves the current setting unchanged.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class PasteInputConfig (
+  /**
+   * How long, in milliseconds, a completed clipboard read is reused for
+   * further paste requests while the clipboard is unchanged.
+   *
+   * Requests arriving while a read is in flight always share it. This
+   * covers key repeat from a held-down Ctrl+V.
+   */
+  val coalesceWindowMs: Long? = null,
+  /**
+   * Maximum number of paste requests that may wait on an in-flight read.
+   *
+   * Further requests fail with the error code "busy".
+   */
+  val maxPendingReads: Long? = null,
+  /**
+   * Maximum number of [PasteInputFlutterApi.onPasteDetected] events sent
+   * before Dart has handled them (Linux).
+   *
+   * Events beyond the limit are held back and only the newest is kept, so
+   * a burst of pastes never queues several stale payloads.
+   */
+  val maxOutstandingEvents: Long? = null,
+  /**
+   * Upper bound, in bytes, on the native memory held by pastes in flight
+   * and by their results, shared by all engines in the process (Linux).
+   *
+   * An image paste that does not fit waits for earlier pastes to release
+   * their buffers. One that could never fit is downscaled (see
+   * [downscaleOverBudgetImages]) or fails with the error code
+   * "over-budget". 0 disables the limit; the default is 512 MiB.
+   */
+  val memoryBudgetBytes: Long? = null,
+  /**
+   * Whether images too large for [memoryBudgetBytes] are downscaled rather
+   * than refused. Defaults to true.
+   */
+  val downscaleOverBudgetImages: Boolean? = null,
+  /**
+   * Largest clipboard selection, in bytes, that is transferred before the
+   * paste fails with the error code "too-large" (Linux, X11). 0 disables
+   * the limit; the default is 256 MiB.
+   */
+  val maxTransferBytes: Long? = null,
+  /**
+   * Most bytes of content set with [PasteInputHostApi.setClipboardContent]
+   * handed to the clipboard manager when the app exits, so that it stays
+   * pasteable (Linux).
+   *
+   * Text is offered first, then the image as given, then rendered formats
+   * in order; each format that would exceed the limit is left out, so a
+   * compact rendered format is kept even when the original image is too
+   * large. 0 disables the limit; the default is 64 MiB.
+   */
+  val clipboardStoreMaxBytes: Long? = null,
+  /**
+   * Time, in milliseconds, the app may spend at exit rendering formats not
+   * requested yet for the clipboard manager (Linux). Formats not rendered
+   * in time are left out; an encode still running at the deadline stops at
+   * its next output chunk. Decoding the source image, done once, is not
+   * interrupted. 0 disables the limit; the default is 1000.
+   */
+  val clipboardStoreTimeBudgetMs: Long? = null,
+  /**
+   * Most clipboard snapshots kept in the history (Linux).
+   *
+   * Every successful read is recorded; content already in the history
+   * moves to the front instead of being added again. 0 disables the
+   * history and drops what it holds; the default is 50.
+   */
+  val historyMaxEntries: Long? = null,
+  /**
+   * Upper bound, in bytes, on the memory held by the history (Linux).
+   *
+   * Text is kept compressed and counts with its compressed size. The
+   * oldest entries are dropped first. 0 disables the limit; the default
+   * is 32 MiB.
+   *
+   * With [persistHistory] set, entries over the limit are only dropped
+   * from memory and read back from disk when fetched.
+   */
+  val historyMaxBytes: Long? = null,
+  /**
+   * Whether the history is kept on disk, under the user cache directory,
+   * so that it survives restarts (Linux).
+   *
+   * Off by default, as clipboard content may be sensitive. Turning it off
+   * deletes the files.
+   */
+  val persistHistory: Boolean? = null,
+  /**
+   * Upper bound, in bytes, on the disk space used by a persisted history
+   * (Linux). The oldest entries are dropped first. 0 disables the limit;
+   * the default is 128 MiB.
+   */
+  val historyMaxDiskBytes: Long? = null,
+  /**
+   * File the paste pipeline trace is written to when the app exits
+   * (Linux).
+   *
+   * Setting it starts recording the begin and end of every pipeline stage
+   * and worker thread job; an empty string stops recording. The file is
+   * Chrome trace JSON, for Perfetto or chrome://tracing. See also
+   * [PasteInputHostApi.dumpPasteTrace].
+   */
+  val traceFile: String? = null
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): PasteInputConfig {
+      val coalesceWindowMs = pigeonVar_list[0] as Long?
+      val maxPendingReads = pigeonVar_list[1] as Long?
+      val maxOutstandingEvents = pigeonVar_list[2] as Long?
+      val memoryBudgetBytes = pigeonVar_list[3] as Long?
+      val downscaleOverBudgetImages = pigeonVar_list[4] as Boolean?
+      val maxTransferBytes = pigeonVar_list[5] as Long?
+      val clipboardStoreMaxBytes = pigeonVar_list[6] as Long?
+      val clipboardStoreTimeBudgetMs = pigeonVar_list[7] as Long?
+      val historyMaxEntries = pigeonVar_list[8] as Long?
+      val historyMaxBytes = pigeonVar_list[9] as Long?
+      val persistHistory = pigeonVar_list[10] as Boolean?
+      val historyMaxDiskBytes = pigeonVar_list[11] as Long?
+      val traceFile = pigeonVar_list[12] as String?
+      return PasteInputConfig(coalesceWindowMs, maxPendingReads, maxOutstandingEvents, memoryBudgetBytes, downscaleOverBudgetImages, maxTransferBytes, clipboardStoreMaxBytes, clipboardStoreTimeBudgetMs, historyMaxEntries, historyMaxBytes, persistHistory, historyMaxDiskBytes, traceFile)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      coalesceWindowMs,
+      maxPendingReads,
+      maxOutstandingEvents,
+      memoryBudgetBytes,
+      downscaleOverBudgetImages,
+      maxTransferBytes,
+      clipboardStoreMaxBytes,
+      clipboardStoreTimeBudgetMs,
+      historyMaxEntries,
+      historyMaxBytes,
+      persistHistory,
+      historyMaxDiskBytes,
+      traceFile,
+    )
+  }
+}
+
+/**
+ * Progress of a large clipboard transfer for a pending
+ * [PasteInputHostApi.getClipboardContent] request (Linux, X11).
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class PasteProgress (
+  /**
+   * The id the request was made with.
+   */
+  val requestId: Long,
+  /**
+   * Bytes received from the clipboard owner so far.
+   */
+  val receivedBytes: Long,
+  /**
+   * Size announced by the owner, if any. For incremental transfers this
+   * is only a lower bound.
+   */
+  val expectedBytes: Long? = null
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): PasteProgress {
+      val requestId = pigeonVar_list[0] as Long
+      val receivedBytes = pigeonVar_list[1] as Long
+      val expectedBytes = pigeonVar_list[2] as Long?
+      return PasteProgress(requestId, receivedBytes, expectedBytes)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      requestId,
+      receivedBytes,
+      expectedBytes,
+    )
+  }
+}
+
+/**
+ * Content placed on the clipboard by
+ * [PasteInputHostApi.setClipboardContent].
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class ClipboardWrite (
+  /**
+   * Plain text to offer.
+   */
+  val text: String? = null,
+  /**
+   * Encoded image to offer, in the format given by [imageMimeType].
+   */
+  val image: ByteArray? = null,
+  /**
+   * MIME type of [image], e.g. "image/png". Required with [image].
+   */
+  val imageMimeType: String? = null,
+  /**
+   * Further image formats to offer, e.g. "image/jpeg" or "image/bmp".
+   *
+   * On Linux each is rendered from [image] only when another application
+   * asks for it, and kept once rendered. Other platforms offer [image] in
+   * its own format only.
+   */
+  val renderedImageTypes: List<String>? = null
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): ClipboardWrite {
+      val text = pigeonVar_list[0] as String?
+      val image = pigeonVar_list[1] as ByteArray?
+      val imageMimeType = pigeonVar_list[2] as String?
+      val renderedImageTypes = pigeonVar_list[3] as List<String>?
+      return ClipboardWrite(text, image, imageMimeType, renderedImageTypes)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      text,
+      image,
+      imageMimeType,
+      renderedImageTypes,
+    )
+  }
+}
+
+/**
+ * Metadata of one clipboard history entry, see
+ * [PasteInputHostApi.listClipboardHistory].
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class ClipboardHistoryEntry (
+  /**
+   * Identifies the entry for [PasteInputHostApi.getClipboardHistoryEntry].
+   * Ids are never reused within a process.
+   */
+  val id: Long,
+  /**
+   * When the content was last read from the clipboard, in milliseconds
+   * since the Unix epoch.
+   */
+  val capturedAtMs: Long,
+  /**
+   * MIME types of the entry's items, images first.
+   */
+  val mimeTypes: List<String>,
+  /**
+   * Size of the content as it was pasted, before compression.
+   */
+  val byteSize: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): ClipboardHistoryEntry {
+      val id = pigeonVar_list[0] as Long
+      val capturedAtMs = pigeonVar_list[1] as Long
+      val mimeTypes = pigeonVar_list[2] as List<String>
+      val byteSize = pigeonVar_list[3] as Long
+      return ClipboardHistoryEntry(id, capturedAtMs, mimeTypes, byteSize)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      id,
+      capturedAtMs,
+      mimeTypes,
+      byteSize,
+    )
+  }
+}
+
+/**
+ * A clipboard history entry matching a search, see
+ * [PasteInputHostApi.searchClipboardHistory].
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class ClipboardHistoryMatch (
+  /**
+   * The entry, as in [ClipboardHistoryEntry.id].
+   */
+  val id: Long,
+  /**
+   * Occurrences of the query's terms in the entry's text.
+   */
+  val matchCount: Long,
+  /**
+   * Where matches start in the entry's text, in UTF-16 code units as Dart
+   * strings index them, in ascending order. At most 64 are reported.
+   */
+  val matchStarts: List<Long>,
+  /**
+   * Where the matches in [matchStarts] end, exclusive.
+   */
+  val matchEnds: List<Long>
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): ClipboardHistoryMatch {
+      val id = pigeonVar_list[0] as Long
+      val matchCount = pigeonVar_list[1] as Long
+      val matchStarts = pigeonVar_list[2] as List<Long>
+      val matchEnds = pigeonVar_list[3] as List<Long>
+      return ClipboardHistoryMatch(id, matchCount, matchStarts, matchEnds)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      id,
+      matchCount,
+      matchStarts,
+      matchEnds,
+    )
+  }
+}
+
+/**
+ * Timings of one stage of the native paste pipeline, see
+ * [PasteInputHostApi.getPasteStats].
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class PasteStageStats (
+  /**
+   * The stage: "selection" (waiting on the clipboard owner), "decode",
+   * "encode" (PNG), "serialize" (building the reply), "dart" (from
+   * sending a paste event until Dart has handled it) or "total" (from the
+   * paste request reaching the plugin until the reply is sent or the paste
+   * event handled).
+   */
+  val stage: String,
+  /**
+   * Runs of the stage since the last reset.
+   */
+  val count: Long,
+  /**
+   * Time spent in the stage, in microseconds.
+   */
+  val totalMicros: Long,
+  /**
+   * Longest single run, in microseconds.
+   */
+  val maxMicros: Long,
+  /**
+   * Bytes the stage consumed and produced.
+   */
+  val bytesIn: Long,
+  /**
+   */
+  val bytesOut: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): PasteStageStats {
+      val stage = pigeonVar_list[0] as String
+      val count = pigeonVar_list[1] as Long
+      val totalMicros = pigeonVar_list[2] as Long
+      val maxMicros = pigeonVar_list[3] as Long
+      val bytesIn = pigeonVar_list[4] as Long
+      val bytesOut = pigeonVar_list[5] as Long
+      return PasteStageStats(stage, count, totalMicros, maxMicros, bytesIn, bytesOut)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      stage,
+      count,
+      totalMicros,
+      maxMicros,
+      bytesIn,
+      bytesOut,
+    )
+  }
+}
+
+/**
+ * Latency percentiles of one stage of the native paste pipeline for one
+ * kind of content, see [PasteInputHostApi.getPasteLatencies].
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class PasteLatencyStats (
+  /**
+   * The stage, as in [PasteStageStats.stage].
+   */
+  val stage: String,
+  /**
+   * What was pasted: "text", "small-image" or "large-image" (at least
+   * 1024 x 1024 pixels).
+   */
+  val contentClass: String,
+  /**
+   * Runs of the stage since the last reset.
+   */
+  val count: Long,
+  /**
+   * Percentiles, in microseconds, within about 6% of the exact value.
+   */
+  val p50Micros: Long,
+  /**
+   */
+  val p90Micros: Long,
+  /**
+   */
+  val p99Micros: Long,
+  /**
+   * Longest single run, in microseconds.
+   */
+  val maxMicros: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): PasteLatencyStats {
+      val stage = pigeonVar_list[0] as String
+      val contentClass = pigeonVar_list[1] as String
+      val count = pigeonVar_list[2] as Long
+      val p50Micros = pigeonVar_list[3] as Long
+      val p90Micros = pigeonVar_list[4] as Long
+      val p99Micros = pigeonVar_list[5] as Long
+      val maxMicros = pigeonVar_list[6] as Long
+      return PasteLatencyStats(stage, contentClass, count, p50Micros, p90Micros, p99Micros, maxMicros)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      stage,
+      contentClass,
+      count,
+      p50Micros,
+      p90Micros,
+      p99Micros,
+      maxMicros,
     )
   }
 }
@@ -135,6 +671,46 @@ private open class MessagesPigeonCodec : StandardMessageCodec() {
           ClipboardContent.fromList(it)
         }
       }
+      131.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          ClipboardProbe.fromList(it)
+        }
+      }
+      132.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          PasteInputConfig.fromList(it)
+        }
+      }
+      133.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          PasteProgress.fromList(it)
+        }
+      }
+      134.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          ClipboardWrite.fromList(it)
+        }
+      }
+      135.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          ClipboardHistoryEntry.fromList(it)
+        }
+      }
+      136.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          ClipboardHistoryMatch.fromList(it)
+        }
+      }
+      137.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          PasteStageStats.fromList(it)
+        }
+      }
+      138.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          PasteLatencyStats.fromList(it)
+        }
+      }
       else -> super.readValueOfType(type, buffer)
     }
   }
@@ -148,6 +724,38 @@ private open class MessagesPigeonCodec : StandardMessageCodec() {
         stream.write(130)
         writeValue(stream, value.toList())
       }
+      is ClipboardProbe -> {
+        stream.write(131)
+        writeValue(stream, value.toList())
+      }
+      is PasteInputConfig -> {
+        stream.write(132)
+        writeValue(stream, value.toList())
+      }
+      is PasteProgress -> {
+        stream.write(133)
+        writeValue(stream, value.toList())
+      }
+      is ClipboardWrite -> {
+        stream.write(134)
+        writeValue(stream, value.toList())
+      }
+      is ClipboardHistoryEntry -> {
+        stream.write(135)
+        writeValue(stream, value.toList())
+      }
+      is ClipboardHistoryMatch -> {
+        stream.write(136)
+        writeValue(stream, value.toList())
+      }
+      is PasteStageStats -> {
+        stream.write(137)
+        writeValue(stream, value.toList())
+      }
+      is PasteLatencyStats -> {
+        stream.write(138)
+        writeValue(stream, value.toList())
+      }
       else -> super.writeValue(stream, value)
     }
   }
@@ -170,8 +778,14 @@ interface PasteInputHostApi {
    *
    * Returns an empty [ClipboardContent] if the clipboard is empty or
    * contains only unsupported content types.
+   *
+   * Requests made while a read is in progress, or shortly after one
+   * completed (see [PasteInputConfig.coalesceWindowMs]), share its result.
+   *
+   * [requestId] identifies the request for [cancelPaste]; 0 means the
+   * request cannot be cancelled.
    */
-  fun getClipboardContent(): ClipboardContent
+  fun getClipboardContent(requestId: Long, callback: (Result<ClipboardContent>) -> Unit)
   /**
    * Clears temporary files created during paste operations.
    *
@@ -186,6 +800,107 @@ interface PasteInputHostApi {
    * Example: "Android 14", "iOS 17.0", "macOS 14.0"
    */
   fun getPlatformVersion(): String
+  /**
+   * Returns the clipboard change counter and the available MIME types.
+   *
+   * This is served from state the platform already tracks and transfers
+   * no clipboard payload, so it is cheap enough to call while building UI
+   * (e.g. to decide whether a paste button should be enabled).
+   */
+  fun probeClipboard(callback: (Result<ClipboardProbe>) -> Unit)
+  /**
+   * Applies tuning options to the native paste pipeline.
+   *
+   * On Linux and Windows the clipboard cache is shared by all Flutter
+   * engines in the process, so the options apply to every engine.
+   */
+  fun configure(config: PasteInputConfig)
+  /**
+   * Hints that a paste is likely soon, e.g. because a text field gained
+   * focus.
+   *
+   * Where supported (Linux), the clipboard is read and encoded in the
+   * background at idle priority so that the next [getClipboardContent]
+   * is served from the warm snapshot. Elsewhere this is a no-op.
+   */
+  fun prefetchClipboard()
+  /**
+   * Cancels the [getClipboardContent] request with the given id.
+   *
+   * The request fails with the error code "cancelled". Native work that no
+   * other request is waiting on is abandoned and its buffers released.
+   * Unknown or already completed ids are ignored.
+   */
+  fun cancelPaste(requestId: Long)
+  /**
+   * Releases natively cached clipboard data, as the platform does by
+   * itself on low-memory warnings where it reports them (Linux).
+   *
+   * [level] is 0 (low), 1 (medium) or 2 (critical); higher levels drop
+   * more, including data that is still fresh. Returns the number of bytes
+   * released from the plugin's caches.
+   */
+  fun trimMemory(level: Long, callback: (Result<Long>) -> Unit)
+  /**
+   * Replaces the clipboard content with [content].
+   *
+   * Fails with the error code "invalid-argument" if [content] is empty or
+   * an image lacks its MIME type, and with "unsupported-format" if a
+   * requested rendition cannot be produced on this platform.
+   */
+  fun setClipboardContent(content: ClipboardWrite, callback: (Result<Unit>) -> Unit)
+  /**
+   * Lists the clipboard history, most recent first, without its content.
+   *
+   * Only Linux keeps a history; elsewhere the list is empty.
+   */
+  fun listClipboardHistory(callback: (Result<List<ClipboardHistoryEntry>>) -> Unit)
+  /**
+   * Returns the content of the history entry with the given [id].
+   *
+   * Fails with the error code "not-found" if the entry has been dropped
+   * from the history, or never existed.
+   */
+  fun getClipboardHistoryEntry(id: Long, callback: (Result<ClipboardContent>) -> Unit)
+  /**
+   * Searches the text of the clipboard history for [query].
+   *
+   * Entries match if their text contains every whitespace-separated term
+   * of [query], ignoring ASCII case. At most [maxResults] are returned,
+   * those with the most occurrences first, then the most recent. Only
+   * Linux keeps a history; elsewhere the list is empty.
+   */
+  fun searchClipboardHistory(query: String, maxResults: Long, callback: (Result<List<ClipboardHistoryMatch>>) -> Unit)
+  /**
+   * Returns the time spent in each stage of the paste pipeline since the
+   * last [resetPasteStats].
+   *
+   * Only Linux instruments its pipeline; elsewhere the list is empty.
+   */
+  fun getPasteStats(callback: (Result<List<PasteStageStats>>) -> Unit)
+  /**
+   * Zeroes the counters reported by [getPasteStats] and
+   * [getPasteLatencies].
+   */
+  fun resetPasteStats(callback: (Result<Unit>) -> Unit)
+  /**
+   * Returns latency percentiles of each stage of the paste pipeline, and
+   * end to end, per kind of content, since the last [resetPasteStats].
+   * Combinations without runs are left out.
+   *
+   * Only Linux instruments its pipeline; elsewhere the list is empty.
+   */
+  fun getPasteLatencies(callback: (Result<List<PasteLatencyStats>>) -> Unit)
+  /**
+   * Writes the paste pipeline activity recorded since tracing was started
+   * with [PasteInputConfig.traceFile] to [path] as Chrome trace JSON.
+   * Recording goes on.
+   *
+   * Returns the number of events written, or fails with the error code
+   * "write-failed" if the file cannot be written. Only Linux records a
+   * trace; elsewhere no file is written and 0 is returned.
+   */
+  fun dumpPasteTrace(path: String, callback: (Result<Long>) -> Unit)
 
   companion object {
     /** The codec used by PasteInputHostApi. */
@@ -198,10 +913,31 @@ interface PasteInputHostApi {
       val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
       run {
         val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardContent$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val requestIdArg = args[0] as Long
+            api.getClipboardContent(requestIdArg) { result: Result<ClipboardContent> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.clearTempFiles$separatedMessageChannelSuffix", codec)
         if (api != null) {
           channel.setMessageHandler { _, reply ->
             val wrapped: List<Any?> = try {
-              listOf(api.getClipboardContent())
+              api.clearTempFiles()
+              listOf(null)
             } catch (exception: Throwable) {
               wrapError(exception)
             }
@@ -212,11 +948,46 @@ interface PasteInputHostApi {
         }
       }
       run {
-        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.clearTempFiles$separatedMessageChannelSuffix", codec)
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPlatformVersion$separatedMessageChannelSuffix", codec)
         if (api != null) {
           channel.setMessageHandler { _, reply ->
             val wrapped: List<Any?> = try {
-              api.clearTempFiles()
+              listOf(api.getPlatformVersion())
+            } catch (exception: Throwable) {
+              wrapError(exception)
+            }
+            reply.reply(wrapped)
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.probeClipboard$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.probeClipboard{ result: Result<ClipboardProbe> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.configure$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val configArg = args[0] as PasteInputConfig
+            val wrapped: List<Any?> = try {
+              api.configure(configArg)
               listOf(null)
             } catch (exception: Throwable) {
               wrapError(exception)
@@ -228,11 +999,12 @@ interface PasteInputHostApi {
         }
       }
       run {
-        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPlatformVersion$separatedMessageChannelSuffix", codec)
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.prefetchClipboard$separatedMessageChannelSuffix", codec)
         if (api != null) {
           channel.setMessageHandler { _, reply ->
             val wrapped: List<Any?> = try {
-              listOf(api.getPlatformVersion())
+              api.prefetchClipboard()
+              listOf(null)
             } catch (exception: Throwable) {
               wrapError(exception)
             }
@@ -242,6 +1014,195 @@ interface PasteInputHostApi {
           channel.setMessageHandler(null)
         }
       }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.cancelPaste$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val requestIdArg = args[0] as Long
+            val wrapped: List<Any?> = try {
+              api.cancelPaste(requestIdArg)
+              listOf(null)
+            } catch (exception: Throwable) {
+              wrapError(exception)
+            }
+            reply.reply(wrapped)
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.trimMemory$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val levelArg = args[0] as Long
+            api.trimMemory(levelArg) { result: Result<Long> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.setClipboardContent$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val contentArg = args[0] as ClipboardWrite
+            api.setClipboardContent(contentArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                reply.reply(wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.listClipboardHistory$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.listClipboardHistory{ result: Result<List<ClipboardHistoryEntry>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardHistoryEntry$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val idArg = args[0] as Long
+            api.getClipboardHistoryEntry(idArg) { result: Result<ClipboardContent> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.searchClipboardHistory$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val queryArg = args[0] as String
+            val maxResultsArg = args[1] as Long
+            api.searchClipboardHistory(queryArg, maxResultsArg) { result: Result<List<ClipboardHistoryMatch>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteStats$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.getPasteStats{ result: Result<List<PasteStageStats>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.resetPasteStats$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.resetPasteStats{ result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                reply.reply(wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteLatencies$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.getPasteLatencies{ result: Result<List<PasteLatencyStats>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.dumpPasteTrace$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val pathArg = args[0] as String
+            api.dumpPasteTrace(pathArg) { result: Result<Long> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
     }
   }
 }
@@ -285,4 +1246,25 @@ class PasteInputFlutterApi(private val binaryMessenger: BinaryMessenger, private
       } 
     }
   }
+  /**
+   * Called periodically while a large selection is transferred for a
+   * [PasteInputHostApi.getClipboardContent] request.
+   */
+  fun onPasteProgress(progressArg: PasteProgress, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.flutter_paste_input.PasteInputFlutterApi.onPasteProgress$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(progressArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(createConnectionError(channelName)))
+      } 
+    }
+  }
 }
@@ -10,6 +10,13 @@ public class FlutterPasteInputPlugin: NSObject, FlutterPlugin, PasteInputHostApi
     private static weak var sharedInstance: FlutterPasteInputPlugin?
     private var flutterApi: PasteInputFlutterApi?
 
+    /// Last content read, reused by repeated pastes within the coalescing
+    /// window while the pasteboard change count is unchanged.
+    private var cachedContent: ClipboardContent?
+    private var cachedChangeCount = 0
+    private var cachedAt: TimeInterval = 0
+    private var coalesceWindowMs: Int64 = 250
+
     public static func register(with registrar: FlutterPluginRegistrar) {
         let instance = FlutterPasteInputPlugin()
         sharedInstance = instance
@@ -27,7 +34,115 @@ public class FlutterPasteInputPlugin: NSObject, FlutterPlugin, PasteInputHostApi
 
     // MARK: - PasteInputHostApi Implementation
 
-    func getClipboardContent() throws -> ClipboardContent {
+    func getClipboardContent(requestId: Int64, completion: @escaping (Result<ClipboardContent, Error>) -> Void) {
+        completion(.success(readClipboardContentCoalesced()))
+    }
+
+    func configure(config: PasteInputConfig) throws {
+        if let coalesceWindowMs = config.coalesceWindowMs {
+            guard coalesceWindowMs >= 0 else {
+                throw PigeonError(code: "invalid-argument", message: "coalesceWindowMs must not be negative.", details: nil)
+            }
+            self.coalesceWindowMs = coalesceWindowMs
+        }
+        // Reads are synchronous here, so nothing ever waits on one and
+        // maxPendingReads does not apply.
+    }
+
+    func prefetchClipboard() throws {
+        // Reading the pasteboard ahead of a paste would show the system
+        // paste prompt, so nothing is prefetched.
+    }
+
+    func cancelPaste(requestId: Int64) throws {
+        // Reads complete synchronously, before a cancellation can arrive.
+    }
+
+    func trimMemory(level: Int64, completion: @escaping (Result<Int64, Error>) -> Void) {
+        guard (0...2).contains(level) else {
+            completion(.failure(PigeonError(code: "invalid-argument", message: "level must be 0, 1 or 2.", details: nil)))
+            return
+        }
+        // The coalescing cache is the only native cache; it is cheap to
+        // rebuild, so every level drops it.
+        let released = cachedContent?.items.reduce(0) { $0 + Int64($1.data.data.count) } ?? 0
+        cachedContent = nil
+        completion(.success(released))
+    }
+
+    func setClipboardContent(content: ClipboardWrite, completion: @escaping (Result<Void, Error>) -> Void) {
+        var item: [String: Any] = [:]
+        if let text = content.text {
+            item[kUTTypeUTF8PlainText as String] = text
+        }
+        if let image = content.image {
+            guard let mimeType = content.imageMimeType else {
+                completion(.failure(PigeonError(code: "invalid-argument", message: "imageMimeType is required with image.", details: nil)))
+                return
+            }
+            guard let type = pasteboardType(forMimeType: mimeType) else {
+                completion(.failure(PigeonError(code: "unsupported-format", message: "Cannot copy \(mimeType) images.", details: nil)))
+                return
+            }
+            // Only the image's own format is offered; renditions are not
+            // produced here.
+            item[type] = image.data
+        }
+        guard !item.isEmpty else {
+            completion(.failure(PigeonError(code: "invalid-argument", message: "Nothing to copy.", details: nil)))
+            return
+        }
+        UIPasteboard.general.setItems([item])
+        completion(.success(()))
+    }
+
+    // Only Linux keeps a clipboard history.
+    func listClipboardHistory(completion: @escaping (Result<[ClipboardHistoryEntry], Error>) -> Void) {
+        completion(.success([]))
+    }
+
+    func getClipboardHistoryEntry(id: Int64, completion: @escaping (Result<ClipboardContent, Error>) -> Void) {
+        completion(.failure(PigeonError(code: "not-found", message: "No such clipboard history entry.", details: nil)))
+    }
+
+    func searchClipboardHistory(query: String, maxResults: Int64, completion: @escaping (Result<[ClipboardHistoryMatch], Error>) -> Void) {
+        completion(.success([]))
+    }
+
+    func getPasteStats(completion: @escaping (Result<[PasteStageStats], Error>) -> Void) {
+        // Only Linux instruments its paste pipeline.
+        completion(.success([]))
+    }
+
+    func resetPasteStats(completion: @escaping (Result<Void, Error>) -> Void) {
+        completion(.success(()))
+    }
+
+    func getPasteLatencies(completion: @escaping (Result<[PasteLatencyStats], Error>) -> Void) {
+        completion(.success([]))
+    }
+
+    func dumpPasteTrace(path: String, completion: @escaping (Result<Int64, Error>) -> Void) {
+        // Only Linux records a trace.
+        completion(.success(0))
+    }
+
+    private func readClipboardContentCoalesced() -> ClipboardContent {
+        let changeCount = UIPasteboard.general.changeCount
+        let now = ProcessInfo.processInfo.systemUptime
+        if let cached = cachedContent, cachedChangeCount == changeCount,
+           (now - cachedAt) * 1000 <= Double(coalesceWindowMs) {
+            return cached
+        }
+
+        let content = readClipboardContent()
+        cachedContent = content
+        cachedChangeCount = changeCount
+        cachedAt = ProcessInfo.processInfo.systemUptime
+        return content
+    }
+
+    private func readClipboardContent() -> ClipboardContent {
         let pasteboard = UIPasteboard.general
         var items: [ClipboardItem] = []
 
@@ -66,6 +181,31 @@ public class FlutterPasteInputPlugin: NSObject, FlutterPlugin, PasteInputHostApi
         return "iOS " + UIDevice.current.systemVersion
     }
 
+    func probeClipboard(completion: @escaping (Result<ClipboardProbe, Error>) -> Void) {
+        // Only the change count and type list are read, which does not
+        // trigger the system paste prompt.
+        let pasteboard = UIPasteboard.general
+        var mimeTypes: [String] = []
+        for type in pasteboard.types {
+            if let mimeType = mimeType(forPasteboardType: type), !mimeTypes.contains(mimeType) {
+                mimeTypes.append(mimeType)
+            }
+        }
+        completion(.success(ClipboardProbe(changeCount: Int64(pasteboard.changeCount), mimeTypes: mimeTypes)))
+    }
+
+    private func mimeType(forPasteboardType type: String) -> String? {
+        let uti = type as CFString
+        if UTTypeConformsTo(uti, kUTTypePlainText) {
+            return "text/plain"
+        }
+        return UTTypeCopyPreferredTagWithClass(uti, kUTTagClassMIMEType)?.takeRetainedValue() as String?
+    }
+
+    private func pasteboardType(forMimeType mimeType: String) -> String? {
+        return UTTypeCreatePreferredIdentifierForTag(kUTTagClassMIMEType, mimeType as CFString, nil)?.takeRetainedValue() as String?
+    }
+
     // MARK: - Image Extraction
 
     private func extractImageItems(from pasteboard: UIPasteboard) -> [ClipboardItem] {
@@ -147,15 +287,11 @@ public class FlutterPasteInputPlugin: NSObject, FlutterPlugin, PasteInputHostApi
     }
 
     private func notifyPasteDetected() {
-        do {
-            let content = try getClipboardContent()
-            flutterApi?.onPasteDetected(content: content) { result in
-                if case .failure(let error) = result {
-                    print("FlutterPasteInput: Failed to notify paste: \(error)")
-                }
+        let content = readClipboardContentCoalesced()
+        flutterApi?.onPasteDetected(content: content) { result in
+            if case .failure(let error) = result {
+                print("FlutterPasteInput: Failed to notify paste: \(error)")
             }
-        } catch {
-            print("FlutterPasteInput: Error getting clipboard content: \(error)")
         }
     }
 
@@ -33,6 +33,11 @@ class ClipboardItem {
   ClipboardItem({
     required this.data,
     required this.mimeType,
+    this.width,
+    this.height,
+    this.hasAlpha,
+    this.frameCount,
+    this.originalByteSize,
   });
 
   /// Raw binary data of the clipboard item.
@@ -51,10 +56,42 @@ class ClipboardItem {
   /// - "image/webp" for WebP images
   String mimeType;
 
+  /// Width of the image in pixels.
+  ///
+  /// Only set for image items, and only when the platform knows the
+  /// dimensions without decoding the bytes on the Dart side.
+  int? width;
+
+  /// Height of the image in pixels.
+  ///
+  /// Only set for image items, see [width].
+  int? height;
+
+  /// Whether the image has an alpha channel.
+  ///
+  /// Only set for image items.
+  bool? hasAlpha;
+
+  /// Number of frames in the image (greater than 1 for animations).
+  ///
+  /// Only set for image items.
+  int? frameCount;
+
+  /// Size in bytes of the clipboard representation the item was read from.
+  ///
+  /// For images that are re-encoded natively (e.g. a bitmap converted to
+  /// PNG), this is the size of the source data rather than [data].
+  int? originalByteSize;
+
   Object encode() {
     return <Object?>[
       data,
       mimeType,
+      width,
+      height,
+      hasAlpha,
+      frameCount,
+      originalByteSize,
     ];
   }
 
@@ -63,6 +100,11 @@ class ClipboardItem {
     return ClipboardItem(
       data: result[0]! as Uint8List,
       mimeType: result[1]! as String,
+      width: result[2] as int?,
+      height: result[3] as int?,
+      hasAlpha: result[4] as bool?,
+      frameCount: result[5] as int?,
+      originalByteSize: result[6] as int?,
     );
   }
 }
@@ -74,6 +116,7 @@ class ClipboardItem {
 class ClipboardContent {
   ClipboardContent({
     required this.items,
+    this.peakMemoryBytes,
   });
 
   /// List of clipboard items.
@@ -81,9 +124,14 @@ class ClipboardContent {
   /// May be empty if the clipboard is empty or contains unsupported content.
   List<ClipboardItem> items;
 
+  /// Most bytes the platform held at once while reading, converting and
+  /// sending this content (Linux).
+  int? peakMemoryBytes;
+
   Object encode() {
     return <Object?>[
       items,
+      peakMemoryBytes,
     ];
   }
 
@@ -91,6 +139,478 @@ class ClipboardContent {
     result as List<Object?>;
     return ClipboardContent(
       items: (result[0] as List<Object?>?)!.cast<ClipboardItem>(),
+      peakMemoryBytes: result[1] as int?,
+    );
+  }
+}
+
+/// Cheap summary of the clipboard state, obtained without reading any data.
+class ClipboardProbe {
+  ClipboardProbe({
+    required this.changeCount,
+    required this.mimeTypes,
+  });
+
+  /// Counter that increases every time the clipboard contents change.
+  ///
+  /// Only meaningful when compared with an earlier value from the same
+  /// process; the absolute value is platform specific.
+  int changeCount;
+
+  /// MIME types currently offered by the clipboard owner.
+  ///
+  /// Text formats are reported as "text/plain" regardless of the
+  /// platform's native name for them.
+  List<String> mimeTypes;
+
+  Object encode() {
+    return <Object?>[
+      changeCount,
+      mimeTypes,
+    ];
+  }
+
+  static ClipboardProbe decode(Object result) {
+    result as List<Object?>;
+    return ClipboardProbe(
+      changeCount: result[0]! as int,
+      mimeTypes: (result[1] as List<Object?>?)!.cast<String>(),
+    );
+  }
+}
+
+/// Tuning options for the native paste pipeline.
+///
+/// Every field is optional; null leaves the current setting unchanged.
+class PasteInputConfig {
+  PasteInputConfig({
+    this.coalesceWindowMs,
+    this.maxPendingReads,
+    this.maxOutstandingEvents,
+    this.memoryBudgetBytes,
+    this.downscaleOverBudgetImages,
+    this.maxTransferBytes,
+    this.clipboardStoreMaxBytes,
+    this.clipboardStoreTimeBudgetMs,
+    this.historyMaxEntries,
+    this.historyMaxBytes,
+    this.persistHistory,
+    this.historyMaxDiskBytes,
+    this.traceFile,
+  });
+
+  /// How long, in milliseconds, a completed clipboard read is reused for
+  /// further paste requests while the clipboard is unchanged.
+  ///
+  /// Requests arriving while a read is in flight always share it. This
+  /// covers key repeat from a held-down Ctrl+V.
+  int? coalesceWindowMs;
+
+  /// Maximum number of paste requests that may wait on an in-flight read.
+  ///
+  /// Further requests fail with the error code "busy".
+  int? maxPendingReads;
+
+  /// Maximum number of [PasteInputFlutterApi.onPasteDetected] events sent
+  /// before Dart has handled them (Linux).
+  ///
+  /// Events beyond the limit are held back and only the newest is kept, so
+  /// a burst of pastes never queues several stale payloads.
+  int? maxOutstandingEvents;
+
+  /// Upper bound, in bytes, on the native memory held by pastes in flight
+  /// and by their results, shared by all engines in the process (Linux).
+  ///
+  /// An image paste that does not fit waits for earlier pastes to release
+  /// their buffers. One that could never fit is downscaled (see
+  /// [downscaleOverBudgetImages]) or fails with the error code
+  /// "over-budget". 0 disables the limit; the default is 512 MiB.
+  int? memoryBudgetBytes;
+
+  /// Whether images too large for [memoryBudgetBytes] are downscaled rather
+  /// than refused. Defaults to true.
+  bool? downscaleOverBudgetImages;
+
+  /// Largest clipboard selection, in bytes, that is transferred before the
+  /// paste fails with the error code "too-large" (Linux, X11). 0 disables
+  /// the limit; the default is 256 MiB.
+  int? maxTransferBytes;
+
+  /// Most bytes of content set with [PasteInputHostApi.setClipboardContent]
+  /// handed to the clipboard manager when the app exits, so that it stays
+  /// pasteable (Linux).
+  ///
+  /// Text is offered first, then the image as given, then rendered formats
+  /// in order; each format that would exceed the limit is left out, so a
+  /// compact rendered format is kept even when the original image is too
+  /// large. 0 disables the limit; the default is 64 MiB.
+  int? clipboardStoreMaxBytes;
+
+  /// Time, in milliseconds, the app may spend at exit rendering formats not
+  /// requested yet for the clipboard manager (Linux). Formats not rendered
+  /// in time are left out; an encode still running at the deadline stops at
+  /// its next output chunk. Decoding the source image, done once, is not
+  /// interrupted. 0 disables the limit; the default is 1000.
+  int? clipboardStoreTimeBudgetMs;
+
+  /// Most clipboard snapshots kept in the history (Linux).
+  ///
+  /// Every successful read is recorded; content already in the history
+  /// moves to the front instead of being added again. 0 disables the
+  /// history and drops what it holds; the default is 50.
+  int? historyMaxEntries;
+
+  /// Upper bound, in bytes, on the memory held by the history (Linux).
+  ///
+  /// Text is kept compressed and counts with its compressed size. The
+  /// oldest entries are dropped first. 0 disables the limit; the default
+  /// is 32 MiB.
+  ///
+  /// With [persistHistory] set, entries over the limit are only dropped
+  /// from memory and read back from disk when fetched.
+  int? historyMaxBytes;
+
+  /// Whether the history is kept on disk, under the user cache directory,
+  /// so that it survives restarts (Linux).
+  ///
+  /// Off by default, as clipboard content may be sensitive. Turning it off
+  /// deletes the files.
+  bool? persistHistory;
+
+  /// Upper bound, in bytes, on the disk space used by a persisted history
+  /// (Linux). The oldest entries are dropped first. 0 disables the limit;
+  /// the default is 128 MiB.
+  int? historyMaxDiskBytes;
+
+  /// File the paste pipeline trace is written to when the app exits
+  /// (Linux).
+  ///
+  /// Setting it starts recording the begin and end of every pipeline stage
+  /// and worker thread job; an empty string stops recording. The file is
+  /// Chrome trace JSON, for Perfetto or chrome://tracing. See also
+  /// [PasteInputHostApi.dumpPasteTrace].
+  String? traceFile;
+
+  Object encode() {
+    return <Object?>[
+      coalesceWindowMs,
+      maxPendingReads,
+      maxOutstandingEvents,
+      memoryBudgetBytes,
+      downscaleOverBudgetImages,
+      maxTransferBytes,
+      clipboardStoreMaxBytes,
+      clipboardStoreTimeBudgetMs,
+      historyMaxEntries,
+      historyMaxBytes,
+      persistHistory,
+      historyMaxDiskBytes,
+      traceFile,
+    ];
+  }
+
+  static PasteInputConfig decode(Object result) {
+    result as List<Object?>;
+    return PasteInputConfig(
+      coalesceWindowMs: result[0] as int?,
+      maxPendingReads: result[1] as int?,
+      maxOutstandingEvents: result[2] as int?,
+      memoryBudgetBytes: result[3] as int?,
+      downscaleOverBudgetImages: result[4] as bool?,
+      maxTransferBytes: result[5] as int?,
+      clipboardStoreMaxBytes: result[6] as int?,
+      clipboardStoreTimeBudgetMs: result[7] as int?,
+      historyMaxEntries: result[8] as int?,
+      historyMaxBytes: result[9] as int?,
+      persistHistory: result[10] as bool?,
+      historyMaxDiskBytes: result[11] as int?,
+      traceFile: result[12] as String?,
+    );
+  }
+}
+
+/// Progress of a large clipboard transfer for a pending
+/// [PasteInputHostApi.getClipboardContent] request (Linux, X11).
+class PasteProgress {
+  PasteProgress({
+    required this.requestId,
+    required this.receivedBytes,
+    this.expectedBytes,
+  });
+
+  /// The id the request was made with.
+  int requestId;
+
+  /// Bytes received from the clipboard owner so far.
+  int receivedBytes;
+
+  /// Size announced by the owner, if any. For incremental transfers this
+  /// is only a lower bound.
+  int? expectedBytes;
+
+  Object encode() {
+    return <Object?>[
+      requestId,
+      receivedBytes,
+      expectedBytes,
+    ];
+  }
+
+  static PasteProgress decode(Object result) {
+    result as List<Object?>;
+    return PasteProgress(
+      requestId: result[0]! as int,
+      receivedBytes: result[1]! as int,
+      expectedBytes: result[2] as int?,
+    );
+  }
+}
+
+/// Content placed on the clipboard by
+/// [PasteInputHostApi.setClipboardContent].
+class ClipboardWrite {
+  ClipboardWrite({
+    this.text,
+    this.image,
+    this.imageMimeType,
+    this.renderedImageTypes,
+  });
+
+  /// Plain text to offer.
+  String? text;
+
+  /// Encoded image to offer, in the format given by [imageMimeType].
+  Uint8List? image;
+
+  /// MIME type of [image], e.g. "image/png". Required with [image].
+  String? imageMimeType;
+
+  /// Further image formats to offer, e.g. "image/jpeg" or "image/bmp".
+  ///
+  /// On Linux each is rendered from [image] only when another application
+  /// asks for it, and kept once rendered. Other platforms offer [image] in
+  /// its own format only.
+  List<String>? renderedImageTypes;
+
+  Object encode() {
+    return <Object?>[
+      text,
+      image,
+      imageMimeType,
+      renderedImageTypes,
+    ];
+  }
+
+  static ClipboardWrite decode(Object result) {
+    result as List<Object?>;
+    return ClipboardWrite(
+      text: result[0] as String?,
+      image: result[1] as Uint8List?,
+      imageMimeType: result[2] as String?,
+      renderedImageTypes: (result[3] as List<Object?>?)?.cast<String>(),
+    );
+  }
+}
+
+/// Metadata of one clipboard history entry, see
+/// [PasteInputHostApi.listClipboardHistory].
+class ClipboardHistoryEntry {
+  ClipboardHistoryEntry({
+    required this.id,
+    required this.capturedAtMs,
+    required this.mimeTypes,
+    required this.byteSize,
+  });
+
+  /// Identifies the entry for [PasteInputHostApi.getClipboardHistoryEntry].
+  /// Ids are never reused within a process.
+  int id;
+
+  /// When the content was last read from the clipboard, in milliseconds
+  /// since the Unix epoch.
+  int capturedAtMs;
+
+  /// MIME types of the entry's items, images first.
+  List<String> mimeTypes;
+
+  /// Size of the content as it was pasted, before compression.
+  int byteSize;
+
+  Object encode() {
+    return <Object?>[
+      id,
+      capturedAtMs,
+      mimeTypes,
+      byteSize,
+    ];
+  }
+
+  static ClipboardHistoryEntry decode(Object result) {
+    result as List<Object?>;
+    return ClipboardHistoryEntry(
+      id: result[0]! as int,
+      capturedAtMs: result[1]! as int,
+      mimeTypes: (result[2] as List<Object?>?)!.cast<String>(),
+      byteSize: result[3]! as int,
+    );
+  }
+}
+
+/// A clipboard history entry matching a search, see
+/// [PasteInputHostApi.searchClipboardHistory].
+class ClipboardHistoryMatch {
+  ClipboardHistoryMatch({
+    required this.id,
+    required this.matchCount,
+    required this.matchStarts,
+    required this.matchEnds,
+  });
+
+  /// The entry, as in [ClipboardHistoryEntry.id].
+  int id;
+
+  /// Occurrences of the query's terms in the entry's text.
+  int matchCount;
+
+  /// Where matches start in the entry's text, in UTF-16 code units as Dart
+  /// strings index them, in ascending order. At most 64 are reported.
+  List<int> matchStarts;
+
+  /// Where the matches in [matchStarts] end, exclusive.
+  List<int> matchEnds;
+
+  Object encode() {
+    return <Object?>[
+      id,
+      matchCount,
+      matchStarts,
+      matchEnds,
+    ];
+  }
+
+  static ClipboardHistoryMatch decode(Object result) {
+    result as List<Object?>;
+    return ClipboardHistoryMatch(
+      id: result[0]! as int,
+      matchCount: result[1]! as int,
+      matchStarts: (result[2] as List<Object?>?)!.cast<int>(),
+      matchEnds: (result[3] as List<Object?>?)!.cast<int>(),
+    );
+  }
+}
+
+/// Timings of one stage of the native paste pipeline, see
+/// [PasteInputHostApi.getPasteStats].
+class PasteStageStats {
+  PasteStageStats({
+    required this.stage,
+    required this.count,
+    required this.totalMicros,
+    required this.maxMicros,
+    required this.bytesIn,
+    required this.bytesOut,
+  });
+
+  /// The stage: "selection" (waiting on the clipboard owner), "decode",
+  /// "encode" (PNG), "serialize" (building the reply), "dart" (from
+  /// sending a paste event until Dart has handled it) or "total" (from the
+  /// paste request reaching the plugin until the reply is sent or the paste
+  /// event handled).
+  String stage;
+
+  /// Runs of the stage since the last reset.
+  int count;
+
+  /// Time spent in the stage, in microseconds.
+  int totalMicros;
+
+  /// Longest single run, in microseconds.
+  int maxMicros;
+
+  /// Bytes the stage consumed and produced.
+  int bytesIn;
+
+  int bytesOut;
+
+  Object encode() {
+    return <Object?>[
+      stage,
+      count,
+      totalMicros,
+      maxMicros,
+      bytesIn,
+      bytesOut,
+    ];
+  }
+
+  static PasteStageStats decode(Object result) {
+    result as List<Object?>;
+    return PasteStageStats(
+      stage: result[0]! as String,
+      count: result[1]! as int,
+      totalMicros: result[2]! as int,
+      maxMicros: result[3]! as int,
+      bytesIn: result[4]! as int,
+      bytesOut: result[5]! as int,
+    );
+  }
+}
+
+/// Latency percentiles of one stage of the native paste pipeline for one
+/// kind of content, see [PasteInputHostApi.getPasteLatencies].
+class PasteLatencyStats {
+  PasteLatencyStats({
+    required this.stage,
+    required this.contentClass,
+    required this.count,
+    required this.p50Micros,
+    required this.p90Micros,
+    required this.p99Micros,
+    required this.maxMicros,
+  });
+
+  /// The stage, as in [PasteStageStats.stage].
+  String stage;
+
+  /// What was pasted: "text", "small-image" or "large-image" (at least
+  /// 1024 x 1024 pixels).
+  String contentClass;
+
+  /// Runs of the stage since the last reset.
+  int count;
+
+  /// Percentiles, in microseconds, within about 6% of the exact value.
+  int p50Micros;
+
+  int p90Micros;
+
+  int p99Micros;
+
+  /// Longest single run, in microseconds.
+  int maxMicros;
+
+  Object encode() {
+    return <Object?>[
+      stage,
+      contentClass,
+      count,
+      p50Micros,
+      p90Micros,
+      p99Micros,
+      maxMicros,
+    ];
+  }
+
+  static PasteLatencyStats decode(Object result) {
+    result as List<Object?>;
+    return PasteLatencyStats(
+      stage: result[0]! as String,
+      contentClass: result[1]! as String,
+      count: result[2]! as int,
+      p50Micros: result[3]! as int,
+      p90Micros: result[4]! as int,
+      p99Micros: result[5]! as int,
+      maxMicros: result[6]! as int,
     );
   }
 }
@@ -109,6 +629,30 @@ class _PigeonCodec extends StandardMessageCodec {
     }    else if (value is ClipboardContent) {
       buffer.putUint8(130);
       writeValue(buffer, value.encode());
+    }    else if (value is ClipboardProbe) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.encode());
+    }    else if (value is PasteInputConfig) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
+    }    else if (value is PasteProgress) {
+      buffer.putUint8(133);
+      writeValue(buffer, value.encode());
+    }    else if (value is ClipboardWrite) {
+      buffer.putUint8(134);
+      writeValue(buffer, value.encode());
+    }    else if (value is ClipboardHistoryEntry) {
+      buffer.putUint8(135);
+      writeValue(buffer, value.encode());
+    }    else if (value is ClipboardHistoryMatch) {
+      buffer.putUint8(136);
+      writeValue(buffer, value.encode());
+    }    else if (value is PasteStageStats) {
+      buffer.putUint8(137);
+      writeValue(buffer, value.encode());
+    }    else if (value is PasteLatencyStats) {
+      buffer.putUint8(138);
+      writeValue(buffer, value.encode());
     } else {
       super.writeValue(buffer, value);
     }
@@ -121,6 +665,22 @@ class _PigeonCodec extends StandardMessageCodec {
         return ClipboardItem.decode(readValue(buffer)!);
       case 130: 
         return ClipboardContent.decode(readValue(buffer)!);
+      case 131: 
+        return ClipboardProbe.decode(readValue(buffer)!);
+      case 132: 
+        return PasteInputConfig.decode(readValue(buffer)!);
+      case 133: 
+        return PasteProgress.decode(readValue(buffer)!);
+      case 134: 
+        return ClipboardWrite.decode(readValue(buffer)!);
+      case 135: 
+        return ClipboardHistoryEntry.decode(readValue(buffer)!);
+      case 136: 
+        return ClipboardHistoryMatch.decode(readValue(buffer)!);
+      case 137: 
+        return PasteStageStats.decode(readValue(buffer)!);
+      case 138: 
+        return PasteLatencyStats.decode(readValue(buffer)!);
       default:
         return super.readValueOfType(type, buffer);
     }
@@ -151,7 +711,13 @@ class PasteInputHostApi {
   ///
   /// Returns an empty [ClipboardContent] if the clipboard is empty or
   /// contains only unsupported content types.
-  Future<ClipboardContent> getClipboardContent() async {
+  ///
+  /// Requests made while a read is in progress, or shortly after one
+  /// completed (see [PasteInputConfig.coalesceWindowMs]), share its result.
+  ///
+  /// [requestId] identifies the request for [cancelPaste]; 0 means the
+  /// request cannot be cancelled.
+  Future<ClipboardContent> getClipboardContent(int requestId) async {
     final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardContent$pigeonVar_messageChannelSuffix';
     final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
       pigeonVar_channelName,
@@ -159,7 +725,7 @@ class PasteInputHostApi {
       binaryMessenger: pigeonVar_binaryMessenger,
     );
     final List<Object?>? pigeonVar_replyList =
-        await pigeonVar_channel.send(null) as List<Object?>?;
+        await pigeonVar_channel.send(<Object?>[requestId]) as List<Object?>?;
     if (pigeonVar_replyList == null) {
       throw _createConnectionError(pigeonVar_channelName);
     } else if (pigeonVar_replyList.length > 1) {
@@ -234,6 +800,394 @@ class PasteInputHostApi {
       return (pigeonVar_replyList[0] as String?)!;
     }
   }
+
+  /// Returns the clipboard change counter and the available MIME types.
+  ///
+  /// This is served from state the platform already tracks and transfers
+  /// no clipboard payload, so it is cheap enough to call while building UI
+  /// (e.g. to decide whether a paste button should be enabled).
+  Future<ClipboardProbe> probeClipboard() async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.probeClipboard$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(null) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as ClipboardProbe?)!;
+    }
+  }
+
+  /// Applies tuning options to the native paste pipeline.
+  ///
+  /// On Linux and Windows the clipboard cache is shared by all Flutter
+  /// engines in the process, so the options apply to every engine.
+  Future<void> configure(PasteInputConfig config) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.configure$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[config]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Hints that a paste is likely soon, e.g. because a text field gained
+  /// focus.
+  ///
+  /// Where supported (Linux), the clipboard is read and encoded in the
+  /// background at idle priority so that the next [getClipboardContent]
+  /// is served from the warm snapshot. Elsewhere this is a no-op.
+  Future<void> prefetchClipboard() async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.prefetchClipboard$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(null) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Cancels the [getClipboardContent] request with the given id.
+  ///
+  /// The request fails with the error code "cancelled". Native work that no
+  /// other request is waiting on is abandoned and its buffers released.
+  /// Unknown or already completed ids are ignored.
+  Future<void> cancelPaste(int requestId) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.cancelPaste$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[requestId]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Releases natively cached clipboard data, as the platform does by
+  /// itself on low-memory warnings where it reports them (Linux).
+  ///
+  /// [level] is 0 (low), 1 (medium) or 2 (critical); higher levels drop
+  /// more, including data that is still fresh. Returns the number of bytes
+  /// released from the plugin's caches.
+  Future<int> trimMemory(int level) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.trimMemory$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[level]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as int?)!;
+    }
+  }
+
+  /// Replaces the clipboard content with [content].
+  ///
+  /// Fails with the error code "invalid-argument" if [content] is empty or
+  /// an image lacks its MIME type, and with "unsupported-format" if a
+  /// requested rendition cannot be produced on this platform.
+  Future<void> setClipboardContent(ClipboardWrite content) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.setClipboardContent$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[content]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Lists the clipboard history, most recent first, without its content.
+  ///
+  /// Only Linux keeps a history; elsewhere the list is empty.
+  Future<List<ClipboardHistoryEntry>> listClipboardHistory() async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.listClipboardHistory$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(null) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as List<Object?>?)!.cast<ClipboardHistoryEntry>();
+    }
+  }
+
+  /// Returns the content of the history entry with the given [id].
+  ///
+  /// Fails with the error code "not-found" if the entry has been dropped
+  /// from the history, or never existed.
+  Future<ClipboardContent> getClipboardHistoryEntry(int id) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardHistoryEntry$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[id]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as ClipboardContent?)!;
+    }
+  }
+
+  /// Searches the text of the clipboard history for [query].
+  ///
+  /// Entries match if their text contains every whitespace-separated term
+  /// of [query], ignoring ASCII case. At most [maxResults] are returned,
+  /// those with the most occurrences first, then the most recent. Only
+  /// Linux keeps a history; elsewhere the list is empty.
+  Future<List<ClipboardHistoryMatch>> searchClipboardHistory(String query, int maxResults) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.searchClipboardHistory$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[query, maxResults]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as List<Object?>?)!.cast<ClipboardHistoryMatch>();
+    }
+  }
+
+  /// Returns the time spent in each stage of the paste pipeline since the
+  /// last [resetPasteStats].
+  ///
+  /// Only Linux instruments its pipeline; elsewhere the list is empty.
+  Future<List<PasteStageStats>> getPasteStats() async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteStats$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(null) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as List<Object?>?)!.cast<PasteStageStats>();
+    }
+  }
+
+  /// Zeroes the counters reported by [getPasteStats] and
+  /// [getPasteLatencies].
+  Future<void> resetPasteStats() async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.resetPasteStats$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(null) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else {
+      return;
+    }
+  }
+
+  /// Returns latency percentiles of each stage of the paste pipeline, and
+  /// end to end, per kind of content, since the last [resetPasteStats].
+  /// Combinations without runs are left out.
+  ///
+  /// Only Linux instruments its pipeline; elsewhere the list is empty.
+  Future<List<PasteLatencyStats>> getPasteLatencies() async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteLatencies$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(null) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as List<Object?>?)!.cast<PasteLatencyStats>();
+    }
+  }
+
+  /// Writes the paste pipeline activity recorded since tracing was started
+  /// with [PasteInputConfig.traceFile] to [path] as Chrome trace JSON.
+  /// Recording goes on.
+  ///
+  /// Returns the number of events written, or fails with the error code
+  /// "write-failed" if the file cannot be written. Only Linux records a
+  /// trace; elsewhere no file is written and 0 is returned.
+  Future<int> dumpPasteTrace(String path) async {
+    final String pigeonVar_channelName = 'dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.dumpPasteTrace$pigeonVar_messageChannelSuffix';
+    final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final List<Object?>? pigeonVar_replyList =
+        await pigeonVar_channel.send(<Object?>[path]) as List<Object?>?;
+    if (pigeonVar_replyList == null) {
+      throw _createConnectionError(pigeonVar_channelName);
+    } else if (pigeonVar_replyList.length > 1) {
+      throw PlatformException(
+        code: pigeonVar_replyList[0]! as String,
+        message: pigeonVar_replyList[1] as String?,
+        details: pigeonVar_replyList[2],
+      );
+    } else if (pigeonVar_replyList[0] == null) {
+      throw PlatformException(
+        code: 'null-error',
+        message: 'Host platform returned null value for non-null return value.',
+      );
+    } else {
+      return (pigeonVar_replyList[0] as int?)!;
+    }
+  }
 }
 
 /// Flutter API for paste event notifications (Native -> Dart).
@@ -251,6 +1205,10 @@ abstract class PasteInputFlutterApi {
   /// immediately without additional clipboard reads.
   void onPasteDetected(ClipboardContent content);
 
+  /// Called periodically while a large selection is transferred for a
+  /// [PasteInputHostApi.getClipboardContent] request.
+  void onPasteProgress(PasteProgress progress);
+
   static void setUp(PasteInputFlutterApi? api, {BinaryMessenger? binaryMessenger, String messageChannelSuffix = '',}) {
     messageChannelSuffix = messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
     {
@@ -278,5 +1236,30 @@ abstract class PasteInputFlutterApi {
         });
       }
     }
+    {
+      final BasicMessageChannel<Object?> pigeonVar_channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.flutter_paste_input.PasteInputFlutterApi.onPasteProgress$messageChannelSuffix', pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          assert(message != null,
+          'Argument for dev.flutter.pigeon.flutter_paste_input.PasteInputFlutterApi.onPasteProgress was null.');
+          final List<Object?> args = (message as List<Object?>?)!;
+          final PasteProgress? arg_progress = (args[0] as PasteProgress?);
+          assert(arg_progress != null,
+              'Argument for dev.flutter.pigeon.flutter_paste_input.PasteInputFlutterApi.onPasteProgress was null, expected non-null PasteProgress.');
+          try {
+            api.onPasteProgress(arg_progress!);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          }          catch (e) {
+            return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
   }
 }
@@ -1,25 +1,51 @@
 import 'dart:async';
 import 'dart:convert';
+import 'dart:math';
+
+import 'package:flutter/services.dart';
 
 import 'generated/messages.g.dart';
 import 'paste_payload.dart';
 
+/// How much cached data [PasteChannel.trimMemory] releases.
+enum MemoryTrimLevel {
+  /// Drop data that is unlikely to be reused.
+  low,
+
+  /// Drop all caches that can be rebuilt from the clipboard.
+  medium,
+
+  /// Additionally abandon background reads nobody is waiting on.
+  critical,
+}
+
 /// Implementation of [PasteInputFlutterApi] to receive paste events from native.
 class _PasteInputFlutterApiImpl implements PasteInputFlutterApi {
-  _PasteInputFlutterApiImpl(this._onPaste);
+  _PasteInputFlutterApiImpl(this._onPaste, this._onProgress);
 
   final void Function(ClipboardContent content) _onPaste;
+  final void Function(PasteProgress progress) _onProgress;
 
   @override
   void onPasteDetected(ClipboardContent content) {
     _onPaste(content);
   }
+
+  @override
+  void onPasteProgress(PasteProgress progress) {
+    _onProgress(progress);
+  }
 }
 
 /// Handles communication with the native platform for paste events.
 ///
 /// This class uses Pigeon-generated type-safe APIs for communication
 /// with native code across all platforms.
+///
+/// The host API methods can also be used from a background isolate once
+/// `BackgroundIsolateBinaryMessenger.ensureInitialized` has been called
+/// there. Replies go straight to the calling isolate. Paste events
+/// ([onPaste]) are only delivered to the root isolate.
 class PasteChannel {
   PasteChannel._() {
     _hostApi = PasteInputHostApi();
@@ -27,11 +53,44 @@ class PasteChannel {
 
   static final PasteChannel _instance = PasteChannel._();
 
+  /// Error code of a [getClipboardContent] request rejected because too
+  /// many requests are already waiting on the clipboard.
+  static const String busyErrorCode = 'busy';
+
+  /// Error code of a [getClipboardContent] request ended by [cancelPaste].
+  static const String cancelledErrorCode = 'cancelled';
+
+  /// Error code of a [getClipboardContent] request refused because the
+  /// content does not fit the native memory budget (see
+  /// [PasteInputConfig.memoryBudgetBytes]).
+  static const String overBudgetErrorCode = 'over-budget';
+
+  /// Error code of a [getClipboardContent] request whose clipboard data
+  /// exceeds [PasteInputConfig.maxTransferBytes].
+  static const String tooLargeErrorCode = 'too-large';
+
+  /// Error code of a [getClipboardContent] request abandoned because the
+  /// clipboard owner stopped sending data.
+  static const String timeoutErrorCode = 'timeout';
+
+  /// Error code of a [getClipboardHistoryEntry] request for an entry that
+  /// is no longer in the history.
+  static const String notFoundErrorCode = 'not-found';
+
+  /// Error code of a [dumpPasteTrace] request whose file cannot be written.
+  static const String writeFailedErrorCode = 'write-failed';
+
+  // Request ids must not collide across isolates, which each have their
+  // own instance, so every isolate counts up from a random base.
+  final int _requestIdBase = (Random.secure().nextInt(1 << 30) + 1) << 32;
+  int _lastRequestId = 0;
+
   /// The singleton instance of [PasteChannel].
   static PasteChannel get instance => _instance;
 
   late final PasteInputHostApi _hostApi;
   final _pasteController = StreamController<PastePayload>.broadcast();
+  final _progressController = StreamController<PasteProgress>.broadcast();
 
   bool _isInitialized = false;
 
@@ -41,17 +100,24 @@ class PasteChannel {
   /// the user pastes content into a wrapped text field.
   Stream<PastePayload> get onPaste => _pasteController.stream;
 
+  /// Progress of large clipboard transfers for [getClipboardContent]
+  /// requests, identified by [PasteProgress.requestId] (Linux, X11).
+  ///
+  /// Like [onPaste], only delivered to the root isolate.
+  Stream<PasteProgress> get onPasteProgress => _progressController.stream;
+
   /// Initializes the paste event listener.
   ///
   /// This should be called once before using the plugin.
-  /// It's automatically called by [PasteWrapper] when first mounted.
+  /// It's automatically called by [PasteWrapper] when first mounted. Does
+  /// nothing in background isolates, which cannot receive native calls.
   void initialize() {
-    if (_isInitialized) return;
+    if (_isInitialized || RootIsolateToken.instance == null) return;
     _isInitialized = true;
 
     // Set up the Flutter API to receive callbacks from native
     PasteInputFlutterApi.setUp(
-      _PasteInputFlutterApiImpl(_handlePasteFromNative),
+      _PasteInputFlutterApiImpl(_handlePasteFromNative, _progressController.add),
     );
   }
 
@@ -59,6 +125,7 @@ class PasteChannel {
   ///
   /// Call this when the plugin is no longer needed.
   void dispose() {
+    if (!_isInitialized) return;
     _isInitialized = false;
     PasteInputFlutterApi.setUp(null);
   }
@@ -82,6 +149,11 @@ class PasteChannel {
         items: imageItems.map((item) => RawClipboardItem(
           data: item.data,
           mimeType: item.mimeType,
+          width: item.width,
+          height: item.height,
+          hasAlpha: item.hasAlpha,
+          frameCount: item.frameCount,
+          originalByteSize: item.originalByteSize,
         )).toList(),
       );
     }
@@ -124,17 +196,159 @@ class PasteChannel {
   /// Gets the current clipboard content.
   ///
   /// Returns a [ClipboardContent] containing all available items.
-  /// Use this to manually check clipboard content.
-  Future<ClipboardContent> getClipboardContent() async {
-    return await _hostApi.getClipboardContent();
+  /// Use this to manually check clipboard content. Requests made while a
+  /// read is in flight share its result; throws a `PlatformException` with
+  /// code [busyErrorCode] when too many are already waiting.
+  ///
+  /// Pass an id from [newRequestId] as [requestId] to be able to cancel
+  /// the request with [cancelPaste].
+  Future<ClipboardContent> getClipboardContent({int? requestId}) async {
+    return await _hostApi.getClipboardContent(requestId ?? newRequestId());
+  }
+
+  /// Returns a new id for [getClipboardContent] and [cancelPaste].
+  int newRequestId() => _requestIdBase + ++_lastRequestId;
+
+  /// Cancels the [getClipboardContent] request with the given id, which
+  /// then fails with a `PlatformException` with code [cancelledErrorCode].
+  ///
+  /// Native work nobody else waits on is abandoned. Unknown or completed
+  /// ids are ignored.
+  Future<void> cancelPaste(int requestId) async {
+    await _hostApi.cancelPaste(requestId);
+  }
+
+  /// Probes the clipboard without reading its content.
+  ///
+  /// Returns the platform's clipboard change counter and the MIME types
+  /// currently on offer, or null if the platform call fails. This is cheap
+  /// enough to call while building UI.
+  Future<ClipboardProbe?> probeClipboard() async {
+    try {
+      return await _hostApi.probeClipboard();
+    } catch (e) {
+      return null;
+    }
+  }
+
+  /// Tunes how repeated paste requests are coalesced natively.
+  ///
+  /// Fields left null keep their current value. See [PasteInputConfig].
+  Future<void> configure(PasteInputConfig config) async {
+    await _hostApi.configure(config);
+  }
+
+  /// Hints that a paste is likely soon so the platform can read the
+  /// clipboard ahead of time.
+  ///
+  /// Best effort: failures are ignored, and platforms without background
+  /// reads treat this as a no-op.
+  Future<void> prefetchClipboard() async {
+    try {
+      await _hostApi.prefetchClipboard();
+    } catch (e) {
+      // Prefetching is only an optimization.
+    }
+  }
+
+  /// Releases clipboard data cached natively and returns the number of
+  /// bytes freed.
+  ///
+  /// Call this when the app moves to the background or receives a memory
+  /// warning. On Linux the plugin also trims by itself when GLib reports
+  /// low memory.
+  Future<int> trimMemory([MemoryTrimLevel level = MemoryTrimLevel.medium]) async {
+    return await _hostApi.trimMemory(level.index);
+  }
+
+  /// Replaces the clipboard content, e.g. to copy an image out of the app,
+  /// which Flutter's `Clipboard.setData` cannot do.
+  ///
+  /// On Linux the formats in [ClipboardWrite.renderedImageTypes] are only
+  /// encoded when another application asks for them. Android can only
+  /// copy text.
+  Future<void> setClipboardContent(ClipboardWrite content) async {
+    await _hostApi.setClipboardContent(content);
+  }
+
+  /// Lists the clipboard history, most recent first, without its content.
+  ///
+  /// Only Linux keeps a history, of every clipboard read the plugin made;
+  /// see [PasteInputConfig.historyMaxEntries]. Elsewhere the list is empty.
+  Future<List<ClipboardHistoryEntry>> listClipboardHistory() async {
+    return await _hostApi.listClipboardHistory();
+  }
+
+  /// Returns the content of a [listClipboardHistory] entry, e.g. for
+  /// "paste previous".
+  ///
+  /// Throws a `PlatformException` with code [notFoundErrorCode] if the
+  /// entry has been dropped from the history since it was listed.
+  Future<ClipboardContent> getClipboardHistoryEntry(int id) async {
+    return await _hostApi.getClipboardHistoryEntry(id);
+  }
+
+  /// Searches the text of the clipboard history for [query], returning up
+  /// to [maxResults] matching entries with the spans that matched.
+  ///
+  /// Every whitespace-separated term of [query] must occur in an entry,
+  /// ignoring ASCII case. Entries with the most occurrences come first,
+  /// then the most recent. The search uses a trigram index kept by the
+  /// plugin and only scans the text of entries that may match. Only Linux
+  /// keeps a history; elsewhere the list is empty.
+  Future<List<ClipboardHistoryMatch>> searchClipboardHistory(String query,
+      {int maxResults = 20}) async {
+    return await _hostApi.searchClipboardHistory(query, maxResults);
+  }
+
+  /// Returns how long each stage of the native paste pipeline took since
+  /// the last [resetPasteStats], e.g. to tell a slow clipboard owner from
+  /// slow image encoding. Only Linux instruments its pipeline; elsewhere
+  /// the list is empty.
+  Future<List<PasteStageStats>> getPasteStats() async {
+    return await _hostApi.getPasteStats();
+  }
+
+  /// Zeroes the counters reported by [getPasteStats] and
+  /// [getPasteLatencies].
+  Future<void> resetPasteStats() async {
+    await _hostApi.resetPasteStats();
+  }
+
+  /// Returns p50/p90/p99 and maximum latencies of each pipeline stage, and
+  /// end to end, split into text, small images and large images, since the
+  /// last [resetPasteStats]. Only Linux instruments its pipeline; elsewhere
+  /// the list is empty.
+  Future<List<PasteLatencyStats>> getPasteLatencies() async {
+    return await _hostApi.getPasteLatencies();
+  }
+
+  /// Writes the paste pipeline trace recorded since tracing was started
+  /// with [PasteInputConfig.traceFile] to [path] as Chrome trace JSON, for
+  /// Perfetto or chrome://tracing, and returns the number of events
+  /// written. Throws a `PlatformException` with code
+  /// [writeFailedErrorCode] if the file cannot be written. Only Linux
+  /// records a trace; elsewhere this returns 0.
+  Future<int> dumpPasteTrace(String path) async {
+    return await _hostApi.dumpPasteTrace(path);
+  }
+
+  /// Returns true if [probe] lists content that can be pasted as one of
+  /// [acceptedTypes] (all types when null).
+  static bool canPaste(ClipboardProbe probe, {Set<PasteType>? acceptedTypes}) {
+    final acceptsText = acceptedTypes?.contains(PasteType.text) ?? true;
+    final acceptsImage = acceptedTypes?.contains(PasteType.image) ?? true;
+    return probe.mimeTypes.any((mimeType) =>
+        (acceptsText && mimeType.startsWith('text/')) ||
+        (acceptsImage && mimeType.startsWith('image/')));
   }
 
   /// Gets the clipboard content and converts it to a [PastePayload].
   ///
   /// This is useful for handling paste events manually, for example
   /// when intercepting paste actions from the Flutter framework.
-  Future<PastePayload> getPastePayload() async {
-    final content = await getClipboardContent();
+  Future<PastePayload> getPastePayload({int? requestId}) async {
+    final content = await getClipboardContent(requestId: requestId);
     return _convertToPayload(content);
   }
 }
@@ -133,6 +133,11 @@ class RawClipboardItem {
   const RawClipboardItem({
     required this.data,
     required this.mimeType,
+    this.width,
+    this.height,
+    this.hasAlpha,
+    this.frameCount,
+    this.originalByteSize,
   });
 
   /// Raw binary data of the item.
@@ -141,6 +146,25 @@ class RawClipboardItem {
   /// MIME type of the item (e.g., "image/png", "text/plain").
   final String mimeType;
 
+  /// Width of the image in pixels, if reported by the platform.
+  ///
+  /// Together with [height], this lets the UI reserve space for a preview
+  /// before decoding [data].
+  final int? width;
+
+  /// Height of the image in pixels, if reported by the platform.
+  final int? height;
+
+  /// Whether the image has an alpha channel, if reported by the platform.
+  final bool? hasAlpha;
+
+  /// Number of frames in the image, if reported by the platform.
+  final int? frameCount;
+
+  /// Size in bytes of the original clipboard data, if reported by the
+  /// platform. May differ from `data.length` when the image was re-encoded.
+  final int? originalByteSize;
+
   /// Returns true if this is an image item.
   bool get isImage => mimeType.startsWith('image/');
 
@@ -149,6 +173,9 @@ class RawClipboardItem {
 
   /// Returns true if this is a GIF image.
   bool get isGif => mimeType == 'image/gif';
+
+  /// Returns true if this item is known to contain more than one frame.
+  bool get isAnimated => (frameCount ?? 1) > 1;
 }
 
 /// Represents pasted image content with raw data.
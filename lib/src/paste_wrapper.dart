@@ -5,6 +5,7 @@ import 'package:flutter/material.dart';
 import 'package:flutter/services.dart';
 import 'package:path_provider/path_provider.dart';
 
+import 'generated/messages.g.dart' show ClipboardProbe;
 import 'paste_channel.dart';
 import 'paste_payload.dart';
 
@@ -113,6 +114,46 @@ class PasteWrapper extends StatefulWidget {
 class _PasteWrapperState extends State<PasteWrapper> {
   bool get _useContentInsertion => Platform.isIOS || Platform.isAndroid;
 
+  // Latest clipboard probe, used to lay out the context menu without
+  // reading the clipboard content.
+  ClipboardProbe? _clipboardProbe;
+
+  // Ids of clipboard reads still in flight, cancelled on dispose.
+  final Set<int> _pendingRequestIds = {};
+
+  @override
+  void initState() {
+    super.initState();
+    _refreshClipboardProbe();
+  }
+
+  @override
+  void dispose() {
+    for (final requestId in _pendingRequestIds) {
+      PasteChannel.instance.cancelPaste(requestId);
+    }
+    _pendingRequestIds.clear();
+    super.dispose();
+  }
+
+  Future<PastePayload> _getPastePayload() async {
+    final requestId = PasteChannel.instance.newRequestId();
+    _pendingRequestIds.add(requestId);
+    try {
+      return await PasteChannel.instance.getPastePayload(requestId: requestId);
+    } finally {
+      _pendingRequestIds.remove(requestId);
+    }
+  }
+
+  void _refreshClipboardProbe() {
+    PasteChannel.instance.probeClipboard().then((probe) {
+      if (probe != null && mounted) {
+        _clipboardProbe = probe;
+      }
+    });
+  }
+
   // Store reference to the TextField controller for inserting text
   TextEditingController? _getController() {
     final child = widget.child;
@@ -227,17 +268,26 @@ class _PasteWrapperState extends State<PasteWrapper> {
     // Remove the default Paste button and replace with our custom one
     buttonItems.removeWhere((item) => item.type == ContextMenuButtonType.paste);
 
+    // Only offer "Paste" when the last probe saw something we accept. Until
+    // the first probe completes, keep the button so paste is never blocked.
+    final probe = _clipboardProbe;
+    _refreshClipboardProbe();
+    final canPaste = probe == null ||
+        PasteChannel.canPaste(probe, acceptedTypes: widget.acceptedTypes);
+
     // Add our custom "Paste" button that handles both text and images
-    buttonItems.insert(
-      0,
-      ContextMenuButtonItem(
-        label: 'Paste',
-        onPressed: () async {
-          ContextMenuController.removeAny();
-          await _checkAndPasteFromClipboard(editableTextState);
-        },
-      ),
-    );
+    if (canPaste) {
+      buttonItems.insert(
+        0,
+        ContextMenuButtonItem(
+          label: 'Paste',
+          onPressed: () async {
+            ContextMenuController.removeAny();
+            await _checkAndPasteFromClipboard(editableTextState);
+          },
+        ),
+      );
+    }
 
     return AdaptiveTextSelectionToolbar.buttonItems(
       anchors: editableTextState.contextMenuAnchors,
@@ -250,7 +300,7 @@ class _PasteWrapperState extends State<PasteWrapper> {
   ) async {
     try {
       // Use the Pigeon-based API
-      final payload = await PasteChannel.instance.getPastePayload();
+      final payload = await _getPastePayload();
 
       if (payload is TextPaste) {
         _notifyTextPaste(payload.text);
@@ -265,6 +315,10 @@ class _PasteWrapperState extends State<PasteWrapper> {
           _insertTextIntoField(editableTextState, data.text!);
         }
       }
+    } on PlatformException catch (e)
+        when (e.code == PasteChannel.cancelledErrorCode) {
+      // The wrapper was disposed while the clipboard was being read.
+      return;
     } catch (e) {
       // Error reading clipboard content, try fallback
       try {
@@ -363,10 +417,23 @@ class _PasteWrapperState extends State<PasteWrapper> {
           },
         ),
       },
-      child: widget.child,
+      child: Focus(
+        canRequestFocus: false,
+        skipTraversal: true,
+        onFocusChange: _onFocusChange,
+        child: widget.child,
+      ),
     );
   }
 
+  // Warm the native clipboard snapshot while the user is about to type, so
+  // that Ctrl+V is served without waiting for the read and encode.
+  void _onFocusChange(bool hasFocus) {
+    if (hasFocus) {
+      PasteChannel.instance.prefetchClipboard();
+    }
+  }
+
   Future<void> _onContentInserted(KeyboardInsertedContent content) async {
     if (!widget.enabled) return;
 
@@ -427,7 +494,7 @@ class _PasteWrapperState extends State<PasteWrapper> {
 
     try {
       // Use Pigeon-based API
-      final payload = await PasteChannel.instance.getPastePayload();
+      final payload = await _getPastePayload();
       if (payload is TextPaste) {
         _notifyTextPaste(payload.text);
       } else if (payload is RawImagePaste) {
@@ -435,6 +502,13 @@ class _PasteWrapperState extends State<PasteWrapper> {
       } else {
         _notifyUnsupported();
       }
+    } on PlatformException catch (e) when (e.code == PasteChannel.busyErrorCode) {
+      // A repeat of a paste that is still being read, e.g. a held Ctrl+V.
+      return;
+    } on PlatformException catch (e)
+        when (e.code == PasteChannel.cancelledErrorCode) {
+      // The wrapper was disposed while the clipboard was being read.
+      return;
     } catch (e) {
       // Fallback to Flutter's clipboard
       try {
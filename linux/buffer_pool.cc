@@ -0,0 +1,249 @@
+#include "buffer_pool.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace flutter_paste_input {
+
+namespace {
+
+constexpr size_t kClassCount = 13;  // 64 KiB ... 256 MiB
+
+}  // namespace
+
+// static
+BufferPool* BufferPool::Get() {
+  // Never destroyed: worker threads may still return buffers at exit.
+  static BufferPool* pool = new BufferPool();
+  return pool;
+}
+
+BufferPool::BufferPool() : free_blocks_(kClassCount) {}
+
+// static
+size_t BufferPool::ClassIndex(size_t capacity) {
+  size_t index = 0;
+  while (ClassBytes(index) < capacity) {
+    index++;
+  }
+  return index;
+}
+
+// static
+size_t BufferPool::ClassBytes(size_t index) {
+  return kMinClassBytes << index;
+}
+
+// static
+BufferPool::Block BufferPool::Allocate(size_t capacity) {
+  Block block;
+  if (capacity >= kMmapThresholdBytes) {
+    void* data = mmap(nullptr, capacity, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+      return block;
+    }
+    block.data = static_cast<uint8_t*>(data);
+  } else {
+    block.data = static_cast<uint8_t*>(malloc(capacity));
+    if (block.data == nullptr) {
+      return block;
+    }
+  }
+  block.capacity = capacity;
+  return block;
+}
+
+// static
+void BufferPool::Free(Block block) {
+  if (block.capacity >= kMmapThresholdBytes) {
+    munmap(block.data, block.capacity);
+  } else {
+    free(block.data);
+  }
+}
+
+BufferPool::Block BufferPool::Acquire(size_t min_capacity) {
+  if (min_capacity < kMinClassBytes || min_capacity > kMaxClassBytes) {
+    return Allocate(std::max<size_t>(min_capacity, 1));
+  }
+
+  size_t index = ClassIndex(min_capacity);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<FreeBlock>& free_list = free_blocks_[index];
+    if (!free_list.empty()) {
+      // Most recently returned first: its pages are the likeliest to still
+      // be resident.
+      Block block = free_list.back().block;
+      free_list.pop_back();
+      return block;
+    }
+  }
+  return Allocate(ClassBytes(index));
+}
+
+void BufferPool::Return(Block block) {
+  if (block.data == nullptr) {
+    return;
+  }
+  if (block.capacity < kMinClassBytes || block.capacity > kMaxClassBytes) {
+    Free(block);
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  std::vector<FreeBlock>& free_list = free_blocks_[ClassIndex(block.capacity)];
+  if (free_list.size() >= kMaxFreePerClass) {
+    lock.unlock();
+    Free(block);
+    return;
+  }
+  free_list.push_back({block, g_get_monotonic_time(), false});
+
+  if (block.capacity >= kMmapThresholdBytes && idle_source_ == 0) {
+    // Attached to the default main context, whichever thread returns.
+    idle_source_ = g_timeout_add_seconds(kIdleSeconds, OnIdleCheck, this);
+  }
+}
+
+size_t BufferPool::AdviseIdle(gint64 idle_before) {
+  size_t advised = 0;
+  for (std::vector<FreeBlock>& free_list : free_blocks_) {
+    for (FreeBlock& free_block : free_list) {
+      if (free_block.advised || free_block.block.capacity < kMmapThresholdBytes ||
+          free_block.returned_at > idle_before) {
+        continue;
+      }
+      madvise(free_block.block.data, free_block.block.capacity, MADV_DONTNEED);
+      free_block.advised = true;
+      advised += free_block.block.capacity;
+    }
+  }
+  return advised;
+}
+
+// static
+gboolean BufferPool::OnIdleCheck(gpointer user_data) {
+  BufferPool* self = static_cast<BufferPool*>(user_data);
+  std::lock_guard<std::mutex> lock(self->mutex_);
+
+  gint64 now = g_get_monotonic_time();
+  self->AdviseIdle(now - static_cast<gint64>(kIdleSeconds) * G_USEC_PER_SEC);
+
+  // Keep checking while mapped blocks are still resident.
+  for (const std::vector<FreeBlock>& free_list : self->free_blocks_) {
+    for (const FreeBlock& free_block : free_list) {
+      if (!free_block.advised && free_block.block.capacity >= kMmapThresholdBytes) {
+        return G_SOURCE_CONTINUE;
+      }
+    }
+  }
+  self->idle_source_ = 0;
+  return G_SOURCE_REMOVE;
+}
+
+size_t BufferPool::Trim(TrimLevel level) {
+  std::vector<Block> freed;
+  size_t released = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (level < TrimLevel::kMedium) {
+      return AdviseIdle(G_MAXINT64);
+    }
+    for (std::vector<FreeBlock>& free_list : free_blocks_) {
+      for (const FreeBlock& free_block : free_list) {
+        if (!free_block.advised) {
+          released += free_block.block.capacity;
+        }
+        freed.push_back(free_block.block);
+      }
+      free_list.clear();
+    }
+  }
+  for (const Block& block : freed) {
+    Free(block);
+  }
+  return released;
+}
+
+size_t BufferPool::free_resident_bytes() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t bytes = 0;
+  for (const std::vector<FreeBlock>& free_list : free_blocks_) {
+    for (const FreeBlock& free_block : free_list) {
+      if (!free_block.advised) {
+        bytes += free_block.block.capacity;
+      }
+    }
+  }
+  return bytes;
+}
+
+PooledBuffer::PooledBuffer(PooledBuffer&& other) noexcept
+    : block_(std::exchange(other.block_, {})),
+      size_(std::exchange(other.size_, 0)) {}
+
+PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    block_ = std::exchange(other.block_, {});
+    size_ = std::exchange(other.size_, 0);
+  }
+  return *this;
+}
+
+bool PooledBuffer::Append(const uint8_t* bytes, size_t count) {
+  if (count == 0) {
+    return true;
+  }
+  if (size_ + count > block_.capacity) {
+    // Grow geometrically so that streamed encoder output is copied O(log n)
+    // times.
+    size_t capacity = std::max(size_ + count, block_.capacity * 2);
+    BufferPool::Block grown = BufferPool::Get()->Acquire(capacity);
+    if (grown.data == nullptr) {
+      return false;
+    }
+    if (size_ > 0) {
+      memcpy(grown.data, block_.data, size_);
+    }
+    BufferPool::Get()->Return(std::exchange(block_, grown));
+  }
+  memcpy(block_.data + size_, bytes, count);
+  size_ += count;
+  return true;
+}
+
+bool PooledBuffer::Assign(const uint8_t* bytes, size_t count) {
+  size_ = 0;
+  return Append(bytes, count);
+}
+
+bool PooledBuffer::ShrinkToFit() {
+  if (size_ == 0) {
+    Reset();
+    return true;
+  }
+  if (size_ >= BufferPool::kMinClassBytes || size_ == block_.capacity) {
+    return true;
+  }
+  BufferPool::Block exact = BufferPool::Get()->Acquire(size_);
+  if (exact.data == nullptr) {
+    return false;
+  }
+  memcpy(exact.data, block_.data, size_);
+  BufferPool::Get()->Return(std::exchange(block_, exact));
+  return true;
+}
+
+void PooledBuffer::Reset() {
+  BufferPool::Get()->Return(std::exchange(block_, {}));
+  size_ = 0;
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,140 @@
+#ifndef FLUTTER_PLUGIN_BUFFER_POOL_H_
+#define FLUTTER_PLUGIN_BUFFER_POOL_H_
+
+#include <glib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "memory_trimmer.h"
+
+namespace flutter_paste_input {
+
+// Size-classed pool of byte buffers for paste payloads.
+//
+// Pastes allocate and free buffers of several MB each (encoder output,
+// text copies), which fragments the heap and keeps RSS high long after
+// the paste. The pool keeps a few free buffers per power-of-two class for
+// reuse instead. Classes from kMmapThresholdBytes on are mapped directly,
+// and once they have been idle for kIdleSeconds their pages are handed
+// back with MADV_DONTNEED while the mapping stays around for reuse.
+//
+// Requests below kMinClassBytes, such as compressed history text or image
+// tiles, are not pooled: they are allocated at their exact size and freed
+// when returned, so holding many of them costs what they hold.
+//
+// Thread safe: the encoder fills buffers on the GIO worker pool.
+class BufferPool {
+ public:
+  struct Block {
+    uint8_t* data = nullptr;
+    size_t capacity = 0;
+  };
+
+  static constexpr size_t kMinClassBytes = 64 * 1024;
+  static constexpr size_t kMaxClassBytes = 256 * 1024 * 1024;
+  static constexpr size_t kMmapThresholdBytes = 1024 * 1024;
+  static constexpr guint kIdleSeconds = 5;
+
+  // Free buffers kept per class; further returns are freed.
+  static constexpr size_t kMaxFreePerClass = 2;
+
+  // Returns the process-wide pool.
+  static BufferPool* Get();
+
+  BufferPool();
+
+  // Disallow copy and assign.
+  BufferPool(const BufferPool&) = delete;
+  BufferPool& operator=(const BufferPool&) = delete;
+
+  // Returns a block of at least |min_capacity| bytes with unspecified
+  // content, or an empty block if memory is exhausted. Requests below the
+  // smallest class or beyond the largest one are allocated on their own
+  // and never pooled.
+  Block Acquire(size_t min_capacity);
+  void Return(Block block);
+
+  // Releases free buffers: at TrimLevel::kLow the pages of mapped ones,
+  // from kMedium on the buffers themselves. Returns the resident bytes
+  // released.
+  size_t Trim(TrimLevel level);
+
+  // Bytes held in free buffers, excluding pages already handed back.
+  size_t free_resident_bytes();
+
+ private:
+  struct FreeBlock {
+    Block block;
+    gint64 returned_at;
+    bool advised;
+  };
+
+  static gboolean OnIdleCheck(gpointer user_data);
+
+  static size_t ClassIndex(size_t capacity);
+  static size_t ClassBytes(size_t index);
+  static Block Allocate(size_t capacity);
+  static void Free(Block block);
+
+  // Hands back the pages of free mapped blocks idle since before
+  // |idle_before|. Returns the bytes advised. Requires |mutex_|.
+  size_t AdviseIdle(gint64 idle_before);
+
+  std::mutex mutex_;
+  std::vector<std::vector<FreeBlock>> free_blocks_;
+  guint idle_source_ = 0;
+};
+
+// Growable byte buffer backed by the BufferPool, returned to it when the
+// buffer is destroyed or reset. Move-only.
+class PooledBuffer {
+ public:
+  PooledBuffer() = default;
+  ~PooledBuffer() { Reset(); }
+
+  PooledBuffer(PooledBuffer&& other) noexcept;
+  PooledBuffer& operator=(PooledBuffer&& other) noexcept;
+
+  // Disallow copy and assign.
+  PooledBuffer(const PooledBuffer&) = delete;
+  PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+  const uint8_t* data() const { return block_.data; }
+  size_t size() const { return size_; }
+  size_t capacity() const { return block_.capacity; }
+  bool empty() const { return size_ == 0; }
+
+  // Appends |count| bytes, growing into a larger class if needed. Returns
+  // false, leaving the buffer unchanged, if memory is exhausted.
+  bool Append(const uint8_t* bytes, size_t count);
+
+  // Replaces the content with |count| bytes.
+  bool Assign(const uint8_t* bytes, size_t count);
+
+  // Drops the content past the first |size| bytes, keeping the block.
+  void Truncate(size_t size) {
+    if (size < size_) {
+      size_ = size;
+    }
+  }
+
+  // Moves content below BufferPool::kMinClassBytes into a block of its
+  // exact size, for buffers that are kept around. Larger content keeps its
+  // pooled block. Returns false, leaving the buffer unchanged, if memory
+  // is exhausted.
+  bool ShrinkToFit();
+
+  // Empties the buffer and returns its block to the pool.
+  void Reset();
+
+ private:
+  BufferPool::Block block_;
+  size_t size_ = 0;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_BUFFER_POOL_H_
@@ -0,0 +1,948 @@
+#include "clipboard_history.h"
+
+#include <gio/gio.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+#include "content_hash.h"
+#include "paste_tracer.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+constexpr size_t kConvertChunkBytes = 16 * 1024;
+
+constexpr char kTextMimeType[] = "text/plain";
+constexpr char kTextIndexSuffix[] = ".tri";
+
+constexpr uint32_t kCompressedFlag = 1 << 0;
+constexpr uint32_t kImageFlag = 1 << 1;
+constexpr uint32_t kAlphaFlag = 1 << 2;
+constexpr uint32_t kTiledFlag = 1 << 3;
+
+// HistoryStore::Record::tags.
+constexpr uint32_t kTileTag = 1 << 0;
+constexpr uint32_t kTiledEntryTag = 1 << 1;
+
+constexpr char kTiledMimeType[] = "image/png";
+
+// Precedes every item of a stored entry, followed by the MIME type and the
+// data. Host byte order.
+struct StoredItemHeader {
+  uint32_t flags;
+  uint32_t mime_type_size;
+  uint64_t original_size;
+  uint64_t data_size;
+  int64_t width;
+  int64_t height;
+  int64_t frame_count;
+  int64_t original_byte_size;
+};
+
+// Runs |data| through |converter| into |out|, failing once the output
+// would exceed |max_output| bytes.
+bool Convert(GConverter* converter, const uint8_t* data, size_t size,
+             size_t max_output, PooledBuffer* out) {
+  uint8_t chunk[kConvertChunkBytes];
+  size_t consumed = 0;
+  out->Reset();
+  while (true) {
+    gsize bytes_read = 0;
+    gsize bytes_written = 0;
+    GError* error = nullptr;
+    GConverterResult result = g_converter_convert(
+        converter, data + consumed, size - consumed, chunk, sizeof(chunk),
+        G_CONVERTER_INPUT_AT_END, &bytes_read, &bytes_written, &error);
+    if (result == G_CONVERTER_ERROR) {
+      g_error_free(error);
+      out->Reset();
+      return false;
+    }
+    consumed += bytes_read;
+    if (out->size() + bytes_written > max_output ||
+        !out->Append(chunk, bytes_written)) {
+      out->Reset();
+      return false;
+    }
+    if (result == G_CONVERTER_FINISHED) {
+      return true;
+    }
+  }
+}
+
+bool HasText(const std::vector<std::string>& mime_types) {
+  return std::find(mime_types.begin(), mime_types.end(), kTextMimeType) != mime_types.end();
+}
+
+// Splits |query| at ASCII whitespace into case-folded terms.
+std::vector<std::string> SearchTerms(const std::string& query) {
+  std::vector<std::string> terms;
+  std::string term;
+  for (char c : query) {
+    if (g_ascii_isspace(c)) {
+      if (!term.empty()) {
+        terms.push_back(std::move(term));
+        term.clear();
+      }
+      continue;
+    }
+    term.push_back(static_cast<char>(TrigramIndex::Fold(static_cast<uint8_t>(c))));
+  }
+  if (!term.empty()) {
+    terms.push_back(std::move(term));
+  }
+  return terms;
+}
+
+// Converts |spans| from byte offsets into UTF-8 |text| to UTF-16 offsets.
+void SpansToUtf16(const uint8_t* text, size_t size,
+                  std::vector<std::pair<size_t, size_t>>* spans) {
+  std::vector<size_t*> offsets;
+  offsets.reserve(spans->size() * 2);
+  for (auto& span : *spans) {
+    offsets.push_back(&span.first);
+    offsets.push_back(&span.second);
+  }
+  std::sort(offsets.begin(), offsets.end(), [](size_t* a, size_t* b) { return *a < *b; });
+  size_t position = 0;
+  size_t units = 0;
+  for (size_t* offset : offsets) {
+    for (; position < *offset && position < size; position++) {
+      uint8_t c = text[position];
+      // Four-byte sequences become surrogate pairs.
+      if ((c & 0xc0) != 0x80) {
+        units += c >= 0xf0 ? 2 : 1;
+      }
+    }
+    *offset = units;
+  }
+}
+
+}  // namespace
+
+bool DeflateBytes(const uint8_t* data, size_t size, PooledBuffer* out) {
+  GZlibCompressor* compressor =
+      g_zlib_compressor_new(G_ZLIB_COMPRESSOR_FORMAT_ZLIB, -1);
+  // Anything not smaller than the input is not worth keeping.
+  bool ok = size > 0 && Convert(G_CONVERTER(compressor), data, size, size - 1, out);
+  g_object_unref(compressor);
+  return ok;
+}
+
+bool InflateBytes(const uint8_t* data, size_t size, size_t original_size,
+                  PooledBuffer* out) {
+  GZlibDecompressor* decompressor =
+      g_zlib_decompressor_new(G_ZLIB_COMPRESSOR_FORMAT_ZLIB);
+  bool ok = Convert(G_CONVERTER(decompressor), data, size, original_size, out) &&
+            out->size() == original_size;
+  g_object_unref(decompressor);
+  if (!ok) {
+    out->Reset();
+  }
+  return ok;
+}
+
+struct ClipboardHistory::TilingJob {
+  struct Image {
+    size_t index = 0;
+    PooledBuffer encoded;
+    TilePool::Map map;
+    bool ok = false;
+  };
+
+  std::shared_ptr<ClipboardHistory*> history;
+  std::shared_ptr<TilePool> tiles;
+  int64_t id = 0;
+  std::vector<Image> images;
+};
+
+ClipboardHistory::ClipboardHistory(size_t max_entries, size_t max_bytes)
+    : max_entries_(max_entries),
+      max_bytes_(max_bytes),
+      next_id_(g_get_real_time()),
+      tiles_(std::make_shared<TilePool>()),
+      self_(std::make_shared<ClipboardHistory*>(this)) {}
+
+ClipboardHistory::~ClipboardHistory() {
+  *self_ = nullptr;
+  // Entries still being split are stored as they are.
+  if (store_) {
+    for (Entry& entry : entries_) {
+      if (entry.tiling && entry.disk_bytes == 0) {
+        Persist(&entry);
+      }
+    }
+  }
+}
+
+// static
+bool ClipboardHistory::FillItems(const ClipboardSnapshot& snapshot, Entry* entry) {
+  entry->items.clear();
+  entry->stored_bytes = 0;
+  for (const SnapshotItem& source : snapshot.items) {
+    Item item;
+    item.mime_type = source.mime_type;
+    item.original_size = source.data.size();
+    item.is_image = source.is_image;
+    item.width = source.width;
+    item.height = source.height;
+    item.has_alpha = source.has_alpha;
+    item.frame_count = source.frame_count;
+    item.original_byte_size = source.original_byte_size;
+    if (!source.is_image && source.data.size() >= kMinCompressBytes &&
+        DeflateBytes(source.data.data(), source.data.size(), &item.data)) {
+      item.compressed = true;
+    } else if (!item.data.Assign(source.data.data(), source.data.size())) {
+      entry->items.clear();
+      entry->stored_bytes = 0;
+      return false;
+    }
+    // Kept for long, so without the slack of the deflate output.
+    item.data.ShrinkToFit();
+    entry->stored_bytes += item.data.capacity();
+    entry->items.push_back(std::move(item));
+  }
+  return true;
+}
+
+// static
+bool ClipboardHistory::SerializeItems(const std::vector<Item>& items, PooledBuffer* out) {
+  for (const Item& item : items) {
+    StoredItemHeader header = {};
+    header.flags = (item.compressed ? kCompressedFlag : 0) | (item.is_image ? kImageFlag : 0) |
+                   (item.has_alpha ? kAlphaFlag : 0) | (item.tiled ? kTiledFlag : 0);
+    header.mime_type_size = static_cast<uint32_t>(item.mime_type.size());
+    header.original_size = item.original_size;
+    header.data_size = item.data.size();
+    header.width = item.width;
+    header.height = item.height;
+    header.frame_count = item.frame_count;
+    header.original_byte_size = item.original_byte_size;
+    if (!out->Append(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) ||
+        !out->Append(reinterpret_cast<const uint8_t*>(item.mime_type.data()),
+                     item.mime_type.size()) ||
+        !out->Append(item.data.data(), item.data.size())) {
+      out->Reset();
+      return false;
+    }
+  }
+  return true;
+}
+
+// static
+bool ClipboardHistory::ParseItems(const uint8_t* data, size_t size, std::vector<Item>* items) {
+  size_t offset = 0;
+  while (offset < size) {
+    StoredItemHeader header;
+    if (size - offset < sizeof(header)) {
+      return false;
+    }
+    memcpy(&header, data + offset, sizeof(header));
+    offset += sizeof(header);
+    if (size - offset < header.mime_type_size ||
+        size - offset - header.mime_type_size < header.data_size) {
+      return false;
+    }
+    Item item;
+    item.mime_type.assign(reinterpret_cast<const char*>(data + offset), header.mime_type_size);
+    offset += header.mime_type_size;
+    if (!item.data.Assign(data + offset, header.data_size)) {
+      return false;
+    }
+    offset += header.data_size;
+    item.original_size = header.original_size;
+    item.compressed = (header.flags & kCompressedFlag) != 0;
+    item.is_image = (header.flags & kImageFlag) != 0;
+    item.has_alpha = (header.flags & kAlphaFlag) != 0;
+    item.tiled = (header.flags & kTiledFlag) != 0;
+    item.width = header.width;
+    item.height = header.height;
+    item.frame_count = header.frame_count;
+    item.original_byte_size = header.original_byte_size;
+    items->push_back(std::move(item));
+  }
+  return !items->empty();
+}
+
+SnapshotPtr ClipboardHistory::BuildSnapshot(const Entry& entry,
+                                            const std::vector<Item>& items) {
+  auto snapshot = std::make_shared<ClipboardSnapshot>();
+  snapshot->change_count = entry.change_count;
+  snapshot->completed_at = g_get_monotonic_time();
+  for (const Item& source : items) {
+    SnapshotItem item;
+    bool ok;
+    if (source.tiled) {
+      TilePool::Map map;
+      GdkPixbuf* pixbuf =
+          map.Parse(source.data.data(), source.data.size())
+              ? TilePool::Assemble(map, [this](uint64_t hash, PooledBuffer* blob) {
+                  return ReadTileBlob(hash, blob);
+                })
+              : nullptr;
+      ok = pixbuf != nullptr && EncodePixbufAsPng(pixbuf, &item);
+      if (pixbuf != nullptr) {
+        g_object_unref(pixbuf);
+      }
+    } else if (source.compressed) {
+      ok = InflateBytes(source.data.data(), source.data.size(), source.original_size,
+                        &item.data);
+    } else {
+      ok = item.data.Assign(source.data.data(), source.data.size());
+    }
+    if (!ok) {
+      g_warning("FlutterPasteInput: Failed to restore clipboard history entry %" G_GINT64_FORMAT,
+                static_cast<gint64>(entry.id));
+      return nullptr;
+    }
+    item.mime_type = source.mime_type;
+    item.original_byte_size = source.original_byte_size;
+    item.is_image = source.is_image;
+    item.width = source.width;
+    item.height = source.height;
+    item.has_alpha = source.has_alpha;
+    item.frame_count = source.frame_count;
+    snapshot->items.push_back(std::move(item));
+  }
+  snapshot->peak_bytes = static_cast<int64_t>(SnapshotByteSize(*snapshot));
+  return snapshot;
+}
+
+int64_t ClipboardHistory::Record(const ClipboardSnapshot& snapshot) {
+  if (max_entries_ == 0 || snapshot.items.empty() || !snapshot.error_code.empty()) {
+    return 0;
+  }
+
+  gint64 now_ms = g_get_real_time() / 1000;
+  uint64_t content_hash = SnapshotContentHash(snapshot);
+  auto existing = by_hash_.find(content_hash);
+  if (existing != by_hash_.end()) {
+    EntryList::iterator it = existing->second;
+    it->captured_at_ms = now_ms;
+    it->change_count = snapshot.change_count;
+    // Content read back from the store becomes resident again for free.
+    if (it->items.empty() && FillItems(snapshot, &*it)) {
+      stored_bytes_ += it->stored_bytes;
+      StartTiling(&*it);
+    }
+    if (store_) {
+      store_->Touch(it->id, now_ms);
+    }
+    entries_.splice(entries_.begin(), entries_, it);
+    int64_t id = it->id;
+    EvictToLimits();
+    return id;
+  }
+
+  Entry entry;
+  entry.id = next_id_;
+  entry.content_hash = content_hash;
+  entry.captured_at_ms = now_ms;
+  entry.change_count = snapshot.change_count;
+  for (const SnapshotItem& item : snapshot.items) {
+    entry.mime_types.push_back(item.mime_type);
+    entry.byte_size += item.data.size();
+  }
+  if (!FillItems(snapshot, &entry)) {
+    return 0;
+  }
+  if (!store_ && max_bytes_ != 0 && entry.stored_bytes > max_bytes_) {
+    return 0;
+  }
+
+  next_id_++;
+  stored_bytes_ += entry.stored_bytes;
+  entries_.push_front(std::move(entry));
+  by_hash_[content_hash] = entries_.begin();
+  by_id_[entries_.front().id] = entries_.begin();
+  for (const SnapshotItem& item : snapshot.items) {
+    if (item.mime_type == kTextMimeType) {
+      text_index_.Add(entries_.front().id, item.data.data(), item.data.size());
+      break;
+    }
+  }
+  if (!StartTiling(&entries_.front()) && store_) {
+    Persist(&entries_.front());
+  }
+  int64_t id = entries_.front().id;
+  EvictToLimits();
+  return by_id_.count(id) != 0 ? id : 0;
+}
+
+std::vector<HistoryEntryInfo> ClipboardHistory::List() const {
+  std::vector<HistoryEntryInfo> infos;
+  infos.reserve(entries_.size());
+  for (const Entry& entry : entries_) {
+    HistoryEntryInfo info;
+    info.id = entry.id;
+    info.captured_at_ms = entry.captured_at_ms;
+    info.mime_types = entry.mime_types;
+    info.byte_size = entry.byte_size;
+    infos.push_back(std::move(info));
+  }
+  return infos;
+}
+
+SnapshotPtr ClipboardHistory::Fetch(int64_t id) {
+  auto found = by_id_.find(id);
+  if (found == by_id_.end()) {
+    return nullptr;
+  }
+  const Entry& entry = *found->second;
+  if (!entry.items.empty()) {
+    return BuildSnapshot(entry, entry.items);
+  }
+
+  // Dropped from memory; only read back for this request.
+  std::vector<Item> items;
+  if (!ReadStoredItems(id, &items)) {
+    return nullptr;
+  }
+  return BuildSnapshot(entry, items);
+}
+
+std::vector<HistorySearchMatch> ClipboardHistory::Search(const std::string& query,
+                                                         size_t max_results) {
+  std::vector<std::string> terms = SearchTerms(query);
+  if (terms.empty() || max_results == 0) {
+    return {};
+  }
+  IndexPending();
+
+  std::vector<int64_t> candidates = text_index_.Candidates(terms[0]);
+  for (size_t i = 1; i < terms.size() && !candidates.empty(); i++) {
+    std::vector<int64_t> ids = text_index_.Candidates(terms[i]);
+    std::vector<int64_t> kept;
+    std::set_intersection(candidates.begin(), candidates.end(), ids.begin(), ids.end(),
+                          std::back_inserter(kept));
+    candidates = std::move(kept);
+  }
+
+  // Trigrams may come from different places in the text, so every
+  // candidate is scanned.
+  std::vector<HistorySearchMatch> matches;
+  PooledBuffer text;
+  std::string folded;
+  for (int64_t id : candidates) {
+    auto found = by_id_.find(id);
+    if (found == by_id_.end() || !ReadText(*found->second, &text)) {
+      continue;
+    }
+    folded.resize(text.size());
+    for (size_t i = 0; i < text.size(); i++) {
+      folded[i] = static_cast<char>(TrigramIndex::Fold(text.data()[i]));
+    }
+
+    HistorySearchMatch match;
+    match.id = id;
+    for (const std::string& term : terms) {
+      size_t count = 0;
+      for (size_t position = folded.find(term); position != std::string::npos;
+           position = folded.find(term, position + term.size())) {
+        if (match.spans.size() < kMaxSearchSpans) {
+          match.spans.emplace_back(position, position + term.size());
+        }
+        count++;
+      }
+      if (count == 0) {
+        match.match_count = 0;
+        break;
+      }
+      match.match_count += count;
+    }
+    if (match.match_count == 0) {
+      continue;
+    }
+    std::sort(match.spans.begin(), match.spans.end());
+    SpansToUtf16(text.data(), text.size(), &match.spans);
+    matches.push_back(std::move(match));
+  }
+
+  std::sort(matches.begin(), matches.end(),
+            [this](const HistorySearchMatch& a, const HistorySearchMatch& b) {
+              if (a.match_count != b.match_count) {
+                return a.match_count > b.match_count;
+              }
+              return by_id_[a.id]->captured_at_ms > by_id_[b.id]->captured_at_ms;
+            });
+  if (matches.size() > max_results) {
+    matches.resize(max_results);
+  }
+  return matches;
+}
+
+bool ClipboardHistory::ReadText(const Entry& entry, PooledBuffer* text) {
+  text->Reset();
+  std::vector<Item> stored;
+  const std::vector<Item>* items = &entry.items;
+  if (items->empty()) {
+    if (!ReadStoredItems(entry.id, &stored)) {
+      return false;
+    }
+    items = &stored;
+  }
+  for (const Item& item : *items) {
+    if (item.mime_type != kTextMimeType) {
+      continue;
+    }
+    return item.compressed
+               ? InflateBytes(item.data.data(), item.data.size(), item.original_size, text)
+               : text->Assign(item.data.data(), item.data.size());
+  }
+  return false;
+}
+
+void ClipboardHistory::IndexPending() {
+  PooledBuffer text;
+  for (int64_t id : unindexed_) {
+    auto found = by_id_.find(id);
+    if (found != by_id_.end() && ReadText(*found->second, &text)) {
+      text_index_.Add(id, text.data(), text.size());
+    }
+  }
+  unindexed_.clear();
+}
+
+bool ClipboardHistory::ReadStoredItems(int64_t id, std::vector<Item>* items) {
+  PooledBuffer payload;
+  return store_ && store_->Read(id, &payload) &&
+         ParseItems(payload.data(), payload.size(), items);
+}
+
+bool ClipboardHistory::StartTiling(Entry* entry) {
+  auto job = std::make_unique<TilingJob>();
+  for (size_t i = 0; i < entry->items.size(); i++) {
+    const Item& item = entry->items[i];
+    if (!item.is_image || item.tiled || item.mime_type != kTiledMimeType ||
+        item.frame_count > 1 || item.width * item.height < TilePool::kMinPixels) {
+      continue;
+    }
+    // Copied, as the entry may be dropped before the job is done.
+    TilingJob::Image image;
+    image.index = i;
+    if (image.encoded.Assign(item.data.data(), item.data.size())) {
+      job->images.push_back(std::move(image));
+    }
+  }
+  if (job->images.empty()) {
+    return false;
+  }
+  job->history = self_;
+  job->tiles = tiles_;
+  job->id = entry->id;
+  entry->tiling = true;
+
+  GTask* task = g_task_new(nullptr, nullptr, OnTilingDone, nullptr);
+  g_task_set_task_data(task, job.release(),
+                       [](gpointer job) { delete static_cast<TilingJob*>(job); });
+  // Yield to paste encodes queued on the same pool.
+  g_task_set_priority(task, G_PRIORITY_LOW);
+  g_task_run_in_thread(task, TileInThread);
+  g_object_unref(task);
+  return true;
+}
+
+// static
+void ClipboardHistory::TileInThread(GTask* task, gpointer source_object, gpointer task_data,
+                                    GCancellable* cancellable) {
+  TraceScope trace("history-tile");
+  TilingJob* job = static_cast<TilingJob*>(task_data);
+  for (TilingJob::Image& image : job->images) {
+    GdkPixbuf* pixbuf = DecodePixbuf(image.encoded.data(), image.encoded.size());
+    image.encoded.Reset();
+    if (pixbuf != nullptr) {
+      image.ok = job->tiles->AddImage(pixbuf, &image.map);
+      g_object_unref(pixbuf);
+    }
+  }
+  g_task_return_boolean(task, TRUE);
+}
+
+// static
+void ClipboardHistory::OnTilingDone(GObject* source_object, GAsyncResult* result,
+                                    gpointer data) {
+  TilingJob* job = static_cast<TilingJob*>(g_task_get_task_data(G_TASK(result)));
+  ClipboardHistory* self = *job->history;
+  if (self != nullptr) {
+    self->FinishTiling(job);
+    return;
+  }
+  for (const TilingJob::Image& image : job->images) {
+    if (image.ok) {
+      job->tiles->Release(image.map);
+    }
+  }
+}
+
+void ClipboardHistory::FinishTiling(TilingJob* job) {
+  auto found = by_id_.find(job->id);
+  Entry* entry = found != by_id_.end() ? &*found->second : nullptr;
+  // Dropped from memory or from the history meanwhile.
+  bool keep = entry != nullptr && entry->tiling && !entry->items.empty();
+  if (entry != nullptr) {
+    entry->tiling = false;
+  }
+  for (TilingJob::Image& image : job->images) {
+    if (!image.ok) {
+      continue;
+    }
+    PooledBuffer data;
+    if (!keep || image.index >= entry->items.size() || entry->items[image.index].tiled ||
+        !image.map.Serialize(&data)) {
+      tiles_->Release(image.map);
+      continue;
+    }
+    data.ShrinkToFit();
+    Item& item = entry->items[image.index];
+    stored_bytes_ -= item.data.capacity();
+    entry->stored_bytes -= item.data.capacity();
+    item.data = std::move(data);
+    item.tiled = true;
+    stored_bytes_ += item.data.capacity();
+    entry->stored_bytes += item.data.capacity();
+  }
+  if (keep && store_ && entry->disk_bytes == 0) {
+    Persist(entry);
+  }
+  EvictToLimits();
+}
+
+size_t ClipboardHistory::ReleaseTiles(const std::vector<Item>& items) {
+  size_t released = 0;
+  for (const Item& item : items) {
+    TilePool::Map map;
+    if (item.tiled && map.Parse(item.data.data(), item.data.size())) {
+      released += tiles_->Release(map);
+    }
+  }
+  return released;
+}
+
+bool ClipboardHistory::ReadTileBlob(uint64_t hash, PooledBuffer* blob) {
+  if (tiles_->Lookup(hash, blob)) {
+    return true;
+  }
+  auto found = disk_tiles_.find(hash);
+  return store_ && found != disk_tiles_.end() && store_->Read(found->second.id, blob);
+}
+
+void ClipboardHistory::PersistTiles(const Item& item) {
+  TilePool::Map map;
+  if (!map.Parse(item.data.data(), item.data.size())) {
+    return;
+  }
+  for (uint64_t hash : map.tiles) {
+    auto found = disk_tiles_.find(hash);
+    if (found != disk_tiles_.end()) {
+      found->second.refs++;
+      continue;
+    }
+    PooledBuffer blob;
+    if (!tiles_->Lookup(hash, &blob)) {
+      continue;
+    }
+    DiskTile tile;
+    tile.id = next_id_++;
+    tile.refs = 1;
+    tile.bytes = blob.size();
+    disk_tiles_[hash] = tile;
+    disk_bytes_ += tile.bytes;
+
+    HistoryStore::Record record;
+    record.id = tile.id;
+    record.content_hash = hash;
+    record.byte_size = blob.size();
+    record.tags = kTileTag;
+    store_->Append(std::move(record), std::move(blob));
+  }
+}
+
+void ClipboardHistory::ReleaseDiskTiles(const Entry& entry) {
+  CountDiskTileRefs();
+  std::vector<Item> items;
+  if (!ReadStoredItems(entry.id, &items)) {
+    return;
+  }
+  for (const Item& item : items) {
+    TilePool::Map map;
+    if (!item.tiled || !map.Parse(item.data.data(), item.data.size())) {
+      continue;
+    }
+    for (uint64_t hash : map.tiles) {
+      auto found = disk_tiles_.find(hash);
+      if (found == disk_tiles_.end() || --found->second.refs > 0) {
+        continue;
+      }
+      store_->Remove(found->second.id);
+      disk_bytes_ -= found->second.bytes;
+      disk_tiles_.erase(found);
+    }
+  }
+}
+
+void ClipboardHistory::CountDiskTileRefs() {
+  if (disk_tile_refs_counted_) {
+    return;
+  }
+  disk_tile_refs_counted_ = true;
+  for (auto& tile : disk_tiles_) {
+    tile.second.refs = 0;
+  }
+  // Tile maps are small; the tiles themselves are not read.
+  for (const Entry& entry : entries_) {
+    std::vector<Item> items;
+    if (!entry.disk_tiled || !ReadStoredItems(entry.id, &items)) {
+      continue;
+    }
+    for (const Item& item : items) {
+      TilePool::Map map;
+      if (!item.tiled || !map.Parse(item.data.data(), item.data.size())) {
+        continue;
+      }
+      for (uint64_t hash : map.tiles) {
+        auto found = disk_tiles_.find(hash);
+        if (found != disk_tiles_.end()) {
+          found->second.refs++;
+        }
+      }
+    }
+  }
+  // Left behind by entries removed before a crash.
+  for (auto it = disk_tiles_.begin(); it != disk_tiles_.end();) {
+    if (it->second.refs != 0) {
+      ++it;
+      continue;
+    }
+    store_->Remove(it->second.id);
+    disk_bytes_ -= it->second.bytes;
+    it = disk_tiles_.erase(it);
+  }
+}
+
+void ClipboardHistory::Persist(Entry* entry) {
+  PooledBuffer payload;
+  if (!SerializeItems(entry->items, &payload)) {
+    return;
+  }
+  HistoryStore::Record record;
+  record.id = entry->id;
+  record.content_hash = entry->content_hash;
+  record.captured_at_ms = entry->captured_at_ms;
+  record.mime_types = entry->mime_types;
+  record.byte_size = entry->byte_size;
+  for (const Item& item : entry->items) {
+    if (item.tiled) {
+      PersistTiles(item);
+      record.tags |= kTiledEntryTag;
+    }
+  }
+  entry->disk_tiled = (record.tags & kTiledEntryTag) != 0;
+  entry->disk_bytes = payload.size();
+  disk_bytes_ += entry->disk_bytes;
+  store_->Append(std::move(record), std::move(payload));
+}
+
+void ClipboardHistory::OnWriteFailed(int64_t id) {
+  auto found = by_id_.find(id);
+  if (found == by_id_.end()) {
+    for (auto tile = disk_tiles_.begin(); tile != disk_tiles_.end(); ++tile) {
+      if (tile->second.id == id) {
+        disk_bytes_ -= tile->second.bytes;
+        disk_tiles_.erase(tile);
+        return;
+      }
+    }
+    return;
+  }
+
+  Entry& entry = *found->second;
+  disk_bytes_ -= entry.disk_bytes;
+  entry.disk_bytes = 0;
+  if (entry.disk_tiled) {
+    // Its tile references are recounted from the entries that made it.
+    entry.disk_tiled = false;
+    disk_tile_refs_counted_ = false;
+  }
+  if (entry.items.empty()) {
+    Erase(found->second);
+  }
+}
+
+size_t ClipboardHistory::DropItems(Entry* entry) {
+  size_t released = entry->stored_bytes + ReleaseTiles(entry->items);
+  stored_bytes_ -= entry->stored_bytes;
+  entry->items.clear();
+  entry->stored_bytes = 0;
+  entry->tiling = false;
+  return released;
+}
+
+size_t ClipboardHistory::Erase(EntryList::iterator it) {
+  if (store_ && it->disk_bytes != 0) {
+    if (it->disk_tiled) {
+      ReleaseDiskTiles(*it);
+    }
+    store_->Remove(it->id);
+  }
+  size_t released = it->stored_bytes + ReleaseTiles(it->items);
+  stored_bytes_ -= it->stored_bytes;
+  disk_bytes_ -= it->disk_bytes;
+  text_index_.Remove(it->id);
+  unindexed_.erase(it->id);
+  by_hash_.erase(it->content_hash);
+  by_id_.erase(it->id);
+  entries_.erase(it);
+  return released;
+}
+
+void ClipboardHistory::EvictToLimits() {
+  while (!entries_.empty() &&
+         (entries_.size() > max_entries_ ||
+          (max_disk_bytes_ != 0 && disk_bytes_ > max_disk_bytes_))) {
+    Erase(std::prev(entries_.end()));
+  }
+
+  // Persisted entries only leave memory; others leave the history.
+  auto it = entries_.end();
+  while (max_bytes_ != 0 && stored_bytes() > max_bytes_ && it != entries_.begin()) {
+    --it;
+    if (it->disk_bytes != 0) {
+      DropItems(&*it);
+    } else if (it->tiling && store_) {
+      // Persisted, and dropped if need be, once split.
+      continue;
+    } else if (!it->items.empty()) {
+      EntryList::iterator erased = it++;
+      Erase(erased);
+    }
+  }
+}
+
+size_t ClipboardHistory::Clear() {
+  size_t released = 0;
+  while (!entries_.empty()) {
+    released += Erase(entries_.begin());
+  }
+  return released;
+}
+
+size_t ClipboardHistory::Trim(TrimLevel level) {
+  if (level < TrimLevel::kMedium || entries_.empty()) {
+    return 0;
+  }
+  if (!store_ && level >= TrimLevel::kCritical) {
+    return Clear();
+  }
+  size_t released = 0;
+  auto keep = level >= TrimLevel::kCritical ? entries_.begin() : std::next(entries_.begin());
+  for (auto it = keep; it != entries_.end();) {
+    if (it->disk_bytes != 0) {
+      released += DropItems(&*it);
+      ++it;
+    } else {
+      EntryList::iterator erased = it++;
+      released += Erase(erased);
+    }
+  }
+  return released;
+}
+
+void ClipboardHistory::AttachStore(std::unique_ptr<HistoryStore> store) {
+  store_ = std::move(store);
+  store_->set_write_failed_listener([this](int64_t id) { OnWriteFailed(id); });
+  text_index_.Open(store_->SidecarPath(kTextIndexSuffix));
+
+  // Entries of earlier runs, listed from the index without their payload.
+  for (const HistoryStore::Record& record : store_->Records()) {
+    next_id_ = std::max(next_id_, record.id + 1);
+    if ((record.tags & kTileTag) != 0) {
+      if (!disk_tiles_.emplace(record.content_hash, DiskTile{record.id, 0, record.stored_bytes})
+               .second) {
+        store_->Remove(record.id);
+        continue;
+      }
+      disk_bytes_ += record.stored_bytes;
+      continue;
+    }
+    if (by_hash_.count(record.content_hash) != 0 || by_id_.count(record.id) != 0) {
+      // Recorded again in this run; the resident copy is persisted below.
+      store_->Remove(record.id);
+      continue;
+    }
+    Entry entry;
+    entry.id = record.id;
+    entry.content_hash = record.content_hash;
+    entry.captured_at_ms = record.captured_at_ms;
+    entry.mime_types = record.mime_types;
+    entry.byte_size = record.byte_size;
+    entry.disk_bytes = record.stored_bytes;
+    entry.disk_tiled = (record.tags & kTiledEntryTag) != 0;
+    disk_bytes_ += entry.disk_bytes;
+    entries_.push_back(std::move(entry));
+    by_hash_[record.content_hash] = std::prev(entries_.end());
+    by_id_[record.id] = std::prev(entries_.end());
+  }
+  disk_tile_refs_counted_ = false;
+  for (Entry& entry : entries_) {
+    if (entry.disk_bytes == 0 && !entry.tiling) {
+      Persist(&entry);
+    }
+  }
+
+  // Keeps the iterators in the maps valid.
+  entries_.sort([](const Entry& a, const Entry& b) { return a.captured_at_ms > b.captured_at_ms; });
+  EvictToLimits();
+
+  // The saved index may be behind the store after a crash.
+  for (int64_t id : text_index_.Ids()) {
+    if (by_id_.count(id) == 0) {
+      text_index_.Remove(id);
+    }
+  }
+  for (const Entry& entry : entries_) {
+    if (HasText(entry.mime_types) && !text_index_.Contains(entry.id)) {
+      unindexed_.insert(entry.id);
+    }
+  }
+}
+
+std::unique_ptr<HistoryStore> ClipboardHistory::DetachStore() {
+  std::unique_ptr<HistoryStore> store = std::move(store_);
+  store->set_write_failed_listener(nullptr);
+  text_index_.Close();
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    it->disk_bytes = 0;
+    it->disk_tiled = false;
+    if (it->items.empty()) {
+      EntryList::iterator erased = it++;
+      Erase(erased);
+    } else {
+      ++it;
+    }
+  }
+  disk_bytes_ = 0;
+  disk_tiles_.clear();
+  disk_tile_refs_counted_ = false;
+  return store;
+}
+
+void ClipboardHistory::set_max_entries(size_t max_entries) {
+  max_entries_ = max_entries;
+  EvictToLimits();
+}
+
+void ClipboardHistory::set_max_bytes(size_t max_bytes) {
+  max_bytes_ = max_bytes;
+  EvictToLimits();
+}
+
+void ClipboardHistory::set_max_disk_bytes(size_t max_disk_bytes) {
+  max_disk_bytes_ = max_disk_bytes;
+  EvictToLimits();
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,294 @@
+#ifndef FLUTTER_PLUGIN_CLIPBOARD_HISTORY_H_
+#define FLUTTER_PLUGIN_CLIPBOARD_HISTORY_H_
+
+#include <glib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "buffer_pool.h"
+#include "clipboard_reader.h"
+#include "history_store.h"
+#include "memory_trimmer.h"
+#include "tile_pool.h"
+#include "trigram_index.h"
+
+namespace flutter_paste_input {
+
+// Metadata of one history entry, without its content.
+struct HistoryEntryInfo {
+  int64_t id = 0;
+  // Wall-clock time of the last capture, in milliseconds since the epoch.
+  int64_t captured_at_ms = 0;
+  std::vector<std::string> mime_types;
+  // Size of the content as pasted, before compression.
+  size_t byte_size = 0;
+};
+
+// An entry whose text matched a search.
+struct HistorySearchMatch {
+  int64_t id = 0;
+  // Occurrences of all terms.
+  size_t match_count = 0;
+  // [start, end) of the first matches, in UTF-16 code units, ascending.
+  std::vector<std::pair<size_t, size_t>> spans;
+};
+
+// Ring of the most recent clipboard snapshots, for "paste previous".
+//
+// Snapshots are deduplicated by a hash of their items: recording content
+// that is already in the history moves its entry to the front and keeps
+// its id. Text items are deflated with GLib's zlib converter and inflated
+// again when fetched; images are already compressed and kept as they are.
+// The oldest entries are dropped once the ring holds more than
+// |max_entries| entries or |max_bytes| bytes of stored data.
+//
+// With a HistoryStore attached every entry is also written to disk, and
+// entries recorded by earlier runs are listed from the store's index.
+// |max_bytes| then only bounds the payloads kept in memory: the oldest are
+// dropped from memory first and read back from the store when fetched,
+// and |max_disk_bytes| bounds the store.
+//
+// Large PNG images are split into tiles on the GIO worker pool after they
+// are recorded, and kept as a map of tiles in a TilePool shared by all
+// entries, so that near-identical screenshots cost their changed tiles
+// only. An entry is persisted once split, its new tiles as records of
+// their own. Fetching such an entry re-encodes the image as PNG.
+//
+// Text entries are indexed in a TrigramIndex as they are recorded, and the
+// index is saved next to the store. Search() only scans the text of the
+// entries the index lets through. Entries of the store missing from a
+// saved index, e.g. after a crash, are indexed on the first search.
+//
+// Main thread only.
+class ClipboardHistory {
+ public:
+  static constexpr size_t kDefaultMaxEntries = 50;
+  static constexpr size_t kDefaultMaxBytes = 32 * 1024 * 1024;
+  static constexpr size_t kDefaultMaxDiskBytes = 128 * 1024 * 1024;
+
+  // Text items shorter than this are stored as they are.
+  static constexpr size_t kMinCompressBytes = 256;
+
+  // Spans reported per search match.
+  static constexpr size_t kMaxSearchSpans = 64;
+
+  ClipboardHistory(size_t max_entries = kDefaultMaxEntries,
+                   size_t max_bytes = kDefaultMaxBytes);
+  ~ClipboardHistory();
+
+  // Disallow copy and assign.
+  ClipboardHistory(const ClipboardHistory&) = delete;
+  ClipboardHistory& operator=(const ClipboardHistory&) = delete;
+
+  // Records |snapshot| as the most recent entry. Snapshots without items,
+  // refused ones and ones larger than the whole ring are ignored. Returns
+  // the id of the entry, or 0 if nothing was recorded.
+  int64_t Record(const ClipboardSnapshot& snapshot);
+
+  // Entries, most recent first.
+  std::vector<HistoryEntryInfo> List() const;
+
+  // Rebuilds the snapshot of entry |id|, or returns nullptr if it is not
+  // in the history (any more).
+  SnapshotPtr Fetch(int64_t id);
+
+  // Returns up to |max_results| entries whose text contains every
+  // whitespace-separated term of |query|, ignoring ASCII case, those with
+  // the most occurrences first, then the most recent.
+  std::vector<HistorySearchMatch> Search(const std::string& query, size_t max_results);
+
+  // Drops every entry, from the store too. Returns the bytes of memory
+  // released.
+  size_t Clear();
+
+  // Without a store, drops all but the most recent entry at
+  // TrimLevel::kMedium, and every entry at kCritical. With one, only the
+  // payloads held in memory are dropped. Returns the bytes released.
+  size_t Trim(TrimLevel level);
+
+  // Persists the history in |store| from now on, and adds the entries it
+  // holds from earlier runs.
+  void AttachStore(std::unique_ptr<HistoryStore> store);
+
+  // Stops persisting the history. Entries only held by the store are
+  // dropped. Returns the store, or nullptr if none was attached.
+  std::unique_ptr<HistoryStore> DetachStore();
+
+  HistoryStore* store() { return store_.get(); }
+
+  // Shrinking a limit evicts right away. 0 entries disables the history;
+  // 0 bytes disables a byte limit.
+  void set_max_entries(size_t max_entries);
+  void set_max_bytes(size_t max_bytes);
+  void set_max_disk_bytes(size_t max_disk_bytes);
+
+  size_t size() const { return entries_.size(); }
+
+  // Bytes allocated for the item data held in memory, compressed where
+  // applicable, including pooled image tiles.
+  size_t stored_bytes() const { return stored_bytes_ + tiles_->stored_bytes(); }
+
+ private:
+  struct Item {
+    std::string mime_type;
+    PooledBuffer data;
+    // Size of |data| once inflated; equal to its size if not compressed.
+    size_t original_size = 0;
+    bool compressed = false;
+    // |data| is a TilePool::Map rather than the encoded image.
+    bool tiled = false;
+
+    bool is_image = false;
+    int64_t width = 0;
+    int64_t height = 0;
+    bool has_alpha = false;
+    int64_t frame_count = 0;
+    int64_t original_byte_size = 0;
+  };
+
+  struct Entry {
+    int64_t id = 0;
+    uint64_t content_hash = 0;
+    int64_t captured_at_ms = 0;
+    int64_t change_count = 0;
+    std::vector<std::string> mime_types;
+    size_t byte_size = 0;
+
+    // Empty once dropped from memory; the store holds the payload then.
+    std::vector<Item> items;
+    size_t stored_bytes = 0;
+
+    // Size of the payload in the store; 0 if not persisted.
+    size_t disk_bytes = 0;
+    // The stored payload refers to tiles in the store.
+    bool disk_tiled = false;
+
+    // Waiting for its images to be split; persisted afterwards.
+    bool tiling = false;
+  };
+
+  // A tile persisted in the store.
+  struct DiskTile {
+    int64_t id = 0;
+    // Occurrences in persisted entries; only exact once counted.
+    size_t refs = 0;
+    size_t bytes = 0;
+  };
+
+  // Splitting of the images of one entry, on the worker pool.
+  struct TilingJob;
+
+  using EntryList = std::list<Entry>;
+
+  // Copies the items of |snapshot| into |entry|, compressing text.
+  static bool FillItems(const ClipboardSnapshot& snapshot, Entry* entry);
+
+  // Serializes |items| for the store, and parses them back.
+  static bool SerializeItems(const std::vector<Item>& items, PooledBuffer* out);
+  static bool ParseItems(const uint8_t* data, size_t size, std::vector<Item>* items);
+
+  // Builds the snapshot handed to Dart from stored items.
+  SnapshotPtr BuildSnapshot(const Entry& entry, const std::vector<Item>& items);
+
+  // Reads the items of entry |id| from the store.
+  bool ReadStoredItems(int64_t id, std::vector<Item>* items);
+
+  // Splits the large PNG images of |entry| into tiles in the background.
+  // Returns false if it has none.
+  bool StartTiling(Entry* entry);
+  static void TileInThread(GTask* task, gpointer source_object, gpointer task_data,
+                           GCancellable* cancellable);
+  static void OnTilingDone(GObject* source_object, GAsyncResult* result, gpointer data);
+  // Replaces the images of the job's entry with their tile maps.
+  void FinishTiling(TilingJob* job);
+
+  // Drops the references of the tile maps among |items|. Returns the bytes
+  // freed.
+  size_t ReleaseTiles(const std::vector<Item>& items);
+
+  // Fetches the blob of tile |hash| from the pool or the store.
+  bool ReadTileBlob(uint64_t hash, PooledBuffer* blob);
+
+  // Writes the tiles of |item| that are not in the store yet.
+  void PersistTiles(const Item& item);
+
+  // Drops the store's references to the tiles of |entry|, deleting tiles
+  // no longer referenced.
+  void ReleaseDiskTiles(const Entry& entry);
+
+  // Counts the references to the tiles in the store, once after attaching
+  // it, and deletes the tiles no entry refers to.
+  void CountDiskTileRefs();
+
+  // Reads the text item of |entry|, from the store if needed.
+  bool ReadText(const Entry& entry, PooledBuffer* text);
+
+  // Indexes the entries in |unindexed_|.
+  void IndexPending();
+
+  // Writes |entry| to the store.
+  void Persist(Entry* entry);
+
+  // Forgets that the entry or tile with store id |id| is persisted, as its
+  // group commit failed. An entry no longer held in memory is lost.
+  void OnWriteFailed(int64_t id);
+
+  // Drops the payload of |entry| from memory. Returns the bytes released.
+  size_t DropItems(Entry* entry);
+
+  // Drops the entry at |it|, from the store too. Returns the bytes of
+  // memory released.
+  size_t Erase(EntryList::iterator it);
+
+  // Drops the oldest entries, or their payloads, until the limits hold.
+  void EvictToLimits();
+
+  size_t max_entries_;
+  size_t max_bytes_;
+  size_t max_disk_bytes_ = kDefaultMaxDiskBytes;
+  size_t stored_bytes_ = 0;
+  size_t disk_bytes_ = 0;
+
+  // Starts at the wall-clock time in microseconds, so that ids persisted
+  // by earlier runs are not handed out again.
+  int64_t next_id_;
+
+  // Most recent first.
+  EntryList entries_;
+  std::unordered_map<uint64_t, EntryList::iterator> by_hash_;
+  std::unordered_map<int64_t, EntryList::iterator> by_id_;
+
+  std::unique_ptr<HistoryStore> store_;
+
+  // Shared with tiling jobs, which may outlive the history.
+  std::shared_ptr<TilePool> tiles_;
+  std::unordered_map<uint64_t, DiskTile> disk_tiles_;
+  bool disk_tile_refs_counted_ = false;
+
+  TrigramIndex text_index_;
+  // Text entries of the store that the saved index lacked.
+  std::unordered_set<int64_t> unindexed_;
+
+  // Outlives the history while tiling jobs are running.
+  std::shared_ptr<ClipboardHistory*> self_;
+};
+
+// Deflates |size| bytes into |out| with zlib. Returns false, leaving |out|
+// empty, if that fails or would not make the data smaller.
+bool DeflateBytes(const uint8_t* data, size_t size, PooledBuffer* out);
+
+// Inflates zlib data known to expand to exactly |original_size| bytes.
+bool InflateBytes(const uint8_t* data, size_t size, size_t original_size,
+                  PooledBuffer* out);
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_CLIPBOARD_HISTORY_H_
@@ -0,0 +1,227 @@
+#include "clipboard_monitor.h"
+
+#include <algorithm>
+
+#include "content_hash.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+const char kTextMimeType[] = "text/plain";
+
+}  // namespace
+
+struct ClipboardMonitor::Fingerprint {
+  std::weak_ptr<ClipboardMonitor*> monitor;
+  uint64_t serial;
+  uint64_t owner_key;
+  std::vector<std::string> targets;
+  bool has_text = false;
+};
+
+ClipboardMonitor::ClipboardMonitor(GtkClipboard* clipboard, guint debounce_ms,
+                                   X11SelectionWatcher* watcher)
+    : clipboard_(clipboard),
+      debounce_ms_(debounce_ms),
+      self_(std::make_shared<ClipboardMonitor*>(this)) {
+  GdkAtom selection = gtk_clipboard_get_selection(clipboard_);
+  if (watcher != nullptr && watcher->Watch(selection)) {
+    watcher_ = watcher;
+    const X11SelectionWatcher::OwnerState* state = watcher_->state(selection);
+    owner_key_ = OwnerKey(state->owner, state->timestamp);
+    watcher_listener_ = watcher_->AddChangeListener(
+        [this, selection](GdkAtom changed, const X11SelectionWatcher::OwnerState& state) {
+          if (changed == selection) {
+            NoteOwnerState(state);
+          }
+        });
+  } else {
+    owner_change_handler_ = g_signal_connect(
+        clipboard_, "owner-change", G_CALLBACK(OnOwnerChange), this);
+  }
+  TakeFingerprint();
+}
+
+ClipboardMonitor::~ClipboardMonitor() {
+  if (owner_change_handler_ != 0) {
+    g_signal_handler_disconnect(clipboard_, owner_change_handler_);
+  }
+  if (watcher_ != nullptr) {
+    watcher_->RemoveChangeListener(watcher_listener_);
+  }
+  if (debounce_source_ != 0) {
+    g_source_remove(debounce_source_);
+  }
+}
+
+void ClipboardMonitor::AddChangeListener(ChangeListener listener) {
+  listeners_.push_back(std::move(listener));
+}
+
+// static
+std::vector<std::string> ClipboardMonitor::MimeTypesFromTargets(
+    const std::vector<std::string>& targets, bool has_text) {
+  std::vector<std::string> result;
+  if (has_text) {
+    result.push_back(kTextMimeType);
+  }
+  for (const std::string& target : targets) {
+    // Skip X11 atoms such as TARGETS, TIMESTAMP or UTF8_STRING.
+    if (target.find('/') == std::string::npos) {
+      continue;
+    }
+    // Drop parameters, e.g. "text/plain;charset=utf-8" -> "text/plain".
+    std::string mime_type = target.substr(0, target.find(';'));
+    if (std::find(result.begin(), result.end(), mime_type) == result.end()) {
+      result.push_back(mime_type);
+    }
+  }
+  return result;
+}
+
+// static
+uint64_t ClipboardMonitor::OwnerKey(uintptr_t owner, guint32 selection_time) {
+  uint64_t values[2] = {owner, selection_time};
+  return HashBytes(values, sizeof(values));
+}
+
+// static
+void ClipboardMonitor::OnOwnerChange(GtkClipboard* clipboard, GdkEvent* event,
+                                     gpointer user_data) {
+  ClipboardMonitor* self = static_cast<ClipboardMonitor*>(user_data);
+  const GdkEventOwnerChange& change = event->owner_change;
+  // Without a selection time, owners cannot be told apart; an untimed key
+  // never matches a timed one.
+  uint64_t owner_key = change.selection_time != 0
+                           ? OwnerKey(reinterpret_cast<uintptr_t>(change.owner),
+                                      change.selection_time)
+                           : OwnerKey(++self->untimed_changes_, 0);
+  self->NoteOwnerChange(owner_key);
+}
+
+void ClipboardMonitor::NoteOwnerChange(uint64_t owner_key) {
+  owner_key_ = owner_key;
+  gint64 now = g_get_monotonic_time();
+
+  if (debounce_source_ != 0) {
+    gint64 max_delay_us = kMaxDebounceWindows * debounce_ms_ * G_GINT64_CONSTANT(1000);
+    if (now - first_pending_change_ >= max_delay_us) {
+      // Let the pending timer fire instead of postponing it again.
+      return;
+    }
+    g_source_remove(debounce_source_);
+  } else {
+    first_pending_change_ = now;
+  }
+
+  debounce_source_ = g_timeout_add(debounce_ms_, OnDebounceTimeout, this);
+}
+
+void ClipboardMonitor::NoteOwnerState(const X11SelectionWatcher::OwnerState& state) {
+  // A clipboard manager taking over is reported like any other owner, so
+  // reports go through the same debounce and content check.
+  NoteOwnerChange(OwnerKey(state.owner, state.timestamp));
+}
+
+// static
+gboolean ClipboardMonitor::OnDebounceTimeout(gpointer user_data) {
+  ClipboardMonitor* self = static_cast<ClipboardMonitor*>(user_data);
+  self->debounce_source_ = 0;
+  self->TakeFingerprint();
+  return G_SOURCE_REMOVE;
+}
+
+void ClipboardMonitor::TakeFingerprint() {
+  Fingerprint* fingerprint = new Fingerprint();
+  fingerprint->monitor = self_;
+  fingerprint->serial = ++fingerprint_serial_;
+  fingerprint->owner_key = owner_key_;
+  fingerprint_pending_ = true;
+  gtk_clipboard_request_targets(clipboard_, OnTargetsReceived, fingerprint);
+}
+
+// static
+ClipboardMonitor* ClipboardMonitor::Resolve(const Fingerprint& fingerprint) {
+  std::shared_ptr<ClipboardMonitor*> monitor = fingerprint.monitor.lock();
+  if (!monitor) {
+    return nullptr;
+  }
+  ClipboardMonitor* self = *monitor;
+  // A newer owner change has a fingerprint of its own in flight.
+  if (fingerprint.serial != self->fingerprint_serial_) {
+    return nullptr;
+  }
+  return self;
+}
+
+// static
+void ClipboardMonitor::OnTargetsReceived(GtkClipboard* clipboard,
+                                         GdkAtom* atoms, gint n_atoms,
+                                         gpointer data) {
+  std::unique_ptr<Fingerprint> fingerprint(static_cast<Fingerprint*>(data));
+  ClipboardMonitor* self = Resolve(*fingerprint);
+  if (self == nullptr) {
+    return;
+  }
+
+  uint64_t hash = fingerprint->owner_key;
+  for (gint i = 0; i < n_atoms; i++) {
+    gchar* name = gdk_atom_name(atoms[i]);
+    fingerprint->targets.emplace_back(name);
+    g_free(name);
+    hash = HashString(fingerprint->targets.back(), hash);
+  }
+  fingerprint->has_text = n_atoms > 0 && gtk_targets_include_text(atoms, n_atoms);
+  self->Commit(*fingerprint, hash);
+}
+
+void ClipboardMonitor::Commit(const Fingerprint& fingerprint, uint64_t hash) {
+  fingerprint_pending_ = false;
+  mime_types_ = MimeTypesFromTargets(fingerprint.targets, fingerprint.has_text);
+
+  // The first fingerprint only establishes a baseline.
+  if (!has_fingerprint_) {
+    has_fingerprint_ = true;
+    fingerprint_ = hash;
+    return;
+  }
+
+  if (hash == fingerprint_) {
+    return;
+  }
+
+  fingerprint_ = hash;
+  ReportChange();
+}
+
+void ClipboardMonitor::ReportChange() {
+  owner_changes_++;
+  // A change arriving while another is checked joins that check.
+  if (content_pending_) {
+    return;
+  }
+  content_pending_ = content_check_ && content_check_();
+  if (!content_pending_) {
+    NotifyChange();
+  }
+}
+
+void ClipboardMonitor::ConfirmChange(bool content_changed) {
+  if (!content_pending_) {
+    return;
+  }
+  content_pending_ = false;
+  if (content_changed) {
+    NotifyChange();
+  }
+}
+
+void ClipboardMonitor::NotifyChange() {
+  change_count_++;
+  for (const ChangeListener& listener : listeners_) {
+    listener(change_count_);
+  }
+}
+
+}  // namespace flutter_paste_input
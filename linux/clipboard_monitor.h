@@ -0,0 +1,170 @@
+#ifndef FLUTTER_PLUGIN_CLIPBOARD_MONITOR_H_
+#define FLUTTER_PLUGIN_CLIPBOARD_MONITOR_H_
+
+#include <gtk/gtk.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "x11_selection_watcher.h"
+
+namespace flutter_paste_input {
+
+// Tracks clipboard ownership changes and caches the TARGETS offered by the
+// current owner, so the clipboard can be probed without a round trip to the
+// selection owner.
+//
+// Clipboard managers re-take ownership right after every copy, so raw
+// owner-change signals come in storms. Changes are debounced over a short
+// window and then fingerprinted from the owner, the time it took the
+// selection and the targets it offers; the change count only moves, and
+// listeners only run, when the fingerprint differs. Where owner changes
+// carry no selection time, e.g. on Wayland, every debounced change counts.
+//
+// A manager re-taking ownership still yields a new fingerprint, with the
+// same content. If a content check is set, e.g. by the ClipboardReader
+// holding a read of the current content, a new fingerprint is held back
+// until the check reports whether the content differs; the change is
+// dropped if it does not. Without one, no payload is transferred.
+//
+// Given an X11SelectionWatcher that supports the display, owner changes
+// come from XFixes rather than GTK's owner-change signal. Each names the
+// new owner and the time it took the selection, and unsettles the monitor
+// as soon as the server reports it, so cached reads are not served from
+// then on. It is counted like any other change, after the debounce window
+// and the content check.
+class ClipboardMonitor {
+ public:
+  // Called with the new change count after a real content change.
+  using ChangeListener = std::function<void(int64_t change_count)>;
+
+  // Called when the owner changes. Returns true if the caller will settle
+  // the change with ConfirmChange() once it has compared the new content
+  // with the old, false to count the change right away.
+  using ContentCheck = std::function<bool()>;
+
+  static constexpr guint kDefaultDebounceMs = 100;
+
+  // A storm that keeps re-arming the debounce timer is still evaluated
+  // after this many windows, so a busy clipboard cannot starve change
+  // detection.
+  static constexpr gint64 kMaxDebounceWindows = 4;
+
+  explicit ClipboardMonitor(GtkClipboard* clipboard,
+                            guint debounce_ms = kDefaultDebounceMs,
+                            X11SelectionWatcher* watcher = nullptr);
+  ~ClipboardMonitor();
+
+  // Disallow copy and assign.
+  ClipboardMonitor(const ClipboardMonitor&) = delete;
+  ClipboardMonitor& operator=(const ClipboardMonitor&) = delete;
+
+  // Monotonically increasing counter, bumped on every content change.
+  int64_t change_count() const { return change_count_; }
+
+  // Owner changes seen so far, including those the content check dropped.
+  // Moves as soon as a change is detected, before change_count() does.
+  int64_t owner_changes() const { return owner_changes_; }
+
+  // MIME types offered by the current owner. Updated asynchronously after
+  // an owner change, so it may briefly describe the previous owner.
+  const std::vector<std::string>& mime_types() const { return mime_types_; }
+
+  // Fingerprint of the current owner and its targets (0 until the first
+  // one is taken).
+  uint64_t fingerprint() const { return fingerprint_; }
+
+  // True when no owner change is waiting to be evaluated, i.e. the change
+  // count describes what is on the clipboard right now.
+  bool settled() const {
+    return debounce_source_ == 0 && !fingerprint_pending_ && !content_pending_;
+  }
+
+  void set_debounce_ms(guint debounce_ms) { debounce_ms_ = debounce_ms; }
+
+  void set_content_check(ContentCheck content_check) {
+    content_check_ = std::move(content_check);
+  }
+
+  // Settles an owner change held back by the content check: counts it if
+  // |content_changed|, drops it otherwise. Does nothing if none is held.
+  void ConfirmChange(bool content_changed);
+
+  void AddChangeListener(ChangeListener listener);
+
+  // Maps a list of selection targets to de-duplicated MIME types. Text
+  // targets (UTF8_STRING, STRING, ...) are reported as "text/plain".
+  static std::vector<std::string> MimeTypesFromTargets(
+      const std::vector<std::string>& targets, bool has_text);
+
+ private:
+  // One in-flight fingerprint of the clipboard, identified by |serial| so
+  // that replies to superseded requests can be dropped.
+  struct Fingerprint;
+
+  static void OnOwnerChange(GtkClipboard* clipboard, GdkEvent* event,
+                            gpointer user_data);
+
+  // Identifies an owner by its window and the time it took the selection.
+  static uint64_t OwnerKey(uintptr_t owner, guint32 selection_time);
+
+  // Debounces a change to the owner identified by |owner_key| before
+  // fingerprinting it.
+  void NoteOwnerChange(uint64_t owner_key);
+
+  // Debounces an owner change reported by the X11SelectionWatcher.
+  void NoteOwnerState(const X11SelectionWatcher::OwnerState& state);
+  static gboolean OnDebounceTimeout(gpointer user_data);
+  static void OnTargetsReceived(GtkClipboard* clipboard, GdkAtom* atoms,
+                                gint n_atoms, gpointer data);
+
+  // Starts a new fingerprint, superseding any in flight.
+  void TakeFingerprint();
+
+  // Returns the monitor if it is alive and |fingerprint| is current.
+  static ClipboardMonitor* Resolve(const Fingerprint& fingerprint);
+
+  // Applies a completed fingerprint; reports a change if it differs.
+  void Commit(const Fingerprint& fingerprint, uint64_t hash);
+
+  // Counts an owner change, unless the content check holds it back.
+  void ReportChange();
+
+  // Bumps the change count and runs the listeners.
+  void NotifyChange();
+
+  GtkClipboard* clipboard_;
+  guint debounce_ms_;
+  gulong owner_change_handler_ = 0;
+  X11SelectionWatcher* watcher_ = nullptr;
+  int watcher_listener_ = 0;
+  guint debounce_source_ = 0;
+  gint64 first_pending_change_ = 0;
+  uint64_t fingerprint_serial_ = 0;
+  bool fingerprint_pending_ = false;
+  bool has_fingerprint_ = false;
+  // Owner of the latest change, and owner changes without a selection time.
+  uint64_t owner_key_ = 0;
+  uint64_t untimed_changes_ = 0;
+
+  int64_t change_count_ = 0;
+  int64_t owner_changes_ = 0;
+  uint64_t fingerprint_ = 0;
+  ContentCheck content_check_;
+  // True while an owner change waits for ConfirmChange().
+  bool content_pending_ = false;
+  std::vector<std::string> mime_types_;
+  std::vector<ChangeListener> listeners_;
+
+  // Outlives the monitor while GTK requests are pending, so late replies
+  // can tell whether the monitor is still around.
+  std::shared_ptr<ClipboardMonitor*> self_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_CLIPBOARD_MONITOR_H_
@@ -0,0 +1,1005 @@
+#include "clipboard_reader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "content_hash.h"
+#include "paste_arena.h"
+#include "paste_tracer.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+// PNG output is budgeted at half the pixel data. A reply is held three
+// times at its peak: the snapshot, the Pigeon ClipboardItem copy and the
+// codec's message buffer.
+constexpr size_t kEncodedRatio = 2;
+constexpr size_t kReplyCopies = 3;
+
+// Task data of an image encode.
+struct EncodeJob {
+  ~EncodeJob() { g_object_unref(pixbuf); }
+
+  GdkPixbuf* pixbuf;
+  // Size to encode at; differs from the pixbuf's when downscaling.
+  int width;
+  int height;
+  std::shared_ptr<PasteStats> stats;
+};
+
+struct EncodeWriter {
+  PooledBuffer* out;
+  GCancellable* cancellable;
+  gint64 deadline;
+};
+
+// Appends one chunk of encoder output, aborting the encode if cancelled or
+// out of time.
+gboolean WriteEncodedChunk(const gchar* buffer, gsize count, GError** error,
+                           gpointer data) {
+  EncodeWriter* writer = static_cast<EncodeWriter*>(data);
+  if (g_cancellable_set_error_if_cancelled(writer->cancellable, error)) {
+    return FALSE;
+  }
+  if (g_get_monotonic_time() >= writer->deadline) {
+    g_set_error(error, G_IO_ERROR, G_IO_ERROR_TIMED_OUT, "Encoding ran out of time");
+    return FALSE;
+  }
+  if (!writer->out->Append(reinterpret_cast<const uint8_t*>(buffer), count)) {
+    g_set_error(error, G_IO_ERROR, G_IO_ERROR_NO_SPACE, "Out of memory");
+    return FALSE;
+  }
+  return TRUE;
+}
+
+// Returns the preferred UTF-8 text target among |atoms|, or GDK_NONE if
+// the owner offers text only in legacy encodings.
+GdkAtom FindUtf8TextTarget(const GdkAtom* atoms, gint n_atoms) {
+  static const char* const kTargets[] = {"UTF8_STRING", "text/plain;charset=utf-8"};
+  for (const char* name : kTargets) {
+    GdkAtom target = gdk_atom_intern_static_string(name);
+    for (gint i = 0; i < n_atoms; i++) {
+      if (atoms[i] == target) {
+        return target;
+      }
+    }
+  }
+  return GDK_NONE;
+}
+
+}  // namespace
+
+struct ClipboardReader::ReadOperation {
+  ~ReadOperation() {
+    PasteTracer::Get()->AsyncEnd("read", trace_id());
+    if (reserved_bytes > 0) {
+      budget->Release(reserved_bytes);
+    }
+    g_clear_object(&cancellable);
+  }
+
+  void NotePeak(size_t bytes) {
+    peak_bytes = std::max(peak_bytes, static_cast<int64_t>(bytes));
+  }
+
+  // Traced as async events, as the read spans main loop iterations.
+  uint64_t trace_id() const { return reinterpret_cast<uintptr_t>(this); }
+
+  // Bracket a request to the selection owner. A reply without a pending
+  // request, e.g. a pixbuf that was decoded already, is not counted.
+  void NoteRequest() {
+    requested_at = g_get_monotonic_time();
+    PasteTracer::Get()->AsyncBegin("selection", trace_id());
+  }
+  void NoteReply(size_t bytes) {
+    if (requested_at == 0) {
+      return;
+    }
+    PasteTracer::Get()->AsyncEnd("selection", trace_id());
+    selection_us += g_get_monotonic_time() - requested_at;
+    selection_bytes += bytes;
+    requested_at = 0;
+  }
+
+  // Backs the read's temporaries; declared first so it is destroyed last.
+  PasteArena arena;
+
+  std::weak_ptr<ClipboardReader*> reader;
+  uint64_t serial = 0;
+  GCancellable* cancellable = nullptr;
+  std::unique_ptr<ClipboardSnapshot> snapshot;
+  // ClipboardMonitor::owner_changes() when the read started.
+  int64_t owner_changes = 0;
+  bool has_text = false;
+  // UTF-8 text target offered by the owner, or GDK_NONE.
+  GdkAtom utf8_text_target = GDK_NONE;
+
+  // Image targets offered by the owner, tried in order until one yields
+  // a pixbuf.
+  std::pmr::vector<GdkAtom> image_targets{arena.resource()};
+  size_t next_image_target = 0;
+
+  // Size of the raw image selection, reported as original_byte_size.
+  int64_t image_byte_size = 0;
+
+  // Budget bytes reserved for the encoder's working set, released when
+  // the operation ends.
+  std::shared_ptr<MemoryBudget> budget;
+  size_t reserved_bytes = 0;
+
+  // Pixel data held while encoding, source and downscaled copy.
+  size_t pixel_bytes = 0;
+  int64_t peak_bytes = 0;
+
+  // Time spent waiting on the selection owner, and the bytes it sent.
+  std::shared_ptr<PasteStats> stats;
+  gint64 requested_at = 0;
+  gint64 selection_us = 0;
+  size_t selection_bytes = 0;
+  // Text until an image is received.
+  PasteContentClass content_class = PasteContentClass::kText;
+
+  // Returns the reader, or nullptr if it was destroyed or the read was
+  // abandoned in the meantime.
+  ClipboardReader* Resolve() const {
+    std::shared_ptr<ClipboardReader*> alive = reader.lock();
+    if (!alive || (*alive)->read_serial_ != serial) {
+      return nullptr;
+    }
+    return *alive;
+  }
+};
+
+size_t EncodeWorkingSetBytes(size_t source_bytes, size_t target_bytes) {
+  size_t bytes = source_bytes + kReplyCopies * target_bytes / kEncodedRatio;
+  if (target_bytes != source_bytes) {
+    bytes += target_bytes;
+  }
+  return bytes;
+}
+
+bool FitImageToBudget(size_t limit_bytes, size_t source_bytes, int* width,
+                      int* height) {
+  // The source stays alive while it is scaled, so only what is left of
+  // the budget is available for the scaled copy and its encoding.
+  if (*width <= 0 || *height <= 0 || source_bytes == 0 ||
+      limit_bytes <= source_bytes) {
+    return false;
+  }
+  double per_target_byte = 1.0 + static_cast<double>(kReplyCopies) / kEncodedRatio;
+  double max_target_bytes = (limit_bytes - source_bytes) / per_target_byte;
+  double scale = std::sqrt(max_target_bytes / source_bytes);
+  if (scale >= 1.0) {
+    return true;
+  }
+  int scaled_width = static_cast<int>(std::floor(*width * scale));
+  int scaled_height = static_cast<int>(std::floor(*height * scale));
+  if (scaled_width < 1 || scaled_height < 1) {
+    return false;
+  }
+  *width = scaled_width;
+  *height = scaled_height;
+  return true;
+}
+
+PasteContentClass SnapshotContentClass(const ClipboardSnapshot& snapshot) {
+  // Images come first.
+  if (snapshot.items.empty() || !snapshot.items[0].is_image) {
+    return PasteContentClass::kText;
+  }
+  return ImageContentClass(snapshot.items[0].width, snapshot.items[0].height);
+}
+
+size_t SnapshotByteSize(const ClipboardSnapshot& snapshot) {
+  size_t size = 0;
+  for (const SnapshotItem& item : snapshot.items) {
+    size += item.data.size();
+  }
+  return size;
+}
+
+uint64_t SnapshotContentHash(const ClipboardSnapshot& snapshot) {
+  uint64_t hash = 0;
+  for (const SnapshotItem& item : snapshot.items) {
+    hash = HashString(item.mime_type, hash);
+    hash = HashBytes(item.data.data(), item.data.size(), hash);
+  }
+  return hash;
+}
+
+bool EncodePixbuf(GdkPixbuf* pixbuf, const char* type, PooledBuffer* out,
+                  GCancellable* cancellable, gint64 deadline) {
+  EncodeWriter writer = {out, cancellable, deadline};
+  GError* error = nullptr;
+
+  if (!gdk_pixbuf_save_to_callback(pixbuf, WriteEncodedChunk, &writer, type, &error,
+                                   nullptr)) {
+    if (error != nullptr) {
+      if (!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED) &&
+          !g_error_matches(error, G_IO_ERROR, G_IO_ERROR_TIMED_OUT)) {
+        g_warning("FlutterPasteInput: Failed to save image: %s", error->message);
+      }
+      g_error_free(error);
+    }
+    // Release the partial output right away.
+    out->Reset();
+    return false;
+  }
+  return true;
+}
+
+GdkPixbuf* DecodePixbuf(const uint8_t* data, size_t length) {
+  GdkPixbufLoader* loader = gdk_pixbuf_loader_new();
+  GdkPixbuf* pixbuf = nullptr;
+  bool written = gdk_pixbuf_loader_write(loader, data, length, nullptr);
+  if (gdk_pixbuf_loader_close(loader, nullptr) && written) {
+    pixbuf = gdk_pixbuf_loader_get_pixbuf(loader);
+    if (pixbuf != nullptr) {
+      g_object_ref(pixbuf);
+    }
+  }
+  g_object_unref(loader);
+  return pixbuf;
+}
+
+bool EncodePixbufAsPng(GdkPixbuf* pixbuf, SnapshotItem* item,
+                       GCancellable* cancellable) {
+  if (!EncodePixbuf(pixbuf, "png", &item->data, cancellable)) {
+    return false;
+  }
+
+  item->mime_type = "image/png";
+  item->is_image = true;
+  item->width = gdk_pixbuf_get_width(pixbuf);
+  item->height = gdk_pixbuf_get_height(pixbuf);
+  item->has_alpha = gdk_pixbuf_get_has_alpha(pixbuf);
+  item->frame_count = 1;  // Re-encoded as a single PNG frame.
+  return true;
+}
+
+ClipboardReader::ClipboardReader(GtkClipboard* clipboard,
+                                 ClipboardMonitor* monitor,
+                                 std::shared_ptr<MemoryBudget> budget,
+                                 std::shared_ptr<PasteStats> stats)
+    : clipboard_(clipboard),
+      monitor_(monitor),
+      budget_(std::move(budget)),
+      stats_(std::move(stats)),
+      self_(std::make_shared<ClipboardReader*>(this)) {
+  monitor_->set_content_check([this] { return CheckContent(); });
+}
+
+ClipboardReader::~ClipboardReader() {
+  monitor_->set_content_check(nullptr);
+  // Nothing is left to compare the new content with.
+  EndContentCheck(true);
+  if (prefetch_source_ != 0) {
+    g_source_remove(prefetch_source_);
+  }
+  if (read_cancellable_ != nullptr) {
+    g_cancellable_cancel(read_cancellable_);
+    g_object_unref(read_cancellable_);
+  }
+  CancelBudgetWait();
+}
+
+bool ClipboardReader::Read(int64_t request_id, Callback callback,
+                           ProgressCallback progress) {
+  if (last_snapshot_ && IsFresh(*last_snapshot_)) {
+    SnapshotPtr snapshot = last_snapshot_;
+    callback(snapshot);
+    NotifyServed(snapshot);
+    return true;
+  }
+
+  if (reading_) {
+    // A read is in flight; join it unless the backlog is full.
+    if (waiters_.size() >= max_pending_reads_) {
+      return false;
+    }
+    waiters_.push_back({request_id, std::move(callback), std::move(progress)});
+    return true;
+  }
+
+  waiters_.push_back({request_id, std::move(callback), std::move(progress)});
+  StartRead(false);
+  return true;
+}
+
+bool ClipboardReader::Cancel(int64_t request_id) {
+  if (request_id == 0) {
+    return false;
+  }
+  auto it = std::find_if(waiters_.begin(), waiters_.end(),
+                         [request_id](const Waiter& waiter) {
+                           return waiter.request_id == request_id;
+                         });
+  if (it == waiters_.end()) {
+    return false;
+  }
+
+  Callback callback = std::move(it->callback);
+  waiters_.erase(it);
+
+  // A prefetch is still worth finishing without anyone waiting on it.
+  if (waiters_.empty() && reading_ && !read_is_prefetch_) {
+    AbortRead();
+    if (check_pending_) {
+      StartRead(true);
+    }
+  }
+
+  callback(nullptr);
+  return true;
+}
+
+void ClipboardReader::AddSnapshotListener(SnapshotListener listener) {
+  snapshot_listeners_.push_back(std::move(listener));
+}
+
+void ClipboardReader::Prefetch() {
+  if (prefetch_source_ != 0) {
+    return;
+  }
+  prefetch_source_ =
+      g_idle_add_full(G_PRIORITY_LOW, OnPrefetchIdle, this, nullptr);
+}
+
+size_t ClipboardReader::Trim(TrimLevel level) {
+  size_t released = 0;
+  if (last_snapshot_ && (level >= TrimLevel::kMedium || !IsFresh(*last_snapshot_))) {
+    if (last_snapshot_.use_count() == 1) {
+      released = SnapshotByteSize(*last_snapshot_);
+    }
+    last_snapshot_.reset();
+  }
+
+  if (level >= TrimLevel::kMedium && prefetch_source_ != 0) {
+    g_source_remove(prefetch_source_);
+    prefetch_source_ = 0;
+  }
+
+  if (level >= TrimLevel::kCritical && reading_ && waiters_.empty()) {
+    AbortRead();
+    // The change counts without reading the new content.
+    EndContentCheck(true);
+  }
+  return released;
+}
+
+// static
+gboolean ClipboardReader::OnPrefetchIdle(gpointer user_data) {
+  ClipboardReader* self = static_cast<ClipboardReader*>(user_data);
+  self->prefetch_source_ = 0;
+  // A paste may have started a read, or produced a snapshot, meanwhile.
+  if (!self->reading_ &&
+      !(self->last_snapshot_ && self->IsFresh(*self->last_snapshot_))) {
+    self->StartRead(true);
+  }
+  return G_SOURCE_REMOVE;
+}
+
+bool ClipboardReader::IsFresh(const ClipboardSnapshot& snapshot) const {
+  if (!monitor_->settled() || snapshot.change_count != monitor_->change_count()) {
+    return false;
+  }
+  guint lifetime_ms = coalesce_window_ms_;
+  if (snapshot.prefetched && lifetime_ms < kPrefetchLifetimeMs) {
+    lifetime_ms = kPrefetchLifetimeMs;
+  }
+  gint64 age_us = g_get_monotonic_time() - snapshot.completed_at;
+  return age_us <= static_cast<gint64>(lifetime_ms) * 1000;
+}
+
+bool ClipboardReader::CheckContent() {
+  if (check_pending_) {
+    return true;
+  }
+  if (!last_snapshot_ || !last_snapshot_->error_code.empty() ||
+      last_snapshot_->change_count != monitor_->change_count()) {
+    return false;
+  }
+  check_pending_ = true;
+  check_snapshot_ = last_snapshot_;
+  check_hash_ = SnapshotContentHash(*last_snapshot_);
+  // A read in flight describes the previous owner; another follows it.
+  if (!reading_) {
+    StartRead(true);
+  }
+  return true;
+}
+
+bool ClipboardReader::ChecksContent(const ReadOperation& operation) const {
+  return check_pending_ && operation.owner_changes == monitor_->owner_changes();
+}
+
+void ClipboardReader::EndContentCheck(bool content_changed) {
+  if (!check_pending_) {
+    return;
+  }
+  check_pending_ = false;
+  monitor_->ConfirmChange(content_changed);
+}
+
+void ClipboardReader::StartRead(bool prefetch) {
+  reading_ = true;
+  read_is_prefetch_ = prefetch;
+  read_cancellable_ = g_cancellable_new();
+
+  ReadOperation* operation = new ReadOperation();
+  operation->reader = self_;
+  operation->serial = read_serial_;
+  operation->cancellable = G_CANCELLABLE(g_object_ref(read_cancellable_));
+  operation->budget = budget_;
+  operation->stats = stats_;
+  operation->snapshot = std::make_unique<ClipboardSnapshot>();
+  operation->snapshot->change_count = monitor_->change_count();
+  operation->owner_changes = monitor_->owner_changes();
+  operation->snapshot->prefetched = prefetch;
+  PasteTracer::Get()->AsyncBegin("read", operation->trace_id());
+  operation->NoteRequest();
+  gtk_clipboard_request_targets(clipboard_, OnTargetsReceived, operation);
+}
+
+void ClipboardReader::AbortRead() {
+  transfer_.reset();
+  CancelBudgetWait();
+  g_cancellable_cancel(read_cancellable_);
+  g_clear_object(&read_cancellable_);
+  read_serial_++;
+  reading_ = false;
+}
+
+void ClipboardReader::CancelBudgetWait() {
+  if (budget_wait_ != 0) {
+    // Drops the queued read with its pixbuf and frees its place in line.
+    budget_->CancelWait(budget_wait_);
+    budget_wait_ = 0;
+  }
+}
+
+// static
+void ClipboardReader::OnTargetsReceived(GtkClipboard* clipboard,
+                                        GdkAtom* atoms, gint n_atoms,
+                                        gpointer data) {
+  std::unique_ptr<ReadOperation> operation(static_cast<ReadOperation*>(data));
+  if (operation->Resolve() == nullptr) {
+    return;
+  }
+  operation->NoteReply(static_cast<size_t>(std::max(n_atoms, 0)) * sizeof(GdkAtom));
+
+  operation->has_text = n_atoms > 0 && gtk_targets_include_text(atoms, n_atoms);
+  operation->utf8_text_target = FindUtf8TextTarget(atoms, n_atoms);
+
+  // Check for image first, fetching the raw selection so the original
+  // size is known before re-encoding.
+  operation->image_targets.reserve(n_atoms);
+  for (gint i = 0; i < n_atoms; i++) {
+    if (gtk_targets_include_image(&atoms[i], 1, FALSE)) {
+      operation->image_targets.push_back(atoms[i]);
+    }
+  }
+  if (!operation->image_targets.empty()) {
+    RequestNextImageTarget(std::move(operation));
+    return;
+  }
+
+  ReadText(std::move(operation));
+}
+
+// static
+void ClipboardReader::RequestNextImageTarget(std::unique_ptr<ReadOperation> operation) {
+  ClipboardReader* self = operation->Resolve();
+  GdkAtom target = operation->image_targets[operation->next_image_target++];
+  operation->NoteRequest();
+  operation = TransferTarget(std::move(operation), target, OnImageTransferred);
+  if (!operation) {
+    return;
+  }
+  gtk_clipboard_request_contents(self->clipboard_, target, OnImageContentsReceived,
+                                 operation.release());
+}
+
+// static
+std::unique_ptr<ClipboardReader::ReadOperation> ClipboardReader::TransferTarget(
+    std::unique_ptr<ReadOperation> operation, GdkAtom target, TransferDone done) {
+  ClipboardReader* self = operation->Resolve();
+  if (!X11SelectionReader::IsSupported(gtk_clipboard_get_display(self->clipboard_))) {
+    return operation;
+  }
+  auto pending = std::make_shared<std::unique_ptr<ReadOperation>>(std::move(operation));
+  self->transfer_ = std::make_unique<X11SelectionReader>(
+      gtk_clipboard_get_display(self->clipboard_), GDK_SELECTION_CLIPBOARD, target,
+      self->max_transfer_bytes_,
+      [self](size_t received, size_t expected) {
+        self->ReportProgress(received, expected);
+      },
+      [pending, done](PooledBuffer data, const char* error_code,
+                      const std::string& error_message) {
+        done(std::move(*pending), std::move(data), error_code, error_message);
+      });
+  if (!self->transfer_->Start()) {
+    self->transfer_.reset();
+    return std::move(*pending);
+  }
+  return nullptr;
+}
+
+// static
+void ClipboardReader::OnImageTransferred(std::unique_ptr<ReadOperation> operation,
+                                         PooledBuffer data, const char* error_code,
+                                         const std::string& error_message) {
+  ClipboardReader* self = operation->Resolve();
+  if (self == nullptr) {
+    return;
+  }
+  // The transfer is over; this runs as its last step.
+  self->transfer_.reset();
+  operation->NoteReply(data.size());
+
+  if (error_code != nullptr && strcmp(error_code, "refused") != 0) {
+    Fail(std::move(operation), error_code, error_message);
+    return;
+  }
+
+  GdkPixbuf* pixbuf = nullptr;
+  if (!data.empty()) {
+    operation->image_byte_size = static_cast<int64_t>(data.size());
+    gint64 decode_started_at = g_get_monotonic_time();
+    {
+      TraceScope trace("decode");
+      pixbuf = DecodePixbuf(data.data(), data.size());
+    }
+    RecordDecodeStats(*operation, decode_started_at, data.size(), pixbuf);
+    // The pixbuf replaces the raw selection.
+    data.Reset();
+  }
+  ContinueWithPixbuf(std::move(operation), pixbuf);
+  g_clear_object(&pixbuf);
+}
+
+// static
+void ClipboardReader::OnImageContentsReceived(GtkClipboard* clipboard,
+                                              GtkSelectionData* selection,
+                                              gpointer data) {
+  std::unique_ptr<ReadOperation> operation(static_cast<ReadOperation*>(data));
+  if (operation->Resolve() == nullptr) {
+    return;
+  }
+
+  gint length = selection != nullptr ? gtk_selection_data_get_length(selection) : 0;
+  operation->NoteReply(static_cast<size_t>(std::max(length, 0)));
+
+  GdkPixbuf* pixbuf = nullptr;
+  if (length > 0) {
+    operation->image_byte_size = length;
+    // GTK decodes the selection with gdk-pixbuf's loaders.
+    gint64 decode_started_at = g_get_monotonic_time();
+    {
+      TraceScope trace("decode");
+      pixbuf = gtk_selection_data_get_pixbuf(selection);
+    }
+    RecordDecodeStats(*operation, decode_started_at, static_cast<size_t>(length), pixbuf);
+  }
+
+  ContinueWithPixbuf(std::move(operation), pixbuf);
+  g_clear_object(&pixbuf);
+}
+
+// static
+void ClipboardReader::ContinueWithPixbuf(std::unique_ptr<ReadOperation> operation,
+                                         GdkPixbuf* pixbuf) {
+  ClipboardReader* self = operation->Resolve();
+  if (pixbuf == nullptr) {
+    if (operation->next_image_target < operation->image_targets.size()) {
+      RequestNextImageTarget(std::move(operation));
+      return;
+    }
+    // Fall back to GTK's own conversion for owners advertising unusual
+    // targets. On X11 every image target was already transferred under
+    // the size cap, and GTK would only fetch them again without one.
+    if (X11SelectionReader::IsSupported(gtk_clipboard_get_display(self->clipboard_))) {
+      ReadText(std::move(operation));
+      return;
+    }
+    operation->NoteRequest();
+    gtk_clipboard_request_image(self->clipboard_, OnImageReceived, operation.release());
+    return;
+  }
+
+  OnImageReceived(self->clipboard_, pixbuf, operation.release());
+}
+
+// static
+void ClipboardReader::OnImageReceived(GtkClipboard* clipboard,
+                                      GdkPixbuf* pixbuf, gpointer data) {
+  std::unique_ptr<ReadOperation> operation(static_cast<ReadOperation*>(data));
+  if (operation->Resolve() == nullptr) {
+    return;
+  }
+  operation->NoteReply(pixbuf != nullptr ? gdk_pixbuf_get_byte_length(pixbuf) : 0);
+
+  if (pixbuf == nullptr) {
+    ReadText(std::move(operation));
+    return;
+  }
+
+  if (operation->image_byte_size <= 0) {
+    operation->image_byte_size =
+        static_cast<int64_t>(gdk_pixbuf_get_byte_length(pixbuf));
+  }
+  operation->content_class =
+      ImageContentClass(gdk_pixbuf_get_width(pixbuf), gdk_pixbuf_get_height(pixbuf));
+
+  AdmitImage(std::move(operation), pixbuf);
+}
+
+// static
+void ClipboardReader::AdmitImage(std::unique_ptr<ReadOperation> operation,
+                                 GdkPixbuf* pixbuf) {
+  ClipboardReader* self = operation->Resolve();
+  MemoryBudget* budget = self->budget_.get();
+
+  size_t source_bytes = gdk_pixbuf_get_byte_length(pixbuf);
+  operation->NotePeak(static_cast<size_t>(operation->image_byte_size) + source_bytes);
+
+  int width = gdk_pixbuf_get_width(pixbuf);
+  int height = gdk_pixbuf_get_height(pixbuf);
+  size_t target_bytes = source_bytes;
+  size_t needed = EncodeWorkingSetBytes(source_bytes, target_bytes);
+  if (!budget->Fits(needed)) {
+    int source_width = width;
+    int source_height = height;
+    if (self->downscale_over_budget_ &&
+        FitImageToBudget(budget->limit_bytes(), source_bytes, &width, &height)) {
+      target_bytes = static_cast<size_t>(static_cast<double>(source_bytes) * width *
+                                         height / (static_cast<double>(source_width) * source_height));
+      needed = EncodeWorkingSetBytes(source_bytes, target_bytes);
+    }
+    if (!budget->Fits(needed)) {
+      g_autofree gchar* message = g_strdup_printf(
+          "A %dx%d image needs %zu bytes, more than the %zu byte memory budget.",
+          source_width, source_height, needed, budget->limit_bytes());
+      Fail(std::move(operation), "over-budget", message);
+      return;
+    }
+    g_message("FlutterPasteInput: Downscaling %dx%d image to %dx%d to fit the memory budget",
+              source_width, source_height, width, height);
+  }
+  operation->pixel_bytes = source_bytes + (target_bytes != source_bytes ? target_bytes : 0);
+
+  bool reserved = budget->TryReserve(needed);
+  if (!reserved && self->last_snapshot_) {
+    // The cached snapshot may be what is in the way.
+    self->last_snapshot_.reset();
+    reserved = budget->TryReserve(needed);
+  }
+  if (reserved) {
+    operation->reserved_bytes = needed;
+    EncodeImage(std::move(operation), pixbuf, width, height);
+    return;
+  }
+
+  // Other pastes hold the budget; wait for them to release it.
+  auto queued = std::make_shared<std::unique_ptr<ReadOperation>>(std::move(operation));
+  std::shared_ptr<GdkPixbuf> held(GDK_PIXBUF(g_object_ref(pixbuf)), g_object_unref);
+  self->budget_wait_ = budget->WaitFor(
+      needed, MemoryBudget::kDefaultWaitTimeoutMs,
+      [queued, held, width, height, needed](bool admitted) {
+        std::unique_ptr<ReadOperation> operation = std::move(*queued);
+        if (admitted) {
+          operation->reserved_bytes = needed;
+        }
+        ClipboardReader* self = operation->Resolve();
+        if (self == nullptr) {
+          return;
+        }
+        self->budget_wait_ = 0;
+        if (!admitted) {
+          Fail(std::move(operation), "over-budget",
+               "Timed out waiting for other pastes to release memory.");
+          return;
+        }
+        EncodeImage(std::move(operation), held.get(), width, height);
+      });
+}
+
+// static
+void ClipboardReader::EncodeImage(std::unique_ptr<ReadOperation> operation,
+                                  GdkPixbuf* pixbuf, int width, int height) {
+  // PNG encoding of a large image takes long enough to stall the UI, so it
+  // runs on the GIO worker pool. The thread only sees the pixbuf.
+  GCancellable* cancellable = operation->cancellable;
+  EncodeJob* job =
+      new EncodeJob{GDK_PIXBUF(g_object_ref(pixbuf)), width, height, operation->stats};
+  GTask* task = g_task_new(nullptr, cancellable, OnEncodeDone, operation.release());
+  g_task_set_task_data(task, job, [](gpointer job) {
+    delete static_cast<EncodeJob*>(job);
+  });
+  g_task_run_in_thread(task, EncodeInThread);
+  g_object_unref(task);
+}
+
+// static
+void ClipboardReader::EncodeInThread(GTask* task, gpointer source_object,
+                                     gpointer task_data,
+                                     GCancellable* cancellable) {
+  TraceScope trace("encode");
+  EncodeJob* job = static_cast<EncodeJob*>(task_data);
+  gint64 started_at = g_get_monotonic_time();
+  GdkPixbuf* source = GDK_PIXBUF(g_object_ref(job->pixbuf));
+  if (job->width != gdk_pixbuf_get_width(source) ||
+      job->height != gdk_pixbuf_get_height(source)) {
+    GdkPixbuf* scaled = gdk_pixbuf_scale_simple(source, job->width, job->height,
+                                                GDK_INTERP_BILINEAR);
+    g_object_unref(source);
+    source = scaled;
+  }
+
+  SnapshotItem* item = new SnapshotItem();
+  if (source == nullptr || !EncodePixbufAsPng(source, item, cancellable)) {
+    delete item;
+    item = nullptr;
+  } else {
+    job->stats->Record(PasteStage::kEncode,
+                       ImageContentClass(gdk_pixbuf_get_width(job->pixbuf),
+                                         gdk_pixbuf_get_height(job->pixbuf)),
+                       started_at, gdk_pixbuf_get_byte_length(job->pixbuf),
+                       item->data.size());
+  }
+  g_clear_object(&source);
+  g_task_return_pointer(task, item, [](gpointer item) {
+    delete static_cast<SnapshotItem*>(item);
+  });
+}
+
+// static
+void ClipboardReader::OnEncodeDone(GObject* source_object,
+                                   GAsyncResult* result, gpointer data) {
+  std::unique_ptr<ReadOperation> operation(static_cast<ReadOperation*>(data));
+  // Returns nullptr, freeing the item, if the read was cancelled.
+  std::unique_ptr<SnapshotItem> item(static_cast<SnapshotItem*>(
+      g_task_propagate_pointer(G_TASK(result), nullptr)));
+  if (operation->Resolve() == nullptr) {
+    return;
+  }
+
+  if (item) {
+    operation->NotePeak(operation->pixel_bytes + item->data.size());
+    item->original_byte_size = operation->image_byte_size;
+    operation->snapshot->items.push_back(std::move(*item));
+  }
+
+  ReadText(std::move(operation));
+}
+
+// static
+void ClipboardReader::ReadText(std::unique_ptr<ReadOperation> operation) {
+  if (!operation->has_text) {
+    Finish(std::move(operation));
+    return;
+  }
+  ClipboardReader* self = operation->Resolve();
+  operation->NoteRequest();
+  if (operation->utf8_text_target != GDK_NONE) {
+    GdkAtom target = operation->utf8_text_target;
+    operation = TransferTarget(std::move(operation), target, OnTextTransferred);
+    if (!operation) {
+      return;
+    }
+  }
+  gtk_clipboard_request_text(self->clipboard_, OnTextReceived, operation.release());
+}
+
+// static
+void ClipboardReader::OnTextTransferred(std::unique_ptr<ReadOperation> operation,
+                                        PooledBuffer data, const char* error_code,
+                                        const std::string& error_message) {
+  ClipboardReader* self = operation->Resolve();
+  if (self == nullptr) {
+    return;
+  }
+  // The transfer is over; this runs as its last step.
+  self->transfer_.reset();
+  operation->NoteReply(data.size());
+
+  if (error_code != nullptr && strcmp(error_code, "refused") != 0) {
+    Fail(std::move(operation), error_code, error_message);
+    return;
+  }
+  if (error_code != nullptr) {
+    // Let GTK convert from whatever else the owner offers.
+    operation->utf8_text_target = GDK_NONE;
+    ReadText(std::move(operation));
+    return;
+  }
+
+  // Owners may include the terminating NUL.
+  size_t length = data.size();
+  while (length > 0 && data.data()[length - 1] == '\0') {
+    length--;
+  }
+  const gchar* text = reinterpret_cast<const gchar*>(data.data());
+  if (length > 0 && g_utf8_validate(text, static_cast<gssize>(length), nullptr)) {
+    data.Truncate(length);
+    SnapshotItem item;
+    item.mime_type = "text/plain";
+    item.original_byte_size = static_cast<int64_t>(length);
+    item.data = std::move(data);
+    operation->snapshot->items.push_back(std::move(item));
+  } else if (length > 0) {
+    g_warning("FlutterPasteInput: Ignoring pasted text that is not valid UTF-8");
+  }
+
+  Finish(std::move(operation));
+}
+
+// static
+void ClipboardReader::OnTextReceived(GtkClipboard* clipboard,
+                                     const gchar* text, gpointer data) {
+  std::unique_ptr<ReadOperation> operation(static_cast<ReadOperation*>(data));
+  if (operation->Resolve() == nullptr) {
+    return;
+  }
+  size_t length = text != nullptr ? strlen(text) : 0;
+  operation->NoteReply(length);
+
+  if (length > 0) {
+    SnapshotItem item;
+    if (item.data.Assign(reinterpret_cast<const uint8_t*>(text), length)) {
+      item.mime_type = "text/plain";
+      item.original_byte_size = static_cast<int64_t>(length);
+      operation->snapshot->items.push_back(std::move(item));
+    } else {
+      g_warning("FlutterPasteInput: Out of memory copying pasted text");
+    }
+  }
+
+  Finish(std::move(operation));
+}
+
+// static
+void ClipboardReader::Finish(std::unique_ptr<ReadOperation> operation) {
+  ClipboardReader* self = operation->Resolve();
+  if (self == nullptr) {
+    return;
+  }
+
+  RecordSelectionStats(*operation);
+  std::unique_ptr<ClipboardSnapshot> snapshot = std::move(operation->snapshot);
+  size_t payload_bytes = SnapshotByteSize(*snapshot);
+  operation->NotePeak(payload_bytes * kReplyCopies);
+  snapshot->peak_bytes = operation->peak_bytes;
+  snapshot->completed_at = g_get_monotonic_time();
+
+  if (self->ChecksContent(*operation)) {
+    bool content_changed = SnapshotContentHash(*snapshot) != self->check_hash_;
+    // Listeners run with the read still in flight, so pastes they start
+    // join it.
+    self->EndContentCheck(content_changed);
+    SnapshotPtr checked = self->check_snapshot_.lock();
+    if (!content_changed && checked) {
+      // Only the owner changed; the cached snapshot stays current.
+      operation.reset();
+      snapshot.reset();
+      self->last_snapshot_ = checked;
+      self->Deliver(checked);
+      return;
+    }
+    snapshot->change_count = self->monitor_->change_count();
+  }
+
+  // The encoder's buffers are gone; from here on the snapshot holds its
+  // payload against the budget until it is destroyed.
+  operation.reset();
+  std::shared_ptr<MemoryBudget> budget = self->budget_;
+  budget->Reserve(payload_bytes);
+  self->last_snapshot_ = SnapshotPtr(
+      snapshot.release(), [budget, payload_bytes](const ClipboardSnapshot* snapshot) {
+        budget->Release(payload_bytes);
+        delete snapshot;
+      });
+  self->Deliver(self->last_snapshot_);
+}
+
+// static
+void ClipboardReader::Fail(std::unique_ptr<ReadOperation> operation,
+                           const char* error_code,
+                           const std::string& error_message) {
+  ClipboardReader* self = operation->Resolve();
+  if (self == nullptr) {
+    return;
+  }
+
+  g_warning("FlutterPasteInput: Paste refused: %s", error_message.c_str());
+  RecordSelectionStats(*operation);
+  auto snapshot = std::make_shared<ClipboardSnapshot>();
+  snapshot->change_count = operation->snapshot->change_count;
+  if (self->ChecksContent(*operation)) {
+    // The new content cannot be compared; count the change.
+    self->EndContentCheck(true);
+    snapshot->change_count = self->monitor_->change_count();
+  }
+  snapshot->prefetched = operation->snapshot->prefetched;
+  snapshot->peak_bytes = operation->peak_bytes;
+  snapshot->completed_at = g_get_monotonic_time();
+  snapshot->error_code = error_code;
+  snapshot->error_message = error_message;
+  operation.reset();
+  self->Deliver(snapshot);
+}
+
+// static
+void ClipboardReader::RecordSelectionStats(const ReadOperation& operation) {
+  operation.stats->RecordElapsed(PasteStage::kSelection, operation.content_class,
+                                 operation.selection_us, 0, operation.selection_bytes);
+}
+
+// static
+void ClipboardReader::RecordDecodeStats(const ReadOperation& operation, gint64 started_at,
+                                        size_t bytes_in, GdkPixbuf* pixbuf) {
+  if (pixbuf == nullptr) {
+    operation.stats->Record(PasteStage::kDecode, PasteContentClass::kSmallImage, started_at,
+                            bytes_in, 0);
+    return;
+  }
+  operation.stats->Record(
+      PasteStage::kDecode,
+      ImageContentClass(gdk_pixbuf_get_width(pixbuf), gdk_pixbuf_get_height(pixbuf)),
+      started_at, bytes_in, gdk_pixbuf_get_byte_length(pixbuf));
+}
+
+void ClipboardReader::ReportProgress(size_t received, size_t expected) {
+  gint64 now = g_get_monotonic_time();
+  if (now - last_progress_at_ < static_cast<gint64>(kProgressIntervalMs) * 1000) {
+    return;
+  }
+  last_progress_at_ = now;
+
+  // Copied, as a callback might cancel its request.
+  std::vector<ProgressCallback> callbacks;
+  for (const Waiter& waiter : waiters_) {
+    if (waiter.progress) {
+      callbacks.push_back(waiter.progress);
+    }
+  }
+  for (const ProgressCallback& callback : callbacks) {
+    callback(received, expected);
+  }
+}
+
+void ClipboardReader::Deliver(SnapshotPtr snapshot) {
+  reading_ = false;
+  g_clear_object(&read_cancellable_);
+
+  // Callbacks may issue new reads; start from an empty waiter list.
+  std::vector<Waiter> waiters;
+  waiters.swap(waiters_);
+  for (Waiter& waiter : waiters) {
+    waiter.callback(snapshot);
+  }
+  // A prefetch nobody asked for yet is reported once a paste takes it.
+  if (!waiters.empty()) {
+    NotifyServed(snapshot);
+  }
+  // The read predates the owner change being checked.
+  if (check_pending_ && !reading_) {
+    StartRead(true);
+  }
+}
+
+void ClipboardReader::NotifyServed(const SnapshotPtr& snapshot) {
+  if (snapshot->items.empty() || served_snapshot_.lock() == snapshot) {
+    return;
+  }
+  served_snapshot_ = snapshot;
+  // Copied, as a listener might add another.
+  std::vector<SnapshotListener> listeners = snapshot_listeners_;
+  for (const SnapshotListener& listener : listeners) {
+    listener(snapshot);
+  }
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,336 @@
+#ifndef FLUTTER_PLUGIN_CLIPBOARD_READER_H_
+#define FLUTTER_PLUGIN_CLIPBOARD_READER_H_
+
+#include <gio/gio.h>
+#include <gtk/gtk.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "buffer_pool.h"
+#include "clipboard_monitor.h"
+#include "memory_budget.h"
+#include "memory_trimmer.h"
+#include "paste_stats.h"
+#include "x11_selection_reader.h"
+
+namespace flutter_paste_input {
+
+// One item of a clipboard snapshot, mirroring the Pigeon ClipboardItem.
+struct SnapshotItem {
+  PooledBuffer data;
+  std::string mime_type;
+  int64_t original_byte_size = 0;
+
+  // Image metadata, only meaningful when |is_image| is set.
+  bool is_image = false;
+  int64_t width = 0;
+  int64_t height = 0;
+  bool has_alpha = false;
+  int64_t frame_count = 0;
+};
+
+// Immutable result of one clipboard read, shared by every request it serves.
+struct ClipboardSnapshot {
+  // Images first, then text.
+  std::vector<SnapshotItem> items;
+
+  // ClipboardMonitor::change_count() when the read started.
+  int64_t change_count = 0;
+
+  // Monotonic time, in microseconds, at which the read completed.
+  gint64 completed_at = 0;
+
+  // True if the read was started by Prefetch() rather than a paste.
+  bool prefetched = false;
+
+  // Most bytes held natively at once while producing and delivering the
+  // snapshot, including the source selection and pixel data.
+  int64_t peak_bytes = 0;
+
+  // Set if the paste was refused, e.g. by the memory budget; |items| is
+  // then empty and the snapshot is never cached.
+  std::string error_code;
+  std::string error_message;
+};
+
+using SnapshotPtr = std::shared_ptr<const ClipboardSnapshot>;
+
+// Returns the class of the first image in |snapshot|, or kText if it has
+// none.
+PasteContentClass SnapshotContentClass(const ClipboardSnapshot& snapshot);
+
+// Returns the number of payload bytes held by |snapshot|.
+size_t SnapshotByteSize(const ClipboardSnapshot& snapshot);
+
+// Returns a hash of the items' MIME types and data, in order.
+uint64_t SnapshotContentHash(const ClipboardSnapshot& snapshot);
+
+// Reads the clipboard asynchronously and coalesces concurrent requests.
+//
+// A request that arrives while a read is in flight joins it, and one that
+// arrives within the coalescing window after a read completed reuses its
+// snapshot as long as the clipboard has not changed since. This turns a
+// held-down Ctrl+V into a single read and encode.
+//
+// Prefetch() warms the snapshot ahead of a paste, e.g. when a text field
+// gains focus. Image encoding always runs on a worker thread.
+//
+// The reader is the ClipboardMonitor's content check: when the owner
+// changes while a snapshot of the current content is cached, it reads the
+// new content right away and compares it with the snapshot. If only the
+// owner changed, e.g. a clipboard manager took over, the change count
+// stays put and the cached snapshot is kept.
+//
+// Image reads are admitted against a MemoryBudget before pixel data is
+// encoded. A paste that does not fit while other pastes hold buffers waits
+// for them; one that could never fit is downscaled, if allowed, or fails
+// with the error code "over-budget". Snapshots keep their payload reserved
+// until they are destroyed.
+//
+// On X11 image and UTF-8 text selections are fetched with
+// X11SelectionReader, so large INCR transfers report progress, stop at a
+// size cap ("too-large") and give up when the owner stalls ("timeout").
+// Legacy text encodings still go through GTK's conversion.
+//
+// The time spent waiting on the selection owner, decoding and encoding is
+// recorded in PasteStats.
+class ClipboardReader {
+ public:
+  // Receives the snapshot, or nullptr if the request was cancelled.
+  using Callback = std::function<void(SnapshotPtr snapshot)>;
+
+  // Receives every snapshot read successfully once it is handed to a paste
+  // request, after the requests it serves. A cached snapshot is reported
+  // once; a prefetch no paste takes is never reported.
+  using SnapshotListener = std::function<void(const SnapshotPtr& snapshot)>;
+
+  // Receives the progress of a large transfer, throttled to
+  // kProgressIntervalMs; |expected| is 0 if unknown.
+  using ProgressCallback = std::function<void(size_t received, size_t expected)>;
+
+  static constexpr guint kDefaultCoalesceWindowMs = 250;
+  static constexpr size_t kDefaultMaxPendingReads = 8;
+  static constexpr size_t kDefaultMaxTransferBytes = 256 * 1024 * 1024;
+  static constexpr guint kProgressIntervalMs = 100;
+
+  // How long a prefetched snapshot may serve pastes while the clipboard is
+  // unchanged.
+  static constexpr guint kPrefetchLifetimeMs = 10000;
+
+  ClipboardReader(GtkClipboard* clipboard, ClipboardMonitor* monitor,
+                  std::shared_ptr<MemoryBudget> budget,
+                  std::shared_ptr<PasteStats> stats);
+  ~ClipboardReader();
+
+  // Disallow copy and assign.
+  ClipboardReader(const ClipboardReader&) = delete;
+  ClipboardReader& operator=(const ClipboardReader&) = delete;
+
+  // Delivers a snapshot to |callback|, synchronously if a fresh one is
+  // available. Returns false, without calling |callback|, if the number of
+  // requests waiting on the in-flight read has reached the limit.
+  //
+  // A non-zero |request_id| allows the request to be cancelled. |progress|,
+  // if set, is called while a large selection is transferred.
+  bool Read(int64_t request_id, Callback callback,
+            ProgressCallback progress = nullptr);
+
+  // Cancels a waiting request, calling its callback with nullptr. If no
+  // paste is left waiting on the in-flight read, the read is abandoned:
+  // pending GTK replies are dropped on arrival, the encoder stops at its
+  // next chunk, and partial results are freed. Returns false if no request
+  // with |request_id| is waiting.
+  bool Cancel(int64_t request_id);
+
+  // Schedules a background read at idle priority, unless a snapshot of the
+  // current content is already available or a read is in flight.
+  void Prefetch();
+
+  // Drops the cached snapshot: at TrimLevel::kLow only if it can no longer
+  // be served, from kMedium on unconditionally, also cancelling a scheduled
+  // prefetch. At kCritical an in-flight read nobody waits on (a prefetch)
+  // is abandoned too. Returns the bytes released; a snapshot still
+  // referenced elsewhere, e.g. by a queued paste event, counts as zero.
+  size_t Trim(TrimLevel level);
+
+  void AddSnapshotListener(SnapshotListener listener);
+
+  void set_coalesce_window_ms(guint coalesce_window_ms) {
+    coalesce_window_ms_ = coalesce_window_ms;
+  }
+  void set_max_pending_reads(size_t max_pending_reads) {
+    max_pending_reads_ = max_pending_reads;
+  }
+  void set_downscale_over_budget(bool downscale_over_budget) {
+    downscale_over_budget_ = downscale_over_budget;
+  }
+  // 0 disables the cap.
+  void set_max_transfer_bytes(size_t max_transfer_bytes) {
+    max_transfer_bytes_ = max_transfer_bytes;
+  }
+
+ private:
+  // State of the in-flight read, handed from one GTK callback to the next.
+  struct ReadOperation;
+
+  struct Waiter {
+    int64_t request_id;
+    Callback callback;
+    ProgressCallback progress;
+  };
+
+  static void OnTargetsReceived(GtkClipboard* clipboard, GdkAtom* atoms,
+                                gint n_atoms, gpointer data);
+  static void OnImageContentsReceived(GtkClipboard* clipboard,
+                                      GtkSelectionData* selection,
+                                      gpointer data);
+  static void OnImageReceived(GtkClipboard* clipboard, GdkPixbuf* pixbuf,
+                              gpointer data);
+  static void OnTextReceived(GtkClipboard* clipboard, const gchar* text,
+                             gpointer data);
+  static void RequestNextImageTarget(std::unique_ptr<ReadOperation> operation);
+  // Receives the result of a transfer started by TransferTarget().
+  using TransferDone = void (*)(std::unique_ptr<ReadOperation> operation,
+                                PooledBuffer data, const char* error_code,
+                                const std::string& error_message);
+  // Fetches |target| with X11SelectionReader, if the display supports it,
+  // and continues with |done|. Returns the operation if the transfer could
+  // not start.
+  static std::unique_ptr<ReadOperation> TransferTarget(
+      std::unique_ptr<ReadOperation> operation, GdkAtom target, TransferDone done);
+  static void OnImageTransferred(std::unique_ptr<ReadOperation> operation,
+                                 PooledBuffer data, const char* error_code,
+                                 const std::string& error_message);
+  static void OnTextTransferred(std::unique_ptr<ReadOperation> operation,
+                                PooledBuffer data, const char* error_code,
+                                const std::string& error_message);
+  // Continues with |pixbuf|, or with the next image target if it is null.
+  static void ContinueWithPixbuf(std::unique_ptr<ReadOperation> operation,
+                                 GdkPixbuf* pixbuf);
+  static gboolean OnPrefetchIdle(gpointer user_data);
+  static void EncodeInThread(GTask* task, gpointer source_object,
+                             gpointer task_data, GCancellable* cancellable);
+  static void OnEncodeDone(GObject* source_object, GAsyncResult* result,
+                           gpointer data);
+
+  // Reserves the encoder's working set for |pixbuf| and starts encoding,
+  // downscaling, queueing or failing the read as the budget requires.
+  static void AdmitImage(std::unique_ptr<ReadOperation> operation,
+                         GdkPixbuf* pixbuf);
+  static void EncodeImage(std::unique_ptr<ReadOperation> operation,
+                          GdkPixbuf* pixbuf, int width, int height);
+
+  // Returns true if |snapshot| may be handed out for a new request.
+  bool IsFresh(const ClipboardSnapshot& snapshot) const;
+
+  // The monitor's content check. Returns false if no snapshot of the
+  // current content is cached to compare with.
+  bool CheckContent();
+  // True if |operation| started after the owner change being checked.
+  bool ChecksContent(const ReadOperation& operation) const;
+  // Settles the content check with the monitor.
+  void EndContentCheck(bool content_changed);
+
+  void StartRead(bool prefetch);
+
+  // Abandons the in-flight read; its remaining callbacks become no-ops.
+  void AbortRead();
+  // Withdraws the read from the memory budget's queue, if it waits there.
+  void CancelBudgetWait();
+
+  static void ReadText(std::unique_ptr<ReadOperation> operation);
+  static void Finish(std::unique_ptr<ReadOperation> operation);
+  static void Fail(std::unique_ptr<ReadOperation> operation,
+                   const char* error_code, const std::string& error_message);
+  // Counts the read's waits on the selection owner as one selection stage.
+  static void RecordSelectionStats(const ReadOperation& operation);
+  // Counts the decode of |bytes_in| bytes into |pixbuf|, null on failure.
+  static void RecordDecodeStats(const ReadOperation& operation, gint64 started_at,
+                                size_t bytes_in, GdkPixbuf* pixbuf);
+
+  // Ends the current read and hands |snapshot| to every waiter.
+  void Deliver(SnapshotPtr snapshot);
+  // Reports |snapshot|, just handed to a paste request, to the snapshot
+  // listeners unless it was already.
+  void NotifyServed(const SnapshotPtr& snapshot);
+
+  // Forwards transfer progress to the waiters, at most every
+  // kProgressIntervalMs.
+  void ReportProgress(size_t received, size_t expected);
+
+  GtkClipboard* clipboard_;
+  ClipboardMonitor* monitor_;
+  guint coalesce_window_ms_ = kDefaultCoalesceWindowMs;
+  size_t max_pending_reads_ = kDefaultMaxPendingReads;
+  std::shared_ptr<MemoryBudget> budget_;
+  std::shared_ptr<PasteStats> stats_;
+  bool downscale_over_budget_ = true;
+  size_t max_transfer_bytes_ = kDefaultMaxTransferBytes;
+
+  SnapshotPtr last_snapshot_;
+  guint prefetch_source_ = 0;
+
+  // True while an owner change waits for its content to be read, and the
+  // snapshot it is compared with.
+  bool check_pending_ = false;
+  std::weak_ptr<const ClipboardSnapshot> check_snapshot_;
+  uint64_t check_hash_ = 0;
+
+  // True while a read is in flight, even one nobody waits on yet.
+  bool reading_ = false;
+  bool read_is_prefetch_ = false;
+
+  // Identifies the current read; bumped when one is abandoned.
+  uint64_t read_serial_ = 0;
+  GCancellable* read_cancellable_ = nullptr;
+  // Ticket of the read's MemoryBudget::WaitFor(), 0 when not queued.
+  uint64_t budget_wait_ = 0;
+
+  std::vector<SnapshotListener> snapshot_listeners_;
+  // The last snapshot reported to the listeners.
+  std::weak_ptr<const ClipboardSnapshot> served_snapshot_;
+
+  // Requests waiting on the in-flight read; empty when idle.
+  std::vector<Waiter> waiters_;
+
+  // The in-flight X11 transfer of an image target, if any.
+  std::unique_ptr<X11SelectionReader> transfer_;
+  gint64 last_progress_at_ = 0;
+
+  // Outlives the reader while GTK requests are pending.
+  std::shared_ptr<ClipboardReader*> self_;
+};
+
+// Returns the bytes budgeted for encoding a |source_bytes| pixbuf, scaled
+// to |target_bytes| of pixel data first if the two differ.
+size_t EncodeWorkingSetBytes(size_t source_bytes, size_t target_bytes);
+
+// Picks the largest size, keeping the aspect ratio, at which encoding a
+// |width| x |height| image of |source_bytes| pixel data fits within
+// |limit_bytes|. Returns false if no size does.
+bool FitImageToBudget(size_t limit_bytes, size_t source_bytes, int* width,
+                      int* height);
+
+// Encodes |pixbuf| with the gdk-pixbuf saver |type| (e.g. "png") into
+// |out|, which is left empty on failure. Fails early once |cancellable| is
+// cancelled or the monotonic clock passes |deadline|, checked at each
+// chunk of output.
+bool EncodePixbuf(GdkPixbuf* pixbuf, const char* type, PooledBuffer* out,
+                  GCancellable* cancellable = nullptr, gint64 deadline = G_MAXINT64);
+
+// Decodes an encoded image. Returns a new reference, or nullptr if no
+// loader understands the data.
+GdkPixbuf* DecodePixbuf(const uint8_t* data, size_t length);
+
+// Re-encodes |pixbuf| as PNG into |item|, filling in the image metadata.
+// Fails early once |cancellable| is cancelled.
+bool EncodePixbufAsPng(GdkPixbuf* pixbuf, SnapshotItem* item,
+                       GCancellable* cancellable = nullptr);
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_CLIPBOARD_READER_H_
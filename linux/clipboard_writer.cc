@@ -0,0 +1,272 @@
+#include "clipboard_writer.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "clipboard_reader.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+// Target info values handed back to OnGet().
+constexpr guint kTextInfo = 0;
+constexpr guint kImageInfo = 1;
+// Rendition i is registered as kRenditionInfo + i.
+constexpr guint kRenditionInfo = 2;
+
+}  // namespace
+
+struct ClipboardWriter::Offer {
+  struct Rendition {
+    GdkAtom target;
+    std::string saver;
+    // Empty until first requested.
+    PooledBuffer data;
+  };
+
+  ~Offer() { g_clear_object(&decoded); }
+
+  // Returns rendition |index|, rendering it first if needed, or nullptr if
+  // the image cannot be converted or encoding passes |deadline|.
+  const PooledBuffer* Render(size_t index, gint64 deadline = G_MAXINT64);
+
+  std::weak_ptr<ClipboardWriter*> writer;
+  WriteContent content;
+  std::vector<Rendition> renditions;
+
+  // The source image, decoded while renditions are still missing.
+  GdkPixbuf* decoded = nullptr;
+};
+
+const PooledBuffer* ClipboardWriter::Offer::Render(size_t index, gint64 deadline) {
+  Rendition& rendition = renditions[index];
+  if (!rendition.data.empty()) {
+    return &rendition.data;
+  }
+
+  if (decoded == nullptr) {
+    decoded = DecodePixbuf(content.image.data(), content.image.size());
+    if (decoded == nullptr) {
+      g_warning("FlutterPasteInput: Cannot decode the copied %s image",
+                content.image_mime_type.c_str());
+      return nullptr;
+    }
+  }
+  if (!EncodePixbuf(decoded, rendition.saver.c_str(), &rendition.data, nullptr,
+                    deadline)) {
+    return nullptr;
+  }
+
+  // The pixels are only needed until every format has been rendered once.
+  if (std::all_of(renditions.begin(), renditions.end(),
+                  [](const Rendition& rendition) { return !rendition.data.empty(); })) {
+    g_clear_object(&decoded);
+  }
+  return &rendition.data;
+}
+
+ClipboardWriter::ClipboardWriter(GtkClipboard* clipboard)
+    : clipboard_(clipboard), self_(std::make_shared<ClipboardWriter*>(this)) {}
+
+ClipboardWriter::~ClipboardWriter() {
+  // The clipboard keeps serving the current offer, which no longer points
+  // back here once |self_| is gone.
+}
+
+// static
+std::string ClipboardWriter::SaverForMimeType(const std::string& mime_type) {
+  std::string saver;
+  GSList* formats = gdk_pixbuf_get_formats();
+  for (GSList* it = formats; it != nullptr && saver.empty(); it = it->next) {
+    GdkPixbufFormat* format = static_cast<GdkPixbufFormat*>(it->data);
+    if (!gdk_pixbuf_format_is_writable(format)) {
+      continue;
+    }
+    gchar** mime_types = gdk_pixbuf_format_get_mime_types(format);
+    for (gchar** type = mime_types; *type != nullptr; type++) {
+      if (mime_type == *type) {
+        gchar* name = gdk_pixbuf_format_get_name(format);
+        saver = name;
+        g_free(name);
+        break;
+      }
+    }
+    g_strfreev(mime_types);
+  }
+  g_slist_free(formats);
+  return saver;
+}
+
+bool ClipboardWriter::Set(WriteContent content, std::string* error_code,
+                          std::string* error_message) {
+  bool has_image = !content.image.empty();
+  if (!content.has_text && !has_image) {
+    *error_code = "invalid-argument";
+    *error_message = "Nothing to copy.";
+    return false;
+  }
+  if (has_image && content.image_mime_type.empty()) {
+    *error_code = "invalid-argument";
+    *error_message = "imageMimeType is required with image.";
+    return false;
+  }
+
+  auto offer = std::make_unique<Offer>();
+  offer->writer = self_;
+  std::vector<std::string> rendition_types;
+  for (const std::string& mime_type : content.rendered_image_types) {
+    // The image itself is always offered.
+    if (!has_image || mime_type == content.image_mime_type ||
+        std::find(rendition_types.begin(), rendition_types.end(), mime_type) !=
+            rendition_types.end()) {
+      continue;
+    }
+    std::string saver = SaverForMimeType(mime_type);
+    if (saver.empty()) {
+      *error_code = "unsupported-format";
+      *error_message = "Cannot render images as " + mime_type + ".";
+      return false;
+    }
+    rendition_types.push_back(mime_type);
+    offer->renditions.push_back(
+        {gdk_atom_intern(mime_type.c_str(), FALSE), saver, PooledBuffer()});
+  }
+
+  GtkTargetList* targets = gtk_target_list_new(nullptr, 0);
+  if (content.has_text) {
+    gtk_target_list_add_text_targets(targets, kTextInfo);
+  }
+  if (has_image) {
+    gtk_target_list_add(targets, gdk_atom_intern(content.image_mime_type.c_str(), FALSE),
+                        0, kImageInfo);
+    for (size_t i = 0; i < offer->renditions.size(); i++) {
+      gtk_target_list_add(targets, offer->renditions[i].target, 0,
+                          kRenditionInfo + static_cast<guint>(i));
+    }
+  }
+  offer->content = std::move(content);
+
+  gint n_entries = 0;
+  GtkTargetEntry* entries = gtk_target_table_new_from_list(targets, &n_entries);
+  // Clears the previous offer, which may be ours, before returning.
+  bool owned = gtk_clipboard_set_with_data(clipboard_, entries, n_entries, OnGet,
+                                           OnClear, offer.get());
+  gtk_target_table_free(entries, n_entries);
+  gtk_target_list_unref(targets);
+  if (!owned) {
+    *error_code = "unavailable";
+    *error_message = "Could not take ownership of the clipboard.";
+    return false;
+  }
+
+  offer_ = offer.release();
+  return true;
+}
+
+size_t ClipboardWriter::Store() {
+  if (offer_ == nullptr) {
+    return 0;
+  }
+  const WriteContent& content = offer_->content;
+  size_t limit = max_store_bytes_ != 0 ? max_store_bytes_ : SIZE_MAX;
+  gint64 deadline = store_time_budget_ms_ != 0
+                        ? g_get_monotonic_time() + store_time_budget_ms_ * G_GINT64_CONSTANT(1000)
+                        : G_MAXINT64;
+
+  // Cheapest first: text, then the image as given, then renditions in the
+  // order the app listed them. Each format is offered if it still fits, so
+  // a compact rendition is kept even when the original is too large.
+  GtkTargetList* targets = gtk_target_list_new(nullptr, 0);
+  size_t stored = 0;
+  if (content.has_text && content.text.size() <= limit) {
+    gtk_target_list_add_text_targets(targets, kTextInfo);
+    stored += content.text.size();
+  }
+  if (!content.image.empty() && stored + content.image.size() <= limit) {
+    gtk_target_list_add(targets, gdk_atom_intern(content.image_mime_type.c_str(), FALSE),
+                        0, kImageInfo);
+    stored += content.image.size();
+  }
+  for (size_t i = 0; i < offer_->renditions.size(); i++) {
+    // Whatever is not rendered by the deadline is left out. An encode still
+    // running then stops at its next chunk; only decoding the source, done
+    // once for all renditions, can overrun the budget.
+    if (offer_->renditions[i].data.empty() && g_get_monotonic_time() >= deadline) {
+      break;
+    }
+    const PooledBuffer* data = offer_->Render(i, deadline);
+    if (data == nullptr || stored + data->size() > limit) {
+      continue;
+    }
+    gtk_target_list_add(targets, offer_->renditions[i].target, 0,
+                        kRenditionInfo + static_cast<guint>(i));
+    stored += data->size();
+  }
+
+  gint n_entries = 0;
+  GtkTargetEntry* entries = gtk_target_table_new_from_list(targets, &n_entries);
+  gtk_target_list_unref(targets);
+  if (n_entries == 0) {
+    gtk_target_table_free(entries, n_entries);
+    return 0;
+  }
+  gtk_clipboard_set_can_store(clipboard_, entries, n_entries);
+  gtk_target_table_free(entries, n_entries);
+  // Every target offered is ready, so the manager is served from memory.
+  gtk_clipboard_store(clipboard_);
+  return stored;
+}
+
+size_t ClipboardWriter::Trim(TrimLevel level) {
+  if (offer_ == nullptr) {
+    return 0;
+  }
+  size_t released = 0;
+  if (offer_->decoded != nullptr) {
+    released += gdk_pixbuf_get_byte_length(offer_->decoded);
+    g_clear_object(&offer_->decoded);
+  }
+  if (level >= TrimLevel::kMedium) {
+    for (Offer::Rendition& rendition : offer_->renditions) {
+      released += rendition.data.size();
+      rendition.data.Reset();
+    }
+  }
+  return released;
+}
+
+// static
+void ClipboardWriter::OnGet(GtkClipboard* clipboard, GtkSelectionData* selection,
+                            guint info, gpointer data) {
+  Offer* offer = static_cast<Offer*>(data);
+  const WriteContent& content = offer->content;
+  if (info == kTextInfo) {
+    gtk_selection_data_set_text(selection, content.text.c_str(),
+                                static_cast<gint>(content.text.size()));
+    return;
+  }
+
+  const PooledBuffer* image = nullptr;
+  if (info == kImageInfo) {
+    image = &content.image;
+  } else if (info - kRenditionInfo < offer->renditions.size()) {
+    // Rendered on the main thread: GTK needs the data before returning.
+    image = offer->Render(info - kRenditionInfo);
+  }
+  if (image != nullptr) {
+    gtk_selection_data_set(selection, gtk_selection_data_get_target(selection), 8,
+                           image->data(), static_cast<gint>(image->size()));
+  }
+}
+
+// static
+void ClipboardWriter::OnClear(GtkClipboard* clipboard, gpointer data) {
+  std::unique_ptr<Offer> offer(static_cast<Offer*>(data));
+  std::shared_ptr<ClipboardWriter*> writer = offer->writer.lock();
+  if (writer && (*writer)->offer_ == offer.get()) {
+    (*writer)->offer_ = nullptr;
+  }
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,104 @@
+#ifndef FLUTTER_PLUGIN_CLIPBOARD_WRITER_H_
+#define FLUTTER_PLUGIN_CLIPBOARD_WRITER_H_
+
+#include <gtk/gtk.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "buffer_pool.h"
+#include "memory_trimmer.h"
+
+namespace flutter_paste_input {
+
+// Content to place on the clipboard, mirroring the Pigeon ClipboardWrite.
+struct WriteContent {
+  bool has_text = false;
+  std::string text;
+
+  // Encoded image, offered as is under |image_mime_type|.
+  PooledBuffer image;
+  std::string image_mime_type;
+
+  // Further image MIME types rendered from |image| on demand.
+  std::vector<std::string> rendered_image_types;
+};
+
+// Owns the clipboard on behalf of the app.
+//
+// Content is offered with gtk_clipboard_set_with_data, so nothing is
+// converted up front: text and the image are served as given, and each
+// extra image format is decoded and encoded only when another application
+// asks for that target, then kept for later requests. Renditions can be
+// dropped under memory pressure and are rendered again when asked for.
+//
+// Store() hands the content to the clipboard manager so it survives the
+// app. Only formats within the store size limit are offered for that, and
+// renditions not requested yet are rendered up front, as far as the time
+// budget allows, instead of while the manager waits.
+//
+// Main thread only.
+class ClipboardWriter {
+ public:
+  static constexpr size_t kDefaultMaxStoreBytes = 64 * 1024 * 1024;
+  static constexpr guint kDefaultStoreTimeBudgetMs = 1000;
+
+  explicit ClipboardWriter(GtkClipboard* clipboard);
+  ~ClipboardWriter();
+
+  // Disallow copy and assign.
+  ClipboardWriter(const ClipboardWriter&) = delete;
+  ClipboardWriter& operator=(const ClipboardWriter&) = delete;
+
+  // Takes ownership of the clipboard, offering |content|. On failure the
+  // clipboard is untouched and |error_code| is "invalid-argument",
+  // "unsupported-format" or "unavailable".
+  bool Set(WriteContent content, std::string* error_code,
+           std::string* error_message);
+
+  // True while the clipboard still holds content set here.
+  bool owns_clipboard() const { return offer_ != nullptr; }
+
+  // Asks the clipboard manager, if there is one, to take a copy of the
+  // content. Blocks in a nested main loop until the manager is done or GTK
+  // gives up on it. Returns the bytes offered for storing, 0 if the
+  // clipboard holds nothing set here.
+  size_t Store();
+
+  // Drops the decoded source image, and from TrimLevel::kMedium on the
+  // rendered formats too. Returns the bytes released.
+  size_t Trim(TrimLevel level);
+
+  // Returns the name of the gdk-pixbuf saver writing |mime_type|, or an
+  // empty string if there is none.
+  static std::string SaverForMimeType(const std::string& mime_type);
+
+  // 0 disables either limit.
+  void set_max_store_bytes(size_t max_store_bytes) {
+    max_store_bytes_ = max_store_bytes;
+  }
+  void set_store_time_budget_ms(guint store_time_budget_ms) {
+    store_time_budget_ms_ = store_time_budget_ms;
+  }
+
+ private:
+  // What the clipboard currently offers; owned by GTK until it clears it.
+  struct Offer;
+
+  static void OnGet(GtkClipboard* clipboard, GtkSelectionData* selection,
+                    guint info, gpointer data);
+  static void OnClear(GtkClipboard* clipboard, gpointer data);
+
+  GtkClipboard* clipboard_;
+  Offer* offer_ = nullptr;
+  size_t max_store_bytes_ = kDefaultMaxStoreBytes;
+  guint store_time_budget_ms_ = kDefaultStoreTimeBudgetMs;
+
+  // Lets an offer that outlives the writer tell it is gone.
+  std::shared_ptr<ClipboardWriter*> self_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_CLIPBOARD_WRITER_H_
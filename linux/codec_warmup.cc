@@ -0,0 +1,78 @@
+#include "codec_warmup.h"
+
+#include <gdk-pixbuf/gdk-pixbuf.h>
+#include <gio/gio.h>
+
+#include "buffer_pool.h"
+#include "clipboard_reader.h"
+#include "paste_tracer.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+// Small enough to be instant, large enough for a real deflate stream.
+constexpr int kWarmUpImageSize = 16;
+
+// Decodes |data| with the loader for |type|, loading its module.
+void WarmUpLoader(const char* type, const uint8_t* data, size_t length) {
+  GdkPixbufLoader* loader = gdk_pixbuf_loader_new_with_type(type, nullptr);
+  if (loader == nullptr) {
+    return;
+  }
+  if (data != nullptr) {
+    gdk_pixbuf_loader_write(loader, data, length, nullptr);
+  }
+  // Closing without (complete) data fails; only the module load matters.
+  gdk_pixbuf_loader_close(loader, nullptr);
+  g_object_unref(loader);
+}
+
+void WarmUpInThread(GTask* task, gpointer source_object, gpointer task_data,
+                    GCancellable* cancellable) {
+  TraceScope trace("codec-warmup");
+  gint64 started_at = g_get_monotonic_time();
+
+  // Parses loaders.cache.
+  g_slist_free(gdk_pixbuf_get_formats());
+
+  // Encode through the same path as a paste, then decode the result.
+  GdkPixbuf* pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, TRUE, 8,
+                                     kWarmUpImageSize, kWarmUpImageSize);
+  if (pixbuf != nullptr) {
+    gdk_pixbuf_fill(pixbuf, 0x336699ff);
+    SnapshotItem item;
+    if (EncodePixbufAsPng(pixbuf, &item)) {
+      WarmUpLoader("png", item.data.data(), item.data.size());
+    }
+    g_object_unref(pixbuf);
+  }
+  WarmUpLoader("jpeg", nullptr, 0);
+
+  // A first large block, kept on the free list for the first image paste.
+  BufferPool* pool = BufferPool::Get();
+  pool->Return(pool->Acquire(BufferPool::kMmapThresholdBytes));
+
+  g_debug("FlutterPasteInput: Codec warm-up took %" G_GINT64_FORMAT " us",
+          g_get_monotonic_time() - started_at);
+  g_task_return_boolean(task, TRUE);
+}
+
+}  // namespace
+
+void StartCodecWarmUp() {
+  // Called from plugin registration, on the main thread.
+  static bool started = false;
+  if (started) {
+    return;
+  }
+  started = true;
+
+  GTask* task = g_task_new(nullptr, nullptr, nullptr, nullptr);
+  // Yield to paste encodes queued on the same pool.
+  g_task_set_priority(task, G_PRIORITY_LOW);
+  g_task_run_in_thread(task, WarmUpInThread);
+  g_object_unref(task);
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,16 @@
+#ifndef FLUTTER_PLUGIN_CODEC_WARMUP_H_
+#define FLUTTER_PLUGIN_CODEC_WARMUP_H_
+
+namespace flutter_paste_input {
+
+// Prepares the image pipeline on a worker thread so that the first paste
+// does not pay for it on the platform thread: gdk-pixbuf reads
+// loaders.cache and dlopens its PNG and JPEG modules, the PNG encoder
+// sets up zlib, and the buffer pool maps a first large block.
+//
+// Runs at most once per process; later calls do nothing.
+void StartCodecWarmUp();
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_CODEC_WARMUP_H_
@@ -0,0 +1,48 @@
+#include "content_hash.h"
+
+#include <cstring>
+
+namespace flutter_paste_input {
+
+namespace {
+
+constexpr uint64_t kPrime1 = 0x9e3779b185ebca87ULL;
+constexpr uint64_t kPrime2 = 0xc2b2ae3d27d4eb4fULL;
+
+inline uint64_t Rotl(uint64_t value, int bits) {
+  return (value << bits) | (value >> (64 - bits));
+}
+
+// Finalizer from MurmurHash3; spreads every input bit over the output.
+inline uint64_t Mix(uint64_t value) {
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+}  // namespace
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  uint64_t hash = seed ^ (static_cast<uint64_t>(size) * kPrime1);
+
+  while (size >= 8) {
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
+    hash = Rotl(hash ^ (word * kPrime2), 31) * kPrime1;
+    bytes += 8;
+    size -= 8;
+  }
+
+  uint64_t tail = 0;
+  if (size > 0) {
+    memcpy(&tail, bytes, size);
+  }
+  hash ^= Mix(tail ^ kPrime2);
+  return Mix(hash);
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,20 @@
+#ifndef FLUTTER_PLUGIN_CONTENT_HASH_H_
+#define FLUTTER_PLUGIN_CONTENT_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace flutter_paste_input {
+
+// Fast non-cryptographic 64-bit hash used to recognise identical clipboard
+// content. Hashes can be chained by passing a previous result as |seed|.
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+inline uint64_t HashString(const std::string& value, uint64_t seed = 0) {
+  return HashBytes(value.data(), value.size(), seed);
+}
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_CONTENT_HASH_H_
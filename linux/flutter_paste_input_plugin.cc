@@ -7,11 +7,18 @@
 
 #include <cstring>
 #include <cstdlib>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <string>
 
+#include "clipboard_reader.h"
+#include "codec_warmup.h"
 #include "flutter_paste_input_plugin_private.h"
 #include "messages.g.h"
+#include "paste_event_dispatcher.h"
+#include "paste_tracer.h"
+#include "shared_clipboard.h"
 
 #define FLUTTER_PASTE_INPUT_PLUGIN(obj) \
   (G_TYPE_CHECK_INSTANCE_CAST((obj), flutter_paste_input_plugin_get_type(), \
@@ -19,64 +26,169 @@
 
 #define TEMP_FILE_PREFIX "paste_"
 
+// Pigeon codec type ids of custom classes (see messages.g.cc).
+#define CLIPBOARD_ITEM_TYPE_ID 129
+#define CLIPBOARD_HISTORY_ENTRY_TYPE_ID 135
+#define CLIPBOARD_HISTORY_MATCH_TYPE_ID 136
+#define PASTE_STAGE_STATS_TYPE_ID 137
+#define PASTE_LATENCY_STATS_TYPE_ID 138
+
 struct _FlutterPasteInputPlugin {
   GObject parent_instance;
   FlutterPasteInputPasteInputFlutterApi* flutter_api;
+  // Process-wide clipboard state; one reference per engine.
+  flutter_paste_input::SharedClipboard* clipboard;
+  // Per-engine event queue towards this engine's Dart side.
+  flutter_paste_input::PasteEventDispatcher* paste_events;
+  // View of the engine, if any (weak).
+  GtkWidget* view;
+  // Monotonic time of the oldest paste whose snapshot has not been sent to
+  // Dart yet, or 0.
+  gint64 paste_requested_at;
 };
 
 G_DEFINE_TYPE(FlutterPasteInputPlugin, flutter_paste_input_plugin, g_object_get_type())
 
 // Forward declarations
-static std::vector<uint8_t> get_image_data(GtkClipboard* clipboard);
-static std::string get_text_data(GtkClipboard* clipboard);
+static FlutterPasteInputClipboardContent* content_from_snapshot(
+    const flutter_paste_input::ClipboardSnapshot& snapshot);
 static void clear_temp_files();
+static void send_paste_event(FlutterPasteInputPlugin* self,
+                             const flutter_paste_input::ClipboardSnapshot& snapshot);
+
+// Live plugin instances, one per engine (weak), for event routing.
+static GList* g_plugin_instances = nullptr;
+
+// Main context marshaling
+
+// Host API calls made from a background isolate arrive like any other
+// platform message, and their replies are routed back to that isolate by
+// the engine. Clipboard, reader and dispatcher state is only ever touched
+// on the default main context, so work is queued onto it unless the
+// calling thread already runs it.
+struct MainContextCall {
+  FlutterPasteInputPlugin* plugin;
+  std::function<void(FlutterPasteInputPlugin*)> work;
+};
 
-// Global plugin instance for VTable callbacks
-static FlutterPasteInputPlugin* g_plugin_instance = nullptr;
+static gboolean run_main_context_call(gpointer data) {
+  MainContextCall* call = static_cast<MainContextCall*>(data);
+  call->work(call->plugin);
+  return G_SOURCE_REMOVE;
+}
 
-// Pigeon VTable Implementation
+static void free_main_context_call(gpointer data) {
+  MainContextCall* call = static_cast<MainContextCall*>(data);
+  g_object_unref(call->plugin);
+  delete call;
+}
 
-static FlutterPasteInputPasteInputHostApiGetClipboardContentResponse*
-handle_get_clipboard_content(gpointer user_data) {
-  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
-  g_autoptr(FlValue) items = fl_value_new_list();
+static void run_on_main_context(FlutterPasteInputPlugin* self,
+                                std::function<void(FlutterPasteInputPlugin*)> work) {
+  MainContextCall* call = new MainContextCall{
+      FLUTTER_PASTE_INPUT_PLUGIN(g_object_ref(self)), std::move(work)};
+  g_main_context_invoke_full(nullptr, G_PRIORITY_DEFAULT, run_main_context_call,
+                             call, free_main_context_call);
+}
 
-  // Check for image first
-  if (gtk_clipboard_wait_is_image_available(clipboard)) {
-    std::vector<uint8_t> image_data = get_image_data(clipboard);
-    if (!image_data.empty()) {
-      FlutterPasteInputClipboardItem* item =
-          flutter_paste_input_clipboard_item_new(
-              image_data.data(),
-              image_data.size(),
-              "image/png");
-      fl_value_append(items, fl_value_new_custom_object(G_OBJECT(item)));
-      g_object_unref(item);
-    }
+// Sends transfer progress of |request_id| to Dart.
+static void send_paste_progress(FlutterPasteInputPlugin* self, int64_t request_id,
+                                size_t received, size_t expected) {
+  if (self->flutter_api == nullptr) {
+    return;
   }
+  int64_t expected_bytes = static_cast<int64_t>(expected);
+  FlutterPasteInputPasteProgress* progress = flutter_paste_input_paste_progress_new(
+      request_id, static_cast<int64_t>(received), expected != 0 ? &expected_bytes : nullptr);
+  flutter_paste_input_paste_input_flutter_api_on_paste_progress(
+      self->flutter_api, progress, nullptr, nullptr, nullptr);
+  g_object_unref(progress);
+}
 
-  // Check for text
-  if (gtk_clipboard_wait_is_text_available(clipboard)) {
-    std::string text = get_text_data(clipboard);
-    if (!text.empty()) {
-      FlutterPasteInputClipboardItem* item =
-          flutter_paste_input_clipboard_item_new(
-              reinterpret_cast<const uint8_t*>(text.data()),
-              text.size(),
-              "text/plain");
-      fl_value_append(items, fl_value_new_custom_object(G_OBJECT(item)));
-      g_object_unref(item);
-    }
+// Pigeon VTable Implementation
+
+static void read_clipboard_for_request(
+    FlutterPasteInputPlugin* self, int64_t request_id, gint64 requested_at,
+    std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle) {
+  if (self->clipboard == nullptr) {
+    flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_content(
+        handle.get(), "unavailable", "The plugin has been disposed.", nullptr);
+    return;
   }
 
-  FlutterPasteInputClipboardContent* content =
-      flutter_paste_input_clipboard_content_new(items);
+  // Anonymous requests cannot be told apart in Dart, so get no progress.
+  flutter_paste_input::ClipboardReader::ProgressCallback progress;
+  if (request_id != 0) {
+    std::shared_ptr<FlutterPasteInputPlugin> plugin(
+        FLUTTER_PASTE_INPUT_PLUGIN(g_object_ref(self)), g_object_unref);
+    progress = [plugin, request_id](size_t received, size_t expected) {
+      send_paste_progress(plugin.get(), request_id, received, expected);
+    };
+  }
 
-  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* response =
-      flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new(content);
+  flutter_paste_input::PasteStats* stats = self->clipboard->stats();
+  bool accepted = self->clipboard->reader()->Read(
+      request_id, [handle, stats, requested_at](flutter_paste_input::SnapshotPtr snapshot) {
+        if (!snapshot) {
+          flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_content(
+              handle.get(), "cancelled", "The paste request was cancelled.", nullptr);
+          return;
+        }
+        if (!snapshot->error_code.empty()) {
+          flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_content(
+              handle.get(), snapshot->error_code.c_str(), snapshot->error_message.c_str(),
+              nullptr);
+          return;
+        }
+        // The reply is encoded by the codec as it is sent.
+        gint64 serialize_started_at = g_get_monotonic_time();
+        {
+          flutter_paste_input::TraceScope trace("serialize");
+          FlutterPasteInputClipboardContent* content = content_from_snapshot(*snapshot);
+          flutter_paste_input_paste_input_host_api_respond_get_clipboard_content(
+              handle.get(), content);
+          g_object_unref(content);
+        }
+        size_t payload_bytes = flutter_paste_input::SnapshotByteSize(*snapshot);
+        flutter_paste_input::PasteContentClass content_class =
+            flutter_paste_input::SnapshotContentClass(*snapshot);
+        stats->Record(flutter_paste_input::PasteStage::kSerialize, content_class,
+                      serialize_started_at, payload_bytes, payload_bytes);
+        stats->Record(flutter_paste_input::PasteStage::kTotal, content_class, requested_at, 0,
+                      payload_bytes);
+      },
+      std::move(progress));
+
+  if (!accepted) {
+    flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_content(
+        handle.get(), "busy", "Too many paste requests are waiting for the clipboard.",
+        nullptr);
+  }
+}
 
-  g_object_unref(content);
-  return response;
+static void handle_get_clipboard_content(
+    int64_t request_id,
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  // Held until the snapshot arrives; released even if the read is dropped,
+  // which ends the request in the trace.
+  flutter_paste_input::PasteTracer::Get()->AsyncBegin(
+      "paste", reinterpret_cast<uintptr_t>(response_handle));
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      [](FlutterPasteInputPasteInputHostApiResponseHandle* handle) {
+        flutter_paste_input::PasteTracer::Get()->AsyncEnd("paste",
+                                                          reinterpret_cast<uintptr_t>(handle));
+        g_object_unref(handle);
+      });
+
+  // Latency is counted from here, the earliest the plugin sees the request.
+  gint64 requested_at = g_get_monotonic_time();
+  run_on_main_context(self, [request_id, requested_at, handle](FlutterPasteInputPlugin* plugin) {
+    read_clipboard_for_request(plugin, request_id, requested_at, handle);
+  });
 }
 
 static FlutterPasteInputPasteInputHostApiClearTempFilesResponse*
@@ -85,12 +197,535 @@ handle_clear_temp_files(gpointer user_data) {
   return flutter_paste_input_paste_input_host_api_clear_temp_files_response_new();
 }
 
-static FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse*
-handle_get_platform_version(gpointer user_data) {
+FlMethodResponse* get_platform_version() {
   struct utsname uname_data = {};
   uname(&uname_data);
   g_autofree gchar* version = g_strdup_printf("Linux %s", uname_data.release);
-  return flutter_paste_input_paste_input_host_api_get_platform_version_response_new(version);
+  g_autoptr(FlValue) result = fl_value_new_string(version);
+  return FL_METHOD_RESPONSE(fl_method_success_response_new(result));
+}
+
+// Delegates to get_platform_version(), which the unit tests call.
+static FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse*
+handle_get_platform_version(gpointer user_data) {
+  g_autoptr(FlMethodResponse) response = get_platform_version();
+  FlValue* version =
+      fl_method_success_response_get_result(FL_METHOD_SUCCESS_RESPONSE(response));
+  return flutter_paste_input_paste_input_host_api_get_platform_version_response_new(
+      fl_value_get_string(version));
+}
+
+static void handle_probe_clipboard(
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [handle](FlutterPasteInputPlugin* plugin) {
+    if (plugin->clipboard == nullptr) {
+      flutter_paste_input_paste_input_host_api_respond_error_probe_clipboard(
+          handle.get(), "unavailable", "The plugin has been disposed.", nullptr);
+      return;
+    }
+
+    g_autoptr(FlValue) mime_types = fl_value_new_list();
+    for (const std::string& mime_type : plugin->clipboard->monitor()->mime_types()) {
+      fl_value_append_take(mime_types, fl_value_new_string(mime_type.c_str()));
+    }
+
+    FlutterPasteInputClipboardProbe* probe =
+        flutter_paste_input_clipboard_probe_new(
+            plugin->clipboard->monitor()->change_count(), mime_types);
+    flutter_paste_input_paste_input_host_api_respond_probe_clipboard(handle.get(), probe);
+    g_object_unref(probe);
+  });
+}
+
+static FlutterPasteInputPasteInputHostApiConfigureResponse*
+handle_configure(FlutterPasteInputPasteInputConfig* config, gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  int64_t* coalesce_window_ms =
+      flutter_paste_input_paste_input_config_get_coalesce_window_ms(config);
+  if (coalesce_window_ms != nullptr && *coalesce_window_ms < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "coalesceWindowMs must not be negative.", nullptr);
+  }
+
+  int64_t* max_pending_reads =
+      flutter_paste_input_paste_input_config_get_max_pending_reads(config);
+  if (max_pending_reads != nullptr && *max_pending_reads < 1) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "maxPendingReads must be at least 1.", nullptr);
+  }
+
+  int64_t* max_outstanding_events =
+      flutter_paste_input_paste_input_config_get_max_outstanding_events(config);
+  if (max_outstanding_events != nullptr && *max_outstanding_events < 1) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "maxOutstandingEvents must be at least 1.", nullptr);
+  }
+
+  int64_t* memory_budget_bytes =
+      flutter_paste_input_paste_input_config_get_memory_budget_bytes(config);
+  if (memory_budget_bytes != nullptr && *memory_budget_bytes < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "memoryBudgetBytes must not be negative.", nullptr);
+  }
+
+  int64_t* max_transfer_bytes =
+      flutter_paste_input_paste_input_config_get_max_transfer_bytes(config);
+  if (max_transfer_bytes != nullptr && *max_transfer_bytes < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "maxTransferBytes must not be negative.", nullptr);
+  }
+
+  int64_t* clipboard_store_max_bytes =
+      flutter_paste_input_paste_input_config_get_clipboard_store_max_bytes(config);
+  if (clipboard_store_max_bytes != nullptr && *clipboard_store_max_bytes < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "clipboardStoreMaxBytes must not be negative.", nullptr);
+  }
+
+  int64_t* history_max_entries =
+      flutter_paste_input_paste_input_config_get_history_max_entries(config);
+  if (history_max_entries != nullptr && *history_max_entries < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "historyMaxEntries must not be negative.", nullptr);
+  }
+
+  int64_t* history_max_bytes =
+      flutter_paste_input_paste_input_config_get_history_max_bytes(config);
+  if (history_max_bytes != nullptr && *history_max_bytes < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "historyMaxBytes must not be negative.", nullptr);
+  }
+
+  int64_t* history_max_disk_bytes =
+      flutter_paste_input_paste_input_config_get_history_max_disk_bytes(config);
+  if (history_max_disk_bytes != nullptr && *history_max_disk_bytes < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "historyMaxDiskBytes must not be negative.", nullptr);
+  }
+
+  int64_t* clipboard_store_time_budget_ms =
+      flutter_paste_input_paste_input_config_get_clipboard_store_time_budget_ms(config);
+  if (clipboard_store_time_budget_ms != nullptr && *clipboard_store_time_budget_ms < 0) {
+    return flutter_paste_input_paste_input_host_api_configure_response_new_error(
+        "invalid-argument", "clipboardStoreTimeBudgetMs must not be negative.", nullptr);
+  }
+
+  // Keep the config alive until it has been applied.
+  std::shared_ptr<FlutterPasteInputPasteInputConfig> settings(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_CONFIG(g_object_ref(config)), g_object_unref);
+  run_on_main_context(self, [settings](FlutterPasteInputPlugin* plugin) {
+    if (plugin->clipboard == nullptr) {
+      return;
+    }
+    int64_t* coalesce_window_ms =
+        flutter_paste_input_paste_input_config_get_coalesce_window_ms(settings.get());
+    if (coalesce_window_ms != nullptr) {
+      plugin->clipboard->reader()->set_coalesce_window_ms(static_cast<guint>(*coalesce_window_ms));
+    }
+    int64_t* max_pending_reads =
+        flutter_paste_input_paste_input_config_get_max_pending_reads(settings.get());
+    if (max_pending_reads != nullptr) {
+      plugin->clipboard->reader()->set_max_pending_reads(static_cast<size_t>(*max_pending_reads));
+    }
+    int64_t* max_outstanding_events =
+        flutter_paste_input_paste_input_config_get_max_outstanding_events(settings.get());
+    if (max_outstanding_events != nullptr) {
+      plugin->paste_events->set_max_outstanding(static_cast<size_t>(*max_outstanding_events));
+    }
+    int64_t* memory_budget_bytes =
+        flutter_paste_input_paste_input_config_get_memory_budget_bytes(settings.get());
+    if (memory_budget_bytes != nullptr) {
+      plugin->clipboard->budget()->set_limit_bytes(static_cast<size_t>(*memory_budget_bytes));
+    }
+    gboolean* downscale_over_budget_images =
+        flutter_paste_input_paste_input_config_get_downscale_over_budget_images(settings.get());
+    if (downscale_over_budget_images != nullptr) {
+      plugin->clipboard->reader()->set_downscale_over_budget(*downscale_over_budget_images);
+    }
+    int64_t* max_transfer_bytes =
+        flutter_paste_input_paste_input_config_get_max_transfer_bytes(settings.get());
+    if (max_transfer_bytes != nullptr) {
+      plugin->clipboard->reader()->set_max_transfer_bytes(static_cast<size_t>(*max_transfer_bytes));
+    }
+    int64_t* clipboard_store_max_bytes =
+        flutter_paste_input_paste_input_config_get_clipboard_store_max_bytes(settings.get());
+    if (clipboard_store_max_bytes != nullptr) {
+      plugin->clipboard->writer()->set_max_store_bytes(
+          static_cast<size_t>(*clipboard_store_max_bytes));
+    }
+    int64_t* clipboard_store_time_budget_ms =
+        flutter_paste_input_paste_input_config_get_clipboard_store_time_budget_ms(settings.get());
+    if (clipboard_store_time_budget_ms != nullptr) {
+      plugin->clipboard->writer()->set_store_time_budget_ms(
+          static_cast<guint>(*clipboard_store_time_budget_ms));
+    }
+    int64_t* history_max_entries =
+        flutter_paste_input_paste_input_config_get_history_max_entries(settings.get());
+    if (history_max_entries != nullptr) {
+      plugin->clipboard->history()->set_max_entries(static_cast<size_t>(*history_max_entries));
+    }
+    int64_t* history_max_bytes =
+        flutter_paste_input_paste_input_config_get_history_max_bytes(settings.get());
+    if (history_max_bytes != nullptr) {
+      plugin->clipboard->history()->set_max_bytes(static_cast<size_t>(*history_max_bytes));
+    }
+    int64_t* history_max_disk_bytes =
+        flutter_paste_input_paste_input_config_get_history_max_disk_bytes(settings.get());
+    if (history_max_disk_bytes != nullptr) {
+      plugin->clipboard->history()->set_max_disk_bytes(
+          static_cast<size_t>(*history_max_disk_bytes));
+    }
+    gboolean* persist_history =
+        flutter_paste_input_paste_input_config_get_persist_history(settings.get());
+    if (persist_history != nullptr) {
+      plugin->clipboard->SetHistoryPersistent(*persist_history);
+    }
+    const gchar* trace_file =
+        flutter_paste_input_paste_input_config_get_trace_file(settings.get());
+    if (trace_file != nullptr) {
+      plugin->clipboard->SetTraceFile(trace_file);
+    }
+  });
+
+  return flutter_paste_input_paste_input_host_api_configure_response_new();
+}
+
+static FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse*
+handle_prefetch_clipboard(gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+  run_on_main_context(self, [](FlutterPasteInputPlugin* plugin) {
+    if (plugin->clipboard != nullptr) {
+      plugin->clipboard->reader()->Prefetch();
+    }
+  });
+  return flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_new();
+}
+
+static FlutterPasteInputPasteInputHostApiCancelPasteResponse*
+handle_cancel_paste(int64_t request_id, gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+  run_on_main_context(self, [request_id](FlutterPasteInputPlugin* plugin) {
+    if (plugin->clipboard != nullptr) {
+      plugin->clipboard->reader()->Cancel(request_id);
+    }
+  });
+  return flutter_paste_input_paste_input_host_api_cancel_paste_response_new();
+}
+
+static void handle_trim_memory(
+    int64_t level,
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  if (level < static_cast<int64_t>(flutter_paste_input::TrimLevel::kLow) ||
+      level > static_cast<int64_t>(flutter_paste_input::TrimLevel::kCritical)) {
+    flutter_paste_input_paste_input_host_api_respond_error_trim_memory(
+        response_handle, "invalid-argument", "level must be 0, 1 or 2.", nullptr);
+    return;
+  }
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [level, handle](FlutterPasteInputPlugin* plugin) {
+    size_t released = 0;
+    if (plugin->clipboard != nullptr) {
+      released = plugin->clipboard->trimmer()->Trim(
+          static_cast<flutter_paste_input::TrimLevel>(level));
+    }
+    flutter_paste_input_paste_input_host_api_respond_trim_memory(
+        handle.get(), static_cast<int64_t>(released));
+  });
+}
+
+static void handle_set_clipboard_content(
+    FlutterPasteInputClipboardWrite* content,
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  // Copied out of the message so it can be handed to the main context.
+  auto write = std::make_shared<flutter_paste_input::WriteContent>();
+  const gchar* text = flutter_paste_input_clipboard_write_get_text(content);
+  if (text != nullptr) {
+    write->has_text = true;
+    write->text = text;
+  }
+  size_t image_length = 0;
+  const uint8_t* image =
+      flutter_paste_input_clipboard_write_get_image(content, &image_length);
+  if (image != nullptr && image_length > 0 && !write->image.Assign(image, image_length)) {
+    flutter_paste_input_paste_input_host_api_respond_error_set_clipboard_content(
+        response_handle, "too-large", "The image is too large to copy.", nullptr);
+    return;
+  }
+  const gchar* image_mime_type =
+      flutter_paste_input_clipboard_write_get_image_mime_type(content);
+  if (image_mime_type != nullptr) {
+    write->image_mime_type = image_mime_type;
+  }
+  FlValue* rendered_image_types =
+      flutter_paste_input_clipboard_write_get_rendered_image_types(content);
+  if (rendered_image_types != nullptr) {
+    for (size_t i = 0; i < fl_value_get_length(rendered_image_types); i++) {
+      write->rendered_image_types.emplace_back(
+          fl_value_get_string(fl_value_get_list_value(rendered_image_types, i)));
+    }
+  }
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [write, handle](FlutterPasteInputPlugin* plugin) {
+    if (plugin->clipboard == nullptr) {
+      flutter_paste_input_paste_input_host_api_respond_error_set_clipboard_content(
+          handle.get(), "unavailable", "The plugin has been disposed.", nullptr);
+      return;
+    }
+    std::string error_code;
+    std::string error_message;
+    if (!plugin->clipboard->writer()->Set(std::move(*write), &error_code, &error_message)) {
+      flutter_paste_input_paste_input_host_api_respond_error_set_clipboard_content(
+          handle.get(), error_code.c_str(), error_message.c_str(), nullptr);
+      return;
+    }
+    flutter_paste_input_paste_input_host_api_respond_set_clipboard_content(handle.get());
+  });
+}
+
+static void handle_list_clipboard_history(
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [handle](FlutterPasteInputPlugin* plugin) {
+    g_autoptr(FlValue) entries = fl_value_new_list();
+    if (plugin->clipboard != nullptr) {
+      for (const flutter_paste_input::HistoryEntryInfo& info :
+           plugin->clipboard->history()->List()) {
+        g_autoptr(FlValue) mime_types = fl_value_new_list();
+        for (const std::string& mime_type : info.mime_types) {
+          fl_value_append_take(mime_types, fl_value_new_string(mime_type.c_str()));
+        }
+        FlutterPasteInputClipboardHistoryEntry* entry =
+            flutter_paste_input_clipboard_history_entry_new(
+                info.id, info.captured_at_ms, mime_types,
+                static_cast<int64_t>(info.byte_size));
+        fl_value_append_take(
+            entries, fl_value_new_custom_object(CLIPBOARD_HISTORY_ENTRY_TYPE_ID, G_OBJECT(entry)));
+        g_object_unref(entry);
+      }
+    }
+    flutter_paste_input_paste_input_host_api_respond_list_clipboard_history(handle.get(),
+                                                                           entries);
+  });
+}
+
+static void handle_get_clipboard_history_entry(
+    int64_t id,
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [id, handle](FlutterPasteInputPlugin* plugin) {
+    flutter_paste_input::SnapshotPtr snapshot;
+    if (plugin->clipboard != nullptr) {
+      snapshot = plugin->clipboard->history()->Fetch(id);
+    }
+    if (!snapshot) {
+      flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_history_entry(
+          handle.get(), "not-found", "No such clipboard history entry.", nullptr);
+      return;
+    }
+    FlutterPasteInputClipboardContent* content = content_from_snapshot(*snapshot);
+    flutter_paste_input_paste_input_host_api_respond_get_clipboard_history_entry(handle.get(),
+                                                                                content);
+    g_object_unref(content);
+  });
+}
+
+static void handle_search_clipboard_history(
+    const gchar* query,
+    int64_t max_results,
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  if (max_results < 0) {
+    flutter_paste_input_paste_input_host_api_respond_error_search_clipboard_history(
+        response_handle, "invalid-argument", "maxResults must not be negative.", nullptr);
+    return;
+  }
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  std::string terms(query);
+  run_on_main_context(self, [terms, max_results, handle](FlutterPasteInputPlugin* plugin) {
+    g_autoptr(FlValue) matches = fl_value_new_list();
+    if (plugin->clipboard != nullptr) {
+      for (const flutter_paste_input::HistorySearchMatch& result :
+           plugin->clipboard->history()->Search(terms, static_cast<size_t>(max_results))) {
+        g_autoptr(FlValue) starts = fl_value_new_list();
+        g_autoptr(FlValue) ends = fl_value_new_list();
+        for (const auto& span : result.spans) {
+          fl_value_append_take(starts, fl_value_new_int(static_cast<int64_t>(span.first)));
+          fl_value_append_take(ends, fl_value_new_int(static_cast<int64_t>(span.second)));
+        }
+        FlutterPasteInputClipboardHistoryMatch* match =
+            flutter_paste_input_clipboard_history_match_new(
+                result.id, static_cast<int64_t>(result.match_count), starts, ends);
+        fl_value_append_take(
+            matches, fl_value_new_custom_object(CLIPBOARD_HISTORY_MATCH_TYPE_ID, G_OBJECT(match)));
+        g_object_unref(match);
+      }
+    }
+    flutter_paste_input_paste_input_host_api_respond_search_clipboard_history(handle.get(),
+                                                                             matches);
+  });
+}
+
+// Read on the main context; the pipeline's workers record concurrently
+// without locking.
+static void handle_get_paste_stats(
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [handle](FlutterPasteInputPlugin* plugin) {
+    g_autoptr(FlValue) stages = fl_value_new_list();
+    if (plugin->clipboard != nullptr) {
+      for (size_t i = 0; i < flutter_paste_input::kPasteStageCount; i++) {
+        auto stage = static_cast<flutter_paste_input::PasteStage>(i);
+        flutter_paste_input::PasteStageTotals totals =
+            plugin->clipboard->stats()->Totals(stage);
+        FlutterPasteInputPasteStageStats* stats = flutter_paste_input_paste_stage_stats_new(
+            flutter_paste_input::PasteStageName(stage), static_cast<int64_t>(totals.count),
+            static_cast<int64_t>(totals.total_us), static_cast<int64_t>(totals.max_us),
+            static_cast<int64_t>(totals.bytes_in), static_cast<int64_t>(totals.bytes_out));
+        fl_value_append_take(
+            stages, fl_value_new_custom_object(PASTE_STAGE_STATS_TYPE_ID, G_OBJECT(stats)));
+        g_object_unref(stats);
+      }
+    }
+    flutter_paste_input_paste_input_host_api_respond_get_paste_stats(handle.get(), stages);
+  });
+}
+
+static void handle_reset_paste_stats(
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [handle](FlutterPasteInputPlugin* plugin) {
+    if (plugin->clipboard != nullptr) {
+      plugin->clipboard->stats()->Reset();
+    }
+    flutter_paste_input_paste_input_host_api_respond_reset_paste_stats(handle.get());
+  });
+}
+
+static void handle_get_paste_latencies(
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(user_data);
+
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle(
+      FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_ref(response_handle)),
+      g_object_unref);
+  run_on_main_context(self, [handle](FlutterPasteInputPlugin* plugin) {
+    g_autoptr(FlValue) latencies = fl_value_new_list();
+    if (plugin->clipboard != nullptr) {
+      for (size_t i = 0; i < flutter_paste_input::kPasteStageCount; i++) {
+        auto stage = static_cast<flutter_paste_input::PasteStage>(i);
+        for (size_t j = 0; j < flutter_paste_input::kPasteContentClassCount; j++) {
+          auto content_class = static_cast<flutter_paste_input::PasteContentClass>(j);
+          const flutter_paste_input::LatencyHistogram& histogram =
+              plugin->clipboard->stats()->Latencies(stage, content_class);
+          uint64_t count = histogram.Count();
+          if (count == 0) {
+            continue;
+          }
+          FlutterPasteInputPasteLatencyStats* stats = flutter_paste_input_paste_latency_stats_new(
+              flutter_paste_input::PasteStageName(stage),
+              flutter_paste_input::PasteContentClassName(content_class),
+              static_cast<int64_t>(count), static_cast<int64_t>(histogram.Percentile(50)),
+              static_cast<int64_t>(histogram.Percentile(90)),
+              static_cast<int64_t>(histogram.Percentile(99)),
+              static_cast<int64_t>(histogram.Max()));
+          fl_value_append_take(
+              latencies, fl_value_new_custom_object(PASTE_LATENCY_STATS_TYPE_ID, G_OBJECT(stats)));
+          g_object_unref(stats);
+        }
+      }
+    }
+    flutter_paste_input_paste_input_host_api_respond_get_paste_latencies(handle.get(),
+                                                                          latencies);
+  });
+}
+
+// A dumpPasteTrace call, written out on the GIO worker pool as large traces
+// take a while to format.
+struct TraceDumpCall {
+  std::string path;
+  std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle> handle;
+};
+
+static void dump_trace_in_thread(GTask* task, gpointer source_object, gpointer task_data,
+                                 GCancellable* cancellable) {
+  TraceDumpCall* call = static_cast<TraceDumpCall*>(task_data);
+  g_task_return_int(task, flutter_paste_input::PasteTracer::Get()->Dump(call->path));
+}
+
+static void on_trace_dumped(GObject* source_object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(result);
+  TraceDumpCall* call = static_cast<TraceDumpCall*>(g_task_get_task_data(task));
+  gssize written = g_task_propagate_int(task, nullptr);
+  if (written < 0) {
+    // Dump() warns with the reason.
+    flutter_paste_input_paste_input_host_api_respond_error_dump_paste_trace(
+        call->handle.get(), "write-failed", "The paste trace could not be written.", nullptr);
+    return;
+  }
+  flutter_paste_input_paste_input_host_api_respond_dump_paste_trace(
+      call->handle.get(), static_cast<int64_t>(written));
+}
+
+static void handle_dump_paste_trace(
+    const gchar* path,
+    FlutterPasteInputPasteInputHostApiResponseHandle* response_handle,
+    gpointer user_data) {
+  TraceDumpCall* call = new TraceDumpCall{
+      path,
+      std::shared_ptr<FlutterPasteInputPasteInputHostApiResponseHandle>(
+          FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(
+              g_object_ref(response_handle)),
+          g_object_unref)};
+  GTask* task = g_task_new(nullptr, nullptr, on_trace_dumped, nullptr);
+  g_task_set_task_data(task, call,
+                       [](gpointer call) { delete static_cast<TraceDumpCall*>(call); });
+  g_task_run_in_thread(task, dump_trace_in_thread);
+  g_object_unref(task);
 }
 
 // VTable for Pigeon Host API
@@ -98,43 +733,52 @@ static FlutterPasteInputPasteInputHostApiVTable host_api_vtable = {
     .get_clipboard_content = handle_get_clipboard_content,
     .clear_temp_files = handle_clear_temp_files,
     .get_platform_version = handle_get_platform_version,
+    .probe_clipboard = handle_probe_clipboard,
+    .configure = handle_configure,
+    .prefetch_clipboard = handle_prefetch_clipboard,
+    .cancel_paste = handle_cancel_paste,
+    .trim_memory = handle_trim_memory,
+    .set_clipboard_content = handle_set_clipboard_content,
+    .list_clipboard_history = handle_list_clipboard_history,
+    .get_clipboard_history_entry = handle_get_clipboard_history_entry,
+    .search_clipboard_history = handle_search_clipboard_history,
+    .get_paste_stats = handle_get_paste_stats,
+    .reset_paste_stats = handle_reset_paste_stats,
+    .get_paste_latencies = handle_get_paste_latencies,
+    .dump_paste_trace = handle_dump_paste_trace,
 };
 
 // Helper Functions
 
-static std::vector<uint8_t> get_image_data(GtkClipboard* clipboard) {
-  std::vector<uint8_t> result;
-
-  GdkPixbuf* pixbuf = gtk_clipboard_wait_for_image(clipboard);
-  if (pixbuf == nullptr) {
-    return result;
-  }
-
-  gchar* buffer = nullptr;
-  gsize buffer_size = 0;
-  GError* error = nullptr;
+// Converts a snapshot into a FlutterPasteInputClipboardContent holding
+// FlutterPasteInputClipboardItem custom values, images first.
+static FlutterPasteInputClipboardContent* content_from_snapshot(
+    const flutter_paste_input::ClipboardSnapshot& snapshot) {
+  g_autoptr(FlValue) items = fl_value_new_list();
 
-  if (gdk_pixbuf_save_to_buffer(pixbuf, &buffer, &buffer_size, "png", &error, nullptr)) {
-    result.assign(reinterpret_cast<uint8_t*>(buffer),
-                  reinterpret_cast<uint8_t*>(buffer) + buffer_size);
-    g_free(buffer);
-  } else if (error != nullptr) {
-    g_warning("FlutterPasteInput: Failed to save image: %s", error->message);
-    g_error_free(error);
+  for (const flutter_paste_input::SnapshotItem& source : snapshot.items) {
+    int64_t width = source.width;
+    int64_t height = source.height;
+    gboolean has_alpha = source.has_alpha ? TRUE : FALSE;
+    int64_t frame_count = source.frame_count;
+    int64_t original_byte_size = source.original_byte_size;
+
+    FlutterPasteInputClipboardItem* item =
+        flutter_paste_input_clipboard_item_new(
+            source.data.data(),
+            source.data.size(),
+            source.mime_type.c_str(),
+            source.is_image ? &width : nullptr,
+            source.is_image ? &height : nullptr,
+            source.is_image ? &has_alpha : nullptr,
+            source.is_image ? &frame_count : nullptr,
+            &original_byte_size);
+    fl_value_append_take(items, fl_value_new_custom_object(CLIPBOARD_ITEM_TYPE_ID, G_OBJECT(item)));
+    g_object_unref(item);
   }
 
-  g_object_unref(pixbuf);
-  return result;
-}
-
-static std::string get_text_data(GtkClipboard* clipboard) {
-  gchar* text = gtk_clipboard_wait_for_text(clipboard);
-  if (text == nullptr) {
-    return std::string();
-  }
-  std::string result(text);
-  g_free(text);
-  return result;
+  int64_t peak_memory_bytes = snapshot.peak_bytes;
+  return flutter_paste_input_clipboard_content_new(items, &peak_memory_bytes);
 }
 
 static void clear_temp_files() {
@@ -153,50 +797,142 @@ static void clear_temp_files() {
   }
 }
 
+// An onPasteDetected event on its way to Dart.
+struct PasteEventCall {
+  FlutterPasteInputPlugin* plugin;
+  gint64 requested_at;
+  gint64 sent_at;
+  size_t payload_bytes;
+  flutter_paste_input::PasteContentClass content_class;
+};
+
+// Called when Dart has handled (or failed to handle) an onPasteDetected
+// event; lets the dispatcher send the next one.
+static void on_paste_detected_cb(GObject* object, GAsyncResult* result,
+                                 gpointer user_data) {
+  std::unique_ptr<PasteEventCall> call(static_cast<PasteEventCall*>(user_data));
+  FlutterPasteInputPlugin* self = call->plugin;
+  flutter_paste_input::PasteTracer::Get()->AsyncEnd("dart",
+                                                    reinterpret_cast<uintptr_t>(call.get()));
+  if (self->clipboard != nullptr) {
+    flutter_paste_input::PasteStats* stats = self->clipboard->stats();
+    stats->Record(flutter_paste_input::PasteStage::kDart, call->content_class, call->sent_at,
+                  call->payload_bytes, 0);
+    if (call->requested_at != 0) {
+      stats->Record(flutter_paste_input::PasteStage::kTotal, call->content_class,
+                    call->requested_at, 0, call->payload_bytes);
+    }
+  }
+
+  g_autoptr(GError) error = nullptr;
+  g_autoptr(FlutterPasteInputPasteInputFlutterApiOnPasteDetectedResponse) response =
+      flutter_paste_input_paste_input_flutter_api_on_paste_detected_finish(
+          FLUTTER_PASTE_INPUT_PASTE_INPUT_FLUTTER_API(object), result, &error);
+  if (response == nullptr) {
+    g_warning("FlutterPasteInput: Failed to notify paste: %s", error->message);
+  } else if (flutter_paste_input_paste_input_flutter_api_on_paste_detected_response_is_error(response)) {
+    g_warning("FlutterPasteInput: Failed to notify paste: %s",
+              flutter_paste_input_paste_input_flutter_api_on_paste_detected_response_get_error_message(response));
+  }
+
+  if (self->paste_events != nullptr) {
+    self->paste_events->Acknowledge();
+  }
+  g_object_unref(self);
+}
+
+// Sender of the plugin's PasteEventDispatcher.
+static void send_paste_event(FlutterPasteInputPlugin* self,
+                             const flutter_paste_input::ClipboardSnapshot& snapshot) {
+  if (self->flutter_api == nullptr) {
+    self->paste_events->Acknowledge();
+    return;
+  }
+
+  gint64 serialize_started_at = g_get_monotonic_time();
+  size_t payload_bytes = flutter_paste_input::SnapshotByteSize(snapshot);
+  flutter_paste_input::PasteContentClass content_class =
+      flutter_paste_input::SnapshotContentClass(snapshot);
+  PasteEventCall* call = new PasteEventCall{FLUTTER_PASTE_INPUT_PLUGIN(g_object_ref(self)),
+                                            self->paste_requested_at, 0, payload_bytes,
+                                            content_class};
+  self->paste_requested_at = 0;
+  {
+    flutter_paste_input::TraceScope trace("serialize");
+    FlutterPasteInputClipboardContent* content = content_from_snapshot(snapshot);
+    flutter_paste_input::PasteTracer::Get()->AsyncBegin("dart",
+                                                        reinterpret_cast<uintptr_t>(call));
+    // The codec encodes the message before this returns.
+    flutter_paste_input_paste_input_flutter_api_on_paste_detected(
+        self->flutter_api, content, nullptr, on_paste_detected_cb, call);
+    g_object_unref(content);
+  }
+  call->sent_at = g_get_monotonic_time();
+  self->clipboard->stats()->RecordElapsed(flutter_paste_input::PasteStage::kSerialize,
+                                          content_class,
+                                          call->sent_at - serialize_started_at,
+                                          payload_bytes, payload_bytes);
+}
+
 // Notify Flutter about paste events
 void flutter_paste_input_plugin_notify_paste(FlutterPasteInputPlugin* self) {
-  if (self == nullptr || self->flutter_api == nullptr) {
+  if (self == nullptr || self->flutter_api == nullptr || self->clipboard == nullptr) {
     return;
   }
 
-  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
-  g_autoptr(FlValue) items = fl_value_new_list();
-
-  // Get image data
-  if (gtk_clipboard_wait_is_image_available(clipboard)) {
-    std::vector<uint8_t> image_data = get_image_data(clipboard);
-    if (!image_data.empty()) {
-      FlutterPasteInputClipboardItem* item =
-          flutter_paste_input_clipboard_item_new(
-              image_data.data(),
-              image_data.size(),
-              "image/png");
-      fl_value_append(items, fl_value_new_custom_object(G_OBJECT(item)));
-      g_object_unref(item);
+  // Keep the plugin alive until the read completes. A paste that finds the
+  // backlog full is dropped: the in-flight read already reports the same
+  // clipboard content.
+  std::shared_ptr<FlutterPasteInputPlugin> plugin(
+      FLUTTER_PASTE_INPUT_PLUGIN(g_object_ref(self)), g_object_unref);
+  // Apps call this from their paste shortcut handler, so this is as close
+  // to the key event as the plugin gets.
+  gint64 requested_at = g_get_monotonic_time();
+  flutter_paste_input::PasteTracer::Get()->Instant("notify");
+  self->clipboard->reader()->Read(0, [plugin, requested_at](
+                                         flutter_paste_input::SnapshotPtr snapshot) {
+    // Refused pastes were already logged by the reader.
+    if (!snapshot || !snapshot->error_code.empty() || plugin->paste_events == nullptr) {
+      return;
+    }
+    // A paste whose snapshot replaces a queued one counts from the older.
+    if (plugin->paste_requested_at == 0) {
+      plugin->paste_requested_at = requested_at;
     }
+    plugin->paste_events->Post(std::move(snapshot));
+  });
+}
+
+// Ranks |self|'s view as a paste target: 0 if it is not in the active
+// window, 1 if it is, and 2 if it also holds keyboard focus, so the
+// focused view wins when a window embeds several.
+static gint view_focus_rank(FlutterPasteInputPlugin* self) {
+  if (self->view == nullptr) {
+    return 0;
+  }
+  GtkWidget* toplevel = gtk_widget_get_toplevel(self->view);
+  if (!gtk_widget_is_toplevel(toplevel) || !gtk_window_is_active(GTK_WINDOW(toplevel))) {
+    return 0;
   }
+  return gtk_widget_has_focus(self->view) ? 2 : 1;
+}
 
-  // Get text data
-  if (gtk_clipboard_wait_is_text_available(clipboard)) {
-    std::string text = get_text_data(clipboard);
-    if (!text.empty()) {
-      FlutterPasteInputClipboardItem* item =
-          flutter_paste_input_clipboard_item_new(
-              reinterpret_cast<const uint8_t*>(text.data()),
-              text.size(),
-              "text/plain");
-      fl_value_append(items, fl_value_new_custom_object(G_OBJECT(item)));
-      g_object_unref(item);
+void flutter_paste_input_plugin_notify_paste_to_focused_view() {
+  FlutterPasteInputPlugin* target = nullptr;
+  gint best_rank = 0;
+  for (GList* link = g_plugin_instances; link != nullptr; link = link->next) {
+    FlutterPasteInputPlugin* plugin = FLUTTER_PASTE_INPUT_PLUGIN(link->data);
+    gint rank = view_focus_rank(plugin);
+    if (rank > best_rank) {
+      best_rank = rank;
+      target = plugin;
     }
   }
-
-  FlutterPasteInputClipboardContent* content =
-      flutter_paste_input_clipboard_content_new(items);
-
-  flutter_paste_input_paste_input_flutter_api_on_paste_detected(
-      self->flutter_api, content, nullptr, nullptr, nullptr);
-
-  g_object_unref(content);
+  // Nobody has focus, e.g. the paste came from a global shortcut.
+  if (target == nullptr) {
+    return;
+  }
+  flutter_paste_input_plugin_notify_paste(target);
 }
 
 // Plugin lifecycle
@@ -205,10 +941,18 @@ static void flutter_paste_input_plugin_dispose(GObject* object) {
   FlutterPasteInputPlugin* self = FLUTTER_PASTE_INPUT_PLUGIN(object);
 
   g_clear_object(&self->flutter_api);
-
-  if (g_plugin_instance == self) {
-    g_plugin_instance = nullptr;
+  delete self->paste_events;
+  self->paste_events = nullptr;
+  if (self->clipboard != nullptr) {
+    self->clipboard->Release();
+    self->clipboard = nullptr;
   }
+  if (self->view != nullptr) {
+    g_object_remove_weak_pointer(G_OBJECT(self->view), reinterpret_cast<gpointer*>(&self->view));
+    self->view = nullptr;
+  }
+
+  g_plugin_instances = g_list_remove(g_plugin_instances, self);
 
   G_OBJECT_CLASS(flutter_paste_input_plugin_parent_class)->dispose(object);
 }
@@ -219,13 +963,31 @@ static void flutter_paste_input_plugin_class_init(FlutterPasteInputPluginClass*
 
 static void flutter_paste_input_plugin_init(FlutterPasteInputPlugin* self) {
   self->flutter_api = nullptr;
+  self->view = nullptr;
+  self->paste_requested_at = 0;
+  self->clipboard = flutter_paste_input::SharedClipboard::Acquire();
+  self->paste_events = new flutter_paste_input::PasteEventDispatcher(
+      [self](flutter_paste_input::SnapshotPtr snapshot) {
+        send_paste_event(self, *snapshot);
+      });
 }
 
 void flutter_paste_input_plugin_register_with_registrar(FlPluginRegistrar* registrar) {
   FlutterPasteInputPlugin* plugin = FLUTTER_PASTE_INPUT_PLUGIN(
       g_object_new(flutter_paste_input_plugin_get_type(), nullptr));
 
-  g_plugin_instance = plugin;
+  g_plugin_instances = g_list_append(g_plugin_instances, plugin);
+
+#ifdef FLUTTER_PASTE_INPUT_WARM_UP_CODECS
+  flutter_paste_input::StartCodecWarmUp();
+#endif
+
+  // Headless engines have no view and never receive routed paste events.
+  FlView* view = fl_plugin_registrar_get_view(registrar);
+  if (view != nullptr) {
+    plugin->view = GTK_WIDGET(view);
+    g_object_add_weak_pointer(G_OBJECT(view), reinterpret_cast<gpointer*>(&plugin->view));
+  }
 
   FlBinaryMessenger* messenger = fl_plugin_registrar_get_messenger(registrar);
 
@@ -234,8 +996,8 @@ void flutter_paste_input_plugin_register_with_registrar(FlPluginRegistrar* regis
       messenger,
       nullptr,  // no suffix
       &host_api_vtable,
-      plugin,
-      nullptr);  // no free func
+      g_object_ref(plugin),
+      g_object_unref);
 
   // Set up Pigeon Flutter API (for calling Dart)
   plugin->flutter_api = flutter_paste_input_paste_input_flutter_api_new(
@@ -8,3 +8,8 @@
 
 // Handles the getPlatformVersion method call.
 FlMethodResponse *get_platform_version();
+
+// Reads the clipboard and sends it to |self|'s engine as onPasteDetected.
+// Apps go through flutter_paste_input_plugin_notify_paste_to_focused_view(),
+// as they have no handle on the plugin instances.
+void flutter_paste_input_plugin_notify_paste(FlutterPasteInputPlugin *self);
@@ -0,0 +1,762 @@
+#include "history_store.h"
+
+#include <fcntl.h>
+#include <glib/gstdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#include "content_hash.h"
+#include "paste_tracer.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+constexpr uint64_t kIndexMagic = 0x31584449484e5046ULL;  // "FPNHIDX1"
+constexpr uint32_t kIndexVersion = 2;
+constexpr uint32_t kLiveFlag = 1;
+constexpr size_t kMimeTypesBytes = 68;
+
+constexpr char kIndexName[] = "history.idx";
+constexpr char kIndexTempName[] = "history.idx.tmp";
+constexpr char kFilePrefix[] = "history";
+
+std::string LogPath(const std::string& directory, uint32_t generation) {
+  g_autofree gchar* name = g_strdup_printf("history-%u.log", generation);
+  g_autofree gchar* path = g_build_filename(directory.c_str(), name, nullptr);
+  return path;
+}
+
+std::string FilePath(const std::string& directory, const char* name) {
+  g_autofree gchar* path = g_build_filename(directory.c_str(), name, nullptr);
+  return path;
+}
+
+bool WriteAll(int fd, const void* data, size_t size, size_t offset) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  while (size > 0) {
+    ssize_t written = pwrite(fd, bytes, size, static_cast<off_t>(offset));
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written <= 0) {
+      return false;
+    }
+    bytes += written;
+    size -= static_cast<size_t>(written);
+    offset += static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool ReadAll(int fd, void* data, size_t size, size_t offset) {
+  uint8_t* bytes = static_cast<uint8_t*>(data);
+  while (size > 0) {
+    ssize_t count = pread(fd, bytes, size, static_cast<off_t>(offset));
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count <= 0) {
+      return false;
+    }
+    bytes += count;
+    size -= static_cast<size_t>(count);
+    offset += static_cast<size_t>(count);
+  }
+  return true;
+}
+
+size_t FileSize(int fd) {
+  struct stat info;
+  return fstat(fd, &info) == 0 ? static_cast<size_t>(info.st_size) : 0;
+}
+
+}  // namespace
+
+struct HistoryStore::IndexHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t record_size;
+  // Names the log the records point into.
+  uint32_t generation;
+  uint32_t reserved[11];
+};
+
+struct HistoryStore::IndexRecord {
+  int64_t id;
+  uint64_t content_hash;
+  uint64_t offset;
+  // HashBytes() of the payload.
+  uint64_t checksum;
+  int64_t captured_at_ms;
+  uint64_t byte_size;
+  uint32_t size;
+  uint32_t flags;
+  uint32_t tags;
+  // Comma separated, NUL padded.
+  char mime_types[kMimeTypesBytes];
+};
+
+struct HistoryStore::Write {
+  IndexRecord record;
+  PooledBuffer payload;
+};
+
+// Work handed to the worker pool. Inputs are set on the main thread
+// before the job starts and outputs read after it is done.
+struct HistoryStore::Job {
+  enum class Kind { kCommit, kCompact };
+
+  Kind kind;
+  std::string directory;
+  int log_fd = -1;
+  int index_fd = -1;
+
+  // kCommit: the batch, and where its records go in the index.
+  std::vector<std::shared_ptr<Write>> writes;
+  size_t index_offset = 0;
+  size_t log_start = 0;
+  // The mapped index to sync first, if set. Not remapped while the job
+  // runs.
+  uint8_t* index_map = nullptr;
+  size_t index_map_size = 0;
+
+  // kCompact: the live records, whose offsets are rewritten, and the new
+  // log generation.
+  std::vector<IndexRecord> records;
+  uint32_t old_generation = 0;
+  uint32_t generation = 0;
+  int new_log_fd = -1;
+  int new_index_fd = -1;
+  size_t new_log_end = 0;
+
+  bool ok = false;
+
+  std::shared_ptr<HistoryStore*> store;
+
+  // Lets the destructor wait for a running job.
+  std::mutex mutex;
+  std::condition_variable done_condition;
+  bool done = false;
+};
+
+// static
+bool HistoryStore::Compact(Job* job) {
+  std::vector<IndexRecord>* records = &job->records;
+  std::string log_path = LogPath(job->directory, job->generation);
+  std::string temp_path = FilePath(job->directory, kIndexTempName);
+  int log_fd = open(log_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  int index_fd = open(temp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  bool ok = log_fd >= 0 && index_fd >= 0;
+
+  size_t log_end = 0;
+  std::vector<uint8_t> bytes;
+  for (IndexRecord& record : *records) {
+    if (!ok) {
+      break;
+    }
+    bytes.resize(record.size);
+    ok = ReadAll(job->log_fd, bytes.data(), bytes.size(), record.offset) &&
+         WriteAll(log_fd, bytes.data(), bytes.size(), log_end);
+    record.offset = log_end;
+    log_end += record.size;
+  }
+  ok = ok && fdatasync(log_fd) == 0;
+
+  IndexHeader header = {};
+  header.magic = kIndexMagic;
+  header.version = kIndexVersion;
+  header.record_size = sizeof(IndexRecord);
+  header.generation = job->generation;
+  ok = ok && WriteAll(index_fd, &header, sizeof(header), 0) &&
+       WriteAll(index_fd, records->data(),
+                records->size() * sizeof(IndexRecord), sizeof(header)) &&
+       fdatasync(index_fd) == 0;
+  // The commit point: from here on the index names the new log.
+  ok = ok && g_rename(temp_path.c_str(), FilePath(job->directory, kIndexName).c_str()) == 0;
+
+  if (!ok) {
+    if (log_fd >= 0) {
+      close(log_fd);
+    }
+    if (index_fd >= 0) {
+      close(index_fd);
+    }
+    g_unlink(log_path.c_str());
+    g_unlink(temp_path.c_str());
+    return false;
+  }
+  g_unlink(LogPath(job->directory, job->old_generation).c_str());
+  job->new_log_fd = log_fd;
+  job->new_index_fd = index_fd;
+  job->new_log_end = log_end;
+  return true;
+}
+
+// static
+bool HistoryStore::CommitWrites(Job* job) {
+  if (job->index_map != nullptr &&
+      msync(job->index_map, job->index_map_size, MS_SYNC) != 0) {
+    return false;
+  }
+  if (job->writes.empty()) {
+    return true;
+  }
+  std::vector<IndexRecord> records;
+  for (const std::shared_ptr<Write>& write : job->writes) {
+    if (!WriteAll(job->log_fd, write->payload.data(), write->payload.size(),
+                  write->record.offset)) {
+      return false;
+    }
+    records.push_back(write->record);
+  }
+  return fdatasync(job->log_fd) == 0 &&
+         WriteAll(job->index_fd, records.data(),
+                  records.size() * sizeof(IndexRecord), job->index_offset) &&
+         fdatasync(job->index_fd) == 0;
+}
+
+// static
+void HistoryStore::RunJobNow(Job* job) {
+  job->ok = job->kind == Job::Kind::kCommit ? CommitWrites(job) : Compact(job);
+}
+
+// static
+std::unique_ptr<HistoryStore> HistoryStore::Open(const std::string& directory) {
+  if (g_mkdir_with_parents(directory.c_str(), 0700) != 0) {
+    g_warning("FlutterPasteInput: Cannot create %s: %s", directory.c_str(),
+              g_strerror(errno));
+    return nullptr;
+  }
+  std::unique_ptr<HistoryStore> store(new HistoryStore(directory));
+  if (store->Load()) {
+    return store;
+  }
+  g_warning("FlutterPasteInput: Discarding unreadable clipboard history in %s",
+            directory.c_str());
+  store.reset();
+  Destroy(directory);
+  g_mkdir_with_parents(directory.c_str(), 0700);
+  store.reset(new HistoryStore(directory));
+  if (!store->CreateEmpty()) {
+    g_warning("FlutterPasteInput: Cannot create clipboard history in %s: %s",
+              directory.c_str(), g_strerror(errno));
+    return nullptr;
+  }
+  return store;
+}
+
+// static
+void HistoryStore::Destroy(const std::string& directory) {
+  GDir* dir = g_dir_open(directory.c_str(), 0, nullptr);
+  if (dir == nullptr) {
+    return;
+  }
+  const gchar* name;
+  while ((name = g_dir_read_name(dir)) != nullptr) {
+    if (g_str_has_prefix(name, kFilePrefix)) {
+      g_unlink(FilePath(directory, name).c_str());
+    }
+  }
+  g_dir_close(dir);
+  g_rmdir(directory.c_str());
+}
+
+// static
+std::string HistoryStore::DefaultDirectory() {
+  const gchar* application = g_get_prgname();
+  g_autofree gchar* path =
+      g_build_filename(g_get_user_cache_dir(), application != nullptr ? application : "flutter",
+                       "flutter_paste_input", "history", nullptr);
+  return path;
+}
+
+std::string HistoryStore::SidecarPath(const char* suffix) const {
+  g_autofree gchar* name = g_strconcat(kFilePrefix, suffix, nullptr);
+  return FilePath(directory_, name);
+}
+
+HistoryStore::HistoryStore(std::string directory)
+    : directory_(std::move(directory)),
+      self_(std::make_shared<HistoryStore*>(this)) {}
+
+HistoryStore::~HistoryStore() {
+  *self_ = nullptr;
+  write_failed_listener_ = nullptr;
+  if (commit_source_ != 0) {
+    g_source_remove(commit_source_);
+  }
+
+  // Take over the running job as OnJobDone() would have, then commit the
+  // rest on this thread.
+  if (job_) {
+    std::unique_lock<std::mutex> lock(job_->mutex);
+    job_->done_condition.wait(lock, [this] { return job_->done; });
+    lock.unlock();
+    std::shared_ptr<Job> job = std::move(job_);
+    FinishJob(job.get());
+  }
+  if (!queued_.empty() || index_dirty_) {
+    StartCommit();
+    std::shared_ptr<Job> job = std::move(job_);
+    RunJobNow(job.get());
+    FinishJob(job.get());
+  }
+
+  UnmapIndex();
+  if (log_fd_ >= 0) {
+    close(log_fd_);
+  }
+  if (index_fd_ >= 0) {
+    close(index_fd_);
+  }
+}
+
+bool HistoryStore::Load() {
+  static_assert(sizeof(IndexHeader) == 64, "index header layout");
+  static_assert(sizeof(IndexRecord) == 128, "index record layout");
+
+  index_fd_ = open(FilePath(directory_, kIndexName).c_str(), O_RDWR | O_CLOEXEC);
+  if (index_fd_ < 0) {
+    return errno == ENOENT && CreateEmpty();
+  }
+
+  IndexHeader header;
+  size_t file_size = FileSize(index_fd_);
+  if (file_size < sizeof(header) || !ReadAll(index_fd_, &header, sizeof(header), 0) ||
+      header.magic != kIndexMagic || header.version != kIndexVersion ||
+      header.record_size != sizeof(IndexRecord)) {
+    return false;
+  }
+  generation_ = header.generation;
+  log_fd_ = open(LogPath(directory_, generation_).c_str(), O_RDWR | O_CLOEXEC);
+  if (log_fd_ < 0) {
+    return false;
+  }
+  log_end_ = FileSize(log_fd_);
+
+  // A torn record at the end is left over from an interrupted commit.
+  record_count_ = (file_size - sizeof(header)) / sizeof(IndexRecord);
+  index_size_ = sizeof(header) + record_count_ * sizeof(IndexRecord);
+  if (index_size_ != file_size && ftruncate(index_fd_, static_cast<off_t>(index_size_)) != 0) {
+    return false;
+  }
+  if (!MapIndex()) {
+    return false;
+  }
+  for (size_t slot = 0; slot < record_count_; slot++) {
+    IndexRecord* record = RecordAt(slot);
+    if ((record->flags & kLiveFlag) == 0) {
+      continue;
+    }
+    if (record->offset + record->size > log_end_) {
+      record->flags &= ~kLiveFlag;
+      continue;
+    }
+    slots_[record->id] = slot;
+    live_bytes_ += record->size;
+  }
+
+  // Leftovers of an interrupted compaction.
+  GDir* dir = g_dir_open(directory_.c_str(), 0, nullptr);
+  if (dir != nullptr) {
+    std::string current = LogPath(directory_, generation_);
+    const gchar* name;
+    while ((name = g_dir_read_name(dir)) != nullptr) {
+      std::string path = FilePath(directory_, name);
+      if (g_str_has_prefix(name, kFilePrefix) &&
+          (g_str_has_suffix(name, ".log") || strcmp(name, kIndexTempName) == 0) &&
+          path != current) {
+        g_unlink(path.c_str());
+      }
+    }
+    g_dir_close(dir);
+  }
+  return true;
+}
+
+bool HistoryStore::CreateEmpty() {
+  generation_ = 1;
+  log_fd_ = open(LogPath(directory_, generation_).c_str(),
+                 O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (log_fd_ < 0) {
+    return false;
+  }
+
+  IndexHeader header = {};
+  header.magic = kIndexMagic;
+  header.version = kIndexVersion;
+  header.record_size = sizeof(IndexRecord);
+  header.generation = generation_;
+  std::string temp_path = FilePath(directory_, kIndexTempName);
+  index_fd_ = open(temp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (index_fd_ < 0 || !WriteAll(index_fd_, &header, sizeof(header), 0) ||
+      fdatasync(index_fd_) != 0 ||
+      g_rename(temp_path.c_str(), FilePath(directory_, kIndexName).c_str()) != 0) {
+    return false;
+  }
+  index_size_ = sizeof(header);
+  return MapIndex();
+}
+
+bool HistoryStore::MapIndex() {
+  UnmapIndex();
+  void* map = mmap(nullptr, index_size_, PROT_READ | PROT_WRITE, MAP_SHARED, index_fd_, 0);
+  if (map == MAP_FAILED) {
+    return false;
+  }
+  index_map_ = static_cast<uint8_t*>(map);
+  return true;
+}
+
+void HistoryStore::UnmapIndex() {
+  if (index_map_ != nullptr) {
+    munmap(index_map_, index_size_);
+    index_map_ = nullptr;
+  }
+}
+
+HistoryStore::IndexRecord* HistoryStore::RecordAt(size_t slot) const {
+  return reinterpret_cast<IndexRecord*>(index_map_ + sizeof(IndexHeader) +
+                                        slot * sizeof(IndexRecord));
+}
+
+std::vector<HistoryStore::Record> HistoryStore::Records() const {
+  auto to_record = [](const IndexRecord& index_record) {
+    Record record;
+    record.id = index_record.id;
+    record.content_hash = index_record.content_hash;
+    record.captured_at_ms = index_record.captured_at_ms;
+    record.byte_size = static_cast<size_t>(index_record.byte_size);
+    record.stored_bytes = index_record.size;
+    record.tags = index_record.tags;
+    std::string mime_types(index_record.mime_types,
+                           strnlen(index_record.mime_types, kMimeTypesBytes));
+    g_auto(GStrv) parts = g_strsplit(mime_types.c_str(), ",", -1);
+    for (gchar** part = parts; *part != nullptr; part++) {
+      if (**part != '\0') {
+        record.mime_types.emplace_back(*part);
+      }
+    }
+    return record;
+  };
+
+  std::vector<Record> records;
+  for (size_t slot = 0; slot < record_count_; slot++) {
+    const IndexRecord* record = RecordAt(slot);
+    if ((record->flags & kLiveFlag) != 0) {
+      records.push_back(to_record(*record));
+    }
+  }
+  if (job_ && job_->kind == Job::Kind::kCommit) {
+    for (const std::shared_ptr<Write>& write : job_->writes) {
+      records.push_back(to_record(write->record));
+    }
+  }
+  for (const std::shared_ptr<Write>& write : queued_) {
+    records.push_back(to_record(write->record));
+  }
+  return records;
+}
+
+void HistoryStore::Append(Record record, PooledBuffer payload) {
+  auto write = std::make_shared<Write>();
+  IndexRecord& index_record = write->record;
+  memset(&index_record, 0, sizeof(index_record));
+  index_record.id = record.id;
+  index_record.content_hash = record.content_hash;
+  index_record.checksum = HashBytes(payload.data(), payload.size());
+  index_record.captured_at_ms = record.captured_at_ms;
+  index_record.byte_size = record.byte_size;
+  index_record.size = static_cast<uint32_t>(payload.size());
+  index_record.flags = kLiveFlag;
+  index_record.tags = record.tags;
+  std::string mime_types;
+  for (const std::string& mime_type : record.mime_types) {
+    size_t length = mime_types.size() + (mime_types.empty() ? 0 : 1) + mime_type.size();
+    if (length >= kMimeTypesBytes) {
+      break;
+    }
+    if (!mime_types.empty()) {
+      mime_types += ',';
+    }
+    mime_types += mime_type;
+  }
+  memcpy(index_record.mime_types, mime_types.data(), mime_types.size());
+  write->payload = std::move(payload);
+
+  queued_bytes_ += write->payload.size();
+  queued_.push_back(std::move(write));
+  if (queued_bytes_ >= kCommitBytes) {
+    Commit();
+  } else {
+    ScheduleCommit();
+  }
+}
+
+void HistoryStore::Touch(int64_t id, int64_t captured_at_ms) {
+  ApplyUpdate({id, false, captured_at_ms});
+}
+
+void HistoryStore::Remove(int64_t id) {
+  ApplyUpdate({id, true, 0});
+}
+
+void HistoryStore::ApplyUpdate(const Update& update) {
+  for (auto it = queued_.begin(); it != queued_.end(); ++it) {
+    if ((*it)->record.id != update.id) {
+      continue;
+    }
+    if (update.remove) {
+      queued_bytes_ -= (*it)->payload.size();
+      queued_.erase(it);
+    } else {
+      (*it)->record.captured_at_ms = update.captured_at_ms;
+    }
+    return;
+  }
+
+  bool in_flight = false;
+  if (job_ && job_->kind == Job::Kind::kCommit) {
+    for (const std::shared_ptr<Write>& write : job_->writes) {
+      in_flight = in_flight || write->record.id == update.id;
+    }
+  }
+  if (in_flight || (job_ && job_->kind == Job::Kind::kCompact)) {
+    deferred_updates_.push_back(update);
+    return;
+  }
+
+  auto slot = slots_.find(update.id);
+  if (slot == slots_.end()) {
+    return;
+  }
+  IndexRecord* record = RecordAt(slot->second);
+  if (update.remove) {
+    record->flags &= ~kLiveFlag;
+    live_bytes_ -= record->size;
+    slots_.erase(slot);
+  } else {
+    record->captured_at_ms = update.captured_at_ms;
+  }
+  index_dirty_ = true;
+  ScheduleCommit();
+}
+
+bool HistoryStore::Read(int64_t id, PooledBuffer* out) {
+  std::vector<std::shared_ptr<Write>> pending = queued_;
+  if (job_ && job_->kind == Job::Kind::kCommit) {
+    pending.insert(pending.end(), job_->writes.begin(), job_->writes.end());
+  }
+  for (const std::shared_ptr<Write>& write : pending) {
+    if (write->record.id == id) {
+      return out->Assign(write->payload.data(), write->payload.size());
+    }
+  }
+
+  auto slot = slots_.find(id);
+  if (slot == slots_.end()) {
+    return false;
+  }
+  const IndexRecord* record = RecordAt(slot->second);
+  std::vector<uint8_t> bytes(record->size);
+  if (!ReadAll(log_fd_, bytes.data(), bytes.size(), record->offset) ||
+      HashBytes(bytes.data(), bytes.size()) != record->checksum) {
+    g_warning("FlutterPasteInput: Clipboard history entry %" G_GINT64_FORMAT " is damaged",
+              static_cast<gint64>(id));
+    return false;
+  }
+  return out->Assign(bytes.data(), bytes.size());
+}
+
+void HistoryStore::ScheduleCommit() {
+  // The destructor commits what is left itself.
+  if (*self_ == nullptr) {
+    return;
+  }
+  if (commit_source_ == 0) {
+    commit_source_ = g_timeout_add(kCommitDelayMs, OnCommitTimeout, this);
+  }
+}
+
+// static
+gboolean HistoryStore::OnCommitTimeout(gpointer user_data) {
+  HistoryStore* self = static_cast<HistoryStore*>(user_data);
+  self->commit_source_ = 0;
+  self->Commit();
+  return G_SOURCE_REMOVE;
+}
+
+void HistoryStore::Commit() {
+  if (commit_source_ != 0) {
+    g_source_remove(commit_source_);
+    commit_source_ = 0;
+  }
+  commit_requested_ = true;
+  StartNextJob();
+}
+
+void HistoryStore::StartNextJob() {
+  if (job_ || *self_ == nullptr) {
+    return;
+  }
+  if (commit_requested_ && (!queued_.empty() || index_dirty_)) {
+    StartCommit();
+  } else if (!compaction_failed_ && log_end_ - live_bytes_ >= kMinCompactBytes &&
+             log_end_ - live_bytes_ > live_bytes_) {
+    StartCompaction();
+  } else {
+    return;
+  }
+
+  GTask* task = g_task_new(nullptr, nullptr, OnJobDone, nullptr);
+  g_task_set_task_data(task, new std::shared_ptr<Job>(job_), [](gpointer job) {
+    delete static_cast<std::shared_ptr<Job>*>(job);
+  });
+  // Yield to paste encodes queued on the same pool.
+  g_task_set_priority(task, G_PRIORITY_LOW);
+  g_task_run_in_thread(task, RunJob);
+  g_object_unref(task);
+}
+
+void HistoryStore::StartCommit() {
+  commit_requested_ = false;
+  job_ = std::make_shared<Job>();
+  job_->kind = Job::Kind::kCommit;
+  job_->store = self_;
+  job_->log_fd = log_fd_;
+  job_->index_fd = index_fd_;
+  job_->index_offset = index_size_;
+  job_->log_start = log_end_;
+  if (index_dirty_) {
+    job_->index_map = index_map_;
+    job_->index_map_size = index_size_;
+    index_dirty_ = false;
+  }
+  for (const std::shared_ptr<Write>& write : queued_) {
+    write->record.offset = log_end_;
+    log_end_ += write->payload.size();
+    live_bytes_ += write->payload.size();
+  }
+  job_->writes = std::move(queued_);
+  queued_.clear();
+  queued_bytes_ = 0;
+}
+
+void HistoryStore::StartCompaction() {
+  job_ = std::make_shared<Job>();
+  job_->kind = Job::Kind::kCompact;
+  job_->store = self_;
+  job_->directory = directory_;
+  job_->log_fd = log_fd_;
+  job_->old_generation = generation_;
+  job_->generation = generation_ + 1;
+  // The rewritten index carries the updates made so far.
+  index_dirty_ = false;
+  for (size_t slot = 0; slot < record_count_; slot++) {
+    const IndexRecord* record = RecordAt(slot);
+    if ((record->flags & kLiveFlag) != 0) {
+      job_->records.push_back(*record);
+    }
+  }
+}
+
+// static
+void HistoryStore::RunJob(GTask* task, gpointer source_object,
+                          gpointer task_data, GCancellable* cancellable) {
+  TraceScope trace("history-store");
+  std::shared_ptr<Job> job = *static_cast<std::shared_ptr<Job>*>(task_data);
+  RunJobNow(job.get());
+  {
+    std::lock_guard<std::mutex> lock(job->mutex);
+    job->done = true;
+  }
+  job->done_condition.notify_all();
+  g_task_return_boolean(task, TRUE);
+}
+
+// static
+void HistoryStore::OnJobDone(GObject* source_object, GAsyncResult* result,
+                             gpointer data) {
+  std::shared_ptr<Job> job =
+      *static_cast<std::shared_ptr<Job>*>(g_task_get_task_data(G_TASK(result)));
+  HistoryStore* self = *job->store;
+  // The destructor has taken over the job.
+  if (self == nullptr || self->job_ != job) {
+    return;
+  }
+  self->job_.reset();
+  self->FinishJob(job.get());
+  self->StartNextJob();
+}
+
+void HistoryStore::FinishJob(Job* job) {
+  if (job->kind == Job::Kind::kCommit) {
+    if (job->ok) {
+      UnmapIndex();
+      index_size_ += job->writes.size() * sizeof(IndexRecord);
+      for (const std::shared_ptr<Write>& write : job->writes) {
+        slots_[write->record.id] = record_count_++;
+      }
+    } else {
+      g_warning("FlutterPasteInput: Failed to write clipboard history");
+      UnmapIndex();
+      if (ftruncate(index_fd_, static_cast<off_t>(index_size_)) != 0) {
+        g_warning("FlutterPasteInput: Failed to truncate the clipboard history index");
+      }
+      for (const std::shared_ptr<Write>& write : job->writes) {
+        live_bytes_ -= write->payload.size();
+      }
+      log_end_ = job->log_start;
+      // Retried with the next commit.
+      index_dirty_ = index_dirty_ || job->index_map != nullptr;
+    }
+    if (!MapIndex()) {
+      g_warning("FlutterPasteInput: Failed to map the clipboard history index");
+    }
+  } else if (job->ok) {
+    UnmapIndex();
+    close(log_fd_);
+    close(index_fd_);
+    log_fd_ = job->new_log_fd;
+    index_fd_ = job->new_index_fd;
+    generation_ = job->generation;
+    log_end_ = job->new_log_end;
+    record_count_ = job->records.size();
+    index_size_ = sizeof(IndexHeader) + record_count_ * sizeof(IndexRecord);
+    slots_.clear();
+    for (size_t slot = 0; slot < record_count_; slot++) {
+      slots_[job->records[slot].id] = slot;
+    }
+    if (!MapIndex()) {
+      g_warning("FlutterPasteInput: Failed to map the clipboard history index");
+    }
+  } else {
+    g_warning("FlutterPasteInput: Failed to compact clipboard history");
+    compaction_failed_ = true;
+    index_dirty_ = true;
+  }
+
+  std::vector<Update> updates;
+  updates.swap(deferred_updates_);
+  for (const Update& update : updates) {
+    ApplyUpdate(update);
+  }
+
+  if (job->kind == Job::Kind::kCommit && !job->ok && write_failed_listener_) {
+    // Copied, as the listener may remove entries and so touch the store.
+    WriteFailedListener listener = write_failed_listener_;
+    for (const std::shared_ptr<Write>& write : job->writes) {
+      listener(write->record.id);
+    }
+  }
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,204 @@
+#ifndef FLUTTER_PLUGIN_HISTORY_STORE_H_
+#define FLUTTER_PLUGIN_HISTORY_STORE_H_
+
+#include <gio/gio.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "buffer_pool.h"
+
+namespace flutter_paste_input {
+
+// On-disk clipboard history: an append-only data log and a memory-mapped
+// index of fixed-size records.
+//
+// Payloads are opaque to the store. Appends are queued and committed in
+// groups on the GIO worker pool, kCommitDelayMs after the first one or as
+// soon as kCommitBytes are queued: the batch is written to the log and
+// synced, then its index records are written and synced, so the index
+// never points at data that is not on disk. Opening the store maps the
+// index and reads no payloads; Read() fetches a single payload from the
+// log.
+//
+// Removed entries only clear a flag in the index. Removals and touches
+// change the mapped index in place and are synced by the next group
+// commit, which they schedule. Once dead payloads take up more of the log
+// than live ones, the live ones are copied into a new log generation in
+// the background, and the rewritten index is renamed over the old one,
+// which is the commit point. Writes and removals made meanwhile are
+// applied to the new files afterwards.
+//
+// Files use host byte order and are not meant to be moved between
+// machines. Main thread only.
+class HistoryStore {
+ public:
+  // Metadata of a stored entry, as kept in its index record.
+  struct Record {
+    int64_t id = 0;
+    uint64_t content_hash = 0;
+    int64_t captured_at_ms = 0;
+    // Truncated to what fits in the index record.
+    std::vector<std::string> mime_types;
+    // Size of the content as pasted.
+    size_t byte_size = 0;
+    // Size of the payload in the log.
+    size_t stored_bytes = 0;
+    // Opaque to the store, e.g. the kind of payload.
+    uint32_t tags = 0;
+  };
+
+  // Receives the id of an appended entry that was lost because its group
+  // commit failed.
+  using WriteFailedListener = std::function<void(int64_t id)>;
+
+  static constexpr guint kCommitDelayMs = 200;
+  static constexpr size_t kCommitBytes = 4 * 1024 * 1024;
+
+  // Logs with fewer dead bytes than this are never compacted.
+  static constexpr size_t kMinCompactBytes = 1024 * 1024;
+
+  // Opens the store in |directory|, creating it if needed. A store that
+  // cannot be read is discarded and started afresh. Returns nullptr if the
+  // directory is not writable.
+  static std::unique_ptr<HistoryStore> Open(const std::string& directory);
+
+  // Deletes the files of the store in |directory|, which must not be open.
+  static void Destroy(const std::string& directory);
+
+  // The plugin's directory under the user cache directory, per application.
+  static std::string DefaultDirectory();
+
+  // Commits queued writes before returning.
+  ~HistoryStore();
+
+  // Disallow copy and assign.
+  HistoryStore(const HistoryStore&) = delete;
+  HistoryStore& operator=(const HistoryStore&) = delete;
+
+  // Live entries, oldest first, including queued ones.
+  std::vector<Record> Records() const;
+
+  // Queues an entry for the next group commit. |record.stored_bytes| is
+  // taken from |payload|.
+  void Append(Record record, PooledBuffer payload);
+
+  void Touch(int64_t id, int64_t captured_at_ms);
+  void Remove(int64_t id);
+
+  // Reads the payload of entry |id| into |out|. Returns false if there is
+  // no such entry or its data is damaged.
+  bool Read(int64_t id, PooledBuffer* out);
+
+  // Starts committing queued writes now rather than after the delay.
+  void Commit();
+
+  // Not called from the destructor.
+  void set_write_failed_listener(WriteFailedListener listener) {
+    write_failed_listener_ = std::move(listener);
+  }
+
+  // Bytes of live and of all payloads in the log, including queued ones.
+  size_t live_bytes() const { return live_bytes_; }
+  size_t log_bytes() const { return log_end_ + queued_bytes_; }
+
+  const std::string& directory() const { return directory_; }
+
+  // Path of a file kept alongside the store by its user, e.g. a search
+  // index, named with |suffix|. Destroy() deletes it with the store.
+  std::string SidecarPath(const char* suffix) const;
+
+ private:
+  struct IndexHeader;
+  struct IndexRecord;
+  struct Write;
+  struct Job;
+
+  // A removal or timestamp change waiting for its record to be indexed.
+  struct Update {
+    int64_t id;
+    bool remove;
+    int64_t captured_at_ms;
+  };
+
+  explicit HistoryStore(std::string directory);
+
+  // Opens the files named by the index, or creates empty ones.
+  bool Load();
+  bool CreateEmpty();
+
+  // (Re)maps the index file, which must be |index_size_| bytes long.
+  bool MapIndex();
+  void UnmapIndex();
+  IndexRecord* RecordAt(size_t slot) const;
+
+  void ScheduleCommit();
+  static gboolean OnCommitTimeout(gpointer user_data);
+
+  // Starts the next job, a commit or a compaction, unless one is running.
+  void StartNextJob();
+  void StartCommit();
+  void StartCompaction();
+  static void RunJob(GTask* task, gpointer source_object, gpointer task_data,
+                     GCancellable* cancellable);
+  static void OnJobDone(GObject* source_object, GAsyncResult* result,
+                        gpointer data);
+
+  // Worker side of a job; also run on the main thread by the destructor.
+  static void RunJobNow(Job* job);
+  // Syncs the mapped index if updates were made in it, then writes the
+  // batch to the log and its records to the index, syncing each in turn.
+  static bool CommitWrites(Job* job);
+  // Copies the live payloads into a new log generation, then renames a
+  // rewritten index over the old one.
+  static bool Compact(Job* job);
+
+  // Takes over the files and records written by |job|.
+  void FinishJob(Job* job);
+
+  // Applies |update| to the index, or keeps it for later if the record is
+  // not indexed yet or a compaction is running.
+  void ApplyUpdate(const Update& update);
+
+  std::string directory_;
+  uint32_t generation_ = 0;
+  int log_fd_ = -1;
+  int index_fd_ = -1;
+  uint8_t* index_map_ = nullptr;
+  size_t index_size_ = 0;
+
+  // Slot in the index of every live record.
+  std::unordered_map<int64_t, size_t> slots_;
+  size_t record_count_ = 0;
+  size_t log_end_ = 0;
+  size_t live_bytes_ = 0;
+
+  // Appends waiting for the next commit.
+  std::vector<std::shared_ptr<Write>> queued_;
+  size_t queued_bytes_ = 0;
+  guint commit_source_ = 0;
+  bool commit_requested_ = false;
+  // Set after a failed compaction, which is then not retried.
+  bool compaction_failed_ = false;
+  // Set when a removal or touch changed the mapped index since the last
+  // sync.
+  bool index_dirty_ = false;
+  WriteFailedListener write_failed_listener_;
+
+  std::vector<Update> deferred_updates_;
+
+  // The job running on the worker pool, if any.
+  std::shared_ptr<Job> job_;
+
+  // Outlives the store while a job is running.
+  std::shared_ptr<HistoryStore*> self_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_HISTORY_STORE_H_
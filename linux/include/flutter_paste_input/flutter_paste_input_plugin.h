@@ -21,6 +21,15 @@ FLUTTER_PLUGIN_EXPORT GType flutter_paste_input_plugin_get_type();
 FLUTTER_PLUGIN_EXPORT void flutter_paste_input_plugin_register_with_registrar(
     FlPluginRegistrar* registrar);
 
+// Reads the clipboard and sends it as a paste event (PasteChannel.onPaste)
+// to the engine whose view has focus, if any.
+//
+// For apps that handle the paste shortcut natively, e.g. in a GTK key
+// handler of the runner, rather than in Flutter. The clipboard is read once
+// however many engines are registered, and events are held back while Dart
+// is still handling earlier ones. Call on the main thread.
+FLUTTER_PLUGIN_EXPORT void flutter_paste_input_plugin_notify_paste_to_focused_view();
+
 G_END_DECLS
 
 #endif  // FLUTTER_PLUGIN_FLUTTER_PASTE_INPUT_PLUGIN_H_
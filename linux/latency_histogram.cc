@@ -0,0 +1,115 @@
+#include "latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace flutter_paste_input {
+
+namespace {
+
+constexpr uint64_t kGenerationMask = (uint64_t{1} << 24) - 1;
+
+int HighestBit(uint64_t value) {
+  return 63 - __builtin_clzll(value);
+}
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() {
+  for (size_t i = 0; i < kBucketCount; i++) {
+    counts_[i].store(0, std::memory_order_relaxed);
+    baseline_[i] = 0;
+  }
+}
+
+// static
+size_t LatencyHistogram::BucketIndex(uint64_t value) {
+  value = std::min(value, kMaxValue);
+  if (value < kSubBuckets) {
+    return static_cast<size_t>(value);
+  }
+  int exponent = HighestBit(value);
+  uint64_t sub_bucket = (value >> (exponent - kSubBucketBits)) - kSubBuckets;
+  return static_cast<size_t>(exponent - kSubBucketBits + 1) * kSubBuckets +
+         static_cast<size_t>(sub_bucket);
+}
+
+// static
+uint64_t LatencyHistogram::BucketHighestValue(size_t index) {
+  if (index < kSubBuckets) {
+    return index;
+  }
+  int exponent = static_cast<int>(index / kSubBuckets) + kSubBucketBits - 1;
+  uint64_t sub_bucket = index % kSubBuckets;
+  int shift = exponent - kSubBucketBits;
+  return ((kSubBuckets + sub_bucket) << shift) + ((uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::Record(uint64_t value) {
+  counts_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+
+  uint64_t generation = generation_.load(std::memory_order_relaxed) & kGenerationMask;
+  uint64_t clamped = std::min(value, (uint64_t{1} << kMaxValueBits) - 1);
+  uint64_t packed = (generation << kMaxValueBits) | clamped;
+  uint64_t current = max_.load(std::memory_order_relaxed);
+  while ((current >> kMaxValueBits) != generation ||
+         (current & ((uint64_t{1} << kMaxValueBits) - 1)) < clamped) {
+    if (max_.compare_exchange_weak(current, packed, std::memory_order_relaxed)) {
+      break;
+    }
+  }
+}
+
+uint64_t LatencyHistogram::Count() const {
+  uint64_t count = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    count += counts_[i].load(std::memory_order_relaxed) - baseline_[i];
+  }
+  return count;
+}
+
+uint64_t LatencyHistogram::Percentile(double percentile) const {
+  uint64_t counts[kBucketCount];
+  uint64_t total = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    counts[i] = counts_[i].load(std::memory_order_relaxed) - baseline_[i];
+    total += counts[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  double clamped = std::min(std::max(percentile, 0.0), 100.0);
+  uint64_t rank = static_cast<uint64_t>(std::ceil(clamped / 100.0 * total));
+  rank = std::max<uint64_t>(rank, 1);
+  uint64_t seen = 0;
+  size_t index = 0;
+  for (; index < kBucketCount; index++) {
+    seen += counts[index];
+    if (seen >= rank) {
+      break;
+    }
+  }
+  uint64_t value = BucketHighestValue(std::min(index, kBucketCount - 1));
+  uint64_t max = Max();
+  // The maximum may lag behind a racing Record().
+  return max > 0 ? std::min(value, max) : value;
+}
+
+uint64_t LatencyHistogram::Max() const {
+  uint64_t current = max_.load(std::memory_order_relaxed);
+  uint64_t generation = generation_.load(std::memory_order_relaxed) & kGenerationMask;
+  if ((current >> kMaxValueBits) != generation) {
+    return 0;
+  }
+  return current & ((uint64_t{1} << kMaxValueBits) - 1);
+}
+
+void LatencyHistogram::Reset() {
+  for (size_t i = 0; i < kBucketCount; i++) {
+    baseline_[i] = counts_[i].load(std::memory_order_relaxed);
+  }
+  generation_.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace flutter_paste_input
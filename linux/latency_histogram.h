@@ -0,0 +1,68 @@
+#ifndef FLUTTER_PLUGIN_LATENCY_HISTOGRAM_H_
+#define FLUTTER_PLUGIN_LATENCY_HISTOGRAM_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace flutter_paste_input {
+
+// Log-bucketed histogram of durations in microseconds, in the manner of
+// HdrHistogram.
+//
+// Every power of two is split into kSubBuckets linear buckets, so a
+// percentile is reported within 1/kSubBuckets of the recorded value, from
+// 0 up to kMaxValue; longer durations land in the last bucket. The maximum
+// is kept exactly.
+//
+// Record() is wait-free and may be called on any thread. Reset() does not
+// touch the counts: it copies them as a baseline that Percentile()
+// subtracts, and bumps a generation that makes the maximum start over, so
+// writers never synchronize with it. Reset(), Count() and Percentile()
+// must be called on one thread; the plugin uses the main thread.
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBucketBits = 4;
+  static constexpr uint64_t kSubBuckets = 1u << kSubBucketBits;
+  static constexpr int kMaxExponent = 31;
+  static constexpr uint64_t kMaxValue = (uint64_t{1} << (kMaxExponent + 1)) - 1;
+  static constexpr size_t kBucketCount = (kMaxExponent - kSubBucketBits + 2) * kSubBuckets;
+
+  LatencyHistogram();
+
+  // Disallow copy and assign.
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  void Record(uint64_t value);
+
+  // Values recorded since the last reset.
+  uint64_t Count() const;
+
+  // The value below which |percentile| percent of the values recorded since
+  // the last reset fall, as the highest value of its bucket but at most the
+  // maximum. 0 if nothing was recorded.
+  uint64_t Percentile(double percentile) const;
+
+  uint64_t Max() const;
+
+  void Reset();
+
+  // Bucket of |value|, and the highest value in bucket |index|.
+  static size_t BucketIndex(uint64_t value);
+  static uint64_t BucketHighestValue(size_t index);
+
+ private:
+  // The maximum is packed with the generation it was recorded in.
+  static constexpr int kMaxValueBits = 40;
+
+  std::atomic<uint64_t> counts_[kBucketCount];
+  std::atomic<uint64_t> max_{0};
+  std::atomic<uint32_t> generation_{0};
+
+  uint64_t baseline_[kBucketCount];
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_LATENCY_HISTOGRAM_H_
@@ -0,0 +1,128 @@
+#include "memory_budget.h"
+
+#include <algorithm>
+
+namespace flutter_paste_input {
+
+MemoryBudget::MemoryBudget(size_t limit_bytes) : limit_bytes_(limit_bytes) {}
+
+MemoryBudget::~MemoryBudget() {
+  if (wake_source_ != 0) {
+    g_source_remove(wake_source_);
+  }
+  for (Waiter& waiter : waiters_) {
+    g_source_remove(waiter.timeout_source);
+  }
+}
+
+bool MemoryBudget::TryReserve(size_t bytes) {
+  if (!waiters_.empty() || (limit_bytes_ != 0 && in_use_ + bytes > limit_bytes_)) {
+    return false;
+  }
+  Reserve(bytes);
+  return true;
+}
+
+void MemoryBudget::Reserve(size_t bytes) {
+  in_use_ += bytes;
+  peak_in_use_ = std::max(peak_in_use_, in_use_);
+}
+
+void MemoryBudget::Release(size_t bytes) {
+  in_use_ -= std::min(bytes, in_use_);
+  if (!waiters_.empty()) {
+    ScheduleWake();
+  }
+}
+
+uint64_t MemoryBudget::WaitFor(size_t bytes, guint timeout_ms, AdmitCallback callback) {
+  uint64_t id = next_waiter_id_++;
+  TimeoutData* data = new TimeoutData{weak_from_this(), id};
+  guint timeout_source = g_timeout_add_full(
+      G_PRIORITY_DEFAULT, timeout_ms, OnWaitTimeout, data,
+      [](gpointer data) { delete static_cast<TimeoutData*>(data); });
+  waiters_.push_back({id, bytes, timeout_source, std::move(callback)});
+  // Bytes may have been released since the caller's TryReserve().
+  ScheduleWake();
+  return id;
+}
+
+void MemoryBudget::CancelWait(uint64_t ticket) {
+  auto it = std::find_if(waiters_.begin(), waiters_.end(),
+                         [ticket](const Waiter& waiter) { return waiter.id == ticket; });
+  if (it == waiters_.end()) {
+    return;
+  }
+  g_source_remove(it->timeout_source);
+  // Destroyed outside the queue, in case it releases budget of its own.
+  AdmitCallback callback = std::move(it->callback);
+  waiters_.erase(it);
+  // Whoever was queued behind the withdrawn waiter may fit now.
+  ScheduleWake();
+}
+
+void MemoryBudget::set_limit_bytes(size_t limit_bytes) {
+  limit_bytes_ = limit_bytes;
+  if (!waiters_.empty()) {
+    ScheduleWake();
+  }
+}
+
+void MemoryBudget::ScheduleWake() {
+  if (wake_source_ != 0) {
+    return;
+  }
+  std::weak_ptr<MemoryBudget>* budget = new std::weak_ptr<MemoryBudget>(weak_from_this());
+  wake_source_ = g_idle_add_full(
+      G_PRIORITY_DEFAULT, OnWakeIdle, budget,
+      [](gpointer data) { delete static_cast<std::weak_ptr<MemoryBudget>*>(data); });
+}
+
+// static
+gboolean MemoryBudget::OnWakeIdle(gpointer user_data) {
+  std::shared_ptr<MemoryBudget> self =
+      static_cast<std::weak_ptr<MemoryBudget>*>(user_data)->lock();
+  if (self) {
+    self->wake_source_ = 0;
+    self->AdmitWaiters();
+  }
+  return G_SOURCE_REMOVE;
+}
+
+void MemoryBudget::AdmitWaiters() {
+  // Strict FIFO: a large paste at the head is not overtaken by small ones.
+  while (!waiters_.empty()) {
+    Waiter& head = waiters_.front();
+    if (limit_bytes_ != 0 && in_use_ + head.bytes > limit_bytes_) {
+      return;
+    }
+    Reserve(head.bytes);
+    g_source_remove(head.timeout_source);
+    AdmitCallback callback = std::move(head.callback);
+    waiters_.pop_front();
+    callback(true);
+  }
+}
+
+// static
+gboolean MemoryBudget::OnWaitTimeout(gpointer user_data) {
+  TimeoutData* data = static_cast<TimeoutData*>(user_data);
+  std::shared_ptr<MemoryBudget> self = data->budget.lock();
+  if (!self) {
+    return G_SOURCE_REMOVE;
+  }
+
+  auto it = std::find_if(self->waiters_.begin(), self->waiters_.end(),
+                         [data](const Waiter& waiter) { return waiter.id == data->waiter_id; });
+  if (it == self->waiters_.end()) {
+    return G_SOURCE_REMOVE;
+  }
+  AdmitCallback callback = std::move(it->callback);
+  self->waiters_.erase(it);
+  // Whoever was queued behind the expired waiter may fit now.
+  self->ScheduleWake();
+  callback(false);
+  return G_SOURCE_REMOVE;
+}
+
+}  // namespace flutter_paste_input
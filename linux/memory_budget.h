@@ -0,0 +1,104 @@
+#ifndef FLUTTER_PLUGIN_MEMORY_BUDGET_H_
+#define FLUTTER_PLUGIN_MEMORY_BUDGET_H_
+
+#include <glib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+
+namespace flutter_paste_input {
+
+// Process-wide byte budget for paste buffers.
+//
+// Every paste reserves its working set (pixel data, encoder output and the
+// copies made while serializing the reply) before the expensive part of
+// the read starts, and snapshots keep their payload reserved for as long
+// as they are alive. This bounds what several large pastes in quick
+// succession, possibly from several windows, hold at the same time.
+//
+// Main thread only. Shared through a std::shared_ptr so that snapshots can
+// release their bytes whenever they are destroyed.
+class MemoryBudget : public std::enable_shared_from_this<MemoryBudget> {
+ public:
+  // Receives true once the bytes are reserved for the caller, or false if
+  // the wait timed out.
+  using AdmitCallback = std::function<void(bool admitted)>;
+
+  static constexpr size_t kDefaultLimitBytes = 512 * 1024 * 1024;
+
+  // How long a paste may wait for other pastes to release their buffers.
+  static constexpr guint kDefaultWaitTimeoutMs = 5000;
+
+  explicit MemoryBudget(size_t limit_bytes = kDefaultLimitBytes);
+  ~MemoryBudget();
+
+  // Disallow copy and assign.
+  MemoryBudget(const MemoryBudget&) = delete;
+  MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+  // Returns true if |bytes| can be reserved at all, once nothing else is.
+  bool Fits(size_t bytes) const { return limit_bytes_ == 0 || bytes <= limit_bytes_; }
+
+  // Reserves |bytes| if that stays within the limit and nobody is queued.
+  bool TryReserve(size_t bytes);
+
+  // Reserves |bytes| regardless of the limit, for memory that already
+  // exists (e.g. text handed over by GTK).
+  void Reserve(size_t bytes);
+
+  void Release(size_t bytes);
+
+  // Reserves |bytes| as soon as enough are released, in FIFO order with
+  // other waiters, and then calls |callback| with true. Calls it with false
+  // after |timeout_ms|. |bytes| must satisfy Fits(). Returns a ticket for
+  // CancelWait(), never 0.
+  uint64_t WaitFor(size_t bytes, guint timeout_ms, AdmitCallback callback);
+
+  // Withdraws the waiter of |ticket| without calling its callback, which is
+  // destroyed. Does nothing if it was already admitted or timed out.
+  void CancelWait(uint64_t ticket);
+
+  size_t in_use() const { return in_use_; }
+  size_t peak_in_use() const { return peak_in_use_; }
+  size_t limit_bytes() const { return limit_bytes_; }
+
+  // 0 disables the limit. Lowering it does not affect existing reservations.
+  void set_limit_bytes(size_t limit_bytes);
+
+ private:
+  struct Waiter {
+    uint64_t id;
+    size_t bytes;
+    guint timeout_source;
+    AdmitCallback callback;
+  };
+
+  // Context of a waiter's timeout source.
+  struct TimeoutData {
+    std::weak_ptr<MemoryBudget> budget;
+    uint64_t waiter_id;
+  };
+
+  static gboolean OnWakeIdle(gpointer user_data);
+  static gboolean OnWaitTimeout(gpointer user_data);
+
+  // Schedules admission of queued waiters. Callbacks never run from inside
+  // Release(), which is called from snapshot destructors.
+  void ScheduleWake();
+  void AdmitWaiters();
+
+  size_t limit_bytes_;
+  size_t in_use_ = 0;
+  size_t peak_in_use_ = 0;
+
+  std::deque<Waiter> waiters_;
+  uint64_t next_waiter_id_ = 1;
+  guint wake_source_ = 0;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_MEMORY_BUDGET_H_
@@ -0,0 +1,86 @@
+#include "memory_trimmer.h"
+
+#include <algorithm>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace flutter_paste_input {
+
+MemoryTrimmer::MemoryTrimmer() {
+#if GLIB_CHECK_VERSION(2, 64, 0)
+  GMemoryMonitor* monitor = g_memory_monitor_dup_default();
+  if (monitor != nullptr) {
+    memory_monitor_ = G_OBJECT(monitor);
+    warning_handler_ = g_signal_connect(memory_monitor_, "low-memory-warning",
+                                        G_CALLBACK(OnLowMemoryWarning), this);
+  }
+#endif
+}
+
+MemoryTrimmer::~MemoryTrimmer() {
+  if (memory_monitor_ != nullptr) {
+    g_signal_handler_disconnect(memory_monitor_, warning_handler_);
+    g_object_unref(memory_monitor_);
+  }
+}
+
+int MemoryTrimmer::AddCache(TrimLevel level, TrimFunction trim) {
+  int id = next_id_++;
+  auto position = std::upper_bound(
+      caches_.begin(), caches_.end(), level,
+      [](TrimLevel level, const Cache& cache) { return level < cache.level; });
+  caches_.insert(position, {id, level, std::move(trim)});
+  return id;
+}
+
+void MemoryTrimmer::RemoveCache(int id) {
+  caches_.erase(std::remove_if(caches_.begin(), caches_.end(),
+                               [id](const Cache& cache) { return cache.id == id; }),
+                caches_.end());
+}
+
+size_t MemoryTrimmer::Trim(TrimLevel level) {
+  size_t released = 0;
+  for (const Cache& cache : caches_) {
+    if (cache.level > level) {
+      break;
+    }
+    released += cache.trim(level);
+  }
+
+#ifdef __GLIBC__
+  // Freed snapshot buffers are large enough to leave whole pages behind in
+  // the heap; give them back instead of waiting for the next allocation.
+  if (released > 0 || level == TrimLevel::kCritical) {
+    malloc_trim(0);
+  }
+#endif
+
+  g_debug("FlutterPasteInput: Trimmed %zu bytes (level %d)", released,
+          static_cast<int>(level));
+  return released;
+}
+
+// static
+TrimLevel MemoryTrimmer::LevelFromWarning(int warning_level) {
+#if GLIB_CHECK_VERSION(2, 64, 0)
+  if (warning_level >= G_MEMORY_MONITOR_WARNING_LEVEL_CRITICAL) {
+    return TrimLevel::kCritical;
+  }
+  if (warning_level >= G_MEMORY_MONITOR_WARNING_LEVEL_MEDIUM) {
+    return TrimLevel::kMedium;
+  }
+#endif
+  return TrimLevel::kLow;
+}
+
+// static
+void MemoryTrimmer::OnLowMemoryWarning(GObject* monitor, int warning_level,
+                                       gpointer user_data) {
+  MemoryTrimmer* self = static_cast<MemoryTrimmer*>(user_data);
+  self->Trim(LevelFromWarning(warning_level));
+}
+
+}  // namespace flutter_paste_input
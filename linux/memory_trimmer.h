@@ -0,0 +1,75 @@
+#ifndef FLUTTER_PLUGIN_MEMORY_TRIMMER_H_
+#define FLUTTER_PLUGIN_MEMORY_TRIMMER_H_
+
+#include <gio/gio.h>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace flutter_paste_input {
+
+// How hard to trim, matching the trimMemory level of the Pigeon API.
+enum class TrimLevel {
+  // Drop data that is unlikely to be reused.
+  kLow = 0,
+  // Drop all caches that can be rebuilt from the clipboard.
+  kMedium = 1,
+  // Additionally abandon background work that holds memory.
+  kCritical = 2,
+};
+
+// Releases native caches when the system runs low on memory.
+//
+// Caches register a trim function together with the lowest level at which
+// they are trimmed. Trim() visits them from the cheapest to rebuild to the
+// most expensive, then hands freed heap pages back to the kernel.
+//
+// Subscribes to GMemoryMonitor low-memory warnings where GLib provides
+// them (2.64 and later). Main thread only.
+class MemoryTrimmer {
+ public:
+  // Frees what the cache can at |level| and returns the bytes released.
+  using TrimFunction = std::function<size_t(TrimLevel level)>;
+
+  MemoryTrimmer();
+  ~MemoryTrimmer();
+
+  // Disallow copy and assign.
+  MemoryTrimmer(const MemoryTrimmer&) = delete;
+  MemoryTrimmer& operator=(const MemoryTrimmer&) = delete;
+
+  // Registers a cache trimmed at |level| and above. Caches with the same
+  // level are trimmed in registration order. Returns an id for
+  // RemoveCache().
+  int AddCache(TrimLevel level, TrimFunction trim);
+  void RemoveCache(int id);
+
+  // Trims every cache registered at or below |level|. Returns the number
+  // of bytes released by the caches.
+  size_t Trim(TrimLevel level);
+
+  // Maps a GMemoryMonitor warning level onto a trim level.
+  static TrimLevel LevelFromWarning(int warning_level);
+
+ private:
+  struct Cache {
+    int id;
+    TrimLevel level;
+    TrimFunction trim;
+  };
+
+  static void OnLowMemoryWarning(GObject* monitor, int warning_level,
+                                 gpointer user_data);
+
+  // Sorted by level.
+  std::vector<Cache> caches_;
+  int next_id_ = 1;
+
+  GObject* memory_monitor_ = nullptr;
+  gulong warning_handler_ = 0;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_MEMORY_TRIMMER_H_
@@ -9,6 +9,11 @@ struct _FlutterPasteInputClipboardItem {
   uint8_t* data;
   size_t data_length;
   gchar* mime_type;
+  int64_t* width;
+  int64_t* height;
+  gboolean* has_alpha;
+  int64_t* frame_count;
+  int64_t* original_byte_size;
 };
 
 G_DEFINE_TYPE(FlutterPasteInputClipboardItem, flutter_paste_input_clipboard_item, G_TYPE_OBJECT)
@@ -16,6 +21,11 @@ G_DEFINE_TYPE(FlutterPasteInputClipboardItem, flutter_paste_input_clipboard_item
 static void flutter_paste_input_clipboard_item_dispose(GObject* object) {
   FlutterPasteInputClipboardItem* self = FLUTTER_PASTE_INPUT_CLIPBOARD_ITEM(object);
   g_clear_pointer(&self->mime_type, g_free);
+  g_clear_pointer(&self->width, g_free);
+  g_clear_pointer(&self->height, g_free);
+  g_clear_pointer(&self->has_alpha, g_free);
+  g_clear_pointer(&self->frame_count, g_free);
+  g_clear_pointer(&self->original_byte_size, g_free);
   G_OBJECT_CLASS(flutter_paste_input_clipboard_item_parent_class)->dispose(object);
 }
 
@@ -26,11 +36,46 @@ static void flutter_paste_input_clipboard_item_class_init(FlutterPasteInputClipb
   G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_clipboard_item_dispose;
 }
 
-FlutterPasteInputClipboardItem* flutter_paste_input_clipboard_item_new(const uint8_t* data, size_t data_length, const gchar* mime_type) {
+FlutterPasteInputClipboardItem* flutter_paste_input_clipboard_item_new(const uint8_t* data, size_t data_length, const gchar* mime_type, int64_t* width, int64_t* height, gboolean* has_alpha, int64_t* frame_count, int64_t* original_byte_size) {
   FlutterPasteInputClipboardItem* self = FLUTTER_PASTE_INPUT_CLIPBOARD_ITEM(g_object_new(flutter_paste_input_clipboard_item_get_type(), nullptr));
   self->data = static_cast<uint8_t*>(memcpy(malloc(data_length), data, data_length));
   self->data_length = data_length;
   self->mime_type = g_strdup(mime_type);
+  if (width != nullptr) {
+    self->width = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->width = *width;
+  }
+  else {
+    self->width = nullptr;
+  }
+  if (height != nullptr) {
+    self->height = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->height = *height;
+  }
+  else {
+    self->height = nullptr;
+  }
+  if (has_alpha != nullptr) {
+    self->has_alpha = static_cast<gboolean*>(malloc(sizeof(gboolean)));
+    *self->has_alpha = *has_alpha;
+  }
+  else {
+    self->has_alpha = nullptr;
+  }
+  if (frame_count != nullptr) {
+    self->frame_count = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->frame_count = *frame_count;
+  }
+  else {
+    self->frame_count = nullptr;
+  }
+  if (original_byte_size != nullptr) {
+    self->original_byte_size = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->original_byte_size = *original_byte_size;
+  }
+  else {
+    self->original_byte_size = nullptr;
+  }
   return self;
 }
 
@@ -45,10 +90,40 @@ const gchar* flutter_paste_input_clipboard_item_get_mime_type(FlutterPasteInputC
   return self->mime_type;
 }
 
+int64_t* flutter_paste_input_clipboard_item_get_width(FlutterPasteInputClipboardItem* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_ITEM(self), nullptr);
+  return self->width;
+}
+
+int64_t* flutter_paste_input_clipboard_item_get_height(FlutterPasteInputClipboardItem* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_ITEM(self), nullptr);
+  return self->height;
+}
+
+gboolean* flutter_paste_input_clipboard_item_get_has_alpha(FlutterPasteInputClipboardItem* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_ITEM(self), nullptr);
+  return self->has_alpha;
+}
+
+int64_t* flutter_paste_input_clipboard_item_get_frame_count(FlutterPasteInputClipboardItem* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_ITEM(self), nullptr);
+  return self->frame_count;
+}
+
+int64_t* flutter_paste_input_clipboard_item_get_original_byte_size(FlutterPasteInputClipboardItem* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_ITEM(self), nullptr);
+  return self->original_byte_size;
+}
+
 static FlValue* flutter_paste_input_clipboard_item_to_list(FlutterPasteInputClipboardItem* self) {
   FlValue* values = fl_value_new_list();
   fl_value_append_take(values, fl_value_new_uint8_list(self->data, self->data_length));
   fl_value_append_take(values, fl_value_new_string(self->mime_type));
+  fl_value_append_take(values, self->width != nullptr ? fl_value_new_int(*self->width) : fl_value_new_null());
+  fl_value_append_take(values, self->height != nullptr ? fl_value_new_int(*self->height) : fl_value_new_null());
+  fl_value_append_take(values, self->has_alpha != nullptr ? fl_value_new_bool(*self->has_alpha) : fl_value_new_null());
+  fl_value_append_take(values, self->frame_count != nullptr ? fl_value_new_int(*self->frame_count) : fl_value_new_null());
+  fl_value_append_take(values, self->original_byte_size != nullptr ? fl_value_new_int(*self->original_byte_size) : fl_value_new_null());
   return values;
 }
 
@@ -58,13 +133,49 @@ static FlutterPasteInputClipboardItem* flutter_paste_input_clipboard_item_new_fr
   size_t data_length = fl_value_get_length(value0);
   FlValue* value1 = fl_value_get_list_value(values, 1);
   const gchar* mime_type = fl_value_get_string(value1);
-  return flutter_paste_input_clipboard_item_new(data, data_length, mime_type);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t* width = nullptr;
+  int64_t width_value;
+  if (fl_value_get_type(value2) != FL_VALUE_TYPE_NULL) {
+    width_value = fl_value_get_int(value2);
+    width = &width_value;
+  }
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t* height = nullptr;
+  int64_t height_value;
+  if (fl_value_get_type(value3) != FL_VALUE_TYPE_NULL) {
+    height_value = fl_value_get_int(value3);
+    height = &height_value;
+  }
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  gboolean* has_alpha = nullptr;
+  gboolean has_alpha_value;
+  if (fl_value_get_type(value4) != FL_VALUE_TYPE_NULL) {
+    has_alpha_value = fl_value_get_bool(value4);
+    has_alpha = &has_alpha_value;
+  }
+  FlValue* value5 = fl_value_get_list_value(values, 5);
+  int64_t* frame_count = nullptr;
+  int64_t frame_count_value;
+  if (fl_value_get_type(value5) != FL_VALUE_TYPE_NULL) {
+    frame_count_value = fl_value_get_int(value5);
+    frame_count = &frame_count_value;
+  }
+  FlValue* value6 = fl_value_get_list_value(values, 6);
+  int64_t* original_byte_size = nullptr;
+  int64_t original_byte_size_value;
+  if (fl_value_get_type(value6) != FL_VALUE_TYPE_NULL) {
+    original_byte_size_value = fl_value_get_int(value6);
+    original_byte_size = &original_byte_size_value;
+  }
+  return flutter_paste_input_clipboard_item_new(data, data_length, mime_type, width, height, has_alpha, frame_count, original_byte_size);
 }
 
 struct _FlutterPasteInputClipboardContent {
   GObject parent_instance;
 
   FlValue* items;
+  int64_t* peak_memory_bytes;
 };
 
 G_DEFINE_TYPE(FlutterPasteInputClipboardContent, flutter_paste_input_clipboard_content, G_TYPE_OBJECT)
@@ -72,6 +183,7 @@ G_DEFINE_TYPE(FlutterPasteInputClipboardContent, flutter_paste_input_clipboard_c
 static void flutter_paste_input_clipboard_content_dispose(GObject* object) {
   FlutterPasteInputClipboardContent* self = FLUTTER_PASTE_INPUT_CLIPBOARD_CONTENT(object);
   g_clear_pointer(&self->items, fl_value_unref);
+  g_clear_pointer(&self->peak_memory_bytes, g_free);
   G_OBJECT_CLASS(flutter_paste_input_clipboard_content_parent_class)->dispose(object);
 }
 
@@ -82,9 +194,16 @@ static void flutter_paste_input_clipboard_content_class_init(FlutterPasteInputCl
   G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_clipboard_content_dispose;
 }
 
-FlutterPasteInputClipboardContent* flutter_paste_input_clipboard_content_new(FlValue* items) {
+FlutterPasteInputClipboardContent* flutter_paste_input_clipboard_content_new(FlValue* items, int64_t* peak_memory_bytes) {
   FlutterPasteInputClipboardContent* self = FLUTTER_PASTE_INPUT_CLIPBOARD_CONTENT(g_object_new(flutter_paste_input_clipboard_content_get_type(), nullptr));
   self->items = fl_value_ref(items);
+  if (peak_memory_bytes != nullptr) {
+    self->peak_memory_bytes = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->peak_memory_bytes = *peak_memory_bytes;
+  }
+  else {
+    self->peak_memory_bytes = nullptr;
+  }
   return self;
 }
 
@@ -93,210 +212,1841 @@ FlValue* flutter_paste_input_clipboard_content_get_items(FlutterPasteInputClipbo
   return self->items;
 }
 
+int64_t* flutter_paste_input_clipboard_content_get_peak_memory_bytes(FlutterPasteInputClipboardContent* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_CONTENT(self), nullptr);
+  return self->peak_memory_bytes;
+}
+
 static FlValue* flutter_paste_input_clipboard_content_to_list(FlutterPasteInputClipboardContent* self) {
   FlValue* values = fl_value_new_list();
   fl_value_append_take(values, fl_value_ref(self->items));
+  fl_value_append_take(values, self->peak_memory_bytes != nullptr ? fl_value_new_int(*self->peak_memory_bytes) : fl_value_new_null());
   return values;
 }
 
 static FlutterPasteInputClipboardContent* flutter_paste_input_clipboard_content_new_from_list(FlValue* values) {
   FlValue* value0 = fl_value_get_list_value(values, 0);
   FlValue* items = value0;
-  return flutter_paste_input_clipboard_content_new(items);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t* peak_memory_bytes = nullptr;
+  int64_t peak_memory_bytes_value;
+  if (fl_value_get_type(value1) != FL_VALUE_TYPE_NULL) {
+    peak_memory_bytes_value = fl_value_get_int(value1);
+    peak_memory_bytes = &peak_memory_bytes_value;
+  }
+  return flutter_paste_input_clipboard_content_new(items, peak_memory_bytes);
 }
 
-struct _FlutterPasteInputMessageCodec {
-  FlStandardMessageCodec parent_instance;
+struct _FlutterPasteInputClipboardProbe {
+  GObject parent_instance;
 
+  int64_t change_count;
+  FlValue* mime_types;
 };
 
-G_DEFINE_TYPE(FlutterPasteInputMessageCodec, flutter_paste_input_message_codec, fl_standard_message_codec_get_type())
+G_DEFINE_TYPE(FlutterPasteInputClipboardProbe, flutter_paste_input_clipboard_probe, G_TYPE_OBJECT)
 
-static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_item(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardItem* value, GError** error) {
-  uint8_t type = 129;
-  g_byte_array_append(buffer, &type, sizeof(uint8_t));
-  g_autoptr(FlValue) values = flutter_paste_input_clipboard_item_to_list(value);
-  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+static void flutter_paste_input_clipboard_probe_dispose(GObject* object) {
+  FlutterPasteInputClipboardProbe* self = FLUTTER_PASTE_INPUT_CLIPBOARD_PROBE(object);
+  g_clear_pointer(&self->mime_types, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_clipboard_probe_parent_class)->dispose(object);
 }
 
-static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_content(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardContent* value, GError** error) {
-  uint8_t type = 130;
-  g_byte_array_append(buffer, &type, sizeof(uint8_t));
-  g_autoptr(FlValue) values = flutter_paste_input_clipboard_content_to_list(value);
-  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+static void flutter_paste_input_clipboard_probe_init(FlutterPasteInputClipboardProbe* self) {
 }
 
-static gboolean flutter_paste_input_message_codec_write_value(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
-  if (fl_value_get_type(value) == FL_VALUE_TYPE_CUSTOM) {
-    switch (fl_value_get_custom_type(value)) {
-      case 129:
-        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_item(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_ITEM(fl_value_get_custom_value_object(value)), error);
-      case 130:
-        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_content(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_CONTENT(fl_value_get_custom_value_object(value)), error);
-    }
-  }
+static void flutter_paste_input_clipboard_probe_class_init(FlutterPasteInputClipboardProbeClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_clipboard_probe_dispose;
+}
 
-  return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_paste_input_message_codec_parent_class)->write_value(codec, buffer, value, error);
+FlutterPasteInputClipboardProbe* flutter_paste_input_clipboard_probe_new(int64_t change_count, FlValue* mime_types) {
+  FlutterPasteInputClipboardProbe* self = FLUTTER_PASTE_INPUT_CLIPBOARD_PROBE(g_object_new(flutter_paste_input_clipboard_probe_get_type(), nullptr));
+  self->change_count = change_count;
+  self->mime_types = fl_value_ref(mime_types);
+  return self;
 }
 
-static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_item(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
-  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
-  if (values == nullptr) {
-    return nullptr;
-  }
+int64_t flutter_paste_input_clipboard_probe_get_change_count(FlutterPasteInputClipboardProbe* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_PROBE(self), 0);
+  return self->change_count;
+}
 
-  g_autoptr(FlutterPasteInputClipboardItem) value = flutter_paste_input_clipboard_item_new_from_list(values);
-  if (value == nullptr) {
-    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
-    return nullptr;
-  }
+FlValue* flutter_paste_input_clipboard_probe_get_mime_types(FlutterPasteInputClipboardProbe* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_PROBE(self), nullptr);
+  return self->mime_types;
+}
 
-  return fl_value_new_custom_object(129, G_OBJECT(value));
+static FlValue* flutter_paste_input_clipboard_probe_to_list(FlutterPasteInputClipboardProbe* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->change_count));
+  fl_value_append_take(values, fl_value_ref(self->mime_types));
+  return values;
 }
 
-static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_content(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
-  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
-  if (values == nullptr) {
-    return nullptr;
-  }
+static FlutterPasteInputClipboardProbe* flutter_paste_input_clipboard_probe_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t change_count = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  FlValue* mime_types = value1;
+  return flutter_paste_input_clipboard_probe_new(change_count, mime_types);
+}
 
-  g_autoptr(FlutterPasteInputClipboardContent) value = flutter_paste_input_clipboard_content_new_from_list(values);
-  if (value == nullptr) {
-    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
-    return nullptr;
-  }
+struct _FlutterPasteInputPasteInputConfig {
+  GObject parent_instance;
 
-  return fl_value_new_custom_object(130, G_OBJECT(value));
+  int64_t* coalesce_window_ms;
+  int64_t* max_pending_reads;
+  int64_t* max_outstanding_events;
+  int64_t* memory_budget_bytes;
+  gboolean* downscale_over_budget_images;
+  int64_t* max_transfer_bytes;
+  int64_t* clipboard_store_max_bytes;
+  int64_t* clipboard_store_time_budget_ms;
+  int64_t* history_max_entries;
+  int64_t* history_max_bytes;
+  gboolean* persist_history;
+  int64_t* history_max_disk_bytes;
+  gchar* trace_file;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputConfig, flutter_paste_input_paste_input_config, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_config_dispose(GObject* object) {
+  FlutterPasteInputPasteInputConfig* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_CONFIG(object);
+  g_clear_pointer(&self->coalesce_window_ms, g_free);
+  g_clear_pointer(&self->max_pending_reads, g_free);
+  g_clear_pointer(&self->max_outstanding_events, g_free);
+  g_clear_pointer(&self->memory_budget_bytes, g_free);
+  g_clear_pointer(&self->downscale_over_budget_images, g_free);
+  g_clear_pointer(&self->max_transfer_bytes, g_free);
+  g_clear_pointer(&self->clipboard_store_max_bytes, g_free);
+  g_clear_pointer(&self->clipboard_store_time_budget_ms, g_free);
+  g_clear_pointer(&self->history_max_entries, g_free);
+  g_clear_pointer(&self->history_max_bytes, g_free);
+  g_clear_pointer(&self->persist_history, g_free);
+  g_clear_pointer(&self->history_max_disk_bytes, g_free);
+  g_clear_pointer(&self->trace_file, g_free);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_config_parent_class)->dispose(object);
 }
 
-static FlValue* flutter_paste_input_message_codec_read_value_of_type(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, int type, GError** error) {
-  switch (type) {
-    case 129:
-      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_item(codec, buffer, offset, error);
-    case 130:
-      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_content(codec, buffer, offset, error);
-    default:
-      return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_paste_input_message_codec_parent_class)->read_value_of_type(codec, buffer, offset, type, error);
+static void flutter_paste_input_paste_input_config_init(FlutterPasteInputPasteInputConfig* self) {
+}
+
+static void flutter_paste_input_paste_input_config_class_init(FlutterPasteInputPasteInputConfigClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_config_dispose;
+}
+
+FlutterPasteInputPasteInputConfig* flutter_paste_input_paste_input_config_new(int64_t* coalesce_window_ms, int64_t* max_pending_reads, int64_t* max_outstanding_events, int64_t* memory_budget_bytes, gboolean* downscale_over_budget_images, int64_t* max_transfer_bytes, int64_t* clipboard_store_max_bytes, int64_t* clipboard_store_time_budget_ms, int64_t* history_max_entries, int64_t* history_max_bytes, gboolean* persist_history, int64_t* history_max_disk_bytes, const gchar* trace_file) {
+  FlutterPasteInputPasteInputConfig* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_CONFIG(g_object_new(flutter_paste_input_paste_input_config_get_type(), nullptr));
+  if (coalesce_window_ms != nullptr) {
+    self->coalesce_window_ms = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->coalesce_window_ms = *coalesce_window_ms;
+  }
+  else {
+    self->coalesce_window_ms = nullptr;
+  }
+  if (max_pending_reads != nullptr) {
+    self->max_pending_reads = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->max_pending_reads = *max_pending_reads;
+  }
+  else {
+    self->max_pending_reads = nullptr;
+  }
+  if (max_outstanding_events != nullptr) {
+    self->max_outstanding_events = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->max_outstanding_events = *max_outstanding_events;
+  }
+  else {
+    self->max_outstanding_events = nullptr;
+  }
+  if (memory_budget_bytes != nullptr) {
+    self->memory_budget_bytes = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->memory_budget_bytes = *memory_budget_bytes;
+  }
+  else {
+    self->memory_budget_bytes = nullptr;
+  }
+  if (downscale_over_budget_images != nullptr) {
+    self->downscale_over_budget_images = static_cast<gboolean*>(malloc(sizeof(gboolean)));
+    *self->downscale_over_budget_images = *downscale_over_budget_images;
+  }
+  else {
+    self->downscale_over_budget_images = nullptr;
+  }
+  if (max_transfer_bytes != nullptr) {
+    self->max_transfer_bytes = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->max_transfer_bytes = *max_transfer_bytes;
+  }
+  else {
+    self->max_transfer_bytes = nullptr;
+  }
+  if (clipboard_store_max_bytes != nullptr) {
+    self->clipboard_store_max_bytes = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->clipboard_store_max_bytes = *clipboard_store_max_bytes;
+  }
+  else {
+    self->clipboard_store_max_bytes = nullptr;
+  }
+  if (clipboard_store_time_budget_ms != nullptr) {
+    self->clipboard_store_time_budget_ms = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->clipboard_store_time_budget_ms = *clipboard_store_time_budget_ms;
+  }
+  else {
+    self->clipboard_store_time_budget_ms = nullptr;
+  }
+  if (history_max_entries != nullptr) {
+    self->history_max_entries = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->history_max_entries = *history_max_entries;
+  }
+  else {
+    self->history_max_entries = nullptr;
+  }
+  if (history_max_bytes != nullptr) {
+    self->history_max_bytes = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->history_max_bytes = *history_max_bytes;
+  }
+  else {
+    self->history_max_bytes = nullptr;
+  }
+  if (persist_history != nullptr) {
+    self->persist_history = static_cast<gboolean*>(malloc(sizeof(gboolean)));
+    *self->persist_history = *persist_history;
+  }
+  else {
+    self->persist_history = nullptr;
   }
+  if (history_max_disk_bytes != nullptr) {
+    self->history_max_disk_bytes = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->history_max_disk_bytes = *history_max_disk_bytes;
+  }
+  else {
+    self->history_max_disk_bytes = nullptr;
+  }
+  if (trace_file != nullptr) {
+    self->trace_file = g_strdup(trace_file);
+  }
+  else {
+    self->trace_file = nullptr;
+  }
+  return self;
 }
 
-static void flutter_paste_input_message_codec_init(FlutterPasteInputMessageCodec* self) {
+int64_t* flutter_paste_input_paste_input_config_get_coalesce_window_ms(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->coalesce_window_ms;
 }
 
-static void flutter_paste_input_message_codec_class_init(FlutterPasteInputMessageCodecClass* klass) {
-  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->write_value = flutter_paste_input_message_codec_write_value;
-  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->read_value_of_type = flutter_paste_input_message_codec_read_value_of_type;
+int64_t* flutter_paste_input_paste_input_config_get_max_pending_reads(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->max_pending_reads;
 }
 
-static FlutterPasteInputMessageCodec* flutter_paste_input_message_codec_new() {
-  FlutterPasteInputMessageCodec* self = FLUTTER_PASTE_INPUT_MESSAGE_CODEC(g_object_new(flutter_paste_input_message_codec_get_type(), nullptr));
-  return self;
+int64_t* flutter_paste_input_paste_input_config_get_max_outstanding_events(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->max_outstanding_events;
 }
 
-struct _FlutterPasteInputPasteInputHostApiGetClipboardContentResponse {
-  GObject parent_instance;
+int64_t* flutter_paste_input_paste_input_config_get_memory_budget_bytes(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->memory_budget_bytes;
+}
 
-  FlValue* value;
-};
+gboolean* flutter_paste_input_paste_input_config_get_downscale_over_budget_images(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->downscale_over_budget_images;
+}
 
-G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse, flutter_paste_input_paste_input_host_api_get_clipboard_content_response, G_TYPE_OBJECT)
+int64_t* flutter_paste_input_paste_input_config_get_max_transfer_bytes(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->max_transfer_bytes;
+}
 
-static void flutter_paste_input_paste_input_host_api_get_clipboard_content_response_dispose(GObject* object) {
-  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_get_clipboard_content_response_parent_class)->dispose(object);
+int64_t* flutter_paste_input_paste_input_config_get_clipboard_store_max_bytes(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->clipboard_store_max_bytes;
 }
 
-static void flutter_paste_input_paste_input_host_api_get_clipboard_content_response_init(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self) {
+int64_t* flutter_paste_input_paste_input_config_get_clipboard_store_time_budget_ms(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->clipboard_store_time_budget_ms;
 }
 
-static void flutter_paste_input_paste_input_host_api_get_clipboard_content_response_class_init(FlutterPasteInputPasteInputHostApiGetClipboardContentResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_get_clipboard_content_response_dispose;
+int64_t* flutter_paste_input_paste_input_config_get_history_max_entries(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->history_max_entries;
 }
 
-FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new(FlutterPasteInputClipboardContent* return_value) {
-  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_clipboard_content_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_custom_object(130, G_OBJECT(return_value)));
-  return self;
+int64_t* flutter_paste_input_paste_input_config_get_history_max_bytes(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->history_max_bytes;
 }
 
-FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_clipboard_content_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(code));
-  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
-  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
-  return self;
+gboolean* flutter_paste_input_paste_input_config_get_persist_history(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->persist_history;
 }
 
-struct _FlutterPasteInputPasteInputHostApiClearTempFilesResponse {
+int64_t* flutter_paste_input_paste_input_config_get_history_max_disk_bytes(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->history_max_disk_bytes;
+}
+
+const gchar* flutter_paste_input_paste_input_config_get_trace_file(FlutterPasteInputPasteInputConfig* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_CONFIG(self), nullptr);
+  return self->trace_file;
+}
+
+static FlValue* flutter_paste_input_paste_input_config_to_list(FlutterPasteInputPasteInputConfig* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, self->coalesce_window_ms != nullptr ? fl_value_new_int(*self->coalesce_window_ms) : fl_value_new_null());
+  fl_value_append_take(values, self->max_pending_reads != nullptr ? fl_value_new_int(*self->max_pending_reads) : fl_value_new_null());
+  fl_value_append_take(values, self->max_outstanding_events != nullptr ? fl_value_new_int(*self->max_outstanding_events) : fl_value_new_null());
+  fl_value_append_take(values, self->memory_budget_bytes != nullptr ? fl_value_new_int(*self->memory_budget_bytes) : fl_value_new_null());
+  fl_value_append_take(values, self->downscale_over_budget_images != nullptr ? fl_value_new_bool(*self->downscale_over_budget_images) : fl_value_new_null());
+  fl_value_append_take(values, self->max_transfer_bytes != nullptr ? fl_value_new_int(*self->max_transfer_bytes) : fl_value_new_null());
+  fl_value_append_take(values, self->clipboard_store_max_bytes != nullptr ? fl_value_new_int(*self->clipboard_store_max_bytes) : fl_value_new_null());
+  fl_value_append_take(values, self->clipboard_store_time_budget_ms != nullptr ? fl_value_new_int(*self->clipboard_store_time_budget_ms) : fl_value_new_null());
+  fl_value_append_take(values, self->history_max_entries != nullptr ? fl_value_new_int(*self->history_max_entries) : fl_value_new_null());
+  fl_value_append_take(values, self->history_max_bytes != nullptr ? fl_value_new_int(*self->history_max_bytes) : fl_value_new_null());
+  fl_value_append_take(values, self->persist_history != nullptr ? fl_value_new_bool(*self->persist_history) : fl_value_new_null());
+  fl_value_append_take(values, self->history_max_disk_bytes != nullptr ? fl_value_new_int(*self->history_max_disk_bytes) : fl_value_new_null());
+  fl_value_append_take(values, self->trace_file != nullptr ? fl_value_new_string(self->trace_file) : fl_value_new_null());
+  return values;
+}
+
+static FlutterPasteInputPasteInputConfig* flutter_paste_input_paste_input_config_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t* coalesce_window_ms = nullptr;
+  int64_t coalesce_window_ms_value;
+  if (fl_value_get_type(value0) != FL_VALUE_TYPE_NULL) {
+    coalesce_window_ms_value = fl_value_get_int(value0);
+    coalesce_window_ms = &coalesce_window_ms_value;
+  }
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t* max_pending_reads = nullptr;
+  int64_t max_pending_reads_value;
+  if (fl_value_get_type(value1) != FL_VALUE_TYPE_NULL) {
+    max_pending_reads_value = fl_value_get_int(value1);
+    max_pending_reads = &max_pending_reads_value;
+  }
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t* max_outstanding_events = nullptr;
+  int64_t max_outstanding_events_value;
+  if (fl_value_get_type(value2) != FL_VALUE_TYPE_NULL) {
+    max_outstanding_events_value = fl_value_get_int(value2);
+    max_outstanding_events = &max_outstanding_events_value;
+  }
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t* memory_budget_bytes = nullptr;
+  int64_t memory_budget_bytes_value;
+  if (fl_value_get_type(value3) != FL_VALUE_TYPE_NULL) {
+    memory_budget_bytes_value = fl_value_get_int(value3);
+    memory_budget_bytes = &memory_budget_bytes_value;
+  }
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  gboolean* downscale_over_budget_images = nullptr;
+  gboolean downscale_over_budget_images_value;
+  if (fl_value_get_type(value4) != FL_VALUE_TYPE_NULL) {
+    downscale_over_budget_images_value = fl_value_get_bool(value4);
+    downscale_over_budget_images = &downscale_over_budget_images_value;
+  }
+  FlValue* value5 = fl_value_get_list_value(values, 5);
+  int64_t* max_transfer_bytes = nullptr;
+  int64_t max_transfer_bytes_value;
+  if (fl_value_get_type(value5) != FL_VALUE_TYPE_NULL) {
+    max_transfer_bytes_value = fl_value_get_int(value5);
+    max_transfer_bytes = &max_transfer_bytes_value;
+  }
+  FlValue* value6 = fl_value_get_list_value(values, 6);
+  int64_t* clipboard_store_max_bytes = nullptr;
+  int64_t clipboard_store_max_bytes_value;
+  if (fl_value_get_type(value6) != FL_VALUE_TYPE_NULL) {
+    clipboard_store_max_bytes_value = fl_value_get_int(value6);
+    clipboard_store_max_bytes = &clipboard_store_max_bytes_value;
+  }
+  FlValue* value7 = fl_value_get_list_value(values, 7);
+  int64_t* clipboard_store_time_budget_ms = nullptr;
+  int64_t clipboard_store_time_budget_ms_value;
+  if (fl_value_get_type(value7) != FL_VALUE_TYPE_NULL) {
+    clipboard_store_time_budget_ms_value = fl_value_get_int(value7);
+    clipboard_store_time_budget_ms = &clipboard_store_time_budget_ms_value;
+  }
+  FlValue* value8 = fl_value_get_list_value(values, 8);
+  int64_t* history_max_entries = nullptr;
+  int64_t history_max_entries_value;
+  if (fl_value_get_type(value8) != FL_VALUE_TYPE_NULL) {
+    history_max_entries_value = fl_value_get_int(value8);
+    history_max_entries = &history_max_entries_value;
+  }
+  FlValue* value9 = fl_value_get_list_value(values, 9);
+  int64_t* history_max_bytes = nullptr;
+  int64_t history_max_bytes_value;
+  if (fl_value_get_type(value9) != FL_VALUE_TYPE_NULL) {
+    history_max_bytes_value = fl_value_get_int(value9);
+    history_max_bytes = &history_max_bytes_value;
+  }
+  FlValue* value10 = fl_value_get_list_value(values, 10);
+  gboolean* persist_history = nullptr;
+  gboolean persist_history_value;
+  if (fl_value_get_type(value10) != FL_VALUE_TYPE_NULL) {
+    persist_history_value = fl_value_get_bool(value10);
+    persist_history = &persist_history_value;
+  }
+  FlValue* value11 = fl_value_get_list_value(values, 11);
+  int64_t* history_max_disk_bytes = nullptr;
+  int64_t history_max_disk_bytes_value;
+  if (fl_value_get_type(value11) != FL_VALUE_TYPE_NULL) {
+    history_max_disk_bytes_value = fl_value_get_int(value11);
+    history_max_disk_bytes = &history_max_disk_bytes_value;
+  }
+  FlValue* value12 = fl_value_get_list_value(values, 12);
+  const gchar* trace_file = nullptr;
+  if (fl_value_get_type(value12) != FL_VALUE_TYPE_NULL) {
+    trace_file = fl_value_get_string(value12);
+  }
+  return flutter_paste_input_paste_input_config_new(coalesce_window_ms, max_pending_reads, max_outstanding_events, memory_budget_bytes, downscale_over_budget_images, max_transfer_bytes, clipboard_store_max_bytes, clipboard_store_time_budget_ms, history_max_entries, history_max_bytes, persist_history, history_max_disk_bytes, trace_file);
+}
+
+struct _FlutterPasteInputPasteProgress {
   GObject parent_instance;
 
-  FlValue* value;
+  int64_t request_id;
+  int64_t received_bytes;
+  int64_t* expected_bytes;
 };
 
-G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiClearTempFilesResponse, flutter_paste_input_paste_input_host_api_clear_temp_files_response, G_TYPE_OBJECT)
+G_DEFINE_TYPE(FlutterPasteInputPasteProgress, flutter_paste_input_paste_progress, G_TYPE_OBJECT)
 
-static void flutter_paste_input_paste_input_host_api_clear_temp_files_response_dispose(GObject* object) {
-  FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CLEAR_TEMP_FILES_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_clear_temp_files_response_parent_class)->dispose(object);
+static void flutter_paste_input_paste_progress_dispose(GObject* object) {
+  FlutterPasteInputPasteProgress* self = FLUTTER_PASTE_INPUT_PASTE_PROGRESS(object);
+  g_clear_pointer(&self->expected_bytes, g_free);
+  G_OBJECT_CLASS(flutter_paste_input_paste_progress_parent_class)->dispose(object);
 }
 
-static void flutter_paste_input_paste_input_host_api_clear_temp_files_response_init(FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self) {
+static void flutter_paste_input_paste_progress_init(FlutterPasteInputPasteProgress* self) {
 }
 
-static void flutter_paste_input_paste_input_host_api_clear_temp_files_response_class_init(FlutterPasteInputPasteInputHostApiClearTempFilesResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_clear_temp_files_response_dispose;
+static void flutter_paste_input_paste_progress_class_init(FlutterPasteInputPasteProgressClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_progress_dispose;
 }
 
-FlutterPasteInputPasteInputHostApiClearTempFilesResponse* flutter_paste_input_paste_input_host_api_clear_temp_files_response_new() {
-  FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CLEAR_TEMP_FILES_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_clear_temp_files_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_null());
+FlutterPasteInputPasteProgress* flutter_paste_input_paste_progress_new(int64_t request_id, int64_t received_bytes, int64_t* expected_bytes) {
+  FlutterPasteInputPasteProgress* self = FLUTTER_PASTE_INPUT_PASTE_PROGRESS(g_object_new(flutter_paste_input_paste_progress_get_type(), nullptr));
+  self->request_id = request_id;
+  self->received_bytes = received_bytes;
+  if (expected_bytes != nullptr) {
+    self->expected_bytes = static_cast<int64_t*>(malloc(sizeof(int64_t)));
+    *self->expected_bytes = *expected_bytes;
+  }
+  else {
+    self->expected_bytes = nullptr;
+  }
   return self;
 }
 
-FlutterPasteInputPasteInputHostApiClearTempFilesResponse* flutter_paste_input_paste_input_host_api_clear_temp_files_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CLEAR_TEMP_FILES_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_clear_temp_files_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(code));
-  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
-  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
-  return self;
+int64_t flutter_paste_input_paste_progress_get_request_id(FlutterPasteInputPasteProgress* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_PROGRESS(self), 0);
+  return self->request_id;
 }
 
-struct _FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse {
+int64_t flutter_paste_input_paste_progress_get_received_bytes(FlutterPasteInputPasteProgress* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_PROGRESS(self), 0);
+  return self->received_bytes;
+}
+
+int64_t* flutter_paste_input_paste_progress_get_expected_bytes(FlutterPasteInputPasteProgress* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_PROGRESS(self), nullptr);
+  return self->expected_bytes;
+}
+
+static FlValue* flutter_paste_input_paste_progress_to_list(FlutterPasteInputPasteProgress* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->request_id));
+  fl_value_append_take(values, fl_value_new_int(self->received_bytes));
+  fl_value_append_take(values, self->expected_bytes != nullptr ? fl_value_new_int(*self->expected_bytes) : fl_value_new_null());
+  return values;
+}
+
+static FlutterPasteInputPasteProgress* flutter_paste_input_paste_progress_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t request_id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t received_bytes = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t* expected_bytes = nullptr;
+  int64_t expected_bytes_value;
+  if (fl_value_get_type(value2) != FL_VALUE_TYPE_NULL) {
+    expected_bytes_value = fl_value_get_int(value2);
+    expected_bytes = &expected_bytes_value;
+  }
+  return flutter_paste_input_paste_progress_new(request_id, received_bytes, expected_bytes);
+}
+
+struct _FlutterPasteInputClipboardWrite {
   GObject parent_instance;
 
-  FlValue* value;
+  gchar* text;
+  uint8_t* image;
+  size_t image_length;
+  gchar* image_mime_type;
+  FlValue* rendered_image_types;
 };
 
-G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse, flutter_paste_input_paste_input_host_api_get_platform_version_response, G_TYPE_OBJECT)
+G_DEFINE_TYPE(FlutterPasteInputClipboardWrite, flutter_paste_input_clipboard_write, G_TYPE_OBJECT)
 
-static void flutter_paste_input_paste_input_host_api_get_platform_version_response_dispose(GObject* object) {
-  FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PLATFORM_VERSION_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_get_platform_version_response_parent_class)->dispose(object);
+static void flutter_paste_input_clipboard_write_dispose(GObject* object) {
+  FlutterPasteInputClipboardWrite* self = FLUTTER_PASTE_INPUT_CLIPBOARD_WRITE(object);
+  g_clear_pointer(&self->text, g_free);
+  g_clear_pointer(&self->image_mime_type, g_free);
+  g_clear_pointer(&self->rendered_image_types, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_clipboard_write_parent_class)->dispose(object);
 }
 
-static void flutter_paste_input_paste_input_host_api_get_platform_version_response_init(FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self) {
+static void flutter_paste_input_clipboard_write_init(FlutterPasteInputClipboardWrite* self) {
 }
 
-static void flutter_paste_input_paste_input_host_api_get_platform_version_response_class_init(FlutterPasteInputPasteInputHostApiGetPlatformVersionResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_get_platform_version_response_dispose;
+static void flutter_paste_input_clipboard_write_class_init(FlutterPasteInputClipboardWriteClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_clipboard_write_dispose;
 }
 
-FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* flutter_paste_input_paste_input_host_api_get_platform_version_response_new(const gchar* return_value) {
-  FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PLATFORM_VERSION_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_platform_version_response_get_type(), nullptr));
+FlutterPasteInputClipboardWrite* flutter_paste_input_clipboard_write_new(const gchar* text, const uint8_t* image, size_t image_length, const gchar* image_mime_type, FlValue* rendered_image_types) {
+  FlutterPasteInputClipboardWrite* self = FLUTTER_PASTE_INPUT_CLIPBOARD_WRITE(g_object_new(flutter_paste_input_clipboard_write_get_type(), nullptr));
+  if (text != nullptr) {
+    self->text = g_strdup(text);
+  }
+  else {
+    self->text = nullptr;
+  }
+  if (image != nullptr) {
+    self->image = static_cast<uint8_t*>(memcpy(malloc(image_length), image, image_length));
+    self->image_length = image_length;
+  }
+  else {
+    self->image = nullptr;
+    self->image_length = 0;
+  }
+  if (image_mime_type != nullptr) {
+    self->image_mime_type = g_strdup(image_mime_type);
+  }
+  else {
+    self->image_mime_type = nullptr;
+  }
+  if (rendered_image_types != nullptr) {
+    self->rendered_image_types = fl_value_ref(rendered_image_types);
+  }
+  else {
+    self->rendered_image_types = nullptr;
+  }
+  return self;
+}
+
+const gchar* flutter_paste_input_clipboard_write_get_text(FlutterPasteInputClipboardWrite* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_WRITE(self), nullptr);
+  return self->text;
+}
+
+const uint8_t* flutter_paste_input_clipboard_write_get_image(FlutterPasteInputClipboardWrite* self, size_t* length) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_WRITE(self), nullptr);
+  *length = self->image_length;
+  return self->image;
+}
+
+const gchar* flutter_paste_input_clipboard_write_get_image_mime_type(FlutterPasteInputClipboardWrite* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_WRITE(self), nullptr);
+  return self->image_mime_type;
+}
+
+FlValue* flutter_paste_input_clipboard_write_get_rendered_image_types(FlutterPasteInputClipboardWrite* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_WRITE(self), nullptr);
+  return self->rendered_image_types;
+}
+
+static FlValue* flutter_paste_input_clipboard_write_to_list(FlutterPasteInputClipboardWrite* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, self->text != nullptr ? fl_value_new_string(self->text) : fl_value_new_null());
+  fl_value_append_take(values, self->image != nullptr ? fl_value_new_uint8_list(self->image, self->image_length) : fl_value_new_null());
+  fl_value_append_take(values, self->image_mime_type != nullptr ? fl_value_new_string(self->image_mime_type) : fl_value_new_null());
+  fl_value_append_take(values, self->rendered_image_types != nullptr ? fl_value_ref(self->rendered_image_types) : fl_value_new_null());
+  return values;
+}
+
+static FlutterPasteInputClipboardWrite* flutter_paste_input_clipboard_write_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* text = nullptr;
+  if (fl_value_get_type(value0) != FL_VALUE_TYPE_NULL) {
+    text = fl_value_get_string(value0);
+  }
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  const uint8_t* image = nullptr;
+  size_t image_length = 0;
+  if (fl_value_get_type(value1) != FL_VALUE_TYPE_NULL) {
+    image = fl_value_get_uint8_list(value1);
+    image_length = fl_value_get_length(value1);
+  }
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  const gchar* image_mime_type = nullptr;
+  if (fl_value_get_type(value2) != FL_VALUE_TYPE_NULL) {
+    image_mime_type = fl_value_get_string(value2);
+  }
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  FlValue* rendered_image_types = nullptr;
+  if (fl_value_get_type(value3) != FL_VALUE_TYPE_NULL) {
+    rendered_image_types = value3;
+  }
+  return flutter_paste_input_clipboard_write_new(text, image, image_length, image_mime_type, rendered_image_types);
+}
+
+struct _FlutterPasteInputClipboardHistoryEntry {
+  GObject parent_instance;
+
+  int64_t id;
+  int64_t captured_at_ms;
+  FlValue* mime_types;
+  int64_t byte_size;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputClipboardHistoryEntry, flutter_paste_input_clipboard_history_entry, G_TYPE_OBJECT)
+
+static void flutter_paste_input_clipboard_history_entry_dispose(GObject* object) {
+  FlutterPasteInputClipboardHistoryEntry* self = FLUTTER_PASTE_INPUT_CLIPBOARD_HISTORY_ENTRY(object);
+  g_clear_pointer(&self->mime_types, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_clipboard_history_entry_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_clipboard_history_entry_init(FlutterPasteInputClipboardHistoryEntry* self) {
+}
+
+static void flutter_paste_input_clipboard_history_entry_class_init(FlutterPasteInputClipboardHistoryEntryClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_clipboard_history_entry_dispose;
+}
+
+FlutterPasteInputClipboardHistoryEntry* flutter_paste_input_clipboard_history_entry_new(int64_t id, int64_t captured_at_ms, FlValue* mime_types, int64_t byte_size) {
+  FlutterPasteInputClipboardHistoryEntry* self = FLUTTER_PASTE_INPUT_CLIPBOARD_HISTORY_ENTRY(g_object_new(flutter_paste_input_clipboard_history_entry_get_type(), nullptr));
+  self->id = id;
+  self->captured_at_ms = captured_at_ms;
+  self->mime_types = fl_value_ref(mime_types);
+  self->byte_size = byte_size;
+  return self;
+}
+
+int64_t flutter_paste_input_clipboard_history_entry_get_id(FlutterPasteInputClipboardHistoryEntry* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_ENTRY(self), 0);
+  return self->id;
+}
+
+int64_t flutter_paste_input_clipboard_history_entry_get_captured_at_ms(FlutterPasteInputClipboardHistoryEntry* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_ENTRY(self), 0);
+  return self->captured_at_ms;
+}
+
+FlValue* flutter_paste_input_clipboard_history_entry_get_mime_types(FlutterPasteInputClipboardHistoryEntry* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_ENTRY(self), nullptr);
+  return self->mime_types;
+}
+
+int64_t flutter_paste_input_clipboard_history_entry_get_byte_size(FlutterPasteInputClipboardHistoryEntry* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_ENTRY(self), 0);
+  return self->byte_size;
+}
+
+static FlValue* flutter_paste_input_clipboard_history_entry_to_list(FlutterPasteInputClipboardHistoryEntry* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->id));
+  fl_value_append_take(values, fl_value_new_int(self->captured_at_ms));
+  fl_value_append_take(values, fl_value_ref(self->mime_types));
+  fl_value_append_take(values, fl_value_new_int(self->byte_size));
+  return values;
+}
+
+static FlutterPasteInputClipboardHistoryEntry* flutter_paste_input_clipboard_history_entry_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t captured_at_ms = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  FlValue* mime_types = value2;
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t byte_size = fl_value_get_int(value3);
+  return flutter_paste_input_clipboard_history_entry_new(id, captured_at_ms, mime_types, byte_size);
+}
+
+struct _FlutterPasteInputClipboardHistoryMatch {
+  GObject parent_instance;
+
+  int64_t id;
+  int64_t match_count;
+  FlValue* match_starts;
+  FlValue* match_ends;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputClipboardHistoryMatch, flutter_paste_input_clipboard_history_match, G_TYPE_OBJECT)
+
+static void flutter_paste_input_clipboard_history_match_dispose(GObject* object) {
+  FlutterPasteInputClipboardHistoryMatch* self = FLUTTER_PASTE_INPUT_CLIPBOARD_HISTORY_MATCH(object);
+  g_clear_pointer(&self->match_starts, fl_value_unref);
+  g_clear_pointer(&self->match_ends, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_clipboard_history_match_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_clipboard_history_match_init(FlutterPasteInputClipboardHistoryMatch* self) {
+}
+
+static void flutter_paste_input_clipboard_history_match_class_init(FlutterPasteInputClipboardHistoryMatchClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_clipboard_history_match_dispose;
+}
+
+FlutterPasteInputClipboardHistoryMatch* flutter_paste_input_clipboard_history_match_new(int64_t id, int64_t match_count, FlValue* match_starts, FlValue* match_ends) {
+  FlutterPasteInputClipboardHistoryMatch* self = FLUTTER_PASTE_INPUT_CLIPBOARD_HISTORY_MATCH(g_object_new(flutter_paste_input_clipboard_history_match_get_type(), nullptr));
+  self->id = id;
+  self->match_count = match_count;
+  self->match_starts = fl_value_ref(match_starts);
+  self->match_ends = fl_value_ref(match_ends);
+  return self;
+}
+
+int64_t flutter_paste_input_clipboard_history_match_get_id(FlutterPasteInputClipboardHistoryMatch* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_MATCH(self), 0);
+  return self->id;
+}
+
+int64_t flutter_paste_input_clipboard_history_match_get_match_count(FlutterPasteInputClipboardHistoryMatch* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_MATCH(self), 0);
+  return self->match_count;
+}
+
+FlValue* flutter_paste_input_clipboard_history_match_get_match_starts(FlutterPasteInputClipboardHistoryMatch* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_MATCH(self), nullptr);
+  return self->match_starts;
+}
+
+FlValue* flutter_paste_input_clipboard_history_match_get_match_ends(FlutterPasteInputClipboardHistoryMatch* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_CLIPBOARD_HISTORY_MATCH(self), nullptr);
+  return self->match_ends;
+}
+
+static FlValue* flutter_paste_input_clipboard_history_match_to_list(FlutterPasteInputClipboardHistoryMatch* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_int(self->id));
+  fl_value_append_take(values, fl_value_new_int(self->match_count));
+  fl_value_append_take(values, fl_value_ref(self->match_starts));
+  fl_value_append_take(values, fl_value_ref(self->match_ends));
+  return values;
+}
+
+static FlutterPasteInputClipboardHistoryMatch* flutter_paste_input_clipboard_history_match_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  int64_t id = fl_value_get_int(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t match_count = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  FlValue* match_starts = value2;
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  FlValue* match_ends = value3;
+  return flutter_paste_input_clipboard_history_match_new(id, match_count, match_starts, match_ends);
+}
+
+struct _FlutterPasteInputPasteStageStats {
+  GObject parent_instance;
+
+  gchar* stage;
+  int64_t count;
+  int64_t total_micros;
+  int64_t max_micros;
+  int64_t bytes_in;
+  int64_t bytes_out;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteStageStats, flutter_paste_input_paste_stage_stats, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_stage_stats_dispose(GObject* object) {
+  FlutterPasteInputPasteStageStats* self = FLUTTER_PASTE_INPUT_PASTE_STAGE_STATS(object);
+  g_clear_pointer(&self->stage, g_free);
+  G_OBJECT_CLASS(flutter_paste_input_paste_stage_stats_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_stage_stats_init(FlutterPasteInputPasteStageStats* self) {
+}
+
+static void flutter_paste_input_paste_stage_stats_class_init(FlutterPasteInputPasteStageStatsClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_stage_stats_dispose;
+}
+
+FlutterPasteInputPasteStageStats* flutter_paste_input_paste_stage_stats_new(const gchar* stage, int64_t count, int64_t total_micros, int64_t max_micros, int64_t bytes_in, int64_t bytes_out) {
+  FlutterPasteInputPasteStageStats* self = FLUTTER_PASTE_INPUT_PASTE_STAGE_STATS(g_object_new(flutter_paste_input_paste_stage_stats_get_type(), nullptr));
+  self->stage = g_strdup(stage);
+  self->count = count;
+  self->total_micros = total_micros;
+  self->max_micros = max_micros;
+  self->bytes_in = bytes_in;
+  self->bytes_out = bytes_out;
+  return self;
+}
+
+const gchar* flutter_paste_input_paste_stage_stats_get_stage(FlutterPasteInputPasteStageStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_STAGE_STATS(self), nullptr);
+  return self->stage;
+}
+
+int64_t flutter_paste_input_paste_stage_stats_get_count(FlutterPasteInputPasteStageStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_STAGE_STATS(self), 0);
+  return self->count;
+}
+
+int64_t flutter_paste_input_paste_stage_stats_get_total_micros(FlutterPasteInputPasteStageStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_STAGE_STATS(self), 0);
+  return self->total_micros;
+}
+
+int64_t flutter_paste_input_paste_stage_stats_get_max_micros(FlutterPasteInputPasteStageStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_STAGE_STATS(self), 0);
+  return self->max_micros;
+}
+
+int64_t flutter_paste_input_paste_stage_stats_get_bytes_in(FlutterPasteInputPasteStageStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_STAGE_STATS(self), 0);
+  return self->bytes_in;
+}
+
+int64_t flutter_paste_input_paste_stage_stats_get_bytes_out(FlutterPasteInputPasteStageStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_STAGE_STATS(self), 0);
+  return self->bytes_out;
+}
+
+static FlValue* flutter_paste_input_paste_stage_stats_to_list(FlutterPasteInputPasteStageStats* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->stage));
+  fl_value_append_take(values, fl_value_new_int(self->count));
+  fl_value_append_take(values, fl_value_new_int(self->total_micros));
+  fl_value_append_take(values, fl_value_new_int(self->max_micros));
+  fl_value_append_take(values, fl_value_new_int(self->bytes_in));
+  fl_value_append_take(values, fl_value_new_int(self->bytes_out));
+  return values;
+}
+
+static FlutterPasteInputPasteStageStats* flutter_paste_input_paste_stage_stats_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* stage = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t count = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t total_micros = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t max_micros = fl_value_get_int(value3);
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  int64_t bytes_in = fl_value_get_int(value4);
+  FlValue* value5 = fl_value_get_list_value(values, 5);
+  int64_t bytes_out = fl_value_get_int(value5);
+  return flutter_paste_input_paste_stage_stats_new(stage, count, total_micros, max_micros, bytes_in, bytes_out);
+}
+
+struct _FlutterPasteInputPasteLatencyStats {
+  GObject parent_instance;
+
+  gchar* stage;
+  gchar* content_class;
+  int64_t count;
+  int64_t p50_micros;
+  int64_t p90_micros;
+  int64_t p99_micros;
+  int64_t max_micros;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteLatencyStats, flutter_paste_input_paste_latency_stats, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_latency_stats_dispose(GObject* object) {
+  FlutterPasteInputPasteLatencyStats* self = FLUTTER_PASTE_INPUT_PASTE_LATENCY_STATS(object);
+  g_clear_pointer(&self->stage, g_free);
+  g_clear_pointer(&self->content_class, g_free);
+  G_OBJECT_CLASS(flutter_paste_input_paste_latency_stats_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_latency_stats_init(FlutterPasteInputPasteLatencyStats* self) {
+}
+
+static void flutter_paste_input_paste_latency_stats_class_init(FlutterPasteInputPasteLatencyStatsClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_latency_stats_dispose;
+}
+
+FlutterPasteInputPasteLatencyStats* flutter_paste_input_paste_latency_stats_new(const gchar* stage, const gchar* content_class, int64_t count, int64_t p50_micros, int64_t p90_micros, int64_t p99_micros, int64_t max_micros) {
+  FlutterPasteInputPasteLatencyStats* self = FLUTTER_PASTE_INPUT_PASTE_LATENCY_STATS(g_object_new(flutter_paste_input_paste_latency_stats_get_type(), nullptr));
+  self->stage = g_strdup(stage);
+  self->content_class = g_strdup(content_class);
+  self->count = count;
+  self->p50_micros = p50_micros;
+  self->p90_micros = p90_micros;
+  self->p99_micros = p99_micros;
+  self->max_micros = max_micros;
+  return self;
+}
+
+const gchar* flutter_paste_input_paste_latency_stats_get_stage(FlutterPasteInputPasteLatencyStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_LATENCY_STATS(self), nullptr);
+  return self->stage;
+}
+
+const gchar* flutter_paste_input_paste_latency_stats_get_content_class(FlutterPasteInputPasteLatencyStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_LATENCY_STATS(self), nullptr);
+  return self->content_class;
+}
+
+int64_t flutter_paste_input_paste_latency_stats_get_count(FlutterPasteInputPasteLatencyStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_LATENCY_STATS(self), 0);
+  return self->count;
+}
+
+int64_t flutter_paste_input_paste_latency_stats_get_p50_micros(FlutterPasteInputPasteLatencyStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_LATENCY_STATS(self), 0);
+  return self->p50_micros;
+}
+
+int64_t flutter_paste_input_paste_latency_stats_get_p90_micros(FlutterPasteInputPasteLatencyStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_LATENCY_STATS(self), 0);
+  return self->p90_micros;
+}
+
+int64_t flutter_paste_input_paste_latency_stats_get_p99_micros(FlutterPasteInputPasteLatencyStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_LATENCY_STATS(self), 0);
+  return self->p99_micros;
+}
+
+int64_t flutter_paste_input_paste_latency_stats_get_max_micros(FlutterPasteInputPasteLatencyStats* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_LATENCY_STATS(self), 0);
+  return self->max_micros;
+}
+
+static FlValue* flutter_paste_input_paste_latency_stats_to_list(FlutterPasteInputPasteLatencyStats* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->stage));
+  fl_value_append_take(values, fl_value_new_string(self->content_class));
+  fl_value_append_take(values, fl_value_new_int(self->count));
+  fl_value_append_take(values, fl_value_new_int(self->p50_micros));
+  fl_value_append_take(values, fl_value_new_int(self->p90_micros));
+  fl_value_append_take(values, fl_value_new_int(self->p99_micros));
+  fl_value_append_take(values, fl_value_new_int(self->max_micros));
+  return values;
+}
+
+static FlutterPasteInputPasteLatencyStats* flutter_paste_input_paste_latency_stats_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* stage = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  const gchar* content_class = fl_value_get_string(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t count = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t p50_micros = fl_value_get_int(value3);
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  int64_t p90_micros = fl_value_get_int(value4);
+  FlValue* value5 = fl_value_get_list_value(values, 5);
+  int64_t p99_micros = fl_value_get_int(value5);
+  FlValue* value6 = fl_value_get_list_value(values, 6);
+  int64_t max_micros = fl_value_get_int(value6);
+  return flutter_paste_input_paste_latency_stats_new(stage, content_class, count, p50_micros, p90_micros, p99_micros, max_micros);
+}
+
+struct _FlutterPasteInputMessageCodec {
+  FlStandardMessageCodec parent_instance;
+
+};
+
+G_DEFINE_TYPE(FlutterPasteInputMessageCodec, flutter_paste_input_message_codec, fl_standard_message_codec_get_type())
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_item(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardItem* value, GError** error) {
+  uint8_t type = 129;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_clipboard_item_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_content(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardContent* value, GError** error) {
+  uint8_t type = 130;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_clipboard_content_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_probe(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardProbe* value, GError** error) {
+  uint8_t type = 131;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_clipboard_probe_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_paste_input_config(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputPasteInputConfig* value, GError** error) {
+  uint8_t type = 132;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_paste_input_config_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_paste_progress(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputPasteProgress* value, GError** error) {
+  uint8_t type = 133;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_paste_progress_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_write(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardWrite* value, GError** error) {
+  uint8_t type = 134;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_clipboard_write_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_history_entry(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardHistoryEntry* value, GError** error) {
+  uint8_t type = 135;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_clipboard_history_entry_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_history_match(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputClipboardHistoryMatch* value, GError** error) {
+  uint8_t type = 136;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_clipboard_history_match_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_paste_stage_stats(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputPasteStageStats* value, GError** error) {
+  uint8_t type = 137;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_paste_stage_stats_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_flutter_paste_input_paste_latency_stats(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterPasteInputPasteLatencyStats* value, GError** error) {
+  uint8_t type = 138;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_paste_input_paste_latency_stats_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_paste_input_message_codec_write_value(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  if (fl_value_get_type(value) == FL_VALUE_TYPE_CUSTOM) {
+    switch (fl_value_get_custom_type(value)) {
+      case 129:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_item(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_ITEM(fl_value_get_custom_value_object(value)), error);
+      case 130:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_content(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_CONTENT(fl_value_get_custom_value_object(value)), error);
+      case 131:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_probe(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_PROBE(fl_value_get_custom_value_object(value)), error);
+      case 132:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_paste_input_config(codec, buffer, FLUTTER_PASTE_INPUT_PASTE_INPUT_CONFIG(fl_value_get_custom_value_object(value)), error);
+      case 133:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_paste_progress(codec, buffer, FLUTTER_PASTE_INPUT_PASTE_PROGRESS(fl_value_get_custom_value_object(value)), error);
+      case 134:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_write(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_WRITE(fl_value_get_custom_value_object(value)), error);
+      case 135:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_history_entry(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_HISTORY_ENTRY(fl_value_get_custom_value_object(value)), error);
+      case 136:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_clipboard_history_match(codec, buffer, FLUTTER_PASTE_INPUT_CLIPBOARD_HISTORY_MATCH(fl_value_get_custom_value_object(value)), error);
+      case 137:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_paste_stage_stats(codec, buffer, FLUTTER_PASTE_INPUT_PASTE_STAGE_STATS(fl_value_get_custom_value_object(value)), error);
+      case 138:
+        return flutter_paste_input_message_codec_write_flutter_paste_input_paste_latency_stats(codec, buffer, FLUTTER_PASTE_INPUT_PASTE_LATENCY_STATS(fl_value_get_custom_value_object(value)), error);
+    }
+  }
+
+  return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_paste_input_message_codec_parent_class)->write_value(codec, buffer, value, error);
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_item(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputClipboardItem) value = flutter_paste_input_clipboard_item_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(129, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_content(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputClipboardContent) value = flutter_paste_input_clipboard_content_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(130, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_probe(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputClipboardProbe) value = flutter_paste_input_clipboard_probe_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(131, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_paste_input_config(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputPasteInputConfig) value = flutter_paste_input_paste_input_config_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(132, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_paste_progress(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputPasteProgress) value = flutter_paste_input_paste_progress_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(133, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_write(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputClipboardWrite) value = flutter_paste_input_clipboard_write_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(134, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_history_entry(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputClipboardHistoryEntry) value = flutter_paste_input_clipboard_history_entry_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(135, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_history_match(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputClipboardHistoryMatch) value = flutter_paste_input_clipboard_history_match_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(136, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_paste_stage_stats(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputPasteStageStats) value = flutter_paste_input_paste_stage_stats_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(137, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_flutter_paste_input_paste_latency_stats(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterPasteInputPasteLatencyStats) value = flutter_paste_input_paste_latency_stats_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(138, G_OBJECT(value));
+}
+
+static FlValue* flutter_paste_input_message_codec_read_value_of_type(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, int type, GError** error) {
+  switch (type) {
+    case 129:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_item(codec, buffer, offset, error);
+    case 130:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_content(codec, buffer, offset, error);
+    case 131:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_probe(codec, buffer, offset, error);
+    case 132:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_paste_input_config(codec, buffer, offset, error);
+    case 133:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_paste_progress(codec, buffer, offset, error);
+    case 134:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_write(codec, buffer, offset, error);
+    case 135:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_history_entry(codec, buffer, offset, error);
+    case 136:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_clipboard_history_match(codec, buffer, offset, error);
+    case 137:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_paste_stage_stats(codec, buffer, offset, error);
+    case 138:
+      return flutter_paste_input_message_codec_read_flutter_paste_input_paste_latency_stats(codec, buffer, offset, error);
+    default:
+      return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_paste_input_message_codec_parent_class)->read_value_of_type(codec, buffer, offset, type, error);
+  }
+}
+
+static void flutter_paste_input_message_codec_init(FlutterPasteInputMessageCodec* self) {
+}
+
+static void flutter_paste_input_message_codec_class_init(FlutterPasteInputMessageCodecClass* klass) {
+  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->write_value = flutter_paste_input_message_codec_write_value;
+  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->read_value_of_type = flutter_paste_input_message_codec_read_value_of_type;
+}
+
+static FlutterPasteInputMessageCodec* flutter_paste_input_message_codec_new() {
+  FlutterPasteInputMessageCodec* self = FLUTTER_PASTE_INPUT_MESSAGE_CODEC(g_object_new(flutter_paste_input_message_codec_get_type(), nullptr));
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse, flutter_paste_input_paste_input_host_api_get_clipboard_content_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiGetClipboardContentResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse, flutter_paste_input_paste_input_host_api_get_clipboard_content_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_get_clipboard_content_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_get_clipboard_content_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_clipboard_content_response_init(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_get_clipboard_content_response_class_init(FlutterPasteInputPasteInputHostApiGetClipboardContentResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_get_clipboard_content_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new(FlutterPasteInputClipboardContent* return_value) {
+  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_clipboard_content_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(130, G_OBJECT(return_value)));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_clipboard_content_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+struct _FlutterPasteInputPasteInputHostApiClearTempFilesResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiClearTempFilesResponse, flutter_paste_input_paste_input_host_api_clear_temp_files_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_clear_temp_files_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CLEAR_TEMP_FILES_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_clear_temp_files_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_clear_temp_files_response_init(FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_clear_temp_files_response_class_init(FlutterPasteInputPasteInputHostApiClearTempFilesResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_clear_temp_files_response_dispose;
+}
+
+FlutterPasteInputPasteInputHostApiClearTempFilesResponse* flutter_paste_input_paste_input_host_api_clear_temp_files_response_new() {
+  FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CLEAR_TEMP_FILES_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_clear_temp_files_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+FlutterPasteInputPasteInputHostApiClearTempFilesResponse* flutter_paste_input_paste_input_host_api_clear_temp_files_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiClearTempFilesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CLEAR_TEMP_FILES_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_clear_temp_files_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+struct _FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse, flutter_paste_input_paste_input_host_api_get_platform_version_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_get_platform_version_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PLATFORM_VERSION_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_get_platform_version_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_platform_version_response_init(FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_get_platform_version_response_class_init(FlutterPasteInputPasteInputHostApiGetPlatformVersionResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_get_platform_version_response_dispose;
+}
+
+FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* flutter_paste_input_paste_input_host_api_get_platform_version_response_new(const gchar* return_value) {
+  FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PLATFORM_VERSION_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_platform_version_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(return_value));
+  return self;
+}
+
+FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* flutter_paste_input_paste_input_host_api_get_platform_version_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PLATFORM_VERSION_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_platform_version_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiProbeClipboardResponse, flutter_paste_input_paste_input_host_api_probe_clipboard_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_PROBE_CLIPBOARD_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiProbeClipboardResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiProbeClipboardResponse, flutter_paste_input_paste_input_host_api_probe_clipboard_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_probe_clipboard_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiProbeClipboardResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_PROBE_CLIPBOARD_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_probe_clipboard_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_probe_clipboard_response_init(FlutterPasteInputPasteInputHostApiProbeClipboardResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_probe_clipboard_response_class_init(FlutterPasteInputPasteInputHostApiProbeClipboardResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_probe_clipboard_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiProbeClipboardResponse* flutter_paste_input_paste_input_host_api_probe_clipboard_response_new(FlutterPasteInputClipboardProbe* return_value) {
+  FlutterPasteInputPasteInputHostApiProbeClipboardResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_PROBE_CLIPBOARD_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_probe_clipboard_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(131, G_OBJECT(return_value)));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiProbeClipboardResponse* flutter_paste_input_paste_input_host_api_probe_clipboard_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiProbeClipboardResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_PROBE_CLIPBOARD_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_probe_clipboard_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+struct _FlutterPasteInputPasteInputHostApiConfigureResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiConfigureResponse, flutter_paste_input_paste_input_host_api_configure_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_configure_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiConfigureResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CONFIGURE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_configure_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_configure_response_init(FlutterPasteInputPasteInputHostApiConfigureResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_configure_response_class_init(FlutterPasteInputPasteInputHostApiConfigureResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_configure_response_dispose;
+}
+
+FlutterPasteInputPasteInputHostApiConfigureResponse* flutter_paste_input_paste_input_host_api_configure_response_new() {
+  FlutterPasteInputPasteInputHostApiConfigureResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CONFIGURE_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_configure_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+FlutterPasteInputPasteInputHostApiConfigureResponse* flutter_paste_input_paste_input_host_api_configure_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiConfigureResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CONFIGURE_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_configure_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+struct _FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse, flutter_paste_input_paste_input_host_api_prefetch_clipboard_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_PREFETCH_CLIPBOARD_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_init(FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_class_init(FlutterPasteInputPasteInputHostApiPrefetchClipboardResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_dispose;
+}
+
+FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_new() {
+  FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_PREFETCH_CLIPBOARD_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_PREFETCH_CLIPBOARD_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+struct _FlutterPasteInputPasteInputHostApiCancelPasteResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiCancelPasteResponse, flutter_paste_input_paste_input_host_api_cancel_paste_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_cancel_paste_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiCancelPasteResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CANCEL_PASTE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_cancel_paste_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_cancel_paste_response_init(FlutterPasteInputPasteInputHostApiCancelPasteResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_cancel_paste_response_class_init(FlutterPasteInputPasteInputHostApiCancelPasteResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_cancel_paste_response_dispose;
+}
+
+FlutterPasteInputPasteInputHostApiCancelPasteResponse* flutter_paste_input_paste_input_host_api_cancel_paste_response_new() {
+  FlutterPasteInputPasteInputHostApiCancelPasteResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CANCEL_PASTE_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_cancel_paste_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+FlutterPasteInputPasteInputHostApiCancelPasteResponse* flutter_paste_input_paste_input_host_api_cancel_paste_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiCancelPasteResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_CANCEL_PASTE_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_cancel_paste_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiTrimMemoryResponse, flutter_paste_input_paste_input_host_api_trim_memory_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_TRIM_MEMORY_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiTrimMemoryResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiTrimMemoryResponse, flutter_paste_input_paste_input_host_api_trim_memory_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_trim_memory_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiTrimMemoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_TRIM_MEMORY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_trim_memory_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_trim_memory_response_init(FlutterPasteInputPasteInputHostApiTrimMemoryResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_trim_memory_response_class_init(FlutterPasteInputPasteInputHostApiTrimMemoryResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_trim_memory_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiTrimMemoryResponse* flutter_paste_input_paste_input_host_api_trim_memory_response_new(int64_t return_value) {
+  FlutterPasteInputPasteInputHostApiTrimMemoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_TRIM_MEMORY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_trim_memory_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_int(return_value));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiTrimMemoryResponse* flutter_paste_input_paste_input_host_api_trim_memory_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiTrimMemoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_TRIM_MEMORY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_trim_memory_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiSetClipboardContentResponse, flutter_paste_input_paste_input_host_api_set_clipboard_content_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_SET_CLIPBOARD_CONTENT_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiSetClipboardContentResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiSetClipboardContentResponse, flutter_paste_input_paste_input_host_api_set_clipboard_content_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_set_clipboard_content_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiSetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_SET_CLIPBOARD_CONTENT_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_set_clipboard_content_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_set_clipboard_content_response_init(FlutterPasteInputPasteInputHostApiSetClipboardContentResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_set_clipboard_content_response_class_init(FlutterPasteInputPasteInputHostApiSetClipboardContentResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_set_clipboard_content_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiSetClipboardContentResponse* flutter_paste_input_paste_input_host_api_set_clipboard_content_response_new() {
+  FlutterPasteInputPasteInputHostApiSetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_SET_CLIPBOARD_CONTENT_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_set_clipboard_content_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiSetClipboardContentResponse* flutter_paste_input_paste_input_host_api_set_clipboard_content_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiSetClipboardContentResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_SET_CLIPBOARD_CONTENT_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_set_clipboard_content_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse, flutter_paste_input_paste_input_host_api_list_clipboard_history_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_LIST_CLIPBOARD_HISTORY_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse, flutter_paste_input_paste_input_host_api_list_clipboard_history_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_list_clipboard_history_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_LIST_CLIPBOARD_HISTORY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_list_clipboard_history_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_list_clipboard_history_response_init(FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_list_clipboard_history_response_class_init(FlutterPasteInputPasteInputHostApiListClipboardHistoryResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_list_clipboard_history_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse* flutter_paste_input_paste_input_host_api_list_clipboard_history_response_new(FlValue* return_value) {
+  FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_LIST_CLIPBOARD_HISTORY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_list_clipboard_history_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse* flutter_paste_input_paste_input_host_api_list_clipboard_history_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_LIST_CLIPBOARD_HISTORY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_list_clipboard_history_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse, flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_GET_CLIPBOARD_HISTORY_ENTRY_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse, flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_HISTORY_ENTRY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_init(FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_class_init(FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse* flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_new(FlutterPasteInputClipboardContent* return_value) {
+  FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_HISTORY_ENTRY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(130, G_OBJECT(return_value)));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse* flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_CLIPBOARD_HISTORY_ENTRY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse, flutter_paste_input_paste_input_host_api_search_clipboard_history_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_SEARCH_CLIPBOARD_HISTORY_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse, flutter_paste_input_paste_input_host_api_search_clipboard_history_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_search_clipboard_history_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_SEARCH_CLIPBOARD_HISTORY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_search_clipboard_history_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_search_clipboard_history_response_init(FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_search_clipboard_history_response_class_init(FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_search_clipboard_history_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse* flutter_paste_input_paste_input_host_api_search_clipboard_history_response_new(FlValue* return_value) {
+  FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_SEARCH_CLIPBOARD_HISTORY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_search_clipboard_history_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse* flutter_paste_input_paste_input_host_api_search_clipboard_history_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_SEARCH_CLIPBOARD_HISTORY_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_search_clipboard_history_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiGetPasteStatsResponse, flutter_paste_input_paste_input_host_api_get_paste_stats_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_GET_PASTE_STATS_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiGetPasteStatsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiGetPasteStatsResponse, flutter_paste_input_paste_input_host_api_get_paste_stats_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_get_paste_stats_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiGetPasteStatsResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PASTE_STATS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_get_paste_stats_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_paste_stats_response_init(FlutterPasteInputPasteInputHostApiGetPasteStatsResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_get_paste_stats_response_class_init(FlutterPasteInputPasteInputHostApiGetPasteStatsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_get_paste_stats_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiGetPasteStatsResponse* flutter_paste_input_paste_input_host_api_get_paste_stats_response_new(FlValue* return_value) {
+  FlutterPasteInputPasteInputHostApiGetPasteStatsResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PASTE_STATS_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_paste_stats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiGetPasteStatsResponse* flutter_paste_input_paste_input_host_api_get_paste_stats_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiGetPasteStatsResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PASTE_STATS_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_paste_stats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiResetPasteStatsResponse, flutter_paste_input_paste_input_host_api_reset_paste_stats_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_RESET_PASTE_STATS_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiResetPasteStatsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiResetPasteStatsResponse, flutter_paste_input_paste_input_host_api_reset_paste_stats_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_reset_paste_stats_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiResetPasteStatsResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESET_PASTE_STATS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_reset_paste_stats_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_reset_paste_stats_response_init(FlutterPasteInputPasteInputHostApiResetPasteStatsResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_reset_paste_stats_response_class_init(FlutterPasteInputPasteInputHostApiResetPasteStatsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_reset_paste_stats_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiResetPasteStatsResponse* flutter_paste_input_paste_input_host_api_reset_paste_stats_response_new() {
+  FlutterPasteInputPasteInputHostApiResetPasteStatsResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESET_PASTE_STATS_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_reset_paste_stats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiResetPasteStatsResponse* flutter_paste_input_paste_input_host_api_reset_paste_stats_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiResetPasteStatsResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESET_PASTE_STATS_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_reset_paste_stats_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse, flutter_paste_input_paste_input_host_api_get_paste_latencies_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_GET_PASTE_LATENCIES_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse, flutter_paste_input_paste_input_host_api_get_paste_latencies_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_get_paste_latencies_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PASTE_LATENCIES_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_get_paste_latencies_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_paste_latencies_response_init(FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_get_paste_latencies_response_class_init(FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_get_paste_latencies_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse* flutter_paste_input_paste_input_host_api_get_paste_latencies_response_new(FlValue* return_value) {
+  FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PASTE_LATENCIES_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_paste_latencies_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse* flutter_paste_input_paste_input_host_api_get_paste_latencies_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PASTE_LATENCIES_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_paste_latencies_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse, flutter_paste_input_paste_input_host_api_dump_paste_trace_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_DUMP_PASTE_TRACE_RESPONSE, GObject)
+
+struct _FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse, flutter_paste_input_paste_input_host_api_dump_paste_trace_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_dump_paste_trace_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_DUMP_PASTE_TRACE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_dump_paste_trace_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_dump_paste_trace_response_init(FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_dump_paste_trace_response_class_init(FlutterPasteInputPasteInputHostApiDumpPasteTraceResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_dump_paste_trace_response_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse* flutter_paste_input_paste_input_host_api_dump_paste_trace_response_new(int64_t return_value) {
+  FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_DUMP_PASTE_TRACE_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_dump_paste_trace_response_get_type(), nullptr));
   self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(return_value));
+  fl_value_append_take(self->value, fl_value_new_int(return_value));
   return self;
 }
 
-FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* flutter_paste_input_paste_input_host_api_get_platform_version_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_GET_PLATFORM_VERSION_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_get_platform_version_response_get_type(), nullptr));
+static FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse* flutter_paste_input_paste_input_host_api_dump_paste_trace_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_DUMP_PASTE_TRACE_RESPONSE(g_object_new(flutter_paste_input_paste_input_host_api_dump_paste_trace_response_get_type(), nullptr));
   self->value = fl_value_new_list();
   fl_value_append_take(self->value, fl_value_new_string(code));
   fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
@@ -338,6 +2088,36 @@ static FlutterPasteInputPasteInputHostApi* flutter_paste_input_paste_input_host_
   return self;
 }
 
+struct _FlutterPasteInputPasteInputHostApiResponseHandle {
+  GObject parent_instance;
+
+  FlBasicMessageChannel* channel;
+  FlBasicMessageChannelResponseHandle* response_handle;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputHostApiResponseHandle, flutter_paste_input_paste_input_host_api_response_handle, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_host_api_response_handle_dispose(GObject* object) {
+  FlutterPasteInputPasteInputHostApiResponseHandle* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(object);
+  g_clear_object(&self->channel);
+  g_clear_object(&self->response_handle);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_host_api_response_handle_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_host_api_response_handle_init(FlutterPasteInputPasteInputHostApiResponseHandle* self) {
+}
+
+static void flutter_paste_input_paste_input_host_api_response_handle_class_init(FlutterPasteInputPasteInputHostApiResponseHandleClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_host_api_response_handle_dispose;
+}
+
+static FlutterPasteInputPasteInputHostApiResponseHandle* flutter_paste_input_paste_input_host_api_response_handle_new(FlBasicMessageChannel* channel, FlBasicMessageChannelResponseHandle* response_handle) {
+  FlutterPasteInputPasteInputHostApiResponseHandle* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API_RESPONSE_HANDLE(g_object_new(flutter_paste_input_paste_input_host_api_response_handle_get_type(), nullptr));
+  self->channel = FL_BASIC_MESSAGE_CHANNEL(g_object_ref(channel));
+  self->response_handle = FL_BASIC_MESSAGE_CHANNEL_RESPONSE_HANDLE(g_object_ref(response_handle));
+  return self;
+}
+
 static void flutter_paste_input_paste_input_host_api_get_clipboard_content_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
   FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
 
@@ -345,16 +2125,10 @@ static void flutter_paste_input_paste_input_host_api_get_clipboard_content_cb(Fl
     return;
   }
 
-  g_autoptr(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse) response = self->vtable->get_clipboard_content(self->user_data);
-  if (response == nullptr) {
-    g_warning("No response returned to %s.%s", "PasteInputHostApi", "getClipboardContent");
-    return;
-  }
-
-  g_autoptr(GError) error = NULL;
-  if (!fl_basic_message_channel_respond(channel, response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getClipboardContent", error->message);
-  }
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t request_id = fl_value_get_int(value0);
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->get_clipboard_content(request_id, handle, self->user_data);
 }
 
 static void flutter_paste_input_paste_input_host_api_clear_temp_files_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
@@ -395,6 +2169,189 @@ static void flutter_paste_input_paste_input_host_api_get_platform_version_cb(FlB
   }
 }
 
+static void flutter_paste_input_paste_input_host_api_probe_clipboard_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->probe_clipboard == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->probe_clipboard(handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_configure_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->configure == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  FlutterPasteInputPasteInputConfig* config = FLUTTER_PASTE_INPUT_PASTE_INPUT_CONFIG(fl_value_get_custom_value_object(value0));
+  g_autoptr(FlutterPasteInputPasteInputHostApiConfigureResponse) response = self->vtable->configure(config, self->user_data);
+  if (response == nullptr) {
+    g_warning("No response returned to %s.%s", "PasteInputHostApi", "configure");
+    return;
+  }
+
+  g_autoptr(GError) error = NULL;
+  if (!fl_basic_message_channel_respond(channel, response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "configure", error->message);
+  }
+}
+
+static void flutter_paste_input_paste_input_host_api_prefetch_clipboard_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->prefetch_clipboard == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse) response = self->vtable->prefetch_clipboard(self->user_data);
+  if (response == nullptr) {
+    g_warning("No response returned to %s.%s", "PasteInputHostApi", "prefetchClipboard");
+    return;
+  }
+
+  g_autoptr(GError) error = NULL;
+  if (!fl_basic_message_channel_respond(channel, response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "prefetchClipboard", error->message);
+  }
+}
+
+static void flutter_paste_input_paste_input_host_api_cancel_paste_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->cancel_paste == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t request_id = fl_value_get_int(value0);
+  g_autoptr(FlutterPasteInputPasteInputHostApiCancelPasteResponse) response = self->vtable->cancel_paste(request_id, self->user_data);
+  if (response == nullptr) {
+    g_warning("No response returned to %s.%s", "PasteInputHostApi", "cancelPaste");
+    return;
+  }
+
+  g_autoptr(GError) error = NULL;
+  if (!fl_basic_message_channel_respond(channel, response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "cancelPaste", error->message);
+  }
+}
+
+static void flutter_paste_input_paste_input_host_api_trim_memory_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->trim_memory == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t level = fl_value_get_int(value0);
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->trim_memory(level, handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_set_clipboard_content_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_clipboard_content == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  FlutterPasteInputClipboardWrite* content = FLUTTER_PASTE_INPUT_CLIPBOARD_WRITE(fl_value_get_custom_value_object(value0));
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->set_clipboard_content(content, handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_list_clipboard_history_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->list_clipboard_history == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->list_clipboard_history(handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->get_clipboard_history_entry == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t id = fl_value_get_int(value0);
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->get_clipboard_history_entry(id, handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_search_clipboard_history_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->search_clipboard_history == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* query = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t max_results = fl_value_get_int(value1);
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->search_clipboard_history(query, max_results, handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_paste_stats_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->get_paste_stats == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->get_paste_stats(handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_reset_paste_stats_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->reset_paste_stats == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->reset_paste_stats(handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_get_paste_latencies_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->get_paste_latencies == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->get_paste_latencies(handle, self->user_data);
+}
+
+static void flutter_paste_input_paste_input_host_api_dump_paste_trace_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterPasteInputPasteInputHostApi* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->dump_paste_trace == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* path = fl_value_get_string(value0);
+  g_autoptr(FlutterPasteInputPasteInputHostApiResponseHandle) handle = flutter_paste_input_paste_input_host_api_response_handle_new(channel, response_handle);
+  self->vtable->dump_paste_trace(path, handle, self->user_data);
+}
+
 void flutter_paste_input_paste_input_host_api_set_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix, const FlutterPasteInputPasteInputHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
   g_autofree gchar* dot_suffix = suffix != nullptr ? g_strdup_printf(".%s", suffix) : g_strdup("");
   g_autoptr(FlutterPasteInputPasteInputHostApi) api_data = flutter_paste_input_paste_input_host_api_new(vtable, user_data, user_data_free_func);
@@ -409,6 +2366,45 @@ void flutter_paste_input_paste_input_host_api_set_method_handlers(FlBinaryMessen
   g_autofree gchar* get_platform_version_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPlatformVersion%s", dot_suffix);
   g_autoptr(FlBasicMessageChannel) get_platform_version_channel = fl_basic_message_channel_new(messenger, get_platform_version_channel_name, FL_MESSAGE_CODEC(codec));
   fl_basic_message_channel_set_message_handler(get_platform_version_channel, flutter_paste_input_paste_input_host_api_get_platform_version_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* probe_clipboard_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.probeClipboard%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) probe_clipboard_channel = fl_basic_message_channel_new(messenger, probe_clipboard_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(probe_clipboard_channel, flutter_paste_input_paste_input_host_api_probe_clipboard_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* configure_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.configure%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) configure_channel = fl_basic_message_channel_new(messenger, configure_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(configure_channel, flutter_paste_input_paste_input_host_api_configure_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* prefetch_clipboard_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.prefetchClipboard%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) prefetch_clipboard_channel = fl_basic_message_channel_new(messenger, prefetch_clipboard_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(prefetch_clipboard_channel, flutter_paste_input_paste_input_host_api_prefetch_clipboard_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* cancel_paste_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.cancelPaste%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) cancel_paste_channel = fl_basic_message_channel_new(messenger, cancel_paste_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(cancel_paste_channel, flutter_paste_input_paste_input_host_api_cancel_paste_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* trim_memory_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.trimMemory%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) trim_memory_channel = fl_basic_message_channel_new(messenger, trim_memory_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(trim_memory_channel, flutter_paste_input_paste_input_host_api_trim_memory_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_clipboard_content_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.setClipboardContent%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_clipboard_content_channel = fl_basic_message_channel_new(messenger, set_clipboard_content_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_clipboard_content_channel, flutter_paste_input_paste_input_host_api_set_clipboard_content_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* list_clipboard_history_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.listClipboardHistory%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) list_clipboard_history_channel = fl_basic_message_channel_new(messenger, list_clipboard_history_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(list_clipboard_history_channel, flutter_paste_input_paste_input_host_api_list_clipboard_history_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* get_clipboard_history_entry_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardHistoryEntry%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_clipboard_history_entry_channel = fl_basic_message_channel_new(messenger, get_clipboard_history_entry_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_clipboard_history_entry_channel, flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* search_clipboard_history_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.searchClipboardHistory%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) search_clipboard_history_channel = fl_basic_message_channel_new(messenger, search_clipboard_history_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(search_clipboard_history_channel, flutter_paste_input_paste_input_host_api_search_clipboard_history_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* get_paste_stats_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteStats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_paste_stats_channel = fl_basic_message_channel_new(messenger, get_paste_stats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_paste_stats_channel, flutter_paste_input_paste_input_host_api_get_paste_stats_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* reset_paste_stats_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.resetPasteStats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) reset_paste_stats_channel = fl_basic_message_channel_new(messenger, reset_paste_stats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(reset_paste_stats_channel, flutter_paste_input_paste_input_host_api_reset_paste_stats_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* get_paste_latencies_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteLatencies%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_paste_latencies_channel = fl_basic_message_channel_new(messenger, get_paste_latencies_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_paste_latencies_channel, flutter_paste_input_paste_input_host_api_get_paste_latencies_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* dump_paste_trace_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.dumpPasteTrace%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) dump_paste_trace_channel = fl_basic_message_channel_new(messenger, dump_paste_trace_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(dump_paste_trace_channel, flutter_paste_input_paste_input_host_api_dump_paste_trace_cb, g_object_ref(api_data), g_object_unref);
 }
 
 void flutter_paste_input_paste_input_host_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix) {
@@ -424,6 +2420,221 @@ void flutter_paste_input_paste_input_host_api_clear_method_handlers(FlBinaryMess
   g_autofree gchar* get_platform_version_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPlatformVersion%s", dot_suffix);
   g_autoptr(FlBasicMessageChannel) get_platform_version_channel = fl_basic_message_channel_new(messenger, get_platform_version_channel_name, FL_MESSAGE_CODEC(codec));
   fl_basic_message_channel_set_message_handler(get_platform_version_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* probe_clipboard_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.probeClipboard%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) probe_clipboard_channel = fl_basic_message_channel_new(messenger, probe_clipboard_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(probe_clipboard_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* configure_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.configure%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) configure_channel = fl_basic_message_channel_new(messenger, configure_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(configure_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* prefetch_clipboard_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.prefetchClipboard%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) prefetch_clipboard_channel = fl_basic_message_channel_new(messenger, prefetch_clipboard_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(prefetch_clipboard_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* cancel_paste_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.cancelPaste%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) cancel_paste_channel = fl_basic_message_channel_new(messenger, cancel_paste_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(cancel_paste_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* trim_memory_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.trimMemory%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) trim_memory_channel = fl_basic_message_channel_new(messenger, trim_memory_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(trim_memory_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_clipboard_content_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.setClipboardContent%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_clipboard_content_channel = fl_basic_message_channel_new(messenger, set_clipboard_content_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_clipboard_content_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* list_clipboard_history_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.listClipboardHistory%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) list_clipboard_history_channel = fl_basic_message_channel_new(messenger, list_clipboard_history_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(list_clipboard_history_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* get_clipboard_history_entry_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardHistoryEntry%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_clipboard_history_entry_channel = fl_basic_message_channel_new(messenger, get_clipboard_history_entry_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_clipboard_history_entry_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* search_clipboard_history_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.searchClipboardHistory%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) search_clipboard_history_channel = fl_basic_message_channel_new(messenger, search_clipboard_history_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(search_clipboard_history_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* get_paste_stats_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteStats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_paste_stats_channel = fl_basic_message_channel_new(messenger, get_paste_stats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_paste_stats_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* reset_paste_stats_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.resetPasteStats%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) reset_paste_stats_channel = fl_basic_message_channel_new(messenger, reset_paste_stats_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(reset_paste_stats_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* get_paste_latencies_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteLatencies%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) get_paste_latencies_channel = fl_basic_message_channel_new(messenger, get_paste_latencies_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(get_paste_latencies_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* dump_paste_trace_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.dumpPasteTrace%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) dump_paste_trace_channel = fl_basic_message_channel_new(messenger, dump_paste_trace_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(dump_paste_trace_channel, nullptr, nullptr, nullptr);
+}
+
+void flutter_paste_input_paste_input_host_api_respond_get_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlutterPasteInputClipboardContent* return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse) response = flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getClipboardContent", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse) response = flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getClipboardContent", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_probe_clipboard(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlutterPasteInputClipboardProbe* return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiProbeClipboardResponse) response = flutter_paste_input_paste_input_host_api_probe_clipboard_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "probeClipboard", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_probe_clipboard(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiProbeClipboardResponse) response = flutter_paste_input_paste_input_host_api_probe_clipboard_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "probeClipboard", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_trim_memory(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, int64_t return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiTrimMemoryResponse) response = flutter_paste_input_paste_input_host_api_trim_memory_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "trimMemory", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_trim_memory(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiTrimMemoryResponse) response = flutter_paste_input_paste_input_host_api_trim_memory_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "trimMemory", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_set_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiSetClipboardContentResponse) response = flutter_paste_input_paste_input_host_api_set_clipboard_content_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "setClipboardContent", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_set_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiSetClipboardContentResponse) response = flutter_paste_input_paste_input_host_api_set_clipboard_content_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "setClipboardContent", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_list_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse) response = flutter_paste_input_paste_input_host_api_list_clipboard_history_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "listClipboardHistory", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_list_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiListClipboardHistoryResponse) response = flutter_paste_input_paste_input_host_api_list_clipboard_history_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "listClipboardHistory", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_get_clipboard_history_entry(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlutterPasteInputClipboardContent* return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse) response = flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getClipboardHistoryEntry", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_history_entry(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetClipboardHistoryEntryResponse) response = flutter_paste_input_paste_input_host_api_get_clipboard_history_entry_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getClipboardHistoryEntry", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_search_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse) response = flutter_paste_input_paste_input_host_api_search_clipboard_history_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "searchClipboardHistory", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_search_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiSearchClipboardHistoryResponse) response = flutter_paste_input_paste_input_host_api_search_clipboard_history_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "searchClipboardHistory", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_get_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetPasteStatsResponse) response = flutter_paste_input_paste_input_host_api_get_paste_stats_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getPasteStats", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_get_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetPasteStatsResponse) response = flutter_paste_input_paste_input_host_api_get_paste_stats_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getPasteStats", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_reset_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiResetPasteStatsResponse) response = flutter_paste_input_paste_input_host_api_reset_paste_stats_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "resetPasteStats", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_reset_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiResetPasteStatsResponse) response = flutter_paste_input_paste_input_host_api_reset_paste_stats_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "resetPasteStats", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_get_paste_latencies(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse) response = flutter_paste_input_paste_input_host_api_get_paste_latencies_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getPasteLatencies", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_get_paste_latencies(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiGetPasteLatenciesResponse) response = flutter_paste_input_paste_input_host_api_get_paste_latencies_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "getPasteLatencies", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_dump_paste_trace(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, int64_t return_value) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse) response = flutter_paste_input_paste_input_host_api_dump_paste_trace_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "dumpPasteTrace", error->message);
+  }
+}
+
+void flutter_paste_input_paste_input_host_api_respond_error_dump_paste_trace(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterPasteInputPasteInputHostApiDumpPasteTraceResponse) response = flutter_paste_input_paste_input_host_api_dump_paste_trace_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "PasteInputHostApi", "dumpPasteTrace", error->message);
+  }
 }
 
 struct _FlutterPasteInputPasteInputFlutterApi {
@@ -534,3 +2745,81 @@ FlutterPasteInputPasteInputFlutterApiOnPasteDetectedResponse* flutter_paste_inpu
   }
   return flutter_paste_input_paste_input_flutter_api_on_paste_detected_response_new(response);
 }
+struct _FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse {
+  GObject parent_instance;
+
+  FlValue* error;
+};
+
+G_DEFINE_TYPE(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse, flutter_paste_input_paste_input_flutter_api_on_paste_progress_response, G_TYPE_OBJECT)
+
+static void flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_dispose(GObject* object) {
+  FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_FLUTTER_API_ON_PASTE_PROGRESS_RESPONSE(object);
+  g_clear_pointer(&self->error, fl_value_unref);
+  G_OBJECT_CLASS(flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_parent_class)->dispose(object);
+}
+
+static void flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_init(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* self) {
+}
+
+static void flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_class_init(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_dispose;
+}
+
+static FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_new(FlValue* response) {
+  FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* self = FLUTTER_PASTE_INPUT_PASTE_INPUT_FLUTTER_API_ON_PASTE_PROGRESS_RESPONSE(g_object_new(flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_type(), nullptr));
+  if (fl_value_get_length(response) > 1) {
+    self->error = fl_value_ref(response);
+  }
+  return self;
+}
+
+gboolean flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_is_error(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_FLUTTER_API_ON_PASTE_PROGRESS_RESPONSE(self), FALSE);
+  return self->error != nullptr;
+}
+
+const gchar* flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_code(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_FLUTTER_API_ON_PASTE_PROGRESS_RESPONSE(self), nullptr);
+  g_assert(flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 0));
+}
+
+const gchar* flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_message(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_FLUTTER_API_ON_PASTE_PROGRESS_RESPONSE(self), nullptr);
+  g_assert(flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 1));
+}
+
+FlValue* flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_details(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* self) {
+  g_return_val_if_fail(FLUTTER_PASTE_INPUT_IS_PASTE_INPUT_FLUTTER_API_ON_PASTE_PROGRESS_RESPONSE(self), nullptr);
+  g_assert(flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_is_error(self));
+  return fl_value_get_list_value(self->error, 2);
+}
+
+static void flutter_paste_input_paste_input_flutter_api_on_paste_progress_cb(GObject* object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(user_data);
+  g_task_return_pointer(task, result, g_object_unref);
+}
+
+void flutter_paste_input_paste_input_flutter_api_on_paste_progress(FlutterPasteInputPasteInputFlutterApi* self, FlutterPasteInputPasteProgress* progress, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
+  g_autoptr(FlValue) args = fl_value_new_list();
+  fl_value_append_take(args, fl_value_new_custom_object(133, G_OBJECT(progress)));
+  g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_paste_input.PasteInputFlutterApi.onPasteProgress%s", self->suffix);
+  g_autoptr(FlutterPasteInputMessageCodec) codec = flutter_paste_input_message_codec_new();
+  FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
+  GTask* task = g_task_new(self, cancellable, callback, user_data);
+  g_task_set_task_data(task, channel, g_object_unref);
+  fl_basic_message_channel_send(channel, args, cancellable, flutter_paste_input_paste_input_flutter_api_on_paste_progress_cb, task);
+}
+
+FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* flutter_paste_input_paste_input_flutter_api_on_paste_progress_finish(FlutterPasteInputPasteInputFlutterApi* self, GAsyncResult* result, GError** error) {
+  g_autoptr(GTask) task = G_TASK(result);
+  GAsyncResult* r = G_ASYNC_RESULT(g_task_propagate_pointer(task, nullptr));
+  FlBasicMessageChannel* channel = FL_BASIC_MESSAGE_CHANNEL(g_task_get_task_data(task));
+  g_autoptr(FlValue) response = fl_basic_message_channel_send_finish(channel, r, error);
+  if (response == nullptr) { 
+    return nullptr;
+  }
+  return flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_new(response);
+}
@@ -24,12 +24,17 @@ G_DECLARE_FINAL_TYPE(FlutterPasteInputClipboardItem, flutter_paste_input_clipboa
  * data: field in this object.
  * data_length: length of @data.
  * mime_type: field in this object.
+ * width: field in this object.
+ * height: field in this object.
+ * has_alpha: field in this object.
+ * frame_count: field in this object.
+ * original_byte_size: field in this object.
  *
  * Creates a new #ClipboardItem object.
  *
  * Returns: a new #FlutterPasteInputClipboardItem
  */
-FlutterPasteInputClipboardItem* flutter_paste_input_clipboard_item_new(const uint8_t* data, size_t data_length, const gchar* mime_type);
+FlutterPasteInputClipboardItem* flutter_paste_input_clipboard_item_new(const uint8_t* data, size_t data_length, const gchar* mime_type, int64_t* width, int64_t* height, gboolean* has_alpha, int64_t* frame_count, int64_t* original_byte_size);
 
 /**
  * flutter_paste_input_clipboard_item_get_data
@@ -62,65 +67,806 @@ const uint8_t* flutter_paste_input_clipboard_item_get_data(FlutterPasteInputClip
  */
 const gchar* flutter_paste_input_clipboard_item_get_mime_type(FlutterPasteInputClipboardItem* object);
 
+/**
+ * flutter_paste_input_clipboard_item_get_width
+ * @object: a #FlutterPasteInputClipboardItem.
+ *
+ * Width of the image in pixels.
+ *
+ * Only set for image items, and only when the platform knows the
+ * dimensions without decoding the bytes on the Dart side.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_clipboard_item_get_width(FlutterPasteInputClipboardItem* object);
+
+/**
+ * flutter_paste_input_clipboard_item_get_height
+ * @object: a #FlutterPasteInputClipboardItem.
+ *
+ * Height of the image in pixels.
+ *
+ * Only set for image items, see [width].
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_clipboard_item_get_height(FlutterPasteInputClipboardItem* object);
+
+/**
+ * flutter_paste_input_clipboard_item_get_has_alpha
+ * @object: a #FlutterPasteInputClipboardItem.
+ *
+ * Whether the image has an alpha channel.
+ *
+ * Only set for image items.
+ *
+ * Returns: the field value.
+ */
+gboolean* flutter_paste_input_clipboard_item_get_has_alpha(FlutterPasteInputClipboardItem* object);
+
+/**
+ * flutter_paste_input_clipboard_item_get_frame_count
+ * @object: a #FlutterPasteInputClipboardItem.
+ *
+ * Number of frames in the image (greater than 1 for animations).
+ *
+ * Only set for image items.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_clipboard_item_get_frame_count(FlutterPasteInputClipboardItem* object);
+
+/**
+ * flutter_paste_input_clipboard_item_get_original_byte_size
+ * @object: a #FlutterPasteInputClipboardItem.
+ *
+ * Size in bytes of the clipboard representation the item was read from.
+ *
+ * For images that are re-encoded natively (e.g. a bitmap converted to
+ * PNG), this is the size of the source data rather than [data].
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_clipboard_item_get_original_byte_size(FlutterPasteInputClipboardItem* object);
+
 /**
  * FlutterPasteInputClipboardContent:
  *
- * Represents the complete clipboard content.
+ * Represents the complete clipboard content.
+ *
+ * The clipboard may contain multiple items of different types.
+ * For example, copying an image might also include a text representation.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputClipboardContent, flutter_paste_input_clipboard_content, FLUTTER_PASTE_INPUT, CLIPBOARD_CONTENT, GObject)
+
+/**
+ * flutter_paste_input_clipboard_content_new:
+ * items: field in this object.
+ * peak_memory_bytes: field in this object.
+ *
+ * Creates a new #ClipboardContent object.
+ *
+ * Returns: a new #FlutterPasteInputClipboardContent
+ */
+FlutterPasteInputClipboardContent* flutter_paste_input_clipboard_content_new(FlValue* items, int64_t* peak_memory_bytes);
+
+/**
+ * flutter_paste_input_clipboard_content_get_items
+ * @object: a #FlutterPasteInputClipboardContent.
+ *
+ * List of clipboard items.
+ *
+ * May be empty if the clipboard is empty or contains unsupported content.
+ *
+ * Returns: the field value.
+ */
+FlValue* flutter_paste_input_clipboard_content_get_items(FlutterPasteInputClipboardContent* object);
+
+/**
+ * flutter_paste_input_clipboard_content_get_peak_memory_bytes
+ * @object: a #FlutterPasteInputClipboardContent.
+ *
+ * Most bytes the platform held at once while reading, converting and
+ * sending this content (Linux).
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_clipboard_content_get_peak_memory_bytes(FlutterPasteInputClipboardContent* object);
+
+/**
+ * FlutterPasteInputClipboardProbe:
+ *
+ * Cheap summary of the clipboard state, obtained without reading any data.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputClipboardProbe, flutter_paste_input_clipboard_probe, FLUTTER_PASTE_INPUT, CLIPBOARD_PROBE, GObject)
+
+/**
+ * flutter_paste_input_clipboard_probe_new:
+ * change_count: field in this object.
+ * mime_types: field in this object.
+ *
+ * Creates a new #ClipboardProbe object.
+ *
+ * Returns: a new #FlutterPasteInputClipboardProbe
+ */
+FlutterPasteInputClipboardProbe* flutter_paste_input_clipboard_probe_new(int64_t change_count, FlValue* mime_types);
+
+/**
+ * flutter_paste_input_clipboard_probe_get_change_count
+ * @object: a #FlutterPasteInputClipboardProbe.
+ *
+ * Counter that increases every time the clipboard contents change.
+ *
+ * Only meaningful when compared with an earlier value from the same
+ * process; the absolute value is platform specific.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_clipboard_probe_get_change_count(FlutterPasteInputClipboardProbe* object);
+
+/**
+ * flutter_paste_input_clipboard_probe_get_mime_types
+ * @object: a #FlutterPasteInputClipboardProbe.
+ *
+ * MIME types currently offered by the clipboard owner.
+ *
+ * Text formats are reported as "text/plain" regardless of the
+ * platform's native name for them.
+ *
+ * Returns: the field value.
+ */
+FlValue* flutter_paste_input_clipboard_probe_get_mime_types(FlutterPasteInputClipboardProbe* object);
+
+/**
+ * FlutterPasteInputPasteInputConfig:
+ *
+ * Tuning options for the native paste pipeline.
+ *
+ * Every field is optional; null leaves the current setting unchanged.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputConfig, flutter_paste_input_paste_input_config, FLUTTER_PASTE_INPUT, PASTE_INPUT_CONFIG, GObject)
+
+/**
+ * flutter_paste_input_paste_input_config_new:
+ * coalesce_window_ms: field in this object.
+ * max_pending_reads: field in this object.
+ * max_outstanding_events: field in this object.
+ * memory_budget_bytes: field in this object.
+ * downscale_over_budget_images: field in this object.
+ * max_transfer_bytes: field in this object.
+ * clipboard_store_max_bytes: field in this object.
+ * clipboard_store_time_budget_ms: field in this object.
+ * history_max_entries: field in this object.
+ * history_max_bytes: field in this object.
+ * persist_history: field in this object.
+ * history_max_disk_bytes: field in this object.
+ * trace_file: field in this object.
+ *
+ * Creates a new #PasteInputConfig object.
+ *
+ * Returns: a new #FlutterPasteInputPasteInputConfig
+ */
+FlutterPasteInputPasteInputConfig* flutter_paste_input_paste_input_config_new(int64_t* coalesce_window_ms, int64_t* max_pending_reads, int64_t* max_outstanding_events, int64_t* memory_budget_bytes, gboolean* downscale_over_budget_images, int64_t* max_transfer_bytes, int64_t* clipboard_store_max_bytes, int64_t* clipboard_store_time_budget_ms, int64_t* history_max_entries, int64_t* history_max_bytes, gboolean* persist_history, int64_t* history_max_disk_bytes, const gchar* trace_file);
+
+/**
+ * flutter_paste_input_paste_input_config_get_coalesce_window_ms
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * How long, in milliseconds, a completed clipboard read is reused for
+ * further paste requests while the clipboard is unchanged.
+ *
+ * Requests arriving while a read is in flight always share it. This
+ * covers key repeat from a held-down Ctrl+V.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_coalesce_window_ms(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_max_pending_reads
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Maximum number of paste requests that may wait on an in-flight read.
+ *
+ * Further requests fail with the error code "busy".
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_max_pending_reads(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_max_outstanding_events
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Maximum number of [PasteInputFlutterApi.onPasteDetected] events sent
+ * before Dart has handled them (Linux).
+ *
+ * Events beyond the limit are held back and only the newest is kept, so
+ * a burst of pastes never queues several stale payloads.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_max_outstanding_events(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_memory_budget_bytes
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Upper bound, in bytes, on the native memory held by pastes in flight
+ * and by their results, shared by all engines in the process (Linux).
+ *
+ * An image paste that does not fit waits for earlier pastes to release
+ * their buffers. One that could never fit is downscaled (see
+ * [downscaleOverBudgetImages]) or fails with the error code
+ * "over-budget". 0 disables the limit; the default is 512 MiB.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_memory_budget_bytes(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_downscale_over_budget_images
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Whether images too large for [memoryBudgetBytes] are downscaled rather
+ * than refused. Defaults to true.
+ *
+ * Returns: the field value.
+ */
+gboolean* flutter_paste_input_paste_input_config_get_downscale_over_budget_images(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_max_transfer_bytes
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Largest clipboard selection, in bytes, that is transferred before the
+ * paste fails with the error code "too-large" (Linux, X11). 0 disables
+ * the limit; the default is 256 MiB.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_max_transfer_bytes(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_clipboard_store_max_bytes
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Most bytes of content set with [PasteInputHostApi.setClipboardContent]
+ * handed to the clipboard manager when the app exits, so that it stays
+ * pasteable (Linux).
+ *
+ * Text is offered first, then the image as given, then rendered formats
+ * in order; each format that would exceed the limit is left out, so a
+ * compact rendered format is kept even when the original image is too
+ * large. 0 disables the limit; the default is 64 MiB.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_clipboard_store_max_bytes(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_clipboard_store_time_budget_ms
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Time, in milliseconds, the app may spend at exit rendering formats not
+ * requested yet for the clipboard manager (Linux). Formats not rendered
+ * in time are left out; an encode still running at the deadline stops at
+ * its next output chunk. Decoding the source image, done once, is not
+ * interrupted. 0 disables the limit; the default is 1000.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_clipboard_store_time_budget_ms(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_history_max_entries
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Most clipboard snapshots kept in the history (Linux).
+ *
+ * Every successful read is recorded; content already in the history
+ * moves to the front instead of being added again. 0 disables the
+ * history and drops what it holds; the default is 50.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_history_max_entries(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_history_max_bytes
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Upper bound, in bytes, on the memory held by the history (Linux).
+ *
+ * Text is kept compressed and counts with its compressed size. The
+ * oldest entries are dropped first. 0 disables the limit; the default
+ * is 32 MiB.
+ *
+ * With [persistHistory] set, entries over the limit are only dropped
+ * from memory and read back from disk when fetched.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_history_max_bytes(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_persist_history
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Whether the history is kept on disk, under the user cache directory,
+ * so that it survives restarts (Linux).
+ *
+ * Off by default, as clipboard content may be sensitive. Turning it off
+ * deletes the files.
+ *
+ * Returns: the field value.
+ */
+gboolean* flutter_paste_input_paste_input_config_get_persist_history(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_history_max_disk_bytes
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * Upper bound, in bytes, on the disk space used by a persisted history
+ * (Linux). The oldest entries are dropped first. 0 disables the limit;
+ * the default is 128 MiB.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_input_config_get_history_max_disk_bytes(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * flutter_paste_input_paste_input_config_get_trace_file
+ * @object: a #FlutterPasteInputPasteInputConfig.
+ *
+ * File the paste pipeline trace is written to when the app exits
+ * (Linux).
+ *
+ * Setting it starts recording the begin and end of every pipeline stage
+ * and worker thread job; an empty string stops recording. The file is
+ * Chrome trace JSON, for Perfetto or chrome://tracing. See also
+ * [PasteInputHostApi.dumpPasteTrace].
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_paste_input_paste_input_config_get_trace_file(FlutterPasteInputPasteInputConfig* object);
+
+/**
+ * FlutterPasteInputPasteProgress:
+ *
+ * Progress of a large clipboard transfer for a pending
+ * [PasteInputHostApi.getClipboardContent] request (Linux, X11).
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteProgress, flutter_paste_input_paste_progress, FLUTTER_PASTE_INPUT, PASTE_PROGRESS, GObject)
+
+/**
+ * flutter_paste_input_paste_progress_new:
+ * request_id: field in this object.
+ * received_bytes: field in this object.
+ * expected_bytes: field in this object.
+ *
+ * Creates a new #PasteProgress object.
+ *
+ * Returns: a new #FlutterPasteInputPasteProgress
+ */
+FlutterPasteInputPasteProgress* flutter_paste_input_paste_progress_new(int64_t request_id, int64_t received_bytes, int64_t* expected_bytes);
+
+/**
+ * flutter_paste_input_paste_progress_get_request_id
+ * @object: a #FlutterPasteInputPasteProgress.
+ *
+ * The id the request was made with.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_progress_get_request_id(FlutterPasteInputPasteProgress* object);
+
+/**
+ * flutter_paste_input_paste_progress_get_received_bytes
+ * @object: a #FlutterPasteInputPasteProgress.
+ *
+ * Bytes received from the clipboard owner so far.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_progress_get_received_bytes(FlutterPasteInputPasteProgress* object);
+
+/**
+ * flutter_paste_input_paste_progress_get_expected_bytes
+ * @object: a #FlutterPasteInputPasteProgress.
+ *
+ * Size announced by the owner, if any. For incremental transfers this
+ * is only a lower bound.
+ *
+ * Returns: the field value.
+ */
+int64_t* flutter_paste_input_paste_progress_get_expected_bytes(FlutterPasteInputPasteProgress* object);
+
+/**
+ * FlutterPasteInputClipboardWrite:
+ *
+ * Content placed on the clipboard by
+ * [PasteInputHostApi.setClipboardContent].
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputClipboardWrite, flutter_paste_input_clipboard_write, FLUTTER_PASTE_INPUT, CLIPBOARD_WRITE, GObject)
+
+/**
+ * flutter_paste_input_clipboard_write_new:
+ * text: field in this object.
+ * image: field in this object.
+ * image_length: length of @image.
+ * image_mime_type: field in this object.
+ * rendered_image_types: field in this object.
+ *
+ * Creates a new #ClipboardWrite object.
+ *
+ * Returns: a new #FlutterPasteInputClipboardWrite
+ */
+FlutterPasteInputClipboardWrite* flutter_paste_input_clipboard_write_new(const gchar* text, const uint8_t* image, size_t image_length, const gchar* image_mime_type, FlValue* rendered_image_types);
+
+/**
+ * flutter_paste_input_clipboard_write_get_text
+ * @object: a #FlutterPasteInputClipboardWrite.
+ *
+ * Plain text to offer.
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_paste_input_clipboard_write_get_text(FlutterPasteInputClipboardWrite* object);
+
+/**
+ * flutter_paste_input_clipboard_write_get_image
+ * @object: a #FlutterPasteInputClipboardWrite.
+ * @length: location to write the length of this value.
+ *
+ * Encoded image to offer, in the format given by [imageMimeType].
+ *
+ * Returns: the field value.
+ */
+const uint8_t* flutter_paste_input_clipboard_write_get_image(FlutterPasteInputClipboardWrite* object, size_t* length);
+
+/**
+ * flutter_paste_input_clipboard_write_get_image_mime_type
+ * @object: a #FlutterPasteInputClipboardWrite.
+ *
+ * MIME type of [image], e.g. "image/png". Required with [image].
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_paste_input_clipboard_write_get_image_mime_type(FlutterPasteInputClipboardWrite* object);
+
+/**
+ * flutter_paste_input_clipboard_write_get_rendered_image_types
+ * @object: a #FlutterPasteInputClipboardWrite.
+ *
+ * Further image formats to offer, e.g. "image/jpeg" or "image/bmp".
+ *
+ * On Linux each is rendered from [image] only when another application
+ * asks for it, and kept once rendered. Other platforms offer [image] in
+ * its own format only.
+ *
+ * Returns: the field value.
+ */
+FlValue* flutter_paste_input_clipboard_write_get_rendered_image_types(FlutterPasteInputClipboardWrite* object);
+
+/**
+ * FlutterPasteInputClipboardHistoryEntry:
+ *
+ * Metadata of one clipboard history entry, see
+ * [PasteInputHostApi.listClipboardHistory].
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputClipboardHistoryEntry, flutter_paste_input_clipboard_history_entry, FLUTTER_PASTE_INPUT, CLIPBOARD_HISTORY_ENTRY, GObject)
+
+/**
+ * flutter_paste_input_clipboard_history_entry_new:
+ * id: field in this object.
+ * captured_at_ms: field in this object.
+ * mime_types: field in this object.
+ * byte_size: field in this object.
+ *
+ * Creates a new #ClipboardHistoryEntry object.
+ *
+ * Returns: a new #FlutterPasteInputClipboardHistoryEntry
+ */
+FlutterPasteInputClipboardHistoryEntry* flutter_paste_input_clipboard_history_entry_new(int64_t id, int64_t captured_at_ms, FlValue* mime_types, int64_t byte_size);
+
+/**
+ * flutter_paste_input_clipboard_history_entry_get_id
+ * @object: a #FlutterPasteInputClipboardHistoryEntry.
+ *
+ * Identifies the entry for [PasteInputHostApi.getClipboardHistoryEntry].
+ * Ids are never reused within a process.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_clipboard_history_entry_get_id(FlutterPasteInputClipboardHistoryEntry* object);
+
+/**
+ * flutter_paste_input_clipboard_history_entry_get_captured_at_ms
+ * @object: a #FlutterPasteInputClipboardHistoryEntry.
+ *
+ * When the content was last read from the clipboard, in milliseconds
+ * since the Unix epoch.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_clipboard_history_entry_get_captured_at_ms(FlutterPasteInputClipboardHistoryEntry* object);
+
+/**
+ * flutter_paste_input_clipboard_history_entry_get_mime_types
+ * @object: a #FlutterPasteInputClipboardHistoryEntry.
+ *
+ * MIME types of the entry's items, images first.
+ *
+ * Returns: the field value.
+ */
+FlValue* flutter_paste_input_clipboard_history_entry_get_mime_types(FlutterPasteInputClipboardHistoryEntry* object);
+
+/**
+ * flutter_paste_input_clipboard_history_entry_get_byte_size
+ * @object: a #FlutterPasteInputClipboardHistoryEntry.
+ *
+ * Size of the content as it was pasted, before compression.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_clipboard_history_entry_get_byte_size(FlutterPasteInputClipboardHistoryEntry* object);
+
+/**
+ * FlutterPasteInputClipboardHistoryMatch:
+ *
+ * A clipboard history entry matching a search, see
+ * [PasteInputHostApi.searchClipboardHistory].
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputClipboardHistoryMatch, flutter_paste_input_clipboard_history_match, FLUTTER_PASTE_INPUT, CLIPBOARD_HISTORY_MATCH, GObject)
+
+/**
+ * flutter_paste_input_clipboard_history_match_new:
+ * id: field in this object.
+ * match_count: field in this object.
+ * match_starts: field in this object.
+ * match_ends: field in this object.
+ *
+ * Creates a new #ClipboardHistoryMatch object.
+ *
+ * Returns: a new #FlutterPasteInputClipboardHistoryMatch
+ */
+FlutterPasteInputClipboardHistoryMatch* flutter_paste_input_clipboard_history_match_new(int64_t id, int64_t match_count, FlValue* match_starts, FlValue* match_ends);
+
+/**
+ * flutter_paste_input_clipboard_history_match_get_id
+ * @object: a #FlutterPasteInputClipboardHistoryMatch.
+ *
+ * The entry, as in [ClipboardHistoryEntry.id].
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_clipboard_history_match_get_id(FlutterPasteInputClipboardHistoryMatch* object);
+
+/**
+ * flutter_paste_input_clipboard_history_match_get_match_count
+ * @object: a #FlutterPasteInputClipboardHistoryMatch.
+ *
+ * Occurrences of the query's terms in the entry's text.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_clipboard_history_match_get_match_count(FlutterPasteInputClipboardHistoryMatch* object);
+
+/**
+ * flutter_paste_input_clipboard_history_match_get_match_starts
+ * @object: a #FlutterPasteInputClipboardHistoryMatch.
+ *
+ * Where matches start in the entry's text, in UTF-16 code units as Dart
+ * strings index them, in ascending order. At most 64 are reported.
+ *
+ * Returns: the field value.
+ */
+FlValue* flutter_paste_input_clipboard_history_match_get_match_starts(FlutterPasteInputClipboardHistoryMatch* object);
+
+/**
+ * flutter_paste_input_clipboard_history_match_get_match_ends
+ * @object: a #FlutterPasteInputClipboardHistoryMatch.
+ *
+ * Where the matches in [matchStarts] end, exclusive.
+ *
+ * Returns: the field value.
+ */
+FlValue* flutter_paste_input_clipboard_history_match_get_match_ends(FlutterPasteInputClipboardHistoryMatch* object);
+
+/**
+ * FlutterPasteInputPasteStageStats:
+ *
+ * Timings of one stage of the native paste pipeline, see
+ * [PasteInputHostApi.getPasteStats].
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteStageStats, flutter_paste_input_paste_stage_stats, FLUTTER_PASTE_INPUT, PASTE_STAGE_STATS, GObject)
+
+/**
+ * flutter_paste_input_paste_stage_stats_new:
+ * stage: field in this object.
+ * count: field in this object.
+ * total_micros: field in this object.
+ * max_micros: field in this object.
+ * bytes_in: field in this object.
+ * bytes_out: field in this object.
+ *
+ * Creates a new #PasteStageStats object.
+ *
+ * Returns: a new #FlutterPasteInputPasteStageStats
+ */
+FlutterPasteInputPasteStageStats* flutter_paste_input_paste_stage_stats_new(const gchar* stage, int64_t count, int64_t total_micros, int64_t max_micros, int64_t bytes_in, int64_t bytes_out);
+
+/**
+ * flutter_paste_input_paste_stage_stats_get_stage
+ * @object: a #FlutterPasteInputPasteStageStats.
+ *
+ * The stage: "selection" (waiting on the clipboard owner), "decode",
+ * "encode" (PNG), "serialize" (building the reply), "dart" (from
+ * sending a paste event until Dart has handled it) or "total" (from the
+ * paste request reaching the plugin until the reply is sent or the paste
+ * event handled).
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_paste_input_paste_stage_stats_get_stage(FlutterPasteInputPasteStageStats* object);
+
+/**
+ * flutter_paste_input_paste_stage_stats_get_count
+ * @object: a #FlutterPasteInputPasteStageStats.
+ *
+ * Runs of the stage since the last reset.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_stage_stats_get_count(FlutterPasteInputPasteStageStats* object);
+
+/**
+ * flutter_paste_input_paste_stage_stats_get_total_micros
+ * @object: a #FlutterPasteInputPasteStageStats.
+ *
+ * Time spent in the stage, in microseconds.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_stage_stats_get_total_micros(FlutterPasteInputPasteStageStats* object);
+
+/**
+ * flutter_paste_input_paste_stage_stats_get_max_micros
+ * @object: a #FlutterPasteInputPasteStageStats.
+ *
+ * Longest single run, in microseconds.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_stage_stats_get_max_micros(FlutterPasteInputPasteStageStats* object);
+
+/**
+ * flutter_paste_input_paste_stage_stats_get_bytes_in
+ * @object: a #FlutterPasteInputPasteStageStats.
+ *
+ * Bytes the stage consumed and produced.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_stage_stats_get_bytes_in(FlutterPasteInputPasteStageStats* object);
+
+/**
+ * flutter_paste_input_paste_stage_stats_get_bytes_out
+ * @object: a #FlutterPasteInputPasteStageStats.
+ *
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_stage_stats_get_bytes_out(FlutterPasteInputPasteStageStats* object);
+
+/**
+ * FlutterPasteInputPasteLatencyStats:
  *
- * The clipboard may contain multiple items of different types.
- * For example, copying an image might also include a text representation.
+ * Latency percentiles of one stage of the native paste pipeline for one
+ * kind of content, see [PasteInputHostApi.getPasteLatencies].
  */
 
-G_DECLARE_FINAL_TYPE(FlutterPasteInputClipboardContent, flutter_paste_input_clipboard_content, FLUTTER_PASTE_INPUT, CLIPBOARD_CONTENT, GObject)
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteLatencyStats, flutter_paste_input_paste_latency_stats, FLUTTER_PASTE_INPUT, PASTE_LATENCY_STATS, GObject)
 
 /**
- * flutter_paste_input_clipboard_content_new:
- * items: field in this object.
+ * flutter_paste_input_paste_latency_stats_new:
+ * stage: field in this object.
+ * content_class: field in this object.
+ * count: field in this object.
+ * p50_micros: field in this object.
+ * p90_micros: field in this object.
+ * p99_micros: field in this object.
+ * max_micros: field in this object.
  *
- * Creates a new #ClipboardContent object.
+ * Creates a new #PasteLatencyStats object.
  *
- * Returns: a new #FlutterPasteInputClipboardContent
+ * Returns: a new #FlutterPasteInputPasteLatencyStats
  */
-FlutterPasteInputClipboardContent* flutter_paste_input_clipboard_content_new(FlValue* items);
+FlutterPasteInputPasteLatencyStats* flutter_paste_input_paste_latency_stats_new(const gchar* stage, const gchar* content_class, int64_t count, int64_t p50_micros, int64_t p90_micros, int64_t p99_micros, int64_t max_micros);
 
 /**
- * flutter_paste_input_clipboard_content_get_items
- * @object: a #FlutterPasteInputClipboardContent.
+ * flutter_paste_input_paste_latency_stats_get_stage
+ * @object: a #FlutterPasteInputPasteLatencyStats.
  *
- * List of clipboard items.
+ * The stage, as in [PasteStageStats.stage].
  *
- * May be empty if the clipboard is empty or contains unsupported content.
+ * Returns: the field value.
+ */
+const gchar* flutter_paste_input_paste_latency_stats_get_stage(FlutterPasteInputPasteLatencyStats* object);
+
+/**
+ * flutter_paste_input_paste_latency_stats_get_content_class
+ * @object: a #FlutterPasteInputPasteLatencyStats.
+ *
+ * What was pasted: "text", "small-image" or "large-image" (at least
+ * 1024 x 1024 pixels).
  *
  * Returns: the field value.
  */
-FlValue* flutter_paste_input_clipboard_content_get_items(FlutterPasteInputClipboardContent* object);
+const gchar* flutter_paste_input_paste_latency_stats_get_content_class(FlutterPasteInputPasteLatencyStats* object);
 
-G_DECLARE_FINAL_TYPE(FlutterPasteInputMessageCodec, flutter_paste_input_message_codec, FLUTTER_PASTE_INPUT, MESSAGE_CODEC, FlStandardMessageCodec)
+/**
+ * flutter_paste_input_paste_latency_stats_get_count
+ * @object: a #FlutterPasteInputPasteLatencyStats.
+ *
+ * Runs of the stage since the last reset.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_latency_stats_get_count(FlutterPasteInputPasteLatencyStats* object);
 
-G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApi, flutter_paste_input_paste_input_host_api, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API, GObject)
+/**
+ * flutter_paste_input_paste_latency_stats_get_p50_micros
+ * @object: a #FlutterPasteInputPasteLatencyStats.
+ *
+ * Percentiles, in microseconds, within about 6% of the exact value.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_latency_stats_get_p50_micros(FlutterPasteInputPasteLatencyStats* object);
 
-G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiGetClipboardContentResponse, flutter_paste_input_paste_input_host_api_get_clipboard_content_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_GET_CLIPBOARD_CONTENT_RESPONSE, GObject)
+/**
+ * flutter_paste_input_paste_latency_stats_get_p90_micros
+ * @object: a #FlutterPasteInputPasteLatencyStats.
+ *
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_paste_input_paste_latency_stats_get_p90_micros(FlutterPasteInputPasteLatencyStats* object);
 
 /**
- * flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new:
+ * flutter_paste_input_paste_latency_stats_get_p99_micros
+ * @object: a #FlutterPasteInputPasteLatencyStats.
  *
- * Creates a new response to PasteInputHostApi.getClipboardContent.
  *
- * Returns: a new #FlutterPasteInputPasteInputHostApiGetClipboardContentResponse
+ * Returns: the field value.
  */
-FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new(FlutterPasteInputClipboardContent* return_value);
+int64_t flutter_paste_input_paste_latency_stats_get_p99_micros(FlutterPasteInputPasteLatencyStats* object);
 
 /**
- * flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new_error:
- * @code: error code.
- * @message: error message.
- * @details: (allow-none): error details or %NULL.
+ * flutter_paste_input_paste_latency_stats_get_max_micros
+ * @object: a #FlutterPasteInputPasteLatencyStats.
  *
- * Creates a new error response to PasteInputHostApi.getClipboardContent.
+ * Longest single run, in microseconds.
  *
- * Returns: a new #FlutterPasteInputPasteInputHostApiGetClipboardContentResponse
+ * Returns: the field value.
  */
-FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* flutter_paste_input_paste_input_host_api_get_clipboard_content_response_new_error(const gchar* code, const gchar* message, FlValue* details);
+int64_t flutter_paste_input_paste_latency_stats_get_max_micros(FlutterPasteInputPasteLatencyStats* object);
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputMessageCodec, flutter_paste_input_message_codec, FLUTTER_PASTE_INPUT, MESSAGE_CODEC, FlStandardMessageCodec)
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApi, flutter_paste_input_paste_input_host_api, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API, GObject)
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiResponseHandle, flutter_paste_input_paste_input_host_api_response_handle, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_RESPONSE_HANDLE, GObject)
 
 G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiClearTempFilesResponse, flutter_paste_input_paste_input_host_api_clear_temp_files_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_CLEAR_TEMP_FILES_RESPONSE, GObject)
 
@@ -168,15 +914,97 @@ FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* flutter_paste_inpu
  */
 FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* flutter_paste_input_paste_input_host_api_get_platform_version_response_new_error(const gchar* code, const gchar* message, FlValue* details);
 
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiConfigureResponse, flutter_paste_input_paste_input_host_api_configure_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_CONFIGURE_RESPONSE, GObject)
+
+/**
+ * flutter_paste_input_paste_input_host_api_configure_response_new:
+ *
+ * Creates a new response to PasteInputHostApi.configure.
+ *
+ * Returns: a new #FlutterPasteInputPasteInputHostApiConfigureResponse
+ */
+FlutterPasteInputPasteInputHostApiConfigureResponse* flutter_paste_input_paste_input_host_api_configure_response_new();
+
+/**
+ * flutter_paste_input_paste_input_host_api_configure_response_new_error:
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Creates a new error response to PasteInputHostApi.configure.
+ *
+ * Returns: a new #FlutterPasteInputPasteInputHostApiConfigureResponse
+ */
+FlutterPasteInputPasteInputHostApiConfigureResponse* flutter_paste_input_paste_input_host_api_configure_response_new_error(const gchar* code, const gchar* message, FlValue* details);
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse, flutter_paste_input_paste_input_host_api_prefetch_clipboard_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_PREFETCH_CLIPBOARD_RESPONSE, GObject)
+
+/**
+ * flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_new:
+ *
+ * Creates a new response to PasteInputHostApi.prefetchClipboard.
+ *
+ * Returns: a new #FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse
+ */
+FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_new();
+
+/**
+ * flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_new_error:
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Creates a new error response to PasteInputHostApi.prefetchClipboard.
+ *
+ * Returns: a new #FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse
+ */
+FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* flutter_paste_input_paste_input_host_api_prefetch_clipboard_response_new_error(const gchar* code, const gchar* message, FlValue* details);
+
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputHostApiCancelPasteResponse, flutter_paste_input_paste_input_host_api_cancel_paste_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_HOST_API_CANCEL_PASTE_RESPONSE, GObject)
+
+/**
+ * flutter_paste_input_paste_input_host_api_cancel_paste_response_new:
+ *
+ * Creates a new response to PasteInputHostApi.cancelPaste.
+ *
+ * Returns: a new #FlutterPasteInputPasteInputHostApiCancelPasteResponse
+ */
+FlutterPasteInputPasteInputHostApiCancelPasteResponse* flutter_paste_input_paste_input_host_api_cancel_paste_response_new();
+
+/**
+ * flutter_paste_input_paste_input_host_api_cancel_paste_response_new_error:
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Creates a new error response to PasteInputHostApi.cancelPaste.
+ *
+ * Returns: a new #FlutterPasteInputPasteInputHostApiCancelPasteResponse
+ */
+FlutterPasteInputPasteInputHostApiCancelPasteResponse* flutter_paste_input_paste_input_host_api_cancel_paste_response_new_error(const gchar* code, const gchar* message, FlValue* details);
+
 /**
  * FlutterPasteInputPasteInputHostApiVTable:
  *
  * Table of functions exposed by PasteInputHostApi to be implemented by the API provider.
  */
 typedef struct {
-  FlutterPasteInputPasteInputHostApiGetClipboardContentResponse* (*get_clipboard_content)(gpointer user_data);
+  void (*get_clipboard_content)(int64_t request_id, FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
   FlutterPasteInputPasteInputHostApiClearTempFilesResponse* (*clear_temp_files)(gpointer user_data);
   FlutterPasteInputPasteInputHostApiGetPlatformVersionResponse* (*get_platform_version)(gpointer user_data);
+  void (*probe_clipboard)(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  FlutterPasteInputPasteInputHostApiConfigureResponse* (*configure)(FlutterPasteInputPasteInputConfig* config, gpointer user_data);
+  FlutterPasteInputPasteInputHostApiPrefetchClipboardResponse* (*prefetch_clipboard)(gpointer user_data);
+  FlutterPasteInputPasteInputHostApiCancelPasteResponse* (*cancel_paste)(int64_t request_id, gpointer user_data);
+  void (*trim_memory)(int64_t level, FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_clipboard_content)(FlutterPasteInputClipboardWrite* content, FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*list_clipboard_history)(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*get_clipboard_history_entry)(int64_t id, FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*search_clipboard_history)(const gchar* query, int64_t max_results, FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*get_paste_stats)(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*reset_paste_stats)(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*get_paste_latencies)(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*dump_paste_trace)(const gchar* path, FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, gpointer user_data);
 } FlutterPasteInputPasteInputHostApiVTable;
 
 /**
@@ -202,6 +1030,224 @@ void flutter_paste_input_paste_input_host_api_set_method_handlers(FlBinaryMessen
  */
 void flutter_paste_input_paste_input_host_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix);
 
+/**
+ * flutter_paste_input_paste_input_host_api_respond_get_clipboard_content:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.getClipboardContent. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_get_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlutterPasteInputClipboardContent* return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_content:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.getClipboardContent. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_probe_clipboard:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.probeClipboard. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_probe_clipboard(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlutterPasteInputClipboardProbe* return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_probe_clipboard:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.probeClipboard. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_probe_clipboard(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_trim_memory:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.trimMemory. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_trim_memory(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, int64_t return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_trim_memory:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.trimMemory. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_trim_memory(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_set_clipboard_content:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ *
+ * Responds to PasteInputHostApi.setClipboardContent. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_set_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_set_clipboard_content:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.setClipboardContent. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_set_clipboard_content(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_list_clipboard_history:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.listClipboardHistory. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_list_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_list_clipboard_history:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.listClipboardHistory. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_list_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_get_clipboard_history_entry:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.getClipboardHistoryEntry. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_get_clipboard_history_entry(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlutterPasteInputClipboardContent* return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_history_entry:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.getClipboardHistoryEntry. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_get_clipboard_history_entry(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_search_clipboard_history:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.searchClipboardHistory. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_search_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_search_clipboard_history:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.searchClipboardHistory. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_search_clipboard_history(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_get_paste_stats:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.getPasteStats. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_get_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_get_paste_stats:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.getPasteStats. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_get_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_reset_paste_stats:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ *
+ * Responds to PasteInputHostApi.resetPasteStats. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_reset_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_reset_paste_stats:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.resetPasteStats. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_reset_paste_stats(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_get_paste_latencies:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.getPasteLatencies. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_get_paste_latencies(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_get_paste_latencies:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.getPasteLatencies. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_get_paste_latencies(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_dump_paste_trace:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to PasteInputHostApi.dumpPasteTrace. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_dump_paste_trace(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, int64_t return_value);
+
+/**
+ * flutter_paste_input_paste_input_host_api_respond_error_dump_paste_trace:
+ * @response_handle: a #FlutterPasteInputPasteInputHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to PasteInputHostApi.dumpPasteTrace. 
+ */
+void flutter_paste_input_paste_input_host_api_respond_error_dump_paste_trace(FlutterPasteInputPasteInputHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
 G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputFlutterApiOnPasteDetectedResponse, flutter_paste_input_paste_input_flutter_api_on_paste_detected_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_FLUTTER_API_ON_PASTE_DETECTED_RESPONSE, GObject)
 
 /**
@@ -244,6 +1290,48 @@ const gchar* flutter_paste_input_paste_input_flutter_api_on_paste_detected_respo
  */
 FlValue* flutter_paste_input_paste_input_flutter_api_on_paste_detected_response_get_error_details(FlutterPasteInputPasteInputFlutterApiOnPasteDetectedResponse* response);
 
+G_DECLARE_FINAL_TYPE(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse, flutter_paste_input_paste_input_flutter_api_on_paste_progress_response, FLUTTER_PASTE_INPUT, PASTE_INPUT_FLUTTER_API_ON_PASTE_PROGRESS_RESPONSE, GObject)
+
+/**
+ * flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_is_error:
+ * @response: a #FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse.
+ *
+ * Checks if a response to PasteInputFlutterApi.onPasteProgress is an error.
+ *
+ * Returns: a %TRUE if this response is an error.
+ */
+gboolean flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_is_error(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* response);
+
+/**
+ * flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_code:
+ * @response: a #FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse.
+ *
+ * Get the error code for this response.
+ *
+ * Returns: an error code or %NULL if not an error.
+ */
+const gchar* flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_code(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* response);
+
+/**
+ * flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_message:
+ * @response: a #FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse.
+ *
+ * Get the error message for this response.
+ *
+ * Returns: an error message.
+ */
+const gchar* flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_message(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* response);
+
+/**
+ * flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_details:
+ * @response: a #FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse.
+ *
+ * Get the error details for this response.
+ *
+ * Returns: (allow-none): an error details or %NULL.
+ */
+FlValue* flutter_paste_input_paste_input_flutter_api_on_paste_progress_response_get_error_details(FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* response);
+
 /**
  * FlutterPasteInputPasteInputFlutterApi:
  *
@@ -295,6 +1383,31 @@ void flutter_paste_input_paste_input_flutter_api_on_paste_detected(FlutterPasteI
  */
 FlutterPasteInputPasteInputFlutterApiOnPasteDetectedResponse* flutter_paste_input_paste_input_flutter_api_on_paste_detected_finish(FlutterPasteInputPasteInputFlutterApi* api, GAsyncResult* result, GError** error);
 
+/**
+ * flutter_paste_input_paste_input_flutter_api_on_paste_progress:
+ * @api: a #FlutterPasteInputPasteInputFlutterApi.
+ * @progress: parameter for this method.
+ * @cancellable: (allow-none): a #GCancellable or %NULL.
+ * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
+ * @user_data: (closure): user data to pass to @callback.
+ *
+ * Called periodically while a large selection is transferred for a
+ * [PasteInputHostApi.getClipboardContent] request.
+ */
+void flutter_paste_input_paste_input_flutter_api_on_paste_progress(FlutterPasteInputPasteInputFlutterApi* api, FlutterPasteInputPasteProgress* progress, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * flutter_paste_input_paste_input_flutter_api_on_paste_progress_finish:
+ * @api: a #FlutterPasteInputPasteInputFlutterApi.
+ * @result: a #GAsyncResult.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ *
+ * Completes a flutter_paste_input_paste_input_flutter_api_on_paste_progress() call.
+ *
+ * Returns: a #FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse or %NULL on error.
+ */
+FlutterPasteInputPasteInputFlutterApiOnPasteProgressResponse* flutter_paste_input_paste_input_flutter_api_on_paste_progress_finish(FlutterPasteInputPasteInputFlutterApi* api, GAsyncResult* result, GError** error);
+
 G_END_DECLS
 
 #endif  // PIGEON_MESSAGES_G_H_
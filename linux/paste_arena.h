@@ -0,0 +1,34 @@
+#ifndef FLUTTER_PLUGIN_PASTE_ARENA_H_
+#define FLUTTER_PLUGIN_PASTE_ARENA_H_
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace flutter_paste_input {
+
+// Monotonic arena for the temporaries of one clipboard read.
+//
+// Bookkeeping that only lives while a read is in flight is carved out of
+// an inline block, spilling into growing heap chunks if it runs out, and
+// is released in one go when the read has answered its requests. Nothing
+// is freed individually. Not thread safe.
+class PasteArena {
+ public:
+  static constexpr size_t kInlineBytes = 1024;
+
+  PasteArena() : resource_(inline_block_, sizeof(inline_block_)) {}
+
+  // Disallow copy and assign.
+  PasteArena(const PasteArena&) = delete;
+  PasteArena& operator=(const PasteArena&) = delete;
+
+  std::pmr::memory_resource* resource() { return &resource_; }
+
+ private:
+  alignas(std::max_align_t) std::byte inline_block_[kInlineBytes];
+  std::pmr::monotonic_buffer_resource resource_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_PASTE_ARENA_H_
@@ -0,0 +1,37 @@
+#include "paste_event_dispatcher.h"
+
+#include <utility>
+
+namespace flutter_paste_input {
+
+PasteEventDispatcher::PasteEventDispatcher(Sender sender,
+                                           size_t max_outstanding)
+    : sender_(std::move(sender)), max_outstanding_(max_outstanding) {}
+
+void PasteEventDispatcher::Post(SnapshotPtr snapshot) {
+  queued_ = std::move(snapshot);
+  SendQueued();
+}
+
+void PasteEventDispatcher::Acknowledge() {
+  if (outstanding_ > 0) {
+    outstanding_--;
+  }
+  SendQueued();
+}
+
+void PasteEventDispatcher::set_max_outstanding(size_t max_outstanding) {
+  max_outstanding_ = max_outstanding;
+  SendQueued();
+}
+
+void PasteEventDispatcher::SendQueued() {
+  if (!queued_ || outstanding_ >= max_outstanding_) {
+    return;
+  }
+  outstanding_++;
+  // The sender may acknowledge synchronously, e.g. on a send error.
+  sender_(std::move(queued_));
+}
+
+}  // namespace flutter_paste_input
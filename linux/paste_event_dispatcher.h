@@ -0,0 +1,56 @@
+#ifndef FLUTTER_PLUGIN_PASTE_EVENT_DISPATCHER_H_
+#define FLUTTER_PLUGIN_PASTE_EVENT_DISPATCHER_H_
+
+#include <cstddef>
+#include <functional>
+
+#include "clipboard_reader.h"
+
+namespace flutter_paste_input {
+
+// Applies backpressure to onPasteDetected events.
+//
+// At most |max_outstanding| events are sent to Dart before it acknowledges
+// them. Further snapshots are held back, and only the newest one is kept:
+// by the time Dart catches up, older clipboard content is stale, and there
+// is no point in queueing several full payloads inside the engine.
+class PasteEventDispatcher {
+ public:
+  // Sends |snapshot| to Dart; Acknowledge() must be called once it is
+  // handled (or has failed).
+  using Sender = std::function<void(SnapshotPtr snapshot)>;
+
+  static constexpr size_t kDefaultMaxOutstanding = 1;
+
+  explicit PasteEventDispatcher(Sender sender,
+                                size_t max_outstanding = kDefaultMaxOutstanding);
+
+  // Disallow copy and assign.
+  PasteEventDispatcher(const PasteEventDispatcher&) = delete;
+  PasteEventDispatcher& operator=(const PasteEventDispatcher&) = delete;
+
+  // Sends |snapshot| now if below the limit, otherwise queues it in place
+  // of any snapshot already waiting.
+  void Post(SnapshotPtr snapshot);
+
+  // Marks one outstanding event as handled and sends the queued snapshot,
+  // if any.
+  void Acknowledge();
+
+  size_t outstanding() const { return outstanding_; }
+  bool has_queued() const { return static_cast<bool>(queued_); }
+
+  void set_max_outstanding(size_t max_outstanding);
+
+ private:
+  void SendQueued();
+
+  Sender sender_;
+  size_t max_outstanding_;
+  size_t outstanding_ = 0;
+  SnapshotPtr queued_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_PASTE_EVENT_DISPATCHER_H_
@@ -0,0 +1,89 @@
+#include "paste_stats.h"
+
+namespace flutter_paste_input {
+
+const char* PasteStageName(PasteStage stage) {
+  switch (stage) {
+    case PasteStage::kSelection:
+      return "selection";
+    case PasteStage::kDecode:
+      return "decode";
+    case PasteStage::kEncode:
+      return "encode";
+    case PasteStage::kSerialize:
+      return "serialize";
+    case PasteStage::kDart:
+      return "dart";
+    case PasteStage::kTotal:
+      return "total";
+  }
+  return "unknown";
+}
+
+const char* PasteContentClassName(PasteContentClass content_class) {
+  switch (content_class) {
+    case PasteContentClass::kText:
+      return "text";
+    case PasteContentClass::kSmallImage:
+      return "small-image";
+    case PasteContentClass::kLargeImage:
+      return "large-image";
+  }
+  return "unknown";
+}
+
+PasteContentClass ImageContentClass(int64_t width, int64_t height) {
+  return width * height >= kLargeImagePixels ? PasteContentClass::kLargeImage
+                                             : PasteContentClass::kSmallImage;
+}
+
+PasteStats::PasteStats() = default;
+
+void PasteStats::Record(PasteStage stage, PasteContentClass content_class,
+                        gint64 started_at, size_t bytes_in, size_t bytes_out) {
+  RecordElapsed(stage, content_class, g_get_monotonic_time() - started_at, bytes_in,
+                bytes_out);
+}
+
+void PasteStats::RecordElapsed(PasteStage stage, PasteContentClass content_class,
+                               gint64 elapsed_us, size_t bytes_in, size_t bytes_out) {
+  Counters& counters = stages_[static_cast<size_t>(stage)];
+  uint64_t elapsed = elapsed_us > 0 ? static_cast<uint64_t>(elapsed_us) : 0;
+  counters.count.fetch_add(1, std::memory_order_relaxed);
+  counters.total_us.fetch_add(elapsed, std::memory_order_relaxed);
+  counters.bytes_in.fetch_add(bytes_in, std::memory_order_relaxed);
+  counters.bytes_out.fetch_add(bytes_out, std::memory_order_relaxed);
+  uint64_t max = counters.max_us.load(std::memory_order_relaxed);
+  while (elapsed > max &&
+         !counters.max_us.compare_exchange_weak(max, elapsed, std::memory_order_relaxed)) {
+  }
+  latencies_[static_cast<size_t>(stage)][static_cast<size_t>(content_class)].Record(elapsed);
+}
+
+PasteStageTotals PasteStats::Totals(PasteStage stage) const {
+  const Counters& counters = stages_[static_cast<size_t>(stage)];
+  PasteStageTotals totals;
+  totals.count = counters.count.load(std::memory_order_relaxed);
+  totals.total_us = counters.total_us.load(std::memory_order_relaxed);
+  totals.max_us = counters.max_us.load(std::memory_order_relaxed);
+  totals.bytes_in = counters.bytes_in.load(std::memory_order_relaxed);
+  totals.bytes_out = counters.bytes_out.load(std::memory_order_relaxed);
+  return totals;
+}
+
+void PasteStats::Reset() {
+  for (Counters& counters : stages_) {
+    counters.count.store(0, std::memory_order_relaxed);
+    counters.total_us.store(0, std::memory_order_relaxed);
+    counters.max_us.store(0, std::memory_order_relaxed);
+    counters.bytes_in.store(0, std::memory_order_relaxed);
+    counters.bytes_out.store(0, std::memory_order_relaxed);
+  }
+  for (auto& stage : latencies_) {
+    for (LatencyHistogram& histogram : stage) {
+      histogram.Reset();
+    }
+  }
+}
+
+}  // namespace flutter_paste_input
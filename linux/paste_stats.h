@@ -0,0 +1,114 @@
+#ifndef FLUTTER_PLUGIN_PASTE_STATS_H_
+#define FLUTTER_PLUGIN_PASTE_STATS_H_
+
+#include <glib.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "latency_histogram.h"
+
+namespace flutter_paste_input {
+
+// Stages of the paste pipeline that are timed.
+enum class PasteStage {
+  // Waiting on the selection owner for targets, image data and text.
+  kSelection = 0,
+  // Decoding the raw image selection into a pixbuf.
+  kDecode,
+  // Scaling, if needed, and encoding the pixbuf as PNG.
+  kEncode,
+  // Building the Pigeon reply and handing it to the codec.
+  kSerialize,
+  // From sending onPasteDetected until Dart acknowledges it.
+  kDart,
+  // End to end: from the paste request reaching the plugin until the reply
+  // is sent or, for paste events, Dart has handled it.
+  kTotal,
+};
+
+constexpr size_t kPasteStageCount = static_cast<size_t>(PasteStage::kTotal) + 1;
+
+// Latencies are kept apart by what was pasted, as large images dominate
+// the tail.
+enum class PasteContentClass {
+  kText = 0,
+  kSmallImage,
+  // At least kLargeImagePixels.
+  kLargeImage,
+};
+
+constexpr size_t kPasteContentClassCount =
+    static_cast<size_t>(PasteContentClass::kLargeImage) + 1;
+
+constexpr int64_t kLargeImagePixels = 1024 * 1024;
+
+// Name of |stage| as reported to Dart, e.g. "selection".
+const char* PasteStageName(PasteStage stage);
+
+// Name of |content_class| as reported to Dart, e.g. "large-image".
+const char* PasteContentClassName(PasteContentClass content_class);
+
+PasteContentClass ImageContentClass(int64_t width, int64_t height);
+
+// Aggregated timings of one stage. |bytes_in| is what the stage consumed,
+// |bytes_out| what it produced.
+struct PasteStageTotals {
+  uint64_t count = 0;
+  uint64_t total_us = 0;
+  uint64_t max_us = 0;
+  uint64_t bytes_in = 0;
+  uint64_t bytes_out = 0;
+};
+
+// Per-stage timing counters of the paste pipeline, in microseconds of
+// monotonic time, and a LatencyHistogram per stage and content class.
+//
+// Counters are relaxed atomics, so stages running on the GIO worker pool
+// record without locking, and a Totals() call racing with Record() may see
+// a sample half counted. Reset() and Latencies() must be called on the
+// main thread. Shared through a std::shared_ptr with encode jobs, which
+// may outlive the reader.
+class PasteStats {
+ public:
+  PasteStats();
+
+  // Disallow copy and assign.
+  PasteStats(const PasteStats&) = delete;
+  PasteStats& operator=(const PasteStats&) = delete;
+
+  // Counts one run of |stage| that started at |started_at|, as returned by
+  // g_get_monotonic_time(), and ends now.
+  void Record(PasteStage stage, PasteContentClass content_class, gint64 started_at,
+              size_t bytes_in, size_t bytes_out);
+
+  // Counts one run of |stage| that took |elapsed_us|.
+  void RecordElapsed(PasteStage stage, PasteContentClass content_class,
+                     gint64 elapsed_us, size_t bytes_in, size_t bytes_out);
+
+  PasteStageTotals Totals(PasteStage stage) const;
+
+  const LatencyHistogram& Latencies(PasteStage stage,
+                                    PasteContentClass content_class) const {
+    return latencies_[static_cast<size_t>(stage)][static_cast<size_t>(content_class)];
+  }
+
+  void Reset();
+
+ private:
+  struct Counters {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> total_us{0};
+    std::atomic<uint64_t> max_us{0};
+    std::atomic<uint64_t> bytes_in{0};
+    std::atomic<uint64_t> bytes_out{0};
+  };
+
+  Counters stages_[kPasteStageCount];
+  LatencyHistogram latencies_[kPasteStageCount][kPasteContentClassCount];
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_PASTE_STATS_H_
@@ -0,0 +1,233 @@
+#include "paste_tracer.h"
+
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <new>
+
+namespace flutter_paste_input {
+
+struct PasteTracer::Chunk {
+  Event events[kChunkEvents];
+};
+
+struct PasteTracer::ThreadBuffer {
+  int tid = 0;
+  char name[16] = {};
+  std::atomic<Chunk*> chunks[kMaxChunks] = {};
+  // Events published by the owning thread.
+  std::atomic<size_t> size{0};
+  std::atomic<size_t> dropped{0};
+  // The trace the events belong to; rewound by the owning thread when it
+  // lags PasteTracer::trace_.
+  std::atomic<uint32_t> trace{0};
+  ThreadBuffer* next = nullptr;
+};
+
+thread_local PasteTracer::ThreadBuffer* PasteTracer::current_buffer_ = nullptr;
+
+namespace {
+
+// Appends |text| as a JSON string, replacing characters that would need
+// escaping; thread names are all that could contain them.
+void AppendJsonString(GString* out, const char* text) {
+  g_string_append_c(out, '"');
+  for (const char* c = text; *c != '\0'; c++) {
+    bool plain = *c != '"' && *c != '\\' && static_cast<unsigned char>(*c) >= 0x20;
+    g_string_append_c(out, plain ? *c : '_');
+  }
+  g_string_append_c(out, '"');
+}
+
+}  // namespace
+
+// static
+PasteTracer* PasteTracer::Get() {
+  // Never destroyed: worker threads may still record at exit.
+  static PasteTracer* tracer = new PasteTracer();
+  return tracer;
+}
+
+PasteTracer::PasteTracer() = default;
+
+void PasteTracer::Start() {
+  // Buffers are rewound lazily, by their own threads, as only the owner
+  // may write a buffer's size.
+  trace_.fetch_add(1, std::memory_order_relaxed);
+  enabled_.store(true, std::memory_order_relaxed);
+}
+
+void PasteTracer::Stop() {
+  enabled_.store(false, std::memory_order_relaxed);
+}
+
+void PasteTracer::Begin(const char* name) {
+  if (enabled()) {
+    Record('B', name, 0);
+  }
+}
+
+void PasteTracer::End(const char* name) {
+  if (enabled()) {
+    Record('E', name, 0);
+  }
+}
+
+void PasteTracer::AsyncBegin(const char* name, uint64_t id) {
+  if (enabled()) {
+    Record('b', name, id);
+  }
+}
+
+void PasteTracer::AsyncEnd(const char* name, uint64_t id) {
+  if (enabled()) {
+    Record('e', name, id);
+  }
+}
+
+void PasteTracer::Instant(const char* name) {
+  if (enabled()) {
+    Record('i', name, 0);
+  }
+}
+
+PasteTracer::ThreadBuffer* PasteTracer::CurrentBuffer() {
+  if (current_buffer_ != nullptr) {
+    return current_buffer_;
+  }
+  ThreadBuffer* buffer = new (std::nothrow) ThreadBuffer();
+  if (buffer == nullptr) {
+    return nullptr;
+  }
+  buffer->tid = static_cast<int>(syscall(SYS_gettid));
+  pthread_getname_np(pthread_self(), buffer->name, sizeof(buffer->name));
+  buffer->next = buffers_.load(std::memory_order_relaxed);
+  while (!buffers_.compare_exchange_weak(buffer->next, buffer, std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+  }
+  current_buffer_ = buffer;
+  return buffer;
+}
+
+void PasteTracer::Record(char phase, const char* name, uint64_t id) {
+  ThreadBuffer* buffer = CurrentBuffer();
+  if (buffer == nullptr) {
+    return;
+  }
+  uint32_t trace = trace_.load(std::memory_order_relaxed);
+  if (buffer->trace.load(std::memory_order_relaxed) != trace) {
+    // First event of a new trace; the chunks are reused from the start.
+    buffer->size.store(0, std::memory_order_release);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+    buffer->trace.store(trace, std::memory_order_release);
+    // Keeps the events below from being written before the new trace is
+    // published, so Dump() can tell a rewound buffer from its copy.
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+  // Only this thread writes |size|.
+  size_t index = buffer->size.load(std::memory_order_relaxed);
+  size_t chunk_index = index / kChunkEvents;
+  if (chunk_index >= kMaxChunks) {
+    buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  Chunk* chunk = buffer->chunks[chunk_index].load(std::memory_order_relaxed);
+  if (chunk == nullptr) {
+    chunk = new (std::nothrow) Chunk();
+    if (chunk == nullptr) {
+      buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    buffer->chunks[chunk_index].store(chunk, std::memory_order_release);
+  }
+  chunk->events[index % kChunkEvents] = Event{name, g_get_monotonic_time(), id, phase};
+  buffer->size.store(index + 1, std::memory_order_release);
+}
+
+int64_t PasteTracer::Dump(const std::string& path) const {
+  int pid = static_cast<int>(getpid());
+  uint32_t trace = trace_.load(std::memory_order_relaxed);
+  g_autoptr(GString) json = g_string_new("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  int64_t written = 0;
+  size_t dropped = 0;
+  bool first = true;
+  for (ThreadBuffer* buffer = buffers_.load(std::memory_order_acquire); buffer != nullptr;
+       buffer = buffer->next) {
+    if (buffer->trace.load(std::memory_order_acquire) != trace) {
+      continue;
+    }
+    size_t end = buffer->size.load(std::memory_order_acquire);
+    if (end == 0) {
+      continue;
+    }
+    gsize mark = json->len;
+    int64_t written_before = written;
+    bool first_before = first;
+
+    g_string_append_printf(json,
+                           "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,"
+                           "\"args\":{\"name\":",
+                           first ? "" : ",", pid, buffer->tid);
+    AppendJsonString(json, buffer->name[0] != '\0' ? buffer->name : "thread");
+    g_string_append(json, "}}");
+    first = false;
+
+    for (size_t i = 0; i < end; i++) {
+      const Chunk* chunk = buffer->chunks[i / kChunkEvents].load(std::memory_order_acquire);
+      const Event& event = chunk->events[i % kChunkEvents];
+      g_string_append(json, ",\n{\"name\":");
+      AppendJsonString(json, event.name);
+      g_string_append_printf(json,
+                             ",\"cat\":\"flutter_paste_input\",\"ph\":\"%c\","
+                             "\"ts\":%" G_GINT64_FORMAT ",\"pid\":%d,\"tid\":%d",
+                             event.phase, event.timestamp, pid, buffer->tid);
+      if (event.phase == 'b' || event.phase == 'e') {
+        g_string_append_printf(json, ",\"id\":\"0x%" G_GINT64_MODIFIER "x\"",
+                               static_cast<guint64>(event.id));
+      } else if (event.phase == 'i') {
+        g_string_append(json, ",\"s\":\"t\"");
+      }
+      g_string_append_c(json, '}');
+      written++;
+    }
+
+    // A Start() and the thread's first event of the new trace may have
+    // rewound the buffer while it was copied; the copy is then discarded.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (buffer->trace.load(std::memory_order_relaxed) != trace ||
+        buffer->size.load(std::memory_order_relaxed) < end) {
+      g_string_truncate(json, mark);
+      written = written_before;
+      first = first_before;
+      continue;
+    }
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  g_string_append(json, "\n]}\n");
+
+  if (dropped > 0) {
+    g_warning("FlutterPasteInput: %zu trace events were dropped from full buffers", dropped);
+  }
+  g_autoptr(GError) error = nullptr;
+  if (!g_file_set_contents(path.c_str(), json->str, static_cast<gssize>(json->len), &error)) {
+    g_warning("FlutterPasteInput: Failed to write the paste trace: %s", error->message);
+    return -1;
+  }
+  return written;
+}
+
+TraceScope::TraceScope(const char* name)
+    : name_(PasteTracer::Get()->enabled() ? name : nullptr) {
+  if (name_ != nullptr) {
+    PasteTracer::Get()->Begin(name_);
+  }
+}
+
+TraceScope::~TraceScope() {
+  if (name_ != nullptr) {
+    PasteTracer::Get()->End(name_);
+  }
+}
+
+}  // namespace flutter_paste_input
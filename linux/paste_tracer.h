@@ -0,0 +1,106 @@
+#ifndef FLUTTER_PLUGIN_PASTE_TRACER_H_
+#define FLUTTER_PLUGIN_PASTE_TRACER_H_
+
+#include <glib.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace flutter_paste_input {
+
+// Optional recorder of paste pipeline activity, exported as Chrome trace
+// JSON for Perfetto or chrome://tracing.
+//
+// Stages that run to completion on one thread are recorded as begin/end
+// pairs ("B"/"E"); waits that span main loop iterations, such as a pending
+// selection request, as async events ("b"/"e") keyed by an id. Timestamps
+// are g_get_monotonic_time(), the clock of the Flutter engine's timeline,
+// so both traces line up when loaded together.
+//
+// Every thread records into a buffer of its own, registered on its first
+// event, that only it writes: an event is stored and then published with a
+// release store of the buffer's size, so recording takes no lock and the
+// buffers can be read from any thread meanwhile. Buffers grow in chunks of
+// kChunkEvents up to kMaxChunks, after which events are dropped and
+// counted. Each Start() begins a new trace, and a thread rewinds its
+// buffer on its first event of that trace, keeping the chunks. Buffers are
+// never freed, as pool threads come and go.
+//
+// Event names must be string literals. Recording is a single relaxed load
+// while tracing is stopped.
+class PasteTracer {
+ public:
+  static constexpr size_t kChunkEvents = 4096;
+  static constexpr size_t kMaxChunks = 64;
+
+  // Returns the process-wide tracer.
+  static PasteTracer* Get();
+
+  PasteTracer();
+
+  // Disallow copy and assign.
+  PasteTracer(const PasteTracer&) = delete;
+  PasteTracer& operator=(const PasteTracer&) = delete;
+
+  // Starts a new trace, discarding what was recorded before.
+  void Start();
+  // Stops recording; what was recorded can still be dumped.
+  void Stop();
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  void Begin(const char* name);
+  void End(const char* name);
+  void AsyncBegin(const char* name, uint64_t id);
+  void AsyncEnd(const char* name, uint64_t id);
+  void Instant(const char* name);
+
+  // Writes the events recorded since Start() to |path| as Chrome trace
+  // JSON. Returns the number of events written, or -1 if the file cannot be
+  // written. Safe to call on any thread, also while events are recorded;
+  // a buffer rewound by a concurrent Start() is left out.
+  int64_t Dump(const std::string& path) const;
+
+ private:
+  struct Event {
+    const char* name;
+    gint64 timestamp;
+    uint64_t id;
+    char phase;
+  };
+  struct Chunk;
+  struct ThreadBuffer;
+
+  // Returns the calling thread's buffer, registering it on first use.
+  ThreadBuffer* CurrentBuffer();
+
+  void Record(char phase, const char* name, uint64_t id);
+
+  static thread_local ThreadBuffer* current_buffer_;
+
+  std::atomic<bool> enabled_{false};
+  // Bumped by Start(); buffers of an older trace count as empty.
+  std::atomic<uint32_t> trace_{0};
+  // Lock-free list of every thread's buffer, most recent first.
+  std::atomic<ThreadBuffer*> buffers_{nullptr};
+};
+
+// Records |name| as a begin/end pair around the enclosing scope, if tracing
+// is enabled when it starts.
+class TraceScope {
+ public:
+  explicit TraceScope(const char* name);
+  ~TraceScope();
+
+  // Disallow copy and assign.
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  const char* name_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_PASTE_TRACER_H_
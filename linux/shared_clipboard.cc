@@ -0,0 +1,135 @@
+#include "shared_clipboard.h"
+
+#include <string>
+#include <utility>
+
+namespace flutter_paste_input {
+
+SharedClipboard* SharedClipboard::instance_ = nullptr;
+
+// static
+SharedClipboard* SharedClipboard::Acquire() {
+  if (instance_ == nullptr) {
+    instance_ = new SharedClipboard();
+  } else {
+    instance_->ref_count_++;
+  }
+  return instance_;
+}
+
+void SharedClipboard::Release() {
+  if (--ref_count_ > 0) {
+    return;
+  }
+  if (instance_ == this) {
+    instance_ = nullptr;
+  }
+  delete this;
+}
+
+SharedClipboard::SharedClipboard() {
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  budget_ = std::make_shared<MemoryBudget>();
+  stats_ = std::make_shared<PasteStats>();
+  GdkDisplay* display = gtk_clipboard_get_display(clipboard);
+  if (X11SelectionWatcher::IsSupported(display)) {
+    selection_watcher_ = std::make_unique<X11SelectionWatcher>(display);
+    selection_watcher_->Watch(GDK_SELECTION_PRIMARY);
+  }
+  monitor_ = std::make_unique<ClipboardMonitor>(
+      clipboard, ClipboardMonitor::kDefaultDebounceMs, selection_watcher_.get());
+  reader_ = std::make_unique<ClipboardReader>(clipboard, monitor_.get(), budget_, stats_);
+  writer_ = std::make_unique<ClipboardWriter>(clipboard);
+  history_ = std::make_unique<ClipboardHistory>();
+  ClipboardHistory* history = history_.get();
+  reader_->AddSnapshotListener(
+      [history](const SnapshotPtr& snapshot) { history->Record(*snapshot); });
+
+  trimmer_ = std::make_unique<MemoryTrimmer>();
+  ClipboardReader* reader = reader_.get();
+  trimmer_->AddCache(TrimLevel::kLow,
+                     [reader](TrimLevel level) { return reader->Trim(level); });
+  ClipboardWriter* writer = writer_.get();
+  trimmer_->AddCache(TrimLevel::kLow,
+                     [writer](TrimLevel level) { return writer->Trim(level); });
+  // The history cannot be rebuilt; it keeps everything at kLow.
+  trimmer_->AddCache(TrimLevel::kLow,
+                     [history](TrimLevel level) { return history->Trim(level); });
+  // Free pool buffers go after the caches, which return their own.
+  trimmer_->AddCache(TrimLevel::kLow,
+                     [](TrimLevel level) { return BufferPool::Get()->Trim(level); });
+
+  // Engines may outlive the application's main loop, so the clipboard is
+  // stored on shutdown rather than only when the last engine goes away.
+  application_ = g_application_get_default();
+  if (application_ != nullptr) {
+    g_object_ref(application_);
+    shutdown_handler_ = g_signal_connect_swapped(
+        application_, "shutdown", G_CALLBACK(OnApplicationShutdown), this);
+  }
+}
+
+// static
+void SharedClipboard::OnApplicationShutdown(SharedClipboard* self) {
+  self->writer_->Store();
+  self->DumpTrace();
+}
+
+void SharedClipboard::SetHistoryPersistent(bool persistent) {
+  if (persistent == (history_->store() != nullptr)) {
+    return;
+  }
+  if (!persistent) {
+    std::unique_ptr<HistoryStore> store = history_->DetachStore();
+    std::string directory = store->directory();
+    store.reset();
+    HistoryStore::Destroy(directory);
+    return;
+  }
+  // Open() warns if the directory cannot be used.
+  std::unique_ptr<HistoryStore> store = HistoryStore::Open(HistoryStore::DefaultDirectory());
+  if (store != nullptr) {
+    history_->AttachStore(std::move(store));
+  }
+}
+
+void SharedClipboard::SetTraceFile(const std::string& path) {
+  PasteTracer* tracer = PasteTracer::Get();
+  if (path.empty()) {
+    tracer->Stop();
+  } else if (!tracer->enabled()) {
+    tracer->Start();
+  }
+  trace_path_ = path;
+}
+
+void SharedClipboard::DumpTrace() {
+  if (trace_path_.empty()) {
+    return;
+  }
+  // Dump() warns if the file cannot be written.
+  PasteTracer::Get()->Dump(trace_path_);
+  trace_path_.clear();
+}
+
+SharedClipboard::~SharedClipboard() {
+  if (application_ != nullptr) {
+    g_signal_handler_disconnect(application_, shutdown_handler_);
+    g_object_unref(application_);
+  }
+  // Does nothing if the content was stored on shutdown already, as the
+  // clipboard manager owns it then.
+  writer_->Store();
+  DumpTrace();
+
+  // The trimmer calls into the reader, which keeps a pointer to the monitor
+  // and records into the history.
+  trimmer_.reset();
+  writer_.reset();
+  reader_.reset();
+  history_.reset();
+  monitor_.reset();
+  selection_watcher_.reset();
+}
+
+}  // namespace flutter_paste_input
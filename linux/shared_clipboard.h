@@ -0,0 +1,101 @@
+#ifndef FLUTTER_PLUGIN_SHARED_CLIPBOARD_H_
+#define FLUTTER_PLUGIN_SHARED_CLIPBOARD_H_
+
+#include <gtk/gtk.h>
+
+#include <memory>
+#include <string>
+
+#include "clipboard_history.h"
+#include "clipboard_monitor.h"
+#include "clipboard_reader.h"
+#include "clipboard_writer.h"
+#include "memory_budget.h"
+#include "memory_trimmer.h"
+#include "paste_stats.h"
+#include "paste_tracer.h"
+#include "x11_selection_watcher.h"
+
+namespace flutter_paste_input {
+
+// Clipboard state shared by every engine in the process.
+//
+// Multi-window apps register the plugin once per engine, but there is only
+// one system clipboard. All instances share one owner-change monitor and
+// one reader, so a paste is read and encoded once no matter how many
+// windows ask for it, and image encoding uses the GIO worker pool shared
+// by the process. Memory pressure trimming and the memory budget for
+// paste buffers are process-wide as well, and so are the history of
+// clipboard content read by any of them, the pipeline's timings and its
+// trace.
+//
+// Reference counted: each plugin instance holds one reference, and the
+// state is torn down when the last engine goes away. Content the app
+// copied is handed to the clipboard manager then, or when the application
+// shuts down, whichever comes first, and so is the trace written out.
+// Main thread only.
+class SharedClipboard {
+ public:
+  // Returns the process-wide instance, creating it if needed, with a new
+  // reference held by the caller.
+  static SharedClipboard* Acquire();
+
+  // Drops a reference obtained from Acquire().
+  void Release();
+
+  // Disallow copy and assign.
+  SharedClipboard(const SharedClipboard&) = delete;
+  SharedClipboard& operator=(const SharedClipboard&) = delete;
+
+  ClipboardMonitor* monitor() { return monitor_.get(); }
+  ClipboardReader* reader() { return reader_.get(); }
+  ClipboardWriter* writer() { return writer_.get(); }
+  ClipboardHistory* history() { return history_.get(); }
+  MemoryTrimmer* trimmer() { return trimmer_.get(); }
+  MemoryBudget* budget() { return budget_.get(); }
+  PasteStats* stats() { return stats_.get(); }
+
+  // Keeps the history on disk, in HistoryStore::DefaultDirectory(), or
+  // stops doing so and deletes the files.
+  void SetHistoryPersistent(bool persistent);
+
+  // Starts recording a PasteTracer trace, to be written to |path| at exit,
+  // or stops recording if |path| is empty. Recording already under way
+  // goes on.
+  void SetTraceFile(const std::string& path);
+
+  // Owner changes of CLIPBOARD and PRIMARY on X11; nullptr elsewhere.
+  X11SelectionWatcher* selection_watcher() { return selection_watcher_.get(); }
+
+ private:
+  SharedClipboard();
+  ~SharedClipboard();
+
+  static void OnApplicationShutdown(SharedClipboard* self);
+
+  // Writes the trace to |trace_path_|, once.
+  void DumpTrace();
+
+  static SharedClipboard* instance_;
+
+  int ref_count_ = 1;
+  std::shared_ptr<MemoryBudget> budget_;
+  std::shared_ptr<PasteStats> stats_;
+  std::unique_ptr<X11SelectionWatcher> selection_watcher_;
+  std::unique_ptr<ClipboardMonitor> monitor_;
+  std::unique_ptr<ClipboardReader> reader_;
+  std::unique_ptr<ClipboardWriter> writer_;
+  std::unique_ptr<ClipboardHistory> history_;
+  std::unique_ptr<MemoryTrimmer> trimmer_;
+
+  // The default GApplication, if any, whose shutdown stores the clipboard.
+  GApplication* application_ = nullptr;
+  gulong shutdown_handler_ = 0;
+
+  // Where the trace is written at exit; empty if not tracing.
+  std::string trace_path_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_SHARED_CLIPBOARD_H_
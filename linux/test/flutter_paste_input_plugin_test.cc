@@ -1,9 +1,37 @@
 #include <flutter_linux/flutter_linux.h>
 #include <gmock/gmock.h>
+#include <glib/gstdio.h>
 #include <gtest/gtest.h>
 
+#ifdef GDK_WINDOWING_X11
+#include <gdk/gdkx.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
 #include "include/flutter_paste_input/flutter_paste_input_plugin.h"
+#include "buffer_pool.h"
+#include "clipboard_history.h"
+#include "clipboard_monitor.h"
+#include "clipboard_reader.h"
+#include "clipboard_writer.h"
+#include "content_hash.h"
 #include "flutter_paste_input_plugin_private.h"
+#include "history_store.h"
+#include "latency_histogram.h"
+#include "memory_budget.h"
+#include "memory_trimmer.h"
+#include "paste_event_dispatcher.h"
+#include "paste_stats.h"
+#include "paste_tracer.h"
+#include "tile_pool.h"
+#include "x11_selection_reader.h"
+#include "x11_selection_watcher.h"
 
 // This demonstrates a simple unit test of the C portion of this plugin's
 // implementation.
@@ -16,6 +44,178 @@
 namespace flutter_paste_input {
 namespace test {
 
+// Runs the default main context until |done| returns true or |timeout_ms|
+// pass. Returns what |done| returns last.
+bool RunMainLoopUntil(const std::function<bool()>& done, guint timeout_ms = 5000) {
+  gint64 deadline = g_get_monotonic_time() + static_cast<gint64>(timeout_ms) * 1000;
+  while (!done() && g_get_monotonic_time() < deadline) {
+    g_main_context_iteration(nullptr, FALSE);
+  }
+  return done();
+}
+
+// Owns the clipboard with |text| and waits until |monitor| counted it.
+bool SetClipboardText(const ClipboardMonitor& monitor, const char* text) {
+  int64_t change_count = monitor.change_count();
+  gtk_clipboard_set_text(gtk_clipboard_get(GDK_SELECTION_CLIPBOARD), text, -1);
+  return RunMainLoopUntil([&monitor, change_count] {
+    return monitor.settled() && monitor.change_count() > change_count;
+  });
+}
+
+void GetOwnerText(GtkClipboard* clipboard, GtkSelectionData* selection,
+                  guint info, gpointer owner) {
+  gtk_selection_data_set_text(
+      selection, static_cast<const char*>(g_object_get_data(G_OBJECT(owner), "text")),
+      -1);
+}
+
+// Owns the clipboard with |text| on behalf of |owner|, without waiting.
+void SetClipboardTextFromOwner(GObject* owner, const char* text) {
+  static const GtkTargetEntry kTargets[] = {
+      {const_cast<gchar*>("UTF8_STRING"), 0, 0},
+      {const_cast<gchar*>("text/plain;charset=utf-8"), 0, 0},
+  };
+  g_object_set_data_full(owner, "text", g_strdup(text), g_free);
+  gtk_clipboard_set_with_owner(gtk_clipboard_get(GDK_SELECTION_CLIPBOARD), kTargets,
+                               G_N_ELEMENTS(kTargets), GetOwnerText, nullptr, owner);
+}
+
+std::string SnapshotText(const SnapshotPtr& snapshot) {
+  if (!snapshot || snapshot->items.empty()) {
+    return std::string();
+  }
+  const PooledBuffer& data = snapshot->items[0].data;
+  return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+#ifdef GDK_WINDOWING_X11
+// Owns a private selection on its own window and serves UTF8_STRING in
+// INCR chunks, announcing |announced_bytes| up front like owners that only
+// know a lower bound. Other targets are refused. With |stall_after_bytes|
+// set, it stops sending once that much was sent.
+class IncrSelectionOwner {
+ public:
+  IncrSelectionOwner(GdkDisplay* display, size_t total_bytes, size_t chunk_bytes,
+                     long announced_bytes, size_t stall_after_bytes = 0)
+      : display_(display),
+        data_(total_bytes, 'x'),
+        chunk_bytes_(chunk_bytes),
+        announced_bytes_(announced_bytes),
+        stall_after_bytes_(stall_after_bytes) {
+    Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+    window_ = XCreateSimpleWindow(xdisplay, DefaultRootWindow(xdisplay), 0, 0, 1, 1,
+                                  0, 0, 0);
+    selection_ = gdk_atom_intern_static_string("_FLUTTER_PASTE_INPUT_TEST_SELECTION");
+    XSetSelectionOwner(xdisplay, gdk_x11_atom_to_xatom_for_display(display_, selection_),
+                       window_, CurrentTime);
+    XFlush(xdisplay);
+    gdk_window_add_filter(nullptr, OnEvent, this);
+  }
+
+  ~IncrSelectionOwner() {
+    gdk_window_remove_filter(nullptr, OnEvent, this);
+    Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+    XDestroyWindow(xdisplay, window_);
+    XFlush(xdisplay);
+  }
+
+  // Disallow copy and assign.
+  IncrSelectionOwner(const IncrSelectionOwner&) = delete;
+  IncrSelectionOwner& operator=(const IncrSelectionOwner&) = delete;
+
+  GdkAtom selection() const { return selection_; }
+  const std::string& data() const { return data_; }
+  size_t sent_bytes() const { return sent_bytes_; }
+
+  // True once a transfer started and its requestor window was destroyed.
+  bool RequestorGone() const {
+    if (requestor_ == None) {
+      return false;
+    }
+    XWindowAttributes attributes;
+    gdk_x11_display_error_trap_push(display_);
+    XGetWindowAttributes(gdk_x11_display_get_xdisplay(display_), requestor_, &attributes);
+    return gdk_x11_display_error_trap_pop(display_) != 0;
+  }
+
+ private:
+  static GdkFilterReturn OnEvent(GdkXEvent* xevent, GdkEvent* event, gpointer data) {
+    IncrSelectionOwner* self = static_cast<IncrSelectionOwner*>(data);
+    XEvent* x_event = static_cast<XEvent*>(xevent);
+    if (x_event->type == SelectionRequest && x_event->xselectionrequest.owner == self->window_) {
+      self->HandleRequest(x_event->xselectionrequest);
+      return GDK_FILTER_REMOVE;
+    }
+    // The requestor sees the same event; it only acts on new values.
+    if (x_event->type == PropertyNotify && x_event->xproperty.window == self->requestor_ &&
+        x_event->xproperty.atom == self->property_ &&
+        x_event->xproperty.state == PropertyDelete) {
+      self->SendChunk();
+    }
+    return GDK_FILTER_CONTINUE;
+  }
+
+  void HandleRequest(const XSelectionRequestEvent& request) {
+    Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+    XSelectionEvent reply = {};
+    reply.type = SelectionNotify;
+    reply.requestor = request.requestor;
+    reply.selection = request.selection;
+    reply.target = request.target;
+    reply.time = request.time;
+    reply.property = None;
+    gdk_x11_display_error_trap_push(display_);
+    if (request.target == gdk_x11_get_xatom_by_name_for_display(display_, "UTF8_STRING")) {
+      requestor_ = request.requestor;
+      property_ = request.property;
+      XSelectInput(xdisplay, requestor_, PropertyChangeMask);
+      XChangeProperty(xdisplay, requestor_, property_,
+                      gdk_x11_get_xatom_by_name_for_display(display_, "INCR"), 32,
+                      PropModeReplace, reinterpret_cast<unsigned char*>(&announced_bytes_),
+                      1);
+      reply.property = property_;
+    }
+    XSendEvent(xdisplay, request.requestor, False, NoEventMask,
+               reinterpret_cast<XEvent*>(&reply));
+    XFlush(xdisplay);
+    gdk_x11_display_error_trap_pop_ignored(display_);
+  }
+
+  // Answers a deleted property with the next chunk, or with an empty one
+  // once everything was sent.
+  void SendChunk() {
+    if (finished_ || (stall_after_bytes_ != 0 && sent_bytes_ >= stall_after_bytes_)) {
+      return;
+    }
+    size_t size = std::min(chunk_bytes_, data_.size() - sent_bytes_);
+    finished_ = size == 0;
+    Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+    gdk_x11_display_error_trap_push(display_);
+    XChangeProperty(xdisplay, requestor_, property_,
+                    gdk_x11_get_xatom_by_name_for_display(display_, "UTF8_STRING"), 8,
+                    PropModeReplace,
+                    reinterpret_cast<const unsigned char*>(data_.data() + sent_bytes_),
+                    static_cast<int>(size));
+    XFlush(xdisplay);
+    gdk_x11_display_error_trap_pop_ignored(display_);
+    sent_bytes_ += size;
+  }
+
+  GdkDisplay* display_;
+  std::string data_;
+  size_t chunk_bytes_;
+  long announced_bytes_;
+  size_t stall_after_bytes_;
+  GdkAtom selection_;
+  Window window_ = None;
+  Window requestor_ = None;
+  Atom property_ = None;
+  size_t sent_bytes_ = 0;
+  bool finished_ = false;
+};
+#endif  // GDK_WINDOWING_X11
+
 TEST(FlutterPasteInputPlugin, GetPlatformVersion) {
   g_autoptr(FlMethodResponse) response = get_platform_version();
   ASSERT_NE(response, nullptr);
@@ -27,5 +227,921 @@ TEST(FlutterPasteInputPlugin, GetPlatformVersion) {
   EXPECT_THAT(fl_value_get_string(result), testing::StartsWith("Linux "));
 }
 
+TEST(BufferPool, GrowsAndReusesBlocks) {
+  std::vector<uint8_t> chunk(48 * 1024, 0xab);
+  const uint8_t* first_block = nullptr;
+  {
+    PooledBuffer buffer;
+    ASSERT_TRUE(buffer.Append(chunk.data(), chunk.size()));
+    ASSERT_TRUE(buffer.Append(chunk.data(), chunk.size()));
+    EXPECT_EQ(buffer.size(), 2 * chunk.size());
+    EXPECT_GE(buffer.capacity(), buffer.size());
+    EXPECT_EQ(buffer.data()[buffer.size() - 1], 0xab);
+    first_block = buffer.data();
+  }
+
+  // The same class is served from the free list.
+  PooledBuffer reused;
+  ASSERT_TRUE(reused.Assign(chunk.data(), 2 * 1024));
+  PooledBuffer grown;
+  ASSERT_TRUE(grown.Append(chunk.data(), chunk.size()));
+  ASSERT_TRUE(grown.Append(chunk.data(), chunk.size()));
+  EXPECT_EQ(grown.data(), first_block);
+}
+
+TEST(BufferPool, KeepsSmallBuffersAtExactSize) {
+  std::vector<uint8_t> chunk(3000, 0xcd);
+  PooledBuffer buffer;
+  ASSERT_TRUE(buffer.Assign(chunk.data(), chunk.size()));
+  EXPECT_EQ(buffer.capacity(), chunk.size());
+
+  // Streamed appends grow geometrically; shrinking drops the slack.
+  ASSERT_TRUE(buffer.Append(chunk.data(), 100));
+  EXPECT_GT(buffer.capacity(), buffer.size());
+  ASSERT_TRUE(buffer.ShrinkToFit());
+  EXPECT_EQ(buffer.capacity(), chunk.size() + 100);
+  EXPECT_EQ(buffer.data()[buffer.size() - 1], 0xcd);
+
+  // Content of a pool class keeps its block.
+  std::vector<uint8_t> large(BufferPool::kMinClassBytes + 1, 0xcd);
+  ASSERT_TRUE(buffer.Assign(large.data(), large.size()));
+  const uint8_t* block = buffer.data();
+  ASSERT_TRUE(buffer.ShrinkToFit());
+  EXPECT_EQ(buffer.data(), block);
+}
+
+TEST(ClipboardMonitor, MimeTypesFromTargets) {
+  std::vector<std::string> mime_types = ClipboardMonitor::MimeTypesFromTargets(
+      {"TARGETS", "TIMESTAMP", "UTF8_STRING", "image/png",
+       "text/plain;charset=utf-8", "image/png"},
+      true);
+  EXPECT_THAT(mime_types, testing::ElementsAre("text/plain", "image/png"));
+}
+
+TEST(ClipboardMonitor, MimeTypesFromTargetsWithoutText) {
+  std::vector<std::string> mime_types =
+      ClipboardMonitor::MimeTypesFromTargets({"TARGETS", "image/jpeg"}, false);
+  EXPECT_THAT(mime_types, testing::ElementsAre("image/jpeg"));
+}
+
+TEST(ContentHash, DistinguishesContent) {
+  EXPECT_EQ(HashString("hello"), HashString("hello"));
+  EXPECT_NE(HashString("hello"), HashString("hellp"));
+  EXPECT_NE(HashString(""), HashString(std::string(1, '\0')));
+  EXPECT_NE(HashString("b", HashString("a")), HashString("ab"));
+}
+
+TEST(ClipboardHistory, DeduplicatesAndCompressesText) {
+  auto text_snapshot = [](const std::string& text) {
+    ClipboardSnapshot snapshot;
+    SnapshotItem item;
+    item.data.Assign(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    item.mime_type = "text/plain";
+    snapshot.items.push_back(std::move(item));
+    return snapshot;
+  };
+  std::string long_text(4096, 'a');
+  ClipboardHistory history(2, 0);
+
+  int64_t first = history.Record(text_snapshot(long_text));
+  int64_t second = history.Record(text_snapshot("short"));
+  EXPECT_NE(first, 0);
+  EXPECT_LT(history.stored_bytes(), long_text.size());
+  EXPECT_EQ(history.Record(text_snapshot(long_text)), first);
+  ASSERT_EQ(history.size(), 2u);
+  EXPECT_EQ(history.List()[0].id, first);
+  EXPECT_EQ(history.List()[0].byte_size, long_text.size());
+
+  SnapshotPtr restored = history.Fetch(first);
+  ASSERT_TRUE(restored);
+  ASSERT_EQ(restored->items.size(), 1u);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(restored->items[0].data.data()),
+                        restored->items[0].data.size()),
+            long_text);
+
+  // The least recently captured entry makes room.
+  history.Record(text_snapshot("third"));
+  EXPECT_FALSE(history.Fetch(second));
+  EXPECT_TRUE(history.Fetch(first));
+}
+
+TEST(ClipboardHistory, PersistsAcrossRestarts) {
+  g_autofree gchar* directory = g_dir_make_tmp("paste-history-XXXXXX", nullptr);
+  ASSERT_NE(directory, nullptr);
+  std::string text(1024, 'b');
+  int64_t id = 0;
+  {
+    ClipboardHistory history;
+    history.AttachStore(HistoryStore::Open(directory));
+    ASSERT_NE(history.store(), nullptr);
+    ClipboardSnapshot snapshot;
+    SnapshotItem item;
+    item.data.Assign(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    item.mime_type = "text/plain";
+    snapshot.items.push_back(std::move(item));
+    id = history.Record(snapshot);
+    ASSERT_NE(id, 0);
+    // Destroying the store commits the queued entry.
+  }
+
+  ClipboardHistory history;
+  history.AttachStore(HistoryStore::Open(directory));
+  ASSERT_EQ(history.size(), 1u);
+  EXPECT_EQ(history.List()[0].id, id);
+  EXPECT_EQ(history.stored_bytes(), 0u);
+  SnapshotPtr restored = history.Fetch(id);
+  ASSERT_TRUE(restored);
+  ASSERT_EQ(restored->items.size(), 1u);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(restored->items[0].data.data()),
+                        restored->items[0].data.size()),
+            text);
+
+  history.DetachStore();
+  EXPECT_EQ(history.size(), 0u);
+  HistoryStore::Destroy(directory);
+}
+
+TEST(HistoryStore, CommitsRemovalsAndTouches) {
+  g_autofree gchar* directory = g_dir_make_tmp("paste-history-XXXXXX", nullptr);
+  ASSERT_NE(directory, nullptr);
+  const uint8_t payload[] = {1, 2, 3, 4};
+  {
+    std::unique_ptr<HistoryStore> store = HistoryStore::Open(directory);
+    ASSERT_NE(store, nullptr);
+    for (int64_t id : {1, 2}) {
+      HistoryStore::Record record;
+      record.id = id;
+      PooledBuffer buffer;
+      ASSERT_TRUE(buffer.Assign(payload, sizeof(payload)));
+      store->Append(std::move(record), std::move(buffer));
+    }
+  }
+  {
+    std::unique_ptr<HistoryStore> store = HistoryStore::Open(directory);
+    ASSERT_NE(store, nullptr);
+    store->Remove(1);
+    store->Touch(2, 42);
+    // Destroying the store syncs the updated index.
+  }
+
+  std::unique_ptr<HistoryStore> store = HistoryStore::Open(directory);
+  ASSERT_NE(store, nullptr);
+  std::vector<HistoryStore::Record> records = store->Records();
+  ASSERT_EQ(records.size(), 1u);
+  EXPECT_EQ(records[0].id, 2);
+  EXPECT_EQ(records[0].captured_at_ms, 42);
+  store.reset();
+  HistoryStore::Destroy(directory);
+}
+
+TEST(ClipboardHistory, SearchesTextWithTrigramIndex) {
+  auto text_snapshot = [](const std::string& text) {
+    ClipboardSnapshot snapshot;
+    SnapshotItem item;
+    item.data.Assign(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    item.mime_type = "text/plain";
+    snapshot.items.push_back(std::move(item));
+    return snapshot;
+  };
+  ClipboardHistory history;
+  int64_t once = history.Record(text_snapshot("caf\xc3\xa9 Paste here"));
+  int64_t twice = history.Record(text_snapshot(std::string(1024, 'x') + " paste, PASTE"));
+  history.Record(text_snapshot("nothing to see"));
+
+  std::vector<HistorySearchMatch> matches = history.Search("paste", 10);
+  ASSERT_EQ(matches.size(), 2u);
+  EXPECT_EQ(matches[0].id, twice);
+  EXPECT_EQ(matches[0].match_count, 2u);
+  EXPECT_EQ(matches[1].id, once);
+  // "\xc3\xa9" is two bytes of UTF-8 but one UTF-16 code unit.
+  ASSERT_EQ(matches[1].spans.size(), 1u);
+  EXPECT_EQ(matches[1].spans[0], std::make_pair(size_t{5}, size_t{10}));
+
+  EXPECT_EQ(history.Search("here paste", 10).size(), 1u);
+  EXPECT_TRUE(history.Search("pasta", 10).empty());
+}
+
+TEST(TilePool, StoresChangedTilesOnly) {
+  GdkPixbuf* first = gdk_pixbuf_new(GDK_COLORSPACE_RGB, TRUE, 8, 300, 200);
+  gdk_pixbuf_fill(first, 0x336699ff);
+  GdkPixbuf* second = gdk_pixbuf_copy(first);
+  // Changes a pixel of the last tile, which is 44 x 8 pixels.
+  guchar* pixels = gdk_pixbuf_get_pixels(second);
+  pixels[199 * gdk_pixbuf_get_rowstride(second) + 299 * 4] = 0;
+
+  TilePool pool;
+  TilePool::Map first_map;
+  TilePool::Map second_map;
+  ASSERT_TRUE(pool.AddImage(first, &first_map));
+  size_t tiles = pool.size();
+  ASSERT_TRUE(pool.AddImage(second, &second_map));
+  EXPECT_EQ(first_map.tiles.size(), 20u);
+  EXPECT_EQ(pool.size(), tiles + 1);
+  // Deflated tiles of a flat image take a few bytes each, not a pool block.
+  EXPECT_LT(pool.stored_bytes(), BufferPool::kMinClassBytes);
+
+  GdkPixbuf* restored = TilePool::Assemble(
+      second_map, [&pool](uint64_t hash, PooledBuffer* blob) { return pool.Lookup(hash, blob); });
+  ASSERT_NE(restored, nullptr);
+  for (int y = 0; y < 200; y++) {
+    EXPECT_EQ(memcmp(gdk_pixbuf_get_pixels(restored) + y * gdk_pixbuf_get_rowstride(restored),
+                     pixels + y * gdk_pixbuf_get_rowstride(second), 300 * 4),
+              0);
+  }
+
+  // The first image's corner tile is the only one not shared.
+  pool.Release(first_map);
+  EXPECT_EQ(pool.size(), tiles);
+  pool.Release(second_map);
+  EXPECT_EQ(pool.size(), 0u);
+  EXPECT_EQ(pool.stored_bytes(), 0u);
+  g_object_unref(restored);
+  g_object_unref(second);
+  g_object_unref(first);
+}
+
+TEST(PasteEventDispatcher, KeepsOnlyNewestQueuedSnapshot) {
+  std::vector<SnapshotPtr> sent;
+  PasteEventDispatcher dispatcher(
+      [&sent](SnapshotPtr snapshot) { sent.push_back(snapshot); });
+
+  auto first = std::make_shared<ClipboardSnapshot>();
+  auto stale = std::make_shared<ClipboardSnapshot>();
+  auto newest = std::make_shared<ClipboardSnapshot>();
+  dispatcher.Post(first);
+  dispatcher.Post(stale);
+  dispatcher.Post(newest);
+  EXPECT_EQ(sent.size(), 1u);
+  EXPECT_TRUE(dispatcher.has_queued());
+
+  dispatcher.Acknowledge();
+  ASSERT_EQ(sent.size(), 2u);
+  EXPECT_EQ(sent[0], first);
+  EXPECT_EQ(sent[1], newest);
+  EXPECT_FALSE(dispatcher.has_queued());
+
+  dispatcher.Acknowledge();
+  EXPECT_EQ(dispatcher.outstanding(), 0u);
+}
+
+TEST(PasteStats, AggregatesStageTimings) {
+  PasteStats stats;
+  stats.RecordElapsed(PasteStage::kEncode, PasteContentClass::kLargeImage, 300, 4000, 900);
+  stats.RecordElapsed(PasteStage::kEncode, PasteContentClass::kSmallImage, 100, 2000, 500);
+  stats.RecordElapsed(PasteStage::kDart, PasteContentClass::kText, -5, 900, 0);
+
+  PasteStageTotals encode = stats.Totals(PasteStage::kEncode);
+  EXPECT_EQ(encode.count, 2u);
+  EXPECT_EQ(encode.total_us, 400u);
+  EXPECT_EQ(encode.max_us, 300u);
+  EXPECT_EQ(encode.bytes_in, 6000u);
+  EXPECT_EQ(encode.bytes_out, 1400u);
+  // A clock going backwards counts as no time.
+  EXPECT_EQ(stats.Totals(PasteStage::kDart).total_us, 0u);
+  EXPECT_EQ(stats.Totals(PasteStage::kSelection).count, 0u);
+  EXPECT_STREQ(PasteStageName(PasteStage::kSerialize), "serialize");
+
+  EXPECT_EQ(stats.Latencies(PasteStage::kEncode, PasteContentClass::kLargeImage).Max(), 300u);
+
+  stats.Reset();
+  EXPECT_EQ(stats.Totals(PasteStage::kEncode).count, 0u);
+  EXPECT_EQ(stats.Totals(PasteStage::kEncode).max_us, 0u);
+  EXPECT_EQ(stats.Latencies(PasteStage::kEncode, PasteContentClass::kLargeImage).Count(), 0u);
+}
+
+TEST(LatencyHistogram, ReportsPercentilesWithinBucketPrecision) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Percentile(99), 0u);
+  for (uint64_t value = 1; value <= 1000; value++) {
+    histogram.Record(value * 100);
+  }
+  EXPECT_EQ(histogram.Count(), 1000u);
+  EXPECT_EQ(histogram.Max(), 100000u);
+  uint64_t p50 = histogram.Percentile(50);
+  uint64_t p99 = histogram.Percentile(99);
+  EXPECT_GE(p50, 50000u);
+  EXPECT_LE(p50, 50000u + 50000u / LatencyHistogram::kSubBuckets);
+  EXPECT_GE(p99, 99000u);
+  EXPECT_LE(p99, 100000u);
+  EXPECT_EQ(histogram.Percentile(100), 100000u);
+
+  // Every value maps to a bucket whose range holds it.
+  for (uint64_t value : {0ull, 15ull, 16ull, 1000ull, 123456789ull}) {
+    size_t index = LatencyHistogram::BucketIndex(value);
+    EXPECT_GE(LatencyHistogram::BucketHighestValue(index), value);
+    EXPECT_TRUE(index == 0 || LatencyHistogram::BucketHighestValue(index - 1) < value);
+  }
+
+  histogram.Reset();
+  EXPECT_EQ(histogram.Count(), 0u);
+  EXPECT_EQ(histogram.Max(), 0u);
+  histogram.Record(7);
+  EXPECT_EQ(histogram.Percentile(50), 7u);
+  EXPECT_EQ(histogram.Max(), 7u);
+}
+
+TEST(PasteTracer, DumpsChromeTraceJson) {
+  PasteTracer* tracer = PasteTracer::Get();
+  tracer->Instant("before-start");
+  tracer->Start();
+  {
+    TraceScope scope("decode");
+    tracer->AsyncBegin("selection", 0x2a);
+  }
+  std::thread worker([] { TraceScope scope("encode"); });
+  worker.join();
+  tracer->AsyncEnd("selection", 0x2a);
+  tracer->Stop();
+  tracer->Instant("after-stop");
+
+  g_autofree gchar* directory = g_dir_make_tmp("paste-trace-XXXXXX", nullptr);
+  ASSERT_NE(directory, nullptr);
+  g_autofree gchar* path = g_build_filename(directory, "trace.json", nullptr);
+  EXPECT_EQ(tracer->Dump(path), 6);
+
+  g_autofree gchar* contents = nullptr;
+  ASSERT_TRUE(g_file_get_contents(path, &contents, nullptr, nullptr));
+  std::string json(contents);
+  EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+  EXPECT_NE(json.find("\"name\":\"decode\",\"cat\":\"flutter_paste_input\",\"ph\":\"B\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"encode\",\"cat\":\"flutter_paste_input\",\"ph\":\"E\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"e\""), std::string::npos);
+  EXPECT_NE(json.find("\"id\":\"0x2a\""), std::string::npos);
+  EXPECT_EQ(json.find("before-start"), std::string::npos);
+  EXPECT_EQ(json.find("after-stop"), std::string::npos);
+  EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+
+  g_remove(path);
+  g_rmdir(directory);
+}
+
+TEST(PasteTracer, ReusesFullBuffersForTheNextTrace) {
+  PasteTracer* tracer = PasteTracer::Get();
+  tracer->Start();
+  for (size_t i = 0; i <= PasteTracer::kChunkEvents * PasteTracer::kMaxChunks; i++) {
+    tracer->Instant("filler");
+  }
+  tracer->Stop();
+  tracer->End("after-stop");
+  tracer->Start();
+  tracer->Instant("fresh");
+  tracer->Stop();
+
+  g_autofree gchar* directory = g_dir_make_tmp("paste-trace-XXXXXX", nullptr);
+  ASSERT_NE(directory, nullptr);
+  g_autofree gchar* path = g_build_filename(directory, "trace.json", nullptr);
+  EXPECT_EQ(tracer->Dump(path), 1);
+
+  g_autofree gchar* contents = nullptr;
+  ASSERT_TRUE(g_file_get_contents(path, &contents, nullptr, nullptr));
+  std::string json(contents);
+  EXPECT_NE(json.find("\"name\":\"fresh\""), std::string::npos);
+  EXPECT_EQ(json.find("after-stop"), std::string::npos);
+
+  g_remove(path);
+  g_rmdir(directory);
+}
+
+TEST(MemoryBudget, ReservesWithinLimit) {
+  MemoryBudget budget(1000);
+  EXPECT_TRUE(budget.TryReserve(600));
+  EXPECT_FALSE(budget.TryReserve(600));
+  EXPECT_FALSE(budget.Fits(1001));
+  budget.Release(600);
+  EXPECT_TRUE(budget.TryReserve(600));
+  budget.Reserve(600);
+  EXPECT_EQ(budget.in_use(), 1200u);
+  EXPECT_EQ(budget.peak_in_use(), 1200u);
+}
+
+TEST(MemoryBudget, CancelledWaiterFreesItsPlaceInLine) {
+  auto budget = std::make_shared<MemoryBudget>(1000);
+  ASSERT_TRUE(budget->TryReserve(800));
+  std::vector<std::string> admitted;
+  uint64_t large = budget->WaitFor(900, MemoryBudget::kDefaultWaitTimeoutMs,
+                                   [&admitted](bool ok) { admitted.push_back("large"); });
+  budget->WaitFor(100, MemoryBudget::kDefaultWaitTimeoutMs,
+                  [&admitted](bool ok) { admitted.push_back(ok ? "small" : "timeout"); });
+  EXPECT_NE(large, 0u);
+
+  budget->CancelWait(large);
+  budget->CancelWait(large);
+  while (g_main_context_iteration(nullptr, FALSE)) {
+  }
+  EXPECT_THAT(admitted, testing::ElementsAre("small"));
+  EXPECT_EQ(budget->in_use(), 900u);
+}
+
+TEST(MemoryBudget, FitsDownscaledImage) {
+  size_t source_bytes = 4000 * 3000 * 4;
+  int width = 4000;
+  int height = 3000;
+  size_t limit_bytes = 2 * source_bytes;
+  ASSERT_TRUE(FitImageToBudget(limit_bytes, source_bytes, &width, &height));
+  EXPECT_LT(width, 4000);
+  EXPECT_NEAR(static_cast<double>(width) / height, 4.0 / 3.0, 0.01);
+  size_t target_bytes = static_cast<size_t>(width) * height * 4;
+  EXPECT_LE(EncodeWorkingSetBytes(source_bytes, target_bytes), limit_bytes);
+
+  EXPECT_FALSE(FitImageToBudget(source_bytes, source_bytes, &width, &height));
+}
+
+TEST(MemoryTrimmer, TrimsCachesUpToLevelInOrder) {
+  MemoryTrimmer trimmer;
+  std::vector<std::string> trimmed;
+  trimmer.AddCache(TrimLevel::kMedium, [&trimmed](TrimLevel level) {
+    trimmed.push_back("medium");
+    return size_t{200};
+  });
+  trimmer.AddCache(TrimLevel::kLow, [&trimmed](TrimLevel level) {
+    trimmed.push_back("low");
+    return size_t{100};
+  });
+  int critical = trimmer.AddCache(TrimLevel::kCritical, [&trimmed](TrimLevel level) {
+    trimmed.push_back("critical");
+    return size_t{400};
+  });
+
+  EXPECT_EQ(trimmer.Trim(TrimLevel::kLow), 100u);
+  EXPECT_EQ(trimmer.Trim(TrimLevel::kMedium), 300u);
+  trimmer.RemoveCache(critical);
+  EXPECT_EQ(trimmer.Trim(TrimLevel::kCritical), 300u);
+  EXPECT_THAT(trimmed, testing::ElementsAre("low", "low", "medium", "low", "medium"));
+}
+
+// Needs a display, e.g. run under xvfb-run.
+TEST(ClipboardWriter, RendersFormatsOnDemand) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+
+  GdkPixbuf* pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, TRUE, 8, 4, 4);
+  gdk_pixbuf_fill(pixbuf, 0xff0000ff);
+  WriteContent content;
+  ASSERT_TRUE(EncodePixbuf(pixbuf, "png", &content.image));
+  g_object_unref(pixbuf);
+  content.image_mime_type = "image/png";
+  content.rendered_image_types = {"image/bmp"};
+
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  ClipboardWriter writer(clipboard);
+  std::string error_code;
+  std::string error_message;
+  ASSERT_TRUE(writer.Set(std::move(content), &error_code, &error_message));
+  EXPECT_TRUE(writer.owns_clipboard());
+  // Nothing has been rendered yet.
+  EXPECT_EQ(writer.Trim(TrimLevel::kCritical), 0u);
+
+  GtkSelectionData* bmp = gtk_clipboard_wait_for_contents(
+      clipboard, gdk_atom_intern_static_string("image/bmp"));
+  ASSERT_NE(bmp, nullptr);
+  ASSERT_GT(gtk_selection_data_get_length(bmp), 2);
+  EXPECT_EQ(memcmp(gtk_selection_data_get_data(bmp), "BM", 2), 0);
+  gtk_selection_data_free(bmp);
+  EXPECT_GT(writer.Trim(TrimLevel::kMedium), 0u);
+
+  WriteContent text;
+  text.has_text = true;
+  text.text = "text";
+  ASSERT_TRUE(writer.Set(std::move(text), &error_code, &error_message));
+  WriteContent empty;
+  EXPECT_FALSE(writer.Set(std::move(empty), &error_code, &error_message));
+  EXPECT_EQ(error_code, "invalid-argument");
+}
+
+// Needs a display, e.g. run under xvfb-run.
+TEST(ClipboardWriter, StoresFormatsWithinSizeLimit) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+
+  GdkPixbuf* pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, FALSE, 8, 64, 64);
+  gdk_pixbuf_fill(pixbuf, 0x336699ff);
+  WriteContent content;
+  ASSERT_TRUE(EncodePixbuf(pixbuf, "png", &content.image));
+  g_object_unref(pixbuf);
+  content.has_text = true;
+  content.text = "caption";
+  content.image_mime_type = "image/png";
+  // An uncompressed 64x64 BMP is well above the limit set below.
+  content.rendered_image_types = {"image/bmp"};
+  size_t source_bytes = content.text.size() + content.image.size();
+
+  ClipboardWriter writer(gtk_clipboard_get(GDK_SELECTION_CLIPBOARD));
+  std::string error_code;
+  std::string error_message;
+  ASSERT_TRUE(writer.Set(std::move(content), &error_code, &error_message));
+  writer.set_max_store_bytes(source_bytes + 1024);
+  EXPECT_EQ(writer.Store(), source_bytes);
+
+  writer.set_max_store_bytes(0);
+  EXPECT_GT(writer.Store(), source_bytes + 64 * 64 * 3);
+}
+
+// Needs a display, e.g. run under xvfb-run.
+TEST(ClipboardWriter, StoresRenditionSmallerThanOversizedOriginal) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+
+  // A flat 256x256 image: about 192 KiB as BMP, a few hundred bytes as PNG.
+  GdkPixbuf* pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, FALSE, 8, 256, 256);
+  gdk_pixbuf_fill(pixbuf, 0x336699ff);
+  WriteContent content;
+  ASSERT_TRUE(EncodePixbuf(pixbuf, "bmp", &content.image));
+  g_object_unref(pixbuf);
+  content.image_mime_type = "image/bmp";
+  content.rendered_image_types = {"image/png"};
+
+  ClipboardWriter writer(gtk_clipboard_get(GDK_SELECTION_CLIPBOARD));
+  std::string error_code;
+  std::string error_message;
+  ASSERT_TRUE(writer.Set(std::move(content), &error_code, &error_message));
+  writer.set_max_store_bytes(16 * 1024);
+  size_t stored = writer.Store();
+  EXPECT_GT(stored, 0u);
+  EXPECT_LE(stored, 16u * 1024);
+}
+
+// The ClipboardReader tests own the clipboard themselves, like the
+// ClipboardWriter tests, and need a display, e.g. run under xvfb-run.
+TEST(ClipboardReader, CoalescesConcurrentAndWindowedReads) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  ClipboardMonitor monitor(clipboard, 0);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  ASSERT_TRUE(SetClipboardText(monitor, "coalesced"));
+
+  ClipboardReader reader(clipboard, &monitor, std::make_shared<MemoryBudget>(),
+                         std::make_shared<PasteStats>());
+  reader.set_coalesce_window_ms(60000);
+  int served = 0;
+  reader.AddSnapshotListener([&served](const SnapshotPtr&) { served++; });
+
+  SnapshotPtr first;
+  SnapshotPtr second;
+  ASSERT_TRUE(reader.Read(1, [&first](SnapshotPtr snapshot) { first = snapshot; }));
+  ASSERT_TRUE(reader.Read(2, [&second](SnapshotPtr snapshot) { second = snapshot; }));
+  // Nothing is cached yet, so both wait on the same read.
+  EXPECT_EQ(first, nullptr);
+  ASSERT_TRUE(RunMainLoopUntil([&] { return first && second; }));
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(SnapshotText(first), "coalesced");
+
+  // Within the window the snapshot is served synchronously.
+  SnapshotPtr third;
+  ASSERT_TRUE(reader.Read(3, [&third](SnapshotPtr snapshot) { third = snapshot; }));
+  EXPECT_EQ(third, first);
+  EXPECT_EQ(served, 1);
+}
+
+TEST(ClipboardReader, RejectsReadsBeyondMaxPendingReads) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  ClipboardMonitor monitor(clipboard, 0);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  ASSERT_TRUE(SetClipboardText(monitor, "backlog"));
+
+  ClipboardReader reader(clipboard, &monitor, std::make_shared<MemoryBudget>(),
+                         std::make_shared<PasteStats>());
+  reader.set_max_pending_reads(2);
+  int delivered = 0;
+  bool rejected_called = false;
+  EXPECT_TRUE(reader.Read(1, [&delivered](SnapshotPtr) { delivered++; }));
+  EXPECT_TRUE(reader.Read(2, [&delivered](SnapshotPtr) { delivered++; }));
+  EXPECT_FALSE(reader.Read(3, [&rejected_called](SnapshotPtr) { rejected_called = true; }));
+
+  ASSERT_TRUE(RunMainLoopUntil([&delivered] { return delivered == 2; }));
+  EXPECT_FALSE(rejected_called);
+}
+
+TEST(ClipboardReader, AbandonsReadWhenLastWaiterCancels) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  ClipboardMonitor monitor(clipboard, 0);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  ASSERT_TRUE(SetClipboardText(monitor, "kept"));
+
+  ClipboardReader reader(clipboard, &monitor, std::make_shared<MemoryBudget>(),
+                         std::make_shared<PasteStats>());
+  int served = 0;
+  reader.AddSnapshotListener([&served](const SnapshotPtr&) { served++; });
+
+  // Cancelling one of two waiters leaves the read running for the other.
+  std::vector<SnapshotPtr> cancelled;
+  SnapshotPtr kept;
+  ASSERT_TRUE(reader.Read(1, [&cancelled](SnapshotPtr snapshot) {
+    cancelled.push_back(snapshot);
+  }));
+  ASSERT_TRUE(reader.Read(2, [&kept](SnapshotPtr snapshot) { kept = snapshot; }));
+  EXPECT_TRUE(reader.Cancel(1));
+  EXPECT_THAT(cancelled, testing::ElementsAre(nullptr));
+  ASSERT_TRUE(RunMainLoopUntil([&kept] { return kept != nullptr; }));
+  EXPECT_EQ(SnapshotText(kept), "kept");
+
+  // Cancelling the last waiter abandons the read; its replies still arrive
+  // from GTK but are dropped, so nothing is cached or served.
+  ASSERT_TRUE(SetClipboardText(monitor, "abandoned"));
+  cancelled.clear();
+  ASSERT_TRUE(reader.Read(3, [&cancelled](SnapshotPtr snapshot) {
+    cancelled.push_back(snapshot);
+  }));
+  EXPECT_TRUE(reader.Cancel(3));
+  EXPECT_FALSE(reader.Cancel(3));
+  RunMainLoopUntil([] { return false; }, 500);
+  EXPECT_THAT(cancelled, testing::ElementsAre(nullptr));
+  EXPECT_EQ(served, 1);
+
+  SnapshotPtr fresh;
+  ASSERT_TRUE(reader.Read(4, [&fresh](SnapshotPtr snapshot) { fresh = snapshot; }));
+  EXPECT_EQ(fresh, nullptr);
+  ASSERT_TRUE(RunMainLoopUntil([&fresh] { return fresh != nullptr; }));
+  EXPECT_EQ(SnapshotText(fresh), "abandoned");
+  EXPECT_EQ(served, 2);
+}
+
+TEST(ClipboardReader, RereadsAfterChangeCountBump) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  ClipboardMonitor monitor(clipboard, 0);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  ASSERT_TRUE(SetClipboardText(monitor, "before"));
+
+  ClipboardReader reader(clipboard, &monitor, std::make_shared<MemoryBudget>(),
+                         std::make_shared<PasteStats>());
+  reader.set_coalesce_window_ms(60000);
+  SnapshotPtr before;
+  ASSERT_TRUE(reader.Read(0, [&before](SnapshotPtr snapshot) { before = snapshot; }));
+  ASSERT_TRUE(RunMainLoopUntil([&before] { return before != nullptr; }));
+  EXPECT_EQ(before->change_count, monitor.change_count());
+
+  // The cached snapshot is stale once the change count moves, however
+  // long the coalescing window.
+  ASSERT_TRUE(SetClipboardText(monitor, "after"));
+  SnapshotPtr after;
+  ASSERT_TRUE(reader.Read(0, [&after](SnapshotPtr snapshot) { after = snapshot; }));
+  EXPECT_EQ(after, nullptr);
+  ASSERT_TRUE(RunMainLoopUntil([&after] { return after != nullptr; }));
+  EXPECT_NE(after, before);
+  EXPECT_EQ(SnapshotText(after), "after");
+  EXPECT_EQ(after->change_count, monitor.change_count());
+}
+
+TEST(ClipboardMonitor, DebouncesOwnerChanges) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  ClipboardMonitor monitor(clipboard, 300);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  int64_t change_count = monitor.change_count();
+  std::vector<int64_t> notified;
+  monitor.AddChangeListener([&notified](int64_t count) { notified.push_back(count); });
+
+  // Three copies within one window are counted once, after it.
+  for (const char* text : {"one", "two", "three"}) {
+    gtk_clipboard_set_text(clipboard, text, -1);
+    RunMainLoopUntil([] { return false; }, 20);
+  }
+  EXPECT_FALSE(monitor.settled());
+  EXPECT_EQ(monitor.change_count(), change_count);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  EXPECT_EQ(monitor.change_count(), change_count + 1);
+  EXPECT_THAT(notified, testing::ElementsAre(change_count + 1));
+}
+
+TEST(ClipboardMonitor, EvaluatesStormAfterMaxDebounceWindows) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  const guint debounce_ms = 100;
+  ClipboardMonitor monitor(clipboard, debounce_ms);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  int64_t change_count = monitor.change_count();
+
+  // Copies every 20 ms keep re-arming the timer for well over the cap.
+  const gint64 storm_us = 4 * ClipboardMonitor::kMaxDebounceWindows * debounce_ms * 1000;
+  gint64 started_at = g_get_monotonic_time();
+  gint64 counted_at = 0;
+  int copies = 0;
+  while (g_get_monotonic_time() - started_at < storm_us) {
+    gtk_clipboard_set_text(clipboard, std::to_string(copies++).c_str(), -1);
+    RunMainLoopUntil([] { return false; }, 20);
+    if (counted_at == 0 && monitor.change_count() > change_count) {
+      counted_at = g_get_monotonic_time();
+    }
+  }
+
+  // Counted while the storm was still going, not only once it ended.
+  ASSERT_NE(counted_at, 0);
+  EXPECT_LT(counted_at - started_at, storm_us / 2);
+}
+
+TEST(ClipboardMonitor, IgnoresOwnerChangeWithIdenticalContent) {
+  if (!gtk_init_check(nullptr, nullptr)) {
+    GTEST_SKIP() << "No display";
+  }
+  GtkClipboard* clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
+  ClipboardMonitor monitor(clipboard, 0);
+  ASSERT_TRUE(RunMainLoopUntil([&monitor] { return monitor.settled(); }));
+  ClipboardReader reader(clipboard, &monitor, std::make_shared<MemoryBudget>(),
+                         std::make_shared<PasteStats>());
+  reader.set_coalesce_window_ms(60000);
+
+  // The same text from two owners, like a clipboard manager taking over.
+  g_autoptr(GObject) app = G_OBJECT(g_object_new(G_TYPE_OBJECT, nullptr));
+  g_autoptr(GObject) manager = G_OBJECT(g_object_new(G_TYPE_OBJECT, nullptr));
+  int64_t change_count = monitor.change_count();
+  SetClipboardTextFromOwner(app, "same");
+  ASSERT_TRUE(RunMainLoopUntil([&monitor, change_count] {
+    return monitor.settled() && monitor.change_count() > change_count;
+  }));
+
+  SnapshotPtr cached;
+  ASSERT_TRUE(reader.Read(0, [&cached](SnapshotPtr snapshot) { cached = snapshot; }));
+  ASSERT_TRUE(RunMainLoopUntil([&cached] { return cached != nullptr; }));
+  ASSERT_EQ(SnapshotText(cached), "same");
+
+  change_count = monitor.change_count();
+  int64_t owner_changes = monitor.owner_changes();
+  int notified = 0;
+  monitor.AddChangeListener([&notified](int64_t) { notified++; });
+  SetClipboardTextFromOwner(manager, "same");
+  ASSERT_TRUE(RunMainLoopUntil([&monitor, owner_changes] {
+    return monitor.settled() && monitor.owner_changes() > owner_changes;
+  }));
+  EXPECT_EQ(monitor.change_count(), change_count);
+  EXPECT_EQ(notified, 0);
+
+  // The cached snapshot still serves, synchronously.
+  SnapshotPtr served;
+  ASSERT_TRUE(reader.Read(0, [&served](SnapshotPtr snapshot) { served = snapshot; }));
+  EXPECT_EQ(served, cached);
+
+  // Different content from the next owner is a change.
+  SetClipboardTextFromOwner(app, "different");
+  ASSERT_TRUE(RunMainLoopUntil([&monitor, change_count] {
+    return monitor.settled() && monitor.change_count() > change_count;
+  }));
+  EXPECT_EQ(notified, 1);
+  gtk_clipboard_clear(clipboard);
+}
+
+TEST(X11SelectionReader, ReadsIncrTransferWithProgress) {
+  if (!gtk_init_check(nullptr, nullptr) ||
+      !X11SelectionReader::IsSupported(gdk_display_get_default())) {
+    GTEST_SKIP() << "No X11 display";
+  }
+
+  // Well above GTK's 256 KiB chunk size, so it is served with INCR.
+  std::string text(4 * 1024 * 1024, 'x');
+  gtk_clipboard_set_text(gtk_clipboard_get(GDK_SELECTION_CLIPBOARD), text.c_str(),
+                         static_cast<gint>(text.size()));
+
+  bool done = false;
+  const char* error = "pending";
+  std::string received;
+  size_t progress_calls = 0;
+  X11SelectionReader reader(
+      gdk_display_get_default(), GDK_SELECTION_CLIPBOARD,
+      gdk_atom_intern_static_string("UTF8_STRING"), 0,
+      [&progress_calls](size_t, size_t) { progress_calls++; },
+      [&](PooledBuffer data, const char* error_code, const std::string&) {
+        done = true;
+        error = error_code;
+        received.assign(reinterpret_cast<const char*>(data.data()), data.size());
+      });
+  ASSERT_TRUE(reader.Start());
+
+  gint64 deadline = g_get_monotonic_time() + 10 * G_USEC_PER_SEC;
+  while (!done && g_get_monotonic_time() < deadline) {
+    g_main_context_iteration(nullptr, TRUE);
+  }
+  ASSERT_TRUE(done);
+  EXPECT_EQ(error, nullptr);
+  EXPECT_EQ(received, text);
+  EXPECT_GT(progress_calls, 1u);
+}
+
+#ifdef GDK_WINDOWING_X11
+TEST(X11SelectionReader, StopsIncrTransferBeyondMaxBytes) {
+  if (!gtk_init_check(nullptr, nullptr) ||
+      !X11SelectionReader::IsSupported(gdk_display_get_default())) {
+    GTEST_SKIP() << "No X11 display";
+  }
+
+  // The owner announces no size, so the cap is only hit mid-transfer.
+  IncrSelectionOwner owner(gdk_display_get_default(), 1024 * 1024, 64 * 1024, 0);
+  bool done = false;
+  const char* error = "pending";
+  size_t received_bytes = 0;
+  size_t progress_calls = 0;
+  X11SelectionReader reader(
+      gdk_display_get_default(), owner.selection(),
+      gdk_atom_intern_static_string("UTF8_STRING"), 256 * 1024,
+      [&progress_calls](size_t, size_t) { progress_calls++; },
+      [&](PooledBuffer data, const char* error_code, const std::string&) {
+        done = true;
+        error = error_code;
+        received_bytes = data.size();
+      });
+  ASSERT_TRUE(reader.Start());
+
+  ASSERT_TRUE(RunMainLoopUntil([&done] { return done; }));
+  EXPECT_STREQ(error, "too-large");
+  EXPECT_EQ(received_bytes, 0u);
+  EXPECT_GT(progress_calls, 1u);
+  EXPECT_LT(owner.sent_bytes(), owner.data().size());
+  EXPECT_TRUE(owner.RequestorGone());
+}
+
+TEST(X11SelectionReader, DestroyedMidTransferCleansUpSilently) {
+  if (!gtk_init_check(nullptr, nullptr) ||
+      !X11SelectionReader::IsSupported(gdk_display_get_default())) {
+    GTEST_SKIP() << "No X11 display";
+  }
+
+  IncrSelectionOwner owner(gdk_display_get_default(), 1024 * 1024, 64 * 1024, 0,
+                           128 * 1024);
+  bool done = false;
+  size_t received = 0;
+  auto reader = std::make_unique<X11SelectionReader>(
+      gdk_display_get_default(), owner.selection(),
+      gdk_atom_intern_static_string("UTF8_STRING"), 0,
+      [&received](size_t bytes, size_t) { received = bytes; },
+      [&done](PooledBuffer, const char*, const std::string&) { done = true; });
+  ASSERT_TRUE(reader->Start());
+  ASSERT_TRUE(RunMainLoopUntil([&received] { return received > 0; }));
+
+  reader.reset();
+  EXPECT_TRUE(owner.RequestorGone());
+  RunMainLoopUntil([] { return false; }, 200);
+  EXPECT_FALSE(done);
+}
+#endif  // GDK_WINDOWING_X11
+
+TEST(X11SelectionReader, ReportsRefusedTarget) {
+  if (!gtk_init_check(nullptr, nullptr) ||
+      !X11SelectionReader::IsSupported(gdk_display_get_default())) {
+    GTEST_SKIP() << "No X11 display";
+  }
+
+  // GTK's text owner cannot convert to an image type.
+  gtk_clipboard_set_text(gtk_clipboard_get(GDK_SELECTION_CLIPBOARD), "text only", -1);
+  bool done = false;
+  const char* error = "pending";
+  X11SelectionReader reader(
+      gdk_display_get_default(), GDK_SELECTION_CLIPBOARD,
+      gdk_atom_intern_static_string("image/png"), 0, nullptr,
+      [&](PooledBuffer, const char* error_code, const std::string&) {
+        done = true;
+        error = error_code;
+      });
+  ASSERT_TRUE(reader.Start());
+
+  ASSERT_TRUE(RunMainLoopUntil([&done] { return done; }));
+  EXPECT_STREQ(error, "refused");
+}
+
+// Needs an X server with XFixes, e.g. run under xvfb-run.
+TEST(X11SelectionWatcher, RecordsOwnerChanges) {
+  if (!gtk_init_check(nullptr, nullptr) ||
+      !X11SelectionWatcher::IsSupported(gdk_display_get_default())) {
+    GTEST_SKIP() << "No X11 display with XFixes";
+  }
+
+  X11SelectionWatcher watcher(gdk_display_get_default());
+  ASSERT_TRUE(watcher.Watch(GDK_SELECTION_CLIPBOARD));
+  std::vector<GdkAtom> changes;
+  watcher.AddChangeListener(
+      [&changes](GdkAtom selection, const X11SelectionWatcher::OwnerState&) {
+        changes.push_back(selection);
+      });
+
+  gtk_clipboard_set_text(gtk_clipboard_get(GDK_SELECTION_CLIPBOARD), "watched", -1);
+  gint64 deadline = g_get_monotonic_time() + 5 * G_USEC_PER_SEC;
+  while (changes.empty() && g_get_monotonic_time() < deadline) {
+    g_main_context_iteration(nullptr, FALSE);
+  }
+
+  ASSERT_THAT(changes, testing::ElementsAre(GDK_SELECTION_CLIPBOARD));
+  const X11SelectionWatcher::OwnerState* state = watcher.state(GDK_SELECTION_CLIPBOARD);
+  ASSERT_NE(state, nullptr);
+  EXPECT_EQ(state->change_count, 1);
+  EXPECT_NE(state->owner, 0u);
+  EXPECT_EQ(watcher.state(GDK_SELECTION_PRIMARY), nullptr);
+}
+
 }  // namespace test
 }  // namespace flutter_paste_input
@@ -0,0 +1,232 @@
+#include "tile_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "clipboard_history.h"
+#include "content_hash.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+constexpr uint32_t kCompressedFlag = 1;
+
+struct MapHeader {
+  uint32_t width;
+  uint32_t height;
+  uint32_t channels;
+  uint32_t tile_size;
+};
+
+// Precedes the data of a tile blob.
+struct BlobHeader {
+  uint32_t flags;
+  // Size of the filtered rows.
+  uint32_t raw_size;
+};
+
+size_t TileCount(uint32_t width, uint32_t height) {
+  size_t columns = (width + TilePool::kTileSize - 1) / TilePool::kTileSize;
+  size_t rows = (height + TilePool::kTileSize - 1) / TilePool::kTileSize;
+  return columns * rows;
+}
+
+// Filters |raw|, rows of |row_bytes|, in place and packs it into |blob|.
+bool EncodeTile(std::vector<uint8_t>* raw, size_t row_bytes, uint32_t channels,
+                PooledBuffer* blob) {
+  for (size_t row = 0; row < raw->size(); row += row_bytes) {
+    uint8_t* bytes = raw->data() + row;
+    for (size_t i = row_bytes - 1; i >= channels; i--) {
+      bytes[i] -= bytes[i - channels];
+    }
+  }
+
+  PooledBuffer deflated;
+  bool compressed = DeflateBytes(raw->data(), raw->size(), &deflated);
+  BlobHeader header = {compressed ? kCompressedFlag : 0, static_cast<uint32_t>(raw->size())};
+  return blob->Append(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) &&
+         (compressed ? blob->Append(deflated.data(), deflated.size())
+                     : blob->Append(raw->data(), raw->size()));
+}
+
+// Unpacks |blob| into |raw|, still filtered.
+bool UnpackTile(const PooledBuffer& blob, size_t row_bytes, PooledBuffer* raw) {
+  BlobHeader header;
+  if (blob.size() < sizeof(header)) {
+    return false;
+  }
+  memcpy(&header, blob.data(), sizeof(header));
+  raw->Reset();
+  const uint8_t* data = blob.data() + sizeof(header);
+  size_t size = blob.size() - sizeof(header);
+  bool ok = (header.flags & kCompressedFlag) != 0
+                ? InflateBytes(data, size, header.raw_size, raw)
+                : raw->Assign(data, size);
+  return ok && raw->size() == header.raw_size && raw->size() % row_bytes == 0;
+}
+
+}  // namespace
+
+bool TilePool::Map::Parse(const uint8_t* data, size_t size) {
+  MapHeader header;
+  if (size < sizeof(header)) {
+    return false;
+  }
+  memcpy(&header, data, sizeof(header));
+  if (header.tile_size != kTileSize || (header.channels != 3 && header.channels != 4) ||
+      (size - sizeof(header)) / sizeof(uint64_t) != TileCount(header.width, header.height) ||
+      (size - sizeof(header)) % sizeof(uint64_t) != 0) {
+    return false;
+  }
+  width = header.width;
+  height = header.height;
+  channels = header.channels;
+  tiles.resize(TileCount(width, height));
+  memcpy(tiles.data(), data + sizeof(header), tiles.size() * sizeof(uint64_t));
+  return true;
+}
+
+bool TilePool::Map::Serialize(PooledBuffer* out) const {
+  MapHeader header = {width, height, channels, kTileSize};
+  return out->Append(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) &&
+         out->Append(reinterpret_cast<const uint8_t*>(tiles.data()),
+                     tiles.size() * sizeof(uint64_t));
+}
+
+TilePool::TilePool() = default;
+
+TilePool::~TilePool() = default;
+
+bool TilePool::AddImage(GdkPixbuf* pixbuf, Map* map) {
+  int channels = gdk_pixbuf_get_n_channels(pixbuf);
+  if (gdk_pixbuf_get_bits_per_sample(pixbuf) != 8 || (channels != 3 && channels != 4)) {
+    return false;
+  }
+  map->width = static_cast<uint32_t>(gdk_pixbuf_get_width(pixbuf));
+  map->height = static_cast<uint32_t>(gdk_pixbuf_get_height(pixbuf));
+  map->channels = static_cast<uint32_t>(channels);
+  map->tiles.clear();
+  map->tiles.reserve(TileCount(map->width, map->height));
+  const guint8* pixels = gdk_pixbuf_read_pixels(pixbuf);
+  size_t rowstride = static_cast<size_t>(gdk_pixbuf_get_rowstride(pixbuf));
+
+  std::vector<uint8_t> raw;
+  for (uint32_t top = 0; top < map->height; top += kTileSize) {
+    uint32_t tile_height = std::min(kTileSize, map->height - top);
+    for (uint32_t left = 0; left < map->width; left += kTileSize) {
+      uint32_t tile_width = std::min(kTileSize, map->width - left);
+      size_t row_bytes = static_cast<size_t>(tile_width) * map->channels;
+      raw.resize(row_bytes * tile_height);
+      for (uint32_t y = 0; y < tile_height; y++) {
+        memcpy(raw.data() + y * row_bytes,
+               pixels + (top + y) * rowstride + static_cast<size_t>(left) * map->channels,
+               row_bytes);
+      }
+      uint64_t shape = (static_cast<uint64_t>(tile_width) << 32) | (tile_height << 8) |
+                       map->channels;
+      uint64_t hash = HashBytes(raw.data(), raw.size(), shape);
+      map->tiles.push_back(hash);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto found = tiles_.find(hash);
+        if (found != tiles_.end()) {
+          found->second.refs++;
+          continue;
+        }
+      }
+      // Encoded unlocked; another image may pool the same tile meanwhile.
+      PooledBuffer blob;
+      if (!EncodeTile(&raw, row_bytes, map->channels, &blob)) {
+        map->tiles.pop_back();
+        Release(*map);
+        map->tiles.clear();
+        return false;
+      }
+      // Kept at its exact size; a tile is 16 KiB at most, a pool class 64.
+      blob.ShrinkToFit();
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto inserted = tiles_.emplace(hash, Tile());
+      if (inserted.second) {
+        stored_bytes_ += blob.capacity();
+        inserted.first->second.blob = std::move(blob);
+      }
+      inserted.first->second.refs++;
+    }
+  }
+  return true;
+}
+
+size_t TilePool::Release(const Map& map) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t released = 0;
+  for (uint64_t hash : map.tiles) {
+    auto found = tiles_.find(hash);
+    if (found == tiles_.end() || --found->second.refs > 0) {
+      continue;
+    }
+    released += found->second.blob.capacity();
+    stored_bytes_ -= found->second.blob.capacity();
+    tiles_.erase(found);
+  }
+  return released;
+}
+
+bool TilePool::Lookup(uint64_t hash, PooledBuffer* blob) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto found = tiles_.find(hash);
+  if (found == tiles_.end()) {
+    return false;
+  }
+  return blob->Assign(found->second.blob.data(), found->second.blob.size());
+}
+
+// static
+GdkPixbuf* TilePool::Assemble(const Map& map, const BlobSource& source) {
+  GdkPixbuf* pixbuf = gdk_pixbuf_new(GDK_COLORSPACE_RGB, map.channels == 4, 8,
+                                     static_cast<int>(map.width), static_cast<int>(map.height));
+  if (pixbuf == nullptr) {
+    return nullptr;
+  }
+  guchar* pixels = gdk_pixbuf_get_pixels(pixbuf);
+  size_t rowstride = static_cast<size_t>(gdk_pixbuf_get_rowstride(pixbuf));
+  size_t columns = (map.width + kTileSize - 1) / kTileSize;
+
+  PooledBuffer blob;
+  PooledBuffer raw;
+  for (size_t i = 0; i < map.tiles.size(); i++) {
+    uint32_t left = static_cast<uint32_t>(i % columns) * kTileSize;
+    uint32_t top = static_cast<uint32_t>(i / columns) * kTileSize;
+    uint32_t tile_width = std::min(kTileSize, map.width - left);
+    uint32_t tile_height = std::min(kTileSize, map.height - top);
+    size_t row_bytes = static_cast<size_t>(tile_width) * map.channels;
+    blob.Reset();
+    if (!source(map.tiles[i], &blob) || !UnpackTile(blob, row_bytes, &raw) ||
+        raw.size() != row_bytes * tile_height) {
+      g_object_unref(pixbuf);
+      return nullptr;
+    }
+    for (uint32_t y = 0; y < tile_height; y++) {
+      guchar* row = pixels + (top + y) * rowstride + static_cast<size_t>(left) * map.channels;
+      memcpy(row, raw.data() + y * row_bytes, row_bytes);
+      for (size_t x = map.channels; x < row_bytes; x++) {
+        row[x] += row[x - map.channels];
+      }
+    }
+  }
+  return pixbuf;
+}
+
+size_t TilePool::stored_bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stored_bytes_;
+}
+
+size_t TilePool::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return tiles_.size();
+}
+
+}  // namespace flutter_paste_input
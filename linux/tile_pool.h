@@ -0,0 +1,90 @@
+#ifndef FLUTTER_PLUGIN_TILE_POOL_H_
+#define FLUTTER_PLUGIN_TILE_POOL_H_
+
+#include <gdk-pixbuf/gdk-pixbuf.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "buffer_pool.h"
+
+namespace flutter_paste_input {
+
+// Content-addressed pool of image tiles shared by the entries of the
+// clipboard history.
+//
+// Images are cut into kTileSize x kTileSize tiles of 8-bit RGB or RGBA
+// pixels, hashed, and only tiles that are not pooled yet are stored, so
+// consecutive screenshots of the same window cost their changed tiles
+// only. A tile is kept as a blob: its rows delta-encoded against the pixel
+// to the left, like PNG's Sub filter, then deflated. The history store
+// writes the same blobs to disk.
+//
+// Tiles are reference counted by the tile maps that list them, one
+// reference per occurrence. Thread-safe, as images are split on the GIO
+// worker pool.
+class TilePool {
+ public:
+  static constexpr uint32_t kTileSize = 64;
+
+  // Images with fewer pixels are not worth splitting.
+  static constexpr int64_t kMinPixels = 256 * 256;
+
+  // The tiles of one image, row by row.
+  struct Map {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t channels = 0;
+    std::vector<uint64_t> tiles;
+
+    bool Parse(const uint8_t* data, size_t size);
+    bool Serialize(PooledBuffer* out) const;
+  };
+
+  // Fetches the blob of a tile, e.g. from the pool or the history store.
+  using BlobSource = std::function<bool(uint64_t hash, PooledBuffer* blob)>;
+
+  TilePool();
+  ~TilePool();
+
+  // Disallow copy and assign.
+  TilePool(const TilePool&) = delete;
+  TilePool& operator=(const TilePool&) = delete;
+
+  // Splits |pixbuf| into tiles, pooling new ones, and fills |map| holding a
+  // reference on each. Returns false if the pixel format is not supported.
+  bool AddImage(GdkPixbuf* pixbuf, Map* map);
+
+  // Drops the references of |map|. Returns the bytes freed.
+  size_t Release(const Map& map);
+
+  // Copies the blob of tile |hash| into |blob|. Returns false if the tile
+  // is not pooled.
+  bool Lookup(uint64_t hash, PooledBuffer* blob) const;
+
+  // Rebuilds the image of |map|. Returns a new reference, or nullptr if a
+  // tile cannot be fetched or decoded.
+  static GdkPixbuf* Assemble(const Map& map, const BlobSource& source);
+
+  // Bytes allocated for the tile blobs held.
+  size_t stored_bytes() const;
+  size_t size() const;
+
+ private:
+  struct Tile {
+    PooledBuffer blob;
+    size_t refs = 0;
+  };
+
+  mutable std::mutex mutex_;
+  std::unordered_map<uint64_t, Tile> tiles_;
+  size_t stored_bytes_ = 0;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_TILE_POOL_H_
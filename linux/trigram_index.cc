@@ -0,0 +1,322 @@
+#include "trigram_index.h"
+
+#include <glib/gstdio.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#include "paste_tracer.h"
+
+namespace flutter_paste_input {
+
+namespace {
+
+constexpr uint64_t kFileMagic = 0x3149525448504e46ULL;  // "FNPHTRI1"
+
+// Texts at least this long are deduplicated with a bitmap over all
+// trigrams rather than by sorting.
+constexpr size_t kBitmapMinBytes = 64 * 1024;
+constexpr size_t kTrigramCount = 1 << 24;
+
+struct FileHeader {
+  uint64_t magic;
+  uint32_t document_count;
+  uint32_t reserved;
+};
+
+struct DocumentHeader {
+  int64_t id;
+  uint32_t trigram_count;
+  uint32_t reserved;
+};
+
+}  // namespace
+
+struct TrigramIndex::SaveState {
+  std::mutex mutex;
+  uint64_t next_serial = 1;
+  // Serial of the newest save on disk; older ones are dropped.
+  uint64_t saved_serial = 0;
+
+  void Write(const std::string& path, const std::string& data, uint64_t serial) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (serial <= saved_serial) {
+      return;
+    }
+    g_autoptr(GError) error = nullptr;
+    if (!g_file_set_contents(path.c_str(), data.data(), static_cast<gssize>(data.size()),
+                             &error)) {
+      g_warning("FlutterPasteInput: Failed to save the clipboard history index: %s",
+                error->message);
+      return;
+    }
+    saved_serial = serial;
+  }
+};
+
+struct TrigramIndex::SaveJob {
+  std::shared_ptr<SaveState> state;
+  std::string path;
+  std::string data;
+  uint64_t serial;
+};
+
+TrigramIndex::TrigramIndex() : save_state_(std::make_shared<SaveState>()) {}
+
+TrigramIndex::~TrigramIndex() {
+  Close();
+}
+
+// static
+std::vector<uint32_t> TrigramIndex::Trigrams(const uint8_t* text, size_t size) {
+  std::vector<uint32_t> trigrams;
+  if (size < 3) {
+    return trigrams;
+  }
+  uint32_t trigram = (Fold(text[0]) << 8) | Fold(text[1]);
+  if (size < kBitmapMinBytes) {
+    trigrams.reserve(size - 2);
+    for (size_t i = 2; i < size; i++) {
+      trigram = ((trigram << 8) | Fold(text[i])) & (kTrigramCount - 1);
+      trigrams.push_back(trigram);
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    return trigrams;
+  }
+
+  // Zeroed pages are only committed where trigrams land.
+  uint64_t* seen = static_cast<uint64_t*>(g_malloc0(kTrigramCount / 8));
+  for (size_t i = 2; i < size; i++) {
+    trigram = ((trigram << 8) | Fold(text[i])) & (kTrigramCount - 1);
+    uint64_t bit = uint64_t{1} << (trigram % 64);
+    if ((seen[trigram / 64] & bit) == 0) {
+      seen[trigram / 64] |= bit;
+      trigrams.push_back(trigram);
+    }
+  }
+  g_free(seen);
+  std::sort(trigrams.begin(), trigrams.end());
+  return trigrams;
+}
+
+void TrigramIndex::Add(int64_t id, const uint8_t* text, size_t size) {
+  Remove(id);
+  std::vector<uint32_t> trigrams = Trigrams(text, size);
+  for (uint32_t trigram : trigrams) {
+    std::vector<int64_t>& posting = postings_[trigram];
+    // Ids mostly grow, so this is usually an append.
+    posting.insert(std::upper_bound(posting.begin(), posting.end(), id), id);
+  }
+  documents_[id] = std::move(trigrams);
+  ScheduleSave();
+}
+
+void TrigramIndex::Remove(int64_t id) {
+  auto document = documents_.find(id);
+  if (document == documents_.end()) {
+    return;
+  }
+  for (uint32_t trigram : document->second) {
+    auto posting = postings_.find(trigram);
+    if (posting == postings_.end()) {
+      continue;
+    }
+    std::vector<int64_t>& ids = posting->second;
+    auto found = std::lower_bound(ids.begin(), ids.end(), id);
+    if (found != ids.end() && *found == id) {
+      ids.erase(found);
+    }
+    if (ids.empty()) {
+      postings_.erase(posting);
+    }
+  }
+  documents_.erase(document);
+  ScheduleSave();
+}
+
+std::vector<int64_t> TrigramIndex::Ids() const {
+  std::vector<int64_t> ids;
+  ids.reserve(documents_.size());
+  for (const auto& document : documents_) {
+    ids.push_back(document.first);
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+std::vector<int64_t> TrigramIndex::Candidates(const std::string& term) const {
+  std::vector<uint32_t> trigrams =
+      Trigrams(reinterpret_cast<const uint8_t*>(term.data()), term.size());
+  if (trigrams.empty()) {
+    return Ids();
+  }
+
+  std::vector<const std::vector<int64_t>*> lists;
+  lists.reserve(trigrams.size());
+  for (uint32_t trigram : trigrams) {
+    auto posting = postings_.find(trigram);
+    if (posting == postings_.end()) {
+      return {};
+    }
+    lists.push_back(&posting->second);
+  }
+  // Intersect starting from the rarest trigram.
+  std::sort(lists.begin(), lists.end(),
+            [](const std::vector<int64_t>* a, const std::vector<int64_t>* b) {
+              return a->size() < b->size();
+            });
+  std::vector<int64_t> candidates = *lists[0];
+  for (size_t i = 1; i < lists.size() && !candidates.empty(); i++) {
+    const std::vector<int64_t>& ids = *lists[i];
+    auto kept = std::remove_if(candidates.begin(), candidates.end(), [&ids](int64_t id) {
+      return !std::binary_search(ids.begin(), ids.end(), id);
+    });
+    candidates.erase(kept, candidates.end());
+  }
+  return candidates;
+}
+
+void TrigramIndex::Open(const std::string& path) {
+  Close();
+  path_ = path;
+  size_t indexed = documents_.size();
+  if (!Load(path)) {
+    g_unlink(path.c_str());
+  }
+  // Documents indexed before are not in the file yet.
+  if (indexed != 0) {
+    ScheduleSave();
+  }
+}
+
+void TrigramIndex::Close() {
+  if (save_source_ != 0) {
+    g_source_remove(save_source_);
+    save_source_ = 0;
+  }
+  if (dirty_ && !path_.empty()) {
+    Save(true);
+  }
+  dirty_ = false;
+  path_.clear();
+}
+
+bool TrigramIndex::Load(const std::string& path) {
+  g_autofree gchar* contents = nullptr;
+  gsize length = 0;
+  if (!g_file_get_contents(path.c_str(), &contents, &length, nullptr)) {
+    // Not saved yet.
+    return true;
+  }
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(contents);
+  FileHeader header;
+  if (length < sizeof(header)) {
+    return false;
+  }
+  memcpy(&header, data, sizeof(header));
+  if (header.magic != kFileMagic) {
+    return false;
+  }
+
+  size_t offset = sizeof(header);
+  std::vector<std::pair<int64_t, std::vector<uint32_t>>> loaded;
+  for (uint32_t i = 0; i < header.document_count; i++) {
+    DocumentHeader document;
+    if (length - offset < sizeof(document)) {
+      return false;
+    }
+    memcpy(&document, data + offset, sizeof(document));
+    offset += sizeof(document);
+    if ((length - offset) / sizeof(uint32_t) < document.trigram_count) {
+      return false;
+    }
+    std::vector<uint32_t> trigrams(document.trigram_count);
+    memcpy(trigrams.data(), data + offset, document.trigram_count * sizeof(uint32_t));
+    offset += document.trigram_count * sizeof(uint32_t);
+    if (!std::is_sorted(trigrams.begin(), trigrams.end())) {
+      return false;
+    }
+    loaded.emplace_back(document.id, std::move(trigrams));
+  }
+
+  for (auto& document : loaded) {
+    if (Contains(document.first)) {
+      continue;
+    }
+    for (uint32_t trigram : document.second) {
+      std::vector<int64_t>& posting = postings_[trigram];
+      posting.insert(std::upper_bound(posting.begin(), posting.end(), document.first),
+                     document.first);
+    }
+    documents_[document.first] = std::move(document.second);
+  }
+  return true;
+}
+
+std::string TrigramIndex::Serialize() const {
+  size_t size = sizeof(FileHeader);
+  for (const auto& document : documents_) {
+    size += sizeof(DocumentHeader) + document.second.size() * sizeof(uint32_t);
+  }
+  std::string data;
+  data.reserve(size);
+  FileHeader header = {kFileMagic, static_cast<uint32_t>(documents_.size()), 0};
+  data.append(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (const auto& document : documents_) {
+    DocumentHeader document_header = {document.first,
+                                      static_cast<uint32_t>(document.second.size()), 0};
+    data.append(reinterpret_cast<const char*>(&document_header), sizeof(document_header));
+    data.append(reinterpret_cast<const char*>(document.second.data()),
+                document.second.size() * sizeof(uint32_t));
+  }
+  return data;
+}
+
+void TrigramIndex::ScheduleSave() {
+  dirty_ = true;
+  if (!path_.empty() && save_source_ == 0) {
+    save_source_ = g_timeout_add(kSaveDelayMs, OnSaveTimeout, this);
+  }
+}
+
+// static
+gboolean TrigramIndex::OnSaveTimeout(gpointer user_data) {
+  TrigramIndex* self = static_cast<TrigramIndex*>(user_data);
+  self->save_source_ = 0;
+  self->Save(false);
+  return G_SOURCE_REMOVE;
+}
+
+void TrigramIndex::Save(bool now) {
+  dirty_ = false;
+  uint64_t serial;
+  {
+    std::lock_guard<std::mutex> lock(save_state_->mutex);
+    serial = save_state_->next_serial++;
+  }
+  if (now) {
+    save_state_->Write(path_, Serialize(), serial);
+    return;
+  }
+  auto* job = new SaveJob{save_state_, path_, Serialize(), serial};
+  GTask* task = g_task_new(nullptr, nullptr, nullptr, nullptr);
+  g_task_set_task_data(task, job, [](gpointer job) { delete static_cast<SaveJob*>(job); });
+  // Yield to paste encodes queued on the same pool.
+  g_task_set_priority(task, G_PRIORITY_LOW);
+  g_task_run_in_thread(task, RunSave);
+  g_object_unref(task);
+}
+
+// static
+void TrigramIndex::RunSave(GTask* task, gpointer source_object, gpointer task_data,
+                           GCancellable* cancellable) {
+  TraceScope trace("index-save");
+  SaveJob* job = static_cast<SaveJob*>(task_data);
+  job->state->Write(job->path, job->data, job->serial);
+  g_task_return_boolean(task, TRUE);
+}
+
+}  // namespace flutter_paste_input
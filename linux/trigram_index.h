@@ -0,0 +1,98 @@
+#ifndef FLUTTER_PLUGIN_TRIGRAM_INDEX_H_
+#define FLUTTER_PLUGIN_TRIGRAM_INDEX_H_
+
+#include <gio/gio.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace flutter_paste_input {
+
+// Inverted index from byte trigrams to the documents containing them, for
+// substring search over the text history.
+//
+// Text is indexed ASCII-case-folded; other bytes, including every byte of
+// a multi-byte UTF-8 sequence, are indexed as they are. The index only
+// narrows a search down to candidate documents, which the caller then
+// scans for the actual matches.
+//
+// Once Open() has named a file, changes are saved to it kSaveDelayMs after
+// the first one, on the GIO worker pool, replacing it atomically. The file
+// holds the trigram set of every document, from which the posting lists
+// are rebuilt on load without reading the text again.
+//
+// Main thread only.
+class TrigramIndex {
+ public:
+  static constexpr guint kSaveDelayMs = 2000;
+
+  TrigramIndex();
+
+  // Saves pending changes before returning.
+  ~TrigramIndex();
+
+  // Disallow copy and assign.
+  TrigramIndex(const TrigramIndex&) = delete;
+  TrigramIndex& operator=(const TrigramIndex&) = delete;
+
+  // Indexes |size| bytes of text as document |id|, replacing any earlier
+  // text of the same document.
+  void Add(int64_t id, const uint8_t* text, size_t size);
+  void Remove(int64_t id);
+  bool Contains(int64_t id) const { return documents_.count(id) != 0; }
+
+  // Every indexed document, in ascending order.
+  std::vector<int64_t> Ids() const;
+
+  // Documents containing every trigram of |term|, in ascending order. A
+  // term shorter than a trigram matches every document.
+  std::vector<int64_t> Candidates(const std::string& term) const;
+
+  // Adds the documents saved in |path| that are not indexed yet, and saves
+  // the index there from now on. A missing or unreadable file is ignored.
+  void Open(const std::string& path);
+
+  // Saves pending changes and stops saving.
+  void Close();
+
+  size_t size() const { return documents_.size(); }
+
+  // ASCII lower case of |c|; the folding applied to indexed text.
+  static uint8_t Fold(uint8_t c) { return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c; }
+
+ private:
+  // Orders the saves made by workers and by the destructor.
+  struct SaveState;
+  struct SaveJob;
+
+  // Distinct trigrams of |size| bytes of text, in ascending order.
+  static std::vector<uint32_t> Trigrams(const uint8_t* text, size_t size);
+
+  bool Load(const std::string& path);
+  std::string Serialize() const;
+
+  void ScheduleSave();
+  static gboolean OnSaveTimeout(gpointer user_data);
+  // Saves the current state, on the worker pool unless |now| is set.
+  void Save(bool now);
+  static void RunSave(GTask* task, gpointer source_object, gpointer task_data,
+                      GCancellable* cancellable);
+
+  // Trigram set of every document.
+  std::unordered_map<int64_t, std::vector<uint32_t>> documents_;
+  // Documents of every trigram, in ascending order.
+  std::unordered_map<uint32_t, std::vector<int64_t>> postings_;
+
+  std::string path_;
+  bool dirty_ = false;
+  guint save_source_ = 0;
+  std::shared_ptr<SaveState> save_state_;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_TRIGRAM_INDEX_H_
@@ -0,0 +1,292 @@
+#include "x11_selection_reader.h"
+
+#ifdef GDK_WINDOWING_X11
+#include <gdk/gdkx.h>
+#endif
+
+#include <cstdint>
+
+namespace flutter_paste_input {
+
+namespace {
+
+// Property on the private window that receives the selection.
+constexpr char kPropertyName[] = "_FLUTTER_PASTE_INPUT_SELECTION";
+
+// Read size per XGetWindowProperty call, in 32-bit units (256 KiB).
+constexpr long kReadLongs = 64 * 1024;
+
+constexpr char kTooLargeMessage[] =
+    "The clipboard content exceeds the transfer size limit.";
+
+}  // namespace
+
+// static
+bool X11SelectionReader::IsSupported(GdkDisplay* display) {
+#ifdef GDK_WINDOWING_X11
+  return display != nullptr && GDK_IS_X11_DISPLAY(display);
+#else
+  return false;
+#endif
+}
+
+X11SelectionReader::X11SelectionReader(GdkDisplay* display, GdkAtom selection,
+                                       GdkAtom target, size_t max_bytes,
+                                       ProgressCallback progress,
+                                       DoneCallback done)
+    : display_(display),
+      selection_(selection),
+      target_(target),
+      max_bytes_(max_bytes),
+      progress_(std::move(progress)),
+      done_(std::move(done)) {}
+
+X11SelectionReader::~X11SelectionReader() {
+  Cleanup();
+}
+
+bool X11SelectionReader::Start() {
+#ifdef GDK_WINDOWING_X11
+  if (!IsSupported(display_)) {
+    return false;
+  }
+  Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+  window_ = XCreateSimpleWindow(xdisplay, DefaultRootWindow(xdisplay), 0, 0, 1, 1,
+                                0, 0, 0);
+  if (window_ == None) {
+    return false;
+  }
+  // INCR chunks are announced as property changes.
+  XSelectInput(xdisplay, window_, PropertyChangeMask);
+  property_ = gdk_x11_get_xatom_by_name_for_display(display_, kPropertyName);
+  incr_atom_ = gdk_x11_get_xatom_by_name_for_display(display_, "INCR");
+
+  // A global filter sees events for windows GDK does not know about.
+  gdk_window_add_filter(nullptr, OnEvent, this);
+  filtering_ = true;
+
+  guint32 user_time = gdk_x11_display_get_user_time(display_);
+  XConvertSelection(xdisplay, gdk_x11_atom_to_xatom_for_display(display_, selection_),
+                    gdk_x11_atom_to_xatom_for_display(display_, target_), property_,
+                    window_, user_time != 0 ? user_time : CurrentTime);
+  XFlush(xdisplay);
+  RestartStallTimeout();
+  return true;
+#else
+  return false;
+#endif
+}
+
+// static
+GdkFilterReturn X11SelectionReader::OnEvent(GdkXEvent* xevent, GdkEvent* event,
+                                            gpointer data) {
+#ifdef GDK_WINDOWING_X11
+  X11SelectionReader* self = static_cast<X11SelectionReader*>(data);
+  XEvent* x_event = static_cast<XEvent*>(xevent);
+  // The requestor of a SelectionNotify shares its slot with |window|.
+  if (x_event->xany.window != self->window_) {
+    return GDK_FILTER_CONTINUE;
+  }
+
+  if (x_event->type == SelectionNotify) {
+    if (!self->incremental_) {
+      self->HandleSelectionNotify(x_event->xselection.property);
+    }
+    return GDK_FILTER_REMOVE;
+  }
+  if (x_event->type == PropertyNotify) {
+    // Deleting a chunk also reports a change; only new values matter.
+    if (self->incremental_ && x_event->xproperty.atom == self->property_ &&
+        x_event->xproperty.state == PropertyNewValue) {
+      self->HandleNewChunk();
+    }
+    return GDK_FILTER_REMOVE;
+  }
+#endif
+  return GDK_FILTER_CONTINUE;
+}
+
+void X11SelectionReader::HandleSelectionNotify(XId property) {
+#ifdef GDK_WINDOWING_X11
+  if (property == None) {
+    Finish("refused", "The clipboard owner cannot provide this format.");
+    return;
+  }
+
+  // Look at the type and size without transferring anything.
+  Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+  Atom type = None;
+  int format = 0;
+  unsigned long count = 0;
+  unsigned long bytes_after = 0;
+  unsigned char* value = nullptr;
+  if (XGetWindowProperty(xdisplay, window_, property_, 0, 1, False, AnyPropertyType,
+                         &type, &format, &count, &bytes_after, &value) != Success) {
+    Finish("refused", "The clipboard owner did not provide any data.");
+    return;
+  }
+
+  if (type == incr_atom_) {
+    // The value is a lower bound on the size of the whole transfer.
+    if (format == 32 && count == 1) {
+      expected_bytes_ = static_cast<size_t>(reinterpret_cast<long*>(value)[0]);
+    }
+    XFree(value);
+    if (max_bytes_ != 0 && expected_bytes_ > max_bytes_) {
+      Finish("too-large", kTooLargeMessage);
+      return;
+    }
+    // Deleting the property asks the owner for the first chunk.
+    incremental_ = true;
+    XDeleteProperty(xdisplay, window_, property_);
+    XFlush(xdisplay);
+    RestartStallTimeout();
+    ReportProgress();
+    return;
+  }
+
+  expected_bytes_ = count * (format / 8) + bytes_after;
+  if (value != nullptr) {
+    XFree(value);
+  }
+  if (max_bytes_ != 0 && expected_bytes_ > max_bytes_) {
+    Finish("too-large", kTooLargeMessage);
+    return;
+  }
+  if (ReadProperty() < 0) {
+    Finish("refused", "The clipboard data could not be read.");
+    return;
+  }
+  Finish(nullptr, std::string());
+#endif
+}
+
+void X11SelectionReader::HandleNewChunk() {
+  long appended = ReadProperty();
+  if (appended < 0) {
+    Finish("refused", "The clipboard data could not be read.");
+    return;
+  }
+  // A zero-length chunk ends the transfer.
+  if (appended == 0) {
+    Finish(nullptr, std::string());
+    return;
+  }
+  if (max_bytes_ != 0 && data_.size() > max_bytes_) {
+    Finish("too-large", kTooLargeMessage);
+    return;
+  }
+  RestartStallTimeout();
+  ReportProgress();
+}
+
+long X11SelectionReader::ReadProperty() {
+#ifdef GDK_WINDOWING_X11
+  Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+  long appended = 0;
+  long offset = 0;
+  for (;;) {
+    Atom type = None;
+    int format = 0;
+    unsigned long count = 0;
+    unsigned long bytes_after = 0;
+    unsigned char* value = nullptr;
+    if (XGetWindowProperty(xdisplay, window_, property_, offset, kReadLongs, False,
+                           AnyPropertyType, &type, &format, &count, &bytes_after,
+                           &value) != Success) {
+      return -1;
+    }
+
+    bool stored = true;
+    size_t chunk_bytes = 0;
+    if (format == 32) {
+      // Xlib hands out 32-bit items as longs.
+      for (unsigned long i = 0; stored && i < count; i++) {
+        uint32_t item = static_cast<uint32_t>(reinterpret_cast<long*>(value)[i]);
+        stored = data_.Append(reinterpret_cast<const uint8_t*>(&item), sizeof(item));
+      }
+      chunk_bytes = count * 4;
+    } else if (format == 8 || format == 16) {
+      chunk_bytes = count * (format / 8);
+      stored = data_.Append(value, chunk_bytes);
+    }
+    if (value != nullptr) {
+      XFree(value);
+    }
+    if (!stored) {
+      return -1;
+    }
+
+    appended += static_cast<long>(chunk_bytes);
+    offset += static_cast<long>(chunk_bytes / 4);
+    if (bytes_after == 0 || chunk_bytes == 0) {
+      break;
+    }
+    if (max_bytes_ != 0 && data_.size() > max_bytes_) {
+      break;
+    }
+  }
+  XDeleteProperty(xdisplay, window_, property_);
+  XFlush(xdisplay);
+  return appended;
+#else
+  return -1;
+#endif
+}
+
+void X11SelectionReader::ReportProgress() {
+  if (progress_) {
+    progress_(data_.size(), expected_bytes_);
+  }
+}
+
+void X11SelectionReader::RestartStallTimeout() {
+  if (stall_source_ != 0) {
+    g_source_remove(stall_source_);
+  }
+  stall_source_ = g_timeout_add(kStallTimeoutMs, OnStallTimeout, this);
+}
+
+// static
+gboolean X11SelectionReader::OnStallTimeout(gpointer data) {
+  X11SelectionReader* self = static_cast<X11SelectionReader*>(data);
+  self->stall_source_ = 0;
+  self->Finish("timeout", "The clipboard owner stopped sending data.");
+  return G_SOURCE_REMOVE;
+}
+
+void X11SelectionReader::Finish(const char* error_code,
+                                const std::string& error_message) {
+  Cleanup();
+  DoneCallback done = std::move(done_);
+  PooledBuffer data = std::move(data_);
+  if (error_code != nullptr) {
+    data.Reset();
+  }
+  if (done) {
+    done(std::move(data), error_code, error_message);
+  }
+}
+
+void X11SelectionReader::Cleanup() {
+  if (stall_source_ != 0) {
+    g_source_remove(stall_source_);
+    stall_source_ = 0;
+  }
+#ifdef GDK_WINDOWING_X11
+  if (filtering_) {
+    gdk_window_remove_filter(nullptr, OnEvent, this);
+    filtering_ = false;
+  }
+  if (window_ != 0) {
+    // Destroying the window also drops the property, which tells an INCR
+    // owner that the transfer is over.
+    Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+    XDestroyWindow(xdisplay, window_);
+    XFlush(xdisplay);
+    window_ = 0;
+  }
+#endif
+}
+
+}  // namespace flutter_paste_input
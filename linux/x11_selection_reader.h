@@ -0,0 +1,100 @@
+#ifndef FLUTTER_PLUGIN_X11_SELECTION_READER_H_
+#define FLUTTER_PLUGIN_X11_SELECTION_READER_H_
+
+#include <gtk/gtk.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include "buffer_pool.h"
+
+namespace flutter_paste_input {
+
+// Reads one selection target straight from the X server.
+//
+// GTK assembles INCR transfers (used by owners for anything above the
+// maximum request size) internally and only reports the finished result,
+// with no way to see progress or to stop a transfer of hundreds of MB.
+// This reader speaks ICCCM itself on a private window: it converts the
+// selection, and for INCR deletes each chunk's property to ask for the
+// next, appending chunks to a pooled buffer as they arrive.
+//
+// Only available on X11 sessions; see IsSupported(). Main thread only.
+class X11SelectionReader {
+ public:
+  // Bytes received so far, and the owner's size announcement (a lower
+  // bound for INCR transfers), or 0 if not known yet.
+  using ProgressCallback = std::function<void(size_t received, size_t expected)>;
+
+  // Receives the data, or an error code with a message: "refused" if the
+  // owner cannot convert to the target, "too-large" once the size cap is
+  // exceeded, "timeout" if the owner stalls. May destroy the reader.
+  using DoneCallback = std::function<void(PooledBuffer data, const char* error_code,
+                                          const std::string& error_message)>;
+
+  // How long the owner may go without sending anything.
+  static constexpr guint kStallTimeoutMs = 5000;
+
+  // Returns true if |display| is served by the X11 backend.
+  static bool IsSupported(GdkDisplay* display);
+
+  // |max_bytes| of 0 disables the size cap.
+  X11SelectionReader(GdkDisplay* display, GdkAtom selection, GdkAtom target,
+                     size_t max_bytes, ProgressCallback progress,
+                     DoneCallback done);
+
+  // Abandons an unfinished transfer; no callback runs afterwards.
+  ~X11SelectionReader();
+
+  // Disallow copy and assign.
+  X11SelectionReader(const X11SelectionReader&) = delete;
+  X11SelectionReader& operator=(const X11SelectionReader&) = delete;
+
+  // Requests the conversion. Returns false if the transfer cannot start,
+  // in which case no callback runs.
+  bool Start();
+
+ private:
+  // Xlib's Window and Atom, kept out of this header.
+  using XId = unsigned long;
+
+  static GdkFilterReturn OnEvent(GdkXEvent* xevent, GdkEvent* event, gpointer data);
+  static gboolean OnStallTimeout(gpointer data);
+
+  void HandleSelectionNotify(XId property);
+  void HandleNewChunk();
+
+  // Appends the current property value to |data_| and deletes the
+  // property. Returns the number of bytes appended, or -1 on failure.
+  long ReadProperty();
+
+  void ReportProgress();
+  void RestartStallTimeout();
+
+  // Releases X resources, then calls |done_|; must be the last thing the
+  // caller does with |this|.
+  void Finish(const char* error_code, const std::string& error_message);
+  void Cleanup();
+
+  GdkDisplay* display_;
+  GdkAtom selection_;
+  GdkAtom target_;
+  size_t max_bytes_;
+  ProgressCallback progress_;
+  DoneCallback done_;
+
+  XId window_ = 0;
+  XId property_ = 0;
+  XId incr_atom_ = 0;
+  bool filtering_ = false;
+  bool incremental_ = false;
+  guint stall_source_ = 0;
+
+  PooledBuffer data_;
+  size_t expected_bytes_ = 0;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_X11_SELECTION_READER_H_
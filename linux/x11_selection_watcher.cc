@@ -0,0 +1,163 @@
+#include "x11_selection_watcher.h"
+
+#include <algorithm>
+
+#if defined(GDK_WINDOWING_X11) && defined(FLUTTER_PASTE_INPUT_HAVE_XFIXES)
+#include <X11/extensions/Xfixes.h>
+#include <gdk/gdkx.h>
+#define FLUTTER_PASTE_INPUT_USE_XFIXES
+#endif
+
+namespace flutter_paste_input {
+
+// static
+bool X11SelectionWatcher::IsSupported(GdkDisplay* display) {
+#ifdef FLUTTER_PASTE_INPUT_USE_XFIXES
+  if (display == nullptr || !GDK_IS_X11_DISPLAY(display)) {
+    return false;
+  }
+  int event_base = 0;
+  int error_base = 0;
+  return XFixesQueryExtension(gdk_x11_display_get_xdisplay(display), &event_base,
+                              &error_base);
+#else
+  return false;
+#endif
+}
+
+X11SelectionWatcher::X11SelectionWatcher(GdkDisplay* display) : display_(display) {
+#ifdef FLUTTER_PASTE_INPUT_USE_XFIXES
+  if (!IsSupported(display_)) {
+    return;
+  }
+  Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+  int error_base = 0;
+  XFixesQueryExtension(xdisplay, &event_base_, &error_base);
+  // Selection input is tracked per client and window; a window of our own
+  // keeps GDK's selection on the root window untouched.
+  window_ = XCreateSimpleWindow(xdisplay, DefaultRootWindow(xdisplay), 0, 0, 1, 1,
+                                0, 0, 0);
+  gdk_window_add_filter(nullptr, OnEvent, this);
+  filtering_ = true;
+#endif
+}
+
+X11SelectionWatcher::~X11SelectionWatcher() {
+#ifdef FLUTTER_PASTE_INPUT_USE_XFIXES
+  if (filtering_) {
+    gdk_window_remove_filter(nullptr, OnEvent, this);
+  }
+  if (window_ != 0) {
+    // Destroying the window ends its selection input as well.
+    Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+    XDestroyWindow(xdisplay, window_);
+    XFlush(xdisplay);
+  }
+#endif
+}
+
+bool X11SelectionWatcher::Watch(GdkAtom selection) {
+#ifdef FLUTTER_PASTE_INPUT_USE_XFIXES
+  if (window_ == 0) {
+    return false;
+  }
+  if (state(selection) != nullptr) {
+    return true;
+  }
+  Display* xdisplay = gdk_x11_display_get_xdisplay(display_);
+  Atom atom = gdk_x11_atom_to_xatom_for_display(display_, selection);
+
+  // The current owner is the baseline; its timestamp only arrives with the
+  // next change.
+  Watched watched = {selection, atom, {}};
+  watched.state.owner = XGetSelectionOwner(xdisplay, atom);
+  watched_.push_back(watched);
+
+  XFixesSelectSelectionInput(xdisplay, window_, atom,
+                             XFixesSetSelectionOwnerNotifyMask |
+                                 XFixesSelectionWindowDestroyNotifyMask |
+                                 XFixesSelectionClientCloseNotifyMask);
+  XFlush(xdisplay);
+  return true;
+#else
+  return false;
+#endif
+}
+
+const X11SelectionWatcher::OwnerState* X11SelectionWatcher::state(
+    GdkAtom selection) const {
+  for (const Watched& watched : watched_) {
+    if (watched.selection == selection) {
+      return &watched.state;
+    }
+  }
+  return nullptr;
+}
+
+int X11SelectionWatcher::AddChangeListener(ChangeListener listener) {
+  int id = next_listener_id_++;
+  listeners_.push_back({id, std::move(listener)});
+  return id;
+}
+
+void X11SelectionWatcher::RemoveChangeListener(int id) {
+  listeners_.erase(std::remove_if(listeners_.begin(), listeners_.end(),
+                                  [id](const Listener& listener) {
+                                    return listener.id == id;
+                                  }),
+                   listeners_.end());
+}
+
+// static
+GdkFilterReturn X11SelectionWatcher::OnEvent(GdkXEvent* xevent, GdkEvent* event,
+                                             gpointer data) {
+#ifdef FLUTTER_PASTE_INPUT_USE_XFIXES
+  X11SelectionWatcher* self = static_cast<X11SelectionWatcher*>(data);
+  XEvent* x_event = static_cast<XEvent*>(xevent);
+  if (x_event->type != self->event_base_ + XFixesSelectionNotify) {
+    return GDK_FILTER_CONTINUE;
+  }
+  XFixesSelectionNotifyEvent* notify =
+      reinterpret_cast<XFixesSelectionNotifyEvent*>(x_event);
+  if (notify->window != self->window_) {
+    return GDK_FILTER_CONTINUE;
+  }
+  self->HandleOwnerChange(notify->selection, notify->owner,
+                          static_cast<guint32>(notify->selection_timestamp));
+  // GDK may have selected the same events for its own windows; those
+  // arrive separately, so this one is ours alone.
+  return GDK_FILTER_REMOVE;
+#else
+  return GDK_FILTER_CONTINUE;
+#endif
+}
+
+void X11SelectionWatcher::HandleOwnerChange(unsigned long selection,
+                                            unsigned long owner,
+                                            guint32 timestamp) {
+  auto it = std::find_if(watched_.begin(), watched_.end(),
+                         [selection](const Watched& watched) {
+                           return watched.atom == selection;
+                         });
+  if (it == watched_.end()) {
+    return;
+  }
+  // The same owner re-asserting at the same time is not a change.
+  if (it->state.change_count > 0 && it->state.owner == owner &&
+      it->state.timestamp == timestamp) {
+    return;
+  }
+  it->state.owner = owner;
+  it->state.timestamp = timestamp;
+  it->state.change_count++;
+
+  GdkAtom changed = it->selection;
+  OwnerState state = it->state;
+  // Copied, as a listener may remove itself.
+  std::vector<Listener> listeners = listeners_;
+  for (const Listener& listener : listeners) {
+    listener.callback(changed, state);
+  }
+}
+
+}  // namespace flutter_paste_input
@@ -0,0 +1,87 @@
+#ifndef FLUTTER_PLUGIN_X11_SELECTION_WATCHER_H_
+#define FLUTTER_PLUGIN_X11_SELECTION_WATCHER_H_
+
+#include <gtk/gtk.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace flutter_paste_input {
+
+// Follows selection ownership through the X server's XFixes extension.
+//
+// GTK only reports owner changes through a live GtkClipboard and after its
+// own bookkeeping. XFixes delivers SelectionNotify events straight from the
+// server with the new owner window and the time it took the selection,
+// without asking the owner for anything. Every change is recorded, so a
+// cache can be invalidated exactly rather than by polling.
+//
+// Requires an X11 display with XFixes; see IsSupported(). Main thread only.
+class X11SelectionWatcher {
+ public:
+  // Ownership of one selection as last reported by the server.
+  struct OwnerState {
+    // Owner window, or 0 if the selection has no owner.
+    unsigned long owner = 0;
+    // Server time at which the owner took the selection.
+    guint32 timestamp = 0;
+    // Number of owner changes seen since watching started.
+    int64_t change_count = 0;
+  };
+
+  // Called after |selection| changed hands; |state| is the new state.
+  using ChangeListener =
+      std::function<void(GdkAtom selection, const OwnerState& state)>;
+
+  // Returns true if |display| is an X11 display with XFixes 1.0 or later.
+  static bool IsSupported(GdkDisplay* display);
+
+  explicit X11SelectionWatcher(GdkDisplay* display);
+  ~X11SelectionWatcher();
+
+  // Disallow copy and assign.
+  X11SelectionWatcher(const X11SelectionWatcher&) = delete;
+  X11SelectionWatcher& operator=(const X11SelectionWatcher&) = delete;
+
+  // Starts following |selection|. Returns false if XFixes is unavailable.
+  bool Watch(GdkAtom selection);
+
+  // Returns the state of a watched selection, or nullptr.
+  const OwnerState* state(GdkAtom selection) const;
+
+  // Returns an id for RemoveChangeListener().
+  int AddChangeListener(ChangeListener listener);
+  void RemoveChangeListener(int id);
+
+ private:
+  struct Listener {
+    int id;
+    ChangeListener callback;
+  };
+
+  struct Watched {
+    GdkAtom selection;
+    unsigned long atom;
+    OwnerState state;
+  };
+
+  static GdkFilterReturn OnEvent(GdkXEvent* xevent, GdkEvent* event, gpointer data);
+
+  void HandleOwnerChange(unsigned long selection, unsigned long owner,
+                         guint32 timestamp);
+
+  GdkDisplay* display_;
+  // Private window the selection events are delivered to.
+  unsigned long window_ = 0;
+  int event_base_ = 0;
+  bool filtering_ = false;
+
+  std::vector<Watched> watched_;
+  std::vector<Listener> listeners_;
+  int next_listener_id_ = 1;
+};
+
+}  // namespace flutter_paste_input
+
+#endif  // FLUTTER_PLUGIN_X11_SELECTION_WATCHER_H_
@@ -89,22 +89,59 @@ struct ClipboardItem {
   /// - "image/gif" for GIF images
   /// - "image/webp" for WebP images
   var mimeType: String
+  /// Width of the image in pixels.
+  ///
+  /// Only set for image items, and only when the platform knows the
+  /// dimensions without decoding the bytes on the Dart side.
+  var width: Int64? = nil
+  /// Height of the image in pixels.
+  ///
+  /// Only set for image items, see [width].
+  var height: Int64? = nil
+  /// Whether the image has an alpha channel.
+  ///
+  /// Only set for image items.
+  var hasAlpha: Bool? = nil
+  /// Number of frames in the image (greater than 1 for animations).
+  ///
+  /// Only set for image items.
+  var frameCount: Int64? = nil
+  /// Size in bytes of the clipboard representation the item was read from.
+  ///
+  /// For images that are re-encoded natively (e.g. a bitmap converted to
+  /// PNG), this is the size of the source data rather than [data].
+  var originalByteSize: Int64? = nil
 
 
   // swift-format-ignore: AlwaysUseLowerCamelCase
   static func fromList(_ pigeonVar_list: [Any?]) -> ClipboardItem? {
     let data = pigeonVar_list[0] as! FlutterStandardTypedData
     let mimeType = pigeonVar_list[1] as! String
+    let width: Int64? = nilOrValue(pigeonVar_list[2])
+    let height: Int64? = nilOrValue(pigeonVar_list[3])
+    let hasAlpha: Bool? = nilOrValue(pigeonVar_list[4])
+    let frameCount: Int64? = nilOrValue(pigeonVar_list[5])
+    let originalByteSize: Int64? = nilOrValue(pigeonVar_list[6])
 
     return ClipboardItem(
       data: data,
-      mimeType: mimeType
+      mimeType: mimeType,
+      width: width,
+      height: height,
+      hasAlpha: hasAlpha,
+      frameCount: frameCount,
+      originalByteSize: originalByteSize
     )
   }
   func toList() -> [Any?] {
     return [
       data,
       mimeType,
+      width,
+      height,
+      hasAlpha,
+      frameCount,
+      originalByteSize,
     ]
   }
 }
@@ -120,19 +157,461 @@ struct ClipboardContent {
   ///
   /// May be empty if the clipboard is empty or contains unsupported content.
   var items: [ClipboardItem]
+  /// Most bytes the platform held at once while reading, converting and
+  /// sending this content (Linux).
+  var peakMemoryBytes: Int64? = nil
 
 
   // swift-format-ignore: AlwaysUseLowerCamelCase
   static func fromList(_ pigeonVar_list: [Any?]) -> ClipboardContent? {
     let items = pigeonVar_list[0] as! [ClipboardItem]
+    let peakMemoryBytes: Int64? = nilOrValue(pigeonVar_list[1])
 
     return ClipboardContent(
-      items: items
+      items: items,
+      peakMemoryBytes: peakMemoryBytes
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      items,
+      peakMemoryBytes,
+    ]
+  }
+}
+
+/// Cheap summary of the clipboard state, obtained without reading any data.
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct ClipboardProbe {
+  /// Counter that increases every time the clipboard contents change.
+  ///
+  /// Only meaningful when compared with an earlier value from the same
+  /// process; the absolute value is platform specific.
+  var changeCount: Int64
+  /// MIME types currently offered by the clipboard owner.
+  ///
+  /// Text formats are reported as "text/plain" regardless of the
+  /// platform's native name for them.
+  var mimeTypes: [String]
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> ClipboardProbe? {
+    let changeCount = pigeonVar_list[0] as! Int64
+    let mimeTypes = pigeonVar_list[1] as! [String]
+
+    return ClipboardProbe(
+      changeCount: changeCount,
+      mimeTypes: mimeTypes
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      changeCount,
+      mimeTypes,
+    ]
+  }
+}
+
+/// Tuning options for the native paste pipeline.
+///
+/// Every field is optional; null leaves the current setting unchanged.
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct PasteInputConfig {
+  /// How long, in milliseconds, a completed clipboard read is reused for
+  /// further paste requests while the clipboard is unchanged.
+  ///
+  /// Requests arriving while a read is in flight always share it. This
+  /// covers key repeat from a held-down Ctrl+V.
+  var coalesceWindowMs: Int64? = nil
+  /// Maximum number of paste requests that may wait on an in-flight read.
+  ///
+  /// Further requests fail with the error code "busy".
+  var maxPendingReads: Int64? = nil
+  /// Maximum number of [PasteInputFlutterApi.onPasteDetected] events sent
+  /// before Dart has handled them (Linux).
+  ///
+  /// Events beyond the limit are held back and only the newest is kept, so
+  /// a burst of pastes never queues several stale payloads.
+  var maxOutstandingEvents: Int64? = nil
+  /// Upper bound, in bytes, on the native memory held by pastes in flight
+  /// and by their results, shared by all engines in the process (Linux).
+  ///
+  /// An image paste that does not fit waits for earlier pastes to release
+  /// their buffers. One that could never fit is downscaled (see
+  /// [downscaleOverBudgetImages]) or fails with the error code
+  /// "over-budget". 0 disables the limit; the default is 512 MiB.
+  var memoryBudgetBytes: Int64? = nil
+  /// Whether images too large for [memoryBudgetBytes] are downscaled rather
+  /// than refused. Defaults to true.
+  var downscaleOverBudgetImages: Bool? = nil
+  /// Largest clipboard selection, in bytes, that is transferred before the
+  /// paste fails with the error code "too-large" (Linux, X11). 0 disables
+  /// the limit; the default is 256 MiB.
+  var maxTransferBytes: Int64? = nil
+  /// Most bytes of content set with [PasteInputHostApi.setClipboardContent]
+  /// handed to the clipboard manager when the app exits, so that it stays
+  /// pasteable (Linux).
+  ///
+  /// Text is offered first, then the image as given, then rendered formats
+  /// in order; each format that would exceed the limit is left out, so a
+  /// compact rendered format is kept even when the original image is too
+  /// large. 0 disables the limit; the default is 64 MiB.
+  var clipboardStoreMaxBytes: Int64? = nil
+  /// Time, in milliseconds, the app may spend at exit rendering formats not
+  /// requested yet for the clipboard manager (Linux). Formats not rendered
+  /// in time are left out; an encode still running at the deadline stops at
+  /// its next output chunk. Decoding the source image, done once, is not
+  /// interrupted. 0 disables the limit; the default is 1000.
+  var clipboardStoreTimeBudgetMs: Int64? = nil
+  /// Most clipboard snapshots kept in the history (Linux).
+  ///
+  /// Every successful read is recorded; content already in the history
+  /// moves to the front instead of being added again. 0 disables the
+  /// history and drops what it holds; the default is 50.
+  var historyMaxEntries: Int64? = nil
+  /// Upper bound, in bytes, on the memory held by the history (Linux).
+  ///
+  /// Text is kept compressed and counts with its compressed size. The
+  /// oldest entries are dropped first. 0 disables the limit; the default
+  /// is 32 MiB.
+  ///
+  /// With [persistHistory] set, entries over the limit are only dropped
+  /// from memory and read back from disk when fetched.
+  var historyMaxBytes: Int64? = nil
+  /// Whether the history is kept on disk, under the user cache directory,
+  /// so that it survives restarts (Linux).
+  ///
+  /// Off by default, as clipboard content may be sensitive. Turning it off
+  /// deletes the files.
+  var persistHistory: Bool? = nil
+  /// Upper bound, in bytes, on the disk space used by a persisted history
+  /// (Linux). The oldest entries are dropped first. 0 disables the limit;
+  /// the default is 128 MiB.
+  var historyMaxDiskBytes: Int64? = nil
+  /// File the paste pipeline trace is written to when the app exits
+  /// (Linux).
+  ///
+  /// Setting it starts recording the begin and end of every pipeline stage
+  /// and worker thread job; an empty string stops recording. The file is
+  /// Chrome trace JSON, for Perfetto or chrome://tracing. See also
+  /// [PasteInputHostApi.dumpPasteTrace].
+  var traceFile: String? = nil
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> PasteInputConfig? {
+    let coalesceWindowMs: Int64? = nilOrValue(pigeonVar_list[0])
+    let maxPendingReads: Int64? = nilOrValue(pigeonVar_list[1])
+    let maxOutstandingEvents: Int64? = nilOrValue(pigeonVar_list[2])
+    let memoryBudgetBytes: Int64? = nilOrValue(pigeonVar_list[3])
+    let downscaleOverBudgetImages: Bool? = nilOrValue(pigeonVar_list[4])
+    let maxTransferBytes: Int64? = nilOrValue(pigeonVar_list[5])
+    let clipboardStoreMaxBytes: Int64? = nilOrValue(pigeonVar_list[6])
+    let clipboardStoreTimeBudgetMs: Int64? = nilOrValue(pigeonVar_list[7])
+    let historyMaxEntries: Int64? = nilOrValue(pigeonVar_list[8])
+    let historyMaxBytes: Int64? = nilOrValue(pigeonVar_list[9])
+    let persistHistory: Bool? = nilOrValue(pigeonVar_list[10])
+    let historyMaxDiskBytes: Int64? = nilOrValue(pigeonVar_list[11])
+    let traceFile: String? = nilOrValue(pigeonVar_list[12])
+
+    return PasteInputConfig(
+      coalesceWindowMs: coalesceWindowMs,
+      maxPendingReads: maxPendingReads,
+      maxOutstandingEvents: maxOutstandingEvents,
+      memoryBudgetBytes: memoryBudgetBytes,
+      downscaleOverBudgetImages: downscaleOverBudgetImages,
+      maxTransferBytes: maxTransferBytes,
+      clipboardStoreMaxBytes: clipboardStoreMaxBytes,
+      clipboardStoreTimeBudgetMs: clipboardStoreTimeBudgetMs,
+      historyMaxEntries: historyMaxEntries,
+      historyMaxBytes: historyMaxBytes,
+      persistHistory: persistHistory,
+      historyMaxDiskBytes: historyMaxDiskBytes,
+      traceFile: traceFile
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      coalesceWindowMs,
+      maxPendingReads,
+      maxOutstandingEvents,
+      memoryBudgetBytes,
+      downscaleOverBudgetImages,
+      maxTransferBytes,
+      clipboardStoreMaxBytes,
+      clipboardStoreTimeBudgetMs,
+      historyMaxEntries,
+      historyMaxBytes,
+      persistHistory,
+      historyMaxDiskBytes,
+      traceFile,
+    ]
+  }
+}
+
+/// Progress of a large clipboard transfer for a pending
+/// [PasteInputHostApi.getClipboardContent] request (Linux, X11).
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct PasteProgress {
+  /// The id the request was made with.
+  var requestId: Int64
+  /// Bytes received from the clipboard owner so far.
+  var receivedBytes: Int64
+  /// Size announced by the owner, if any. For incremental transfers this
+  /// is only a lower bound.
+  var expectedBytes: Int64? = nil
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> PasteProgress? {
+    let requestId = pigeonVar_list[0] as! Int64
+    let receivedBytes = pigeonVar_list[1] as! Int64
+    let expectedBytes: Int64? = nilOrValue(pigeonVar_list[2])
+
+    return PasteProgress(
+      requestId: requestId,
+      receivedBytes: receivedBytes,
+      expectedBytes: expectedBytes
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      requestId,
+      receivedBytes,
+      expectedBytes,
+    ]
+  }
+}
+
+/// Content placed on the clipboard by
+/// [PasteInputHostApi.setClipboardContent].
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct ClipboardWrite {
+  /// Plain text to offer.
+  var text: String? = nil
+  /// Encoded image to offer, in the format given by [imageMimeType].
+  var image: FlutterStandardTypedData? = nil
+  /// MIME type of [image], e.g. "image/png". Required with [image].
+  var imageMimeType: String? = nil
+  /// Further image formats to offer, e.g. "image/jpeg" or "image/bmp".
+  ///
+  /// On Linux each is rendered from [image] only when another application
+  /// asks for it, and kept once rendered. Other platforms offer [image] in
+  /// its own format only.
+  var renderedImageTypes: [String]? = nil
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> ClipboardWrite? {
+    let text: String? = nilOrValue(pigeonVar_list[0])
+    let image: FlutterStandardTypedData? = nilOrValue(pigeonVar_list[1])
+    let imageMimeType: String? = nilOrValue(pigeonVar_list[2])
+    let renderedImageTypes: [String]? = nilOrValue(pigeonVar_list[3])
+
+    return ClipboardWrite(
+      text: text,
+      image: image,
+      imageMimeType: imageMimeType,
+      renderedImageTypes: renderedImageTypes
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      text,
+      image,
+      imageMimeType,
+      renderedImageTypes,
+    ]
+  }
+}
+
+/// Metadata of one clipboard history entry, see
+/// [PasteInputHostApi.listClipboardHistory].
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct ClipboardHistoryEntry {
+  /// Identifies the entry for [PasteInputHostApi.getClipboardHistoryEntry].
+  /// Ids are never reused within a process.
+  var id: Int64
+  /// When the content was last read from the clipboard, in milliseconds
+  /// since the Unix epoch.
+  var capturedAtMs: Int64
+  /// MIME types of the entry's items, images first.
+  var mimeTypes: [String]
+  /// Size of the content as it was pasted, before compression.
+  var byteSize: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> ClipboardHistoryEntry? {
+    let id = pigeonVar_list[0] as! Int64
+    let capturedAtMs = pigeonVar_list[1] as! Int64
+    let mimeTypes = pigeonVar_list[2] as! [String]
+    let byteSize = pigeonVar_list[3] as! Int64
+
+    return ClipboardHistoryEntry(
+      id: id,
+      capturedAtMs: capturedAtMs,
+      mimeTypes: mimeTypes,
+      byteSize: byteSize
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      id,
+      capturedAtMs,
+      mimeTypes,
+      byteSize,
+    ]
+  }
+}
+
+/// A clipboard history entry matching a search, see
+/// [PasteInputHostApi.searchClipboardHistory].
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct ClipboardHistoryMatch {
+  /// The entry, as in [ClipboardHistoryEntry.id].
+  var id: Int64
+  /// Occurrences of the query's terms in the entry's text.
+  var matchCount: Int64
+  /// Where matches start in the entry's text, in UTF-16 code units as Dart
+  /// strings index them, in ascending order. At most 64 are reported.
+  var matchStarts: [Int64]
+  /// Where the matches in [matchStarts] end, exclusive.
+  var matchEnds: [Int64]
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> ClipboardHistoryMatch? {
+    let id = pigeonVar_list[0] as! Int64
+    let matchCount = pigeonVar_list[1] as! Int64
+    let matchStarts = pigeonVar_list[2] as! [Int64]
+    let matchEnds = pigeonVar_list[3] as! [Int64]
+
+    return ClipboardHistoryMatch(
+      id: id,
+      matchCount: matchCount,
+      matchStarts: matchStarts,
+      matchEnds: matchEnds
     )
   }
   func toList() -> [Any?] {
     return [
-      items
+      id,
+      matchCount,
+      matchStarts,
+      matchEnds,
+    ]
+  }
+}
+
+/// Timings of one stage of the native paste pipeline, see
+/// [PasteInputHostApi.getPasteStats].
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct PasteStageStats {
+  /// The stage: "selection" (waiting on the clipboard owner), "decode",
+  /// "encode" (PNG), "serialize" (building the reply), "dart" (from
+  /// sending a paste event until Dart has handled it) or "total" (from the
+  /// paste request reaching the plugin until the reply is sent or the paste
+  /// event handled).
+  var stage: String
+  /// Runs of the stage since the last reset.
+  var count: Int64
+  /// Time spent in the stage, in microseconds.
+  var totalMicros: Int64
+  /// Longest single run, in microseconds.
+  var maxMicros: Int64
+  /// Bytes the stage consumed and produced.
+  var bytesIn: Int64
+  var bytesOut: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> PasteStageStats? {
+    let stage = pigeonVar_list[0] as! String
+    let count = pigeonVar_list[1] as! Int64
+    let totalMicros = pigeonVar_list[2] as! Int64
+    let maxMicros = pigeonVar_list[3] as! Int64
+    let bytesIn = pigeonVar_list[4] as! Int64
+    let bytesOut = pigeonVar_list[5] as! Int64
+
+    return PasteStageStats(
+      stage: stage,
+      count: count,
+      totalMicros: totalMicros,
+      maxMicros: maxMicros,
+      bytesIn: bytesIn,
+      bytesOut: bytesOut
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      stage,
+      count,
+      totalMicros,
+      maxMicros,
+      bytesIn,
+      bytesOut,
+    ]
+  }
+}
+
+/// Latency percentiles of one stage of the native paste pipeline for one
+/// kind of content, see [PasteInputHostApi.getPasteLatencies].
+///
+/// Generated class from Pigeon that represents data sent in messages.
+struct PasteLatencyStats {
+  /// The stage, as in [PasteStageStats.stage].
+  var stage: String
+  /// What was pasted: "text", "small-image" or "large-image" (at least
+  /// 1024 x 1024 pixels).
+  var contentClass: String
+  /// Runs of the stage since the last reset.
+  var count: Int64
+  /// Percentiles, in microseconds, within about 6% of the exact value.
+  var p50Micros: Int64
+  var p90Micros: Int64
+  var p99Micros: Int64
+  /// Longest single run, in microseconds.
+  var maxMicros: Int64
+
+
+  // swift-format-ignore: AlwaysUseLowerCamelCase
+  static func fromList(_ pigeonVar_list: [Any?]) -> PasteLatencyStats? {
+    let stage = pigeonVar_list[0] as! String
+    let contentClass = pigeonVar_list[1] as! String
+    let count = pigeonVar_list[2] as! Int64
+    let p50Micros = pigeonVar_list[3] as! Int64
+    let p90Micros = pigeonVar_list[4] as! Int64
+    let p99Micros = pigeonVar_list[5] as! Int64
+    let maxMicros = pigeonVar_list[6] as! Int64
+
+    return PasteLatencyStats(
+      stage: stage,
+      contentClass: contentClass,
+      count: count,
+      p50Micros: p50Micros,
+      p90Micros: p90Micros,
+      p99Micros: p99Micros,
+      maxMicros: maxMicros
+    )
+  }
+  func toList() -> [Any?] {
+    return [
+      stage,
+      contentClass,
+      count,
+      p50Micros,
+      p90Micros,
+      p99Micros,
+      maxMicros,
     ]
   }
 }
@@ -144,6 +623,22 @@ private class MessagesPigeonCodecReader: FlutterStandardReader {
       return ClipboardItem.fromList(self.readValue() as! [Any?])
     case 130:
       return ClipboardContent.fromList(self.readValue() as! [Any?])
+    case 131:
+      return ClipboardProbe.fromList(self.readValue() as! [Any?])
+    case 132:
+      return PasteInputConfig.fromList(self.readValue() as! [Any?])
+    case 133:
+      return PasteProgress.fromList(self.readValue() as! [Any?])
+    case 134:
+      return ClipboardWrite.fromList(self.readValue() as! [Any?])
+    case 135:
+      return ClipboardHistoryEntry.fromList(self.readValue() as! [Any?])
+    case 136:
+      return ClipboardHistoryMatch.fromList(self.readValue() as! [Any?])
+    case 137:
+      return PasteStageStats.fromList(self.readValue() as! [Any?])
+    case 138:
+      return PasteLatencyStats.fromList(self.readValue() as! [Any?])
     default:
       return super.readValue(ofType: type)
     }
@@ -158,6 +653,30 @@ private class MessagesPigeonCodecWriter: FlutterStandardWriter {
     } else if let value = value as? ClipboardContent {
       super.writeByte(130)
       super.writeValue(value.toList())
+    } else if let value = value as? ClipboardProbe {
+      super.writeByte(131)
+      super.writeValue(value.toList())
+    } else if let value = value as? PasteInputConfig {
+      super.writeByte(132)
+      super.writeValue(value.toList())
+    } else if let value = value as? PasteProgress {
+      super.writeByte(133)
+      super.writeValue(value.toList())
+    } else if let value = value as? ClipboardWrite {
+      super.writeByte(134)
+      super.writeValue(value.toList())
+    } else if let value = value as? ClipboardHistoryEntry {
+      super.writeByte(135)
+      super.writeValue(value.toList())
+    } else if let value = value as? ClipboardHistoryMatch {
+      super.writeByte(136)
+      super.writeValue(value.toList())
+    } else if let value = value as? PasteStageStats {
+      super.writeByte(137)
+      super.writeValue(value.toList())
+    } else if let value = value as? PasteLatencyStats {
+      super.writeByte(138)
+      super.writeValue(value.toList())
     } else {
       super.writeValue(value)
     }
@@ -192,7 +711,13 @@ protocol PasteInputHostApi {
   ///
   /// Returns an empty [ClipboardContent] if the clipboard is empty or
   /// contains only unsupported content types.
-  func getClipboardContent() throws -> ClipboardContent
+  ///
+  /// Requests made while a read is in progress, or shortly after one
+  /// completed (see [PasteInputConfig.coalesceWindowMs]), share its result.
+  ///
+  /// [requestId] identifies the request for [cancelPaste]; 0 means the
+  /// request cannot be cancelled.
+  func getClipboardContent(requestId: Int64, completion: @escaping (Result<ClipboardContent, Error>) -> Void)
   /// Clears temporary files created during paste operations.
   ///
   /// Call this periodically to free up disk space. Paste operations may
@@ -203,6 +728,81 @@ protocol PasteInputHostApi {
   /// Useful for debugging and platform-specific behavior.
   /// Example: "Android 14", "iOS 17.0", "macOS 14.0"
   func getPlatformVersion() throws -> String
+  /// Returns the clipboard change counter and the available MIME types.
+  ///
+  /// This is served from state the platform already tracks and transfers
+  /// no clipboard payload, so it is cheap enough to call while building UI
+  /// (e.g. to decide whether a paste button should be enabled).
+  func probeClipboard(completion: @escaping (Result<ClipboardProbe, Error>) -> Void)
+  /// Applies tuning options to the native paste pipeline.
+  ///
+  /// On Linux and Windows the clipboard cache is shared by all Flutter
+  /// engines in the process, so the options apply to every engine.
+  func configure(config: PasteInputConfig) throws
+  /// Hints that a paste is likely soon, e.g. because a text field gained
+  /// focus.
+  ///
+  /// Where supported (Linux), the clipboard is read and encoded in the
+  /// background at idle priority so that the next [getClipboardContent]
+  /// is served from the warm snapshot. Elsewhere this is a no-op.
+  func prefetchClipboard() throws
+  /// Cancels the [getClipboardContent] request with the given id.
+  ///
+  /// The request fails with the error code "cancelled". Native work that no
+  /// other request is waiting on is abandoned and its buffers released.
+  /// Unknown or already completed ids are ignored.
+  func cancelPaste(requestId: Int64) throws
+  /// Releases natively cached clipboard data, as the platform does by
+  /// itself on low-memory warnings where it reports them (Linux).
+  ///
+  /// [level] is 0 (low), 1 (medium) or 2 (critical); higher levels drop
+  /// more, including data that is still fresh. Returns the number of bytes
+  /// released from the plugin's caches.
+  func trimMemory(level: Int64, completion: @escaping (Result<Int64, Error>) -> Void)
+  /// Replaces the clipboard content with [content].
+  ///
+  /// Fails with the error code "invalid-argument" if [content] is empty or
+  /// an image lacks its MIME type, and with "unsupported-format" if a
+  /// requested rendition cannot be produced on this platform.
+  func setClipboardContent(content: ClipboardWrite, completion: @escaping (Result<Void, Error>) -> Void)
+  /// Lists the clipboard history, most recent first, without its content.
+  ///
+  /// Only Linux keeps a history; elsewhere the list is empty.
+  func listClipboardHistory(completion: @escaping (Result<[ClipboardHistoryEntry], Error>) -> Void)
+  /// Returns the content of the history entry with the given [id].
+  ///
+  /// Fails with the error code "not-found" if the entry has been dropped
+  /// from the history, or never existed.
+  func getClipboardHistoryEntry(id: Int64, completion: @escaping (Result<ClipboardContent, Error>) -> Void)
+  /// Searches the text of the clipboard history for [query].
+  ///
+  /// Entries match if their text contains every whitespace-separated term
+  /// of [query], ignoring ASCII case. At most [maxResults] are returned,
+  /// those with the most occurrences first, then the most recent. Only
+  /// Linux keeps a history; elsewhere the list is empty.
+  func searchClipboardHistory(query: String, maxResults: Int64, completion: @escaping (Result<[ClipboardHistoryMatch], Error>) -> Void)
+  /// Returns the time spent in each stage of the paste pipeline since the
+  /// last [resetPasteStats].
+  ///
+  /// Only Linux instruments its pipeline; elsewhere the list is empty.
+  func getPasteStats(completion: @escaping (Result<[PasteStageStats], Error>) -> Void)
+  /// Zeroes the counters reported by [getPasteStats] and
+  /// [getPasteLatencies].
+  func resetPasteStats(completion: @escaping (Result<Void, Error>) -> Void)
+  /// Returns latency percentiles of each stage of the paste pipeline, and
+  /// end to end, per kind of content, since the last [resetPasteStats].
+  /// Combinations without runs are left out.
+  ///
+  /// Only Linux instruments its pipeline; elsewhere the list is empty.
+  func getPasteLatencies(completion: @escaping (Result<[PasteLatencyStats], Error>) -> Void)
+  /// Writes the paste pipeline activity recorded since tracing was started
+  /// with [PasteInputConfig.traceFile] to [path] as Chrome trace JSON.
+  /// Recording goes on.
+  ///
+  /// Returns the number of events written, or fails with the error code
+  /// "write-failed" if the file cannot be written. Only Linux records a
+  /// trace; elsewhere no file is written and 0 is returned.
+  func dumpPasteTrace(path: String, completion: @escaping (Result<Int64, Error>) -> Void)
 }
 
 /// Generated setup class from Pigeon to handle messages through the `binaryMessenger`.
@@ -219,14 +819,24 @@ class PasteInputHostApiSetup {
     ///
     /// Returns an empty [ClipboardContent] if the clipboard is empty or
     /// contains only unsupported content types.
+    ///
+    /// Requests made while a read is in progress, or shortly after one
+    /// completed (see [PasteInputConfig.coalesceWindowMs]), share its result.
+    ///
+    /// [requestId] identifies the request for [cancelPaste]; 0 means the
+    /// request cannot be cancelled.
     let getClipboardContentChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardContent\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
     if let api = api {
-      getClipboardContentChannel.setMessageHandler { _, reply in
-        do {
-          let result = try api.getClipboardContent()
-          reply(wrapResult(result))
-        } catch {
-          reply(wrapError(error))
+      getClipboardContentChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let requestIdArg = args[0] as! Int64
+        api.getClipboardContent(requestId: requestIdArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
         }
       }
     } else {
@@ -266,6 +876,272 @@ class PasteInputHostApiSetup {
     } else {
       getPlatformVersionChannel.setMessageHandler(nil)
     }
+    /// Returns the clipboard change counter and the available MIME types.
+    ///
+    /// This is served from state the platform already tracks and transfers
+    /// no clipboard payload, so it is cheap enough to call while building UI
+    /// (e.g. to decide whether a paste button should be enabled).
+    let probeClipboardChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.probeClipboard\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      probeClipboardChannel.setMessageHandler { _, reply in
+        api.probeClipboard { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      probeClipboardChannel.setMessageHandler(nil)
+    }
+    /// Applies tuning options to the native paste pipeline.
+    ///
+    /// On Linux and Windows the clipboard cache is shared by all Flutter
+    /// engines in the process, so the options apply to every engine.
+    let configureChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.configure\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      configureChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let configArg = args[0] as! PasteInputConfig
+        do {
+          try api.configure(config: configArg)
+          reply(wrapResult(nil))
+        } catch {
+          reply(wrapError(error))
+        }
+      }
+    } else {
+      configureChannel.setMessageHandler(nil)
+    }
+    /// Hints that a paste is likely soon, e.g. because a text field gained
+    /// focus.
+    ///
+    /// Where supported (Linux), the clipboard is read and encoded in the
+    /// background at idle priority so that the next [getClipboardContent]
+    /// is served from the warm snapshot. Elsewhere this is a no-op.
+    let prefetchClipboardChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.prefetchClipboard\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      prefetchClipboardChannel.setMessageHandler { _, reply in
+        do {
+          try api.prefetchClipboard()
+          reply(wrapResult(nil))
+        } catch {
+          reply(wrapError(error))
+        }
+      }
+    } else {
+      prefetchClipboardChannel.setMessageHandler(nil)
+    }
+    /// Cancels the [getClipboardContent] request with the given id.
+    ///
+    /// The request fails with the error code "cancelled". Native work that no
+    /// other request is waiting on is abandoned and its buffers released.
+    /// Unknown or already completed ids are ignored.
+    let cancelPasteChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.cancelPaste\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      cancelPasteChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let requestIdArg = args[0] as! Int64
+        do {
+          try api.cancelPaste(requestId: requestIdArg)
+          reply(wrapResult(nil))
+        } catch {
+          reply(wrapError(error))
+        }
+      }
+    } else {
+      cancelPasteChannel.setMessageHandler(nil)
+    }
+    /// Releases natively cached clipboard data, as the platform does by
+    /// itself on low-memory warnings where it reports them (Linux).
+    ///
+    /// [level] is 0 (low), 1 (medium) or 2 (critical); higher levels drop
+    /// more, including data that is still fresh. Returns the number of bytes
+    /// released from the plugin's caches.
+    let trimMemoryChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.trimMemory\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      trimMemoryChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let levelArg = args[0] as! Int64
+        api.trimMemory(level: levelArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      trimMemoryChannel.setMessageHandler(nil)
+    }
+    /// Replaces the clipboard content with [content].
+    ///
+    /// Fails with the error code "invalid-argument" if [content] is empty or
+    /// an image lacks its MIME type, and with "unsupported-format" if a
+    /// requested rendition cannot be produced on this platform.
+    let setClipboardContentChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.setClipboardContent\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      setClipboardContentChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let contentArg = args[0] as! ClipboardWrite
+        api.setClipboardContent(content: contentArg) { result in
+          switch result {
+          case .success:
+            reply(wrapResult(nil))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      setClipboardContentChannel.setMessageHandler(nil)
+    }
+    /// Lists the clipboard history, most recent first, without its content.
+    ///
+    /// Only Linux keeps a history; elsewhere the list is empty.
+    let listClipboardHistoryChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.listClipboardHistory\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      listClipboardHistoryChannel.setMessageHandler { _, reply in
+        api.listClipboardHistory { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      listClipboardHistoryChannel.setMessageHandler(nil)
+    }
+    /// Returns the content of the history entry with the given [id].
+    ///
+    /// Fails with the error code "not-found" if the entry has been dropped
+    /// from the history, or never existed.
+    let getClipboardHistoryEntryChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardHistoryEntry\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getClipboardHistoryEntryChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let idArg = args[0] as! Int64
+        api.getClipboardHistoryEntry(id: idArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getClipboardHistoryEntryChannel.setMessageHandler(nil)
+    }
+    /// Searches the text of the clipboard history for [query].
+    ///
+    /// Entries match if their text contains every whitespace-separated term
+    /// of [query], ignoring ASCII case. At most [maxResults] are returned,
+    /// those with the most occurrences first, then the most recent. Only
+    /// Linux keeps a history; elsewhere the list is empty.
+    let searchClipboardHistoryChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.searchClipboardHistory\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      searchClipboardHistoryChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let queryArg = args[0] as! String
+        let maxResultsArg = args[1] as! Int64
+        api.searchClipboardHistory(query: queryArg, maxResults: maxResultsArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      searchClipboardHistoryChannel.setMessageHandler(nil)
+    }
+    /// Returns the time spent in each stage of the paste pipeline since the
+    /// last [resetPasteStats].
+    ///
+    /// Only Linux instruments its pipeline; elsewhere the list is empty.
+    let getPasteStatsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteStats\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getPasteStatsChannel.setMessageHandler { _, reply in
+        api.getPasteStats { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getPasteStatsChannel.setMessageHandler(nil)
+    }
+    /// Zeroes the counters reported by [getPasteStats] and
+    /// [getPasteLatencies].
+    let resetPasteStatsChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.resetPasteStats\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      resetPasteStatsChannel.setMessageHandler { _, reply in
+        api.resetPasteStats { result in
+          switch result {
+          case .success:
+            reply(wrapResult(nil))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      resetPasteStatsChannel.setMessageHandler(nil)
+    }
+    /// Returns latency percentiles of each stage of the paste pipeline, and
+    /// end to end, per kind of content, since the last [resetPasteStats].
+    /// Combinations without runs are left out.
+    ///
+    /// Only Linux instruments its pipeline; elsewhere the list is empty.
+    let getPasteLatenciesChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteLatencies\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      getPasteLatenciesChannel.setMessageHandler { _, reply in
+        api.getPasteLatencies { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      getPasteLatenciesChannel.setMessageHandler(nil)
+    }
+    /// Writes the paste pipeline activity recorded since tracing was started
+    /// with [PasteInputConfig.traceFile] to [path] as Chrome trace JSON.
+    /// Recording goes on.
+    ///
+    /// Returns the number of events written, or fails with the error code
+    /// "write-failed" if the file cannot be written. Only Linux records a
+    /// trace; elsewhere no file is written and 0 is returned.
+    let dumpPasteTraceChannel = FlutterBasicMessageChannel(name: "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.dumpPasteTrace\(channelSuffix)", binaryMessenger: binaryMessenger, codec: codec)
+    if let api = api {
+      dumpPasteTraceChannel.setMessageHandler { message, reply in
+        let args = message as! [Any?]
+        let pathArg = args[0] as! String
+        api.dumpPasteTrace(path: pathArg) { result in
+          switch result {
+          case .success(let res):
+            reply(wrapResult(res))
+          case .failure(let error):
+            reply(wrapError(error))
+          }
+        }
+      }
+    } else {
+      dumpPasteTraceChannel.setMessageHandler(nil)
+    }
   }
 }
 /// Flutter API for paste event notifications (Native -> Dart).
@@ -282,6 +1158,9 @@ protocol PasteInputFlutterApiProtocol {
   /// of the paste event. This allows Flutter to handle the pasted content
   /// immediately without additional clipboard reads.
   func onPasteDetected(content contentArg: ClipboardContent, completion: @escaping (Result<Void, PigeonError>) -> Void)
+  /// Called periodically while a large selection is transferred for a
+  /// [PasteInputHostApi.getClipboardContent] request.
+  func onPasteProgress(progress progressArg: PasteProgress, completion: @escaping (Result<Void, PigeonError>) -> Void)
 }
 class PasteInputFlutterApi: PasteInputFlutterApiProtocol {
   private let binaryMessenger: FlutterBinaryMessenger
@@ -316,4 +1195,24 @@ class PasteInputFlutterApi: PasteInputFlutterApiProtocol {
       }
     }
   }
+  /// Called periodically while a large selection is transferred for a
+  /// [PasteInputHostApi.getClipboardContent] request.
+  func onPasteProgress(progress progressArg: PasteProgress, completion: @escaping (Result<Void, PigeonError>) -> Void) {
+    let channelName: String = "dev.flutter.pigeon.flutter_paste_input.PasteInputFlutterApi.onPasteProgress\(messageChannelSuffix)"
+    let channel = FlutterBasicMessageChannel(name: channelName, binaryMessenger: binaryMessenger, codec: codec)
+    channel.sendMessage([progressArg] as [Any?]) { response in
+      guard let listResponse = response as? [Any?] else {
+        completion(.failure(createConnectionError(withChannelName: channelName)))
+        return
+      }
+      if listResponse.count > 1 {
+        let code: String = listResponse[0] as! String
+        let message: String? = nilOrValue(listResponse[1])
+        let details: String? = nilOrValue(listResponse[2])
+        completion(.failure(PigeonError(code: code, message: message, details: details)))
+      } else {
+        completion(.success(Void()))
+      }
+    }
+  }
 }
@@ -30,6 +30,11 @@ class ClipboardItem {
   ClipboardItem({
     required this.data,
     required this.mimeType,
+    this.width,
+    this.height,
+    this.hasAlpha,
+    this.frameCount,
+    this.originalByteSize,
   });
 
   /// Raw binary data of the clipboard item.
@@ -47,6 +52,33 @@ class ClipboardItem {
   /// - "image/gif" for GIF images
   /// - "image/webp" for WebP images
   String mimeType;
+
+  /// Width of the image in pixels.
+  ///
+  /// Only set for image items, and only when the platform knows the
+  /// dimensions without decoding the bytes on the Dart side.
+  int? width;
+
+  /// Height of the image in pixels.
+  ///
+  /// Only set for image items, see [width].
+  int? height;
+
+  /// Whether the image has an alpha channel.
+  ///
+  /// Only set for image items.
+  bool? hasAlpha;
+
+  /// Number of frames in the image (greater than 1 for animations).
+  ///
+  /// Only set for image items.
+  int? frameCount;
+
+  /// Size in bytes of the clipboard representation the item was read from.
+  ///
+  /// For images that are re-encoded natively (e.g. a bitmap converted to
+  /// PNG), this is the size of the source data rather than [data].
+  int? originalByteSize;
 }
 
 /// Represents the complete clipboard content.
@@ -54,12 +86,310 @@ class ClipboardItem {
 /// The clipboard may contain multiple items of different types.
 /// For example, copying an image might also include a text representation.
 class ClipboardContent {
-  ClipboardContent({required this.items});
+  ClipboardContent({required this.items, this.peakMemoryBytes});
 
   /// List of clipboard items.
   ///
   /// May be empty if the clipboard is empty or contains unsupported content.
   List<ClipboardItem> items;
+
+  /// Most bytes the platform held at once while reading, converting and
+  /// sending this content (Linux).
+  int? peakMemoryBytes;
+}
+
+/// Cheap summary of the clipboard state, obtained without reading any data.
+class ClipboardProbe {
+  ClipboardProbe({
+    required this.changeCount,
+    required this.mimeTypes,
+  });
+
+  /// Counter that increases every time the clipboard contents change.
+  ///
+  /// Only meaningful when compared with an earlier value from the same
+  /// process; the absolute value is platform specific.
+  int changeCount;
+
+  /// MIME types currently offered by the clipboard owner.
+  ///
+  /// Text formats are reported as "text/plain" regardless of the
+  /// platform's native name for them.
+  List<String> mimeTypes;
+}
+
+/// Tuning options for the native paste pipeline.
+///
+/// Every field is optional; null leaves the current setting unchanged.
+class PasteInputConfig {
+  PasteInputConfig({
+    this.coalesceWindowMs,
+    this.maxPendingReads,
+    this.maxOutstandingEvents,
+    this.memoryBudgetBytes,
+    this.downscaleOverBudgetImages,
+    this.maxTransferBytes,
+    this.clipboardStoreMaxBytes,
+    this.clipboardStoreTimeBudgetMs,
+    this.historyMaxEntries,
+    this.historyMaxBytes,
+    this.persistHistory,
+    this.historyMaxDiskBytes,
+    this.traceFile,
+  });
+
+  /// How long, in milliseconds, a completed clipboard read is reused for
+  /// further paste requests while the clipboard is unchanged.
+  ///
+  /// Requests arriving while a read is in flight always share it. This
+  /// covers key repeat from a held-down Ctrl+V.
+  int? coalesceWindowMs;
+
+  /// Maximum number of paste requests that may wait on an in-flight read.
+  ///
+  /// Further requests fail with the error code "busy".
+  int? maxPendingReads;
+
+  /// Maximum number of [PasteInputFlutterApi.onPasteDetected] events sent
+  /// before Dart has handled them (Linux).
+  ///
+  /// Events beyond the limit are held back and only the newest is kept, so
+  /// a burst of pastes never queues several stale payloads.
+  int? maxOutstandingEvents;
+
+  /// Upper bound, in bytes, on the native memory held by pastes in flight
+  /// and by their results, shared by all engines in the process (Linux).
+  ///
+  /// An image paste that does not fit waits for earlier pastes to release
+  /// their buffers. One that could never fit is downscaled (see
+  /// [downscaleOverBudgetImages]) or fails with the error code
+  /// "over-budget". 0 disables the limit; the default is 512 MiB.
+  int? memoryBudgetBytes;
+
+  /// Whether images too large for [memoryBudgetBytes] are downscaled rather
+  /// than refused. Defaults to true.
+  bool? downscaleOverBudgetImages;
+
+  /// Largest clipboard selection, in bytes, that is transferred before the
+  /// paste fails with the error code "too-large" (Linux, X11). 0 disables
+  /// the limit; the default is 256 MiB.
+  int? maxTransferBytes;
+
+  /// Most bytes of content set with [PasteInputHostApi.setClipboardContent]
+  /// handed to the clipboard manager when the app exits, so that it stays
+  /// pasteable (Linux).
+  ///
+  /// Text is offered first, then the image as given, then rendered formats
+  /// in order; each format that would exceed the limit is left out, so a
+  /// compact rendered format is kept even when the original image is too
+  /// large. 0 disables the limit; the default is 64 MiB.
+  int? clipboardStoreMaxBytes;
+
+  /// Time, in milliseconds, the app may spend at exit rendering formats not
+  /// requested yet for the clipboard manager (Linux). Formats not rendered
+  /// in time are left out; an encode still running at the deadline stops at
+  /// its next output chunk. Decoding the source image, done once, is not
+  /// interrupted. 0 disables the limit; the default is 1000.
+  int? clipboardStoreTimeBudgetMs;
+
+  /// Most clipboard snapshots kept in the history (Linux).
+  ///
+  /// Every successful read is recorded; content already in the history
+  /// moves to the front instead of being added again. 0 disables the
+  /// history and drops what it holds; the default is 50.
+  int? historyMaxEntries;
+
+  /// Upper bound, in bytes, on the memory held by the history (Linux).
+  ///
+  /// Text is kept compressed and counts with its compressed size. The
+  /// oldest entries are dropped first. 0 disables the limit; the default
+  /// is 32 MiB.
+  ///
+  /// With [persistHistory] set, entries over the limit are only dropped
+  /// from memory and read back from disk when fetched.
+  int? historyMaxBytes;
+
+  /// Whether the history is kept on disk, under the user cache directory,
+  /// so that it survives restarts (Linux).
+  ///
+  /// Off by default, as clipboard content may be sensitive. Turning it off
+  /// deletes the files.
+  bool? persistHistory;
+
+  /// Upper bound, in bytes, on the disk space used by a persisted history
+  /// (Linux). The oldest entries are dropped first. 0 disables the limit;
+  /// the default is 128 MiB.
+  int? historyMaxDiskBytes;
+
+  /// File the paste pipeline trace is written to when the app exits
+  /// (Linux).
+  ///
+  /// Setting it starts recording the begin and end of every pipeline stage
+  /// and worker thread job; an empty string stops recording. The file is
+  /// Chrome trace JSON, for Perfetto or chrome://tracing. See also
+  /// [PasteInputHostApi.dumpPasteTrace].
+  String? traceFile;
+}
+
+/// Progress of a large clipboard transfer for a pending
+/// [PasteInputHostApi.getClipboardContent] request (Linux, X11).
+class PasteProgress {
+  PasteProgress({
+    required this.requestId,
+    required this.receivedBytes,
+    this.expectedBytes,
+  });
+
+  /// The id the request was made with.
+  int requestId;
+
+  /// Bytes received from the clipboard owner so far.
+  int receivedBytes;
+
+  /// Size announced by the owner, if any. For incremental transfers this
+  /// is only a lower bound.
+  int? expectedBytes;
+}
+
+/// Content placed on the clipboard by
+/// [PasteInputHostApi.setClipboardContent].
+class ClipboardWrite {
+  ClipboardWrite({
+    this.text,
+    this.image,
+    this.imageMimeType,
+    this.renderedImageTypes,
+  });
+
+  /// Plain text to offer.
+  String? text;
+
+  /// Encoded image to offer, in the format given by [imageMimeType].
+  Uint8List? image;
+
+  /// MIME type of [image], e.g. "image/png". Required with [image].
+  String? imageMimeType;
+
+  /// Further image formats to offer, e.g. "image/jpeg" or "image/bmp".
+  ///
+  /// On Linux each is rendered from [image] only when another application
+  /// asks for it, and kept once rendered. Other platforms offer [image] in
+  /// its own format only.
+  List<String>? renderedImageTypes;
+}
+
+/// Metadata of one clipboard history entry, see
+/// [PasteInputHostApi.listClipboardHistory].
+class ClipboardHistoryEntry {
+  ClipboardHistoryEntry({
+    required this.id,
+    required this.capturedAtMs,
+    required this.mimeTypes,
+    required this.byteSize,
+  });
+
+  /// Identifies the entry for [PasteInputHostApi.getClipboardHistoryEntry].
+  /// Ids are never reused within a process.
+  int id;
+
+  /// When the content was last read from the clipboard, in milliseconds
+  /// since the Unix epoch.
+  int capturedAtMs;
+
+  /// MIME types of the entry's items, images first.
+  List<String> mimeTypes;
+
+  /// Size of the content as it was pasted, before compression.
+  int byteSize;
+}
+
+/// A clipboard history entry matching a search, see
+/// [PasteInputHostApi.searchClipboardHistory].
+class ClipboardHistoryMatch {
+  ClipboardHistoryMatch({
+    required this.id,
+    required this.matchCount,
+    required this.matchStarts,
+    required this.matchEnds,
+  });
+
+  /// The entry, as in [ClipboardHistoryEntry.id].
+  int id;
+
+  /// Occurrences of the query's terms in the entry's text.
+  int matchCount;
+
+  /// Where matches start in the entry's text, in UTF-16 code units as Dart
+  /// strings index them, in ascending order. At most 64 are reported.
+  List<int> matchStarts;
+
+  /// Where the matches in [matchStarts] end, exclusive.
+  List<int> matchEnds;
+}
+
+/// Timings of one stage of the native paste pipeline, see
+/// [PasteInputHostApi.getPasteStats].
+class PasteStageStats {
+  PasteStageStats({
+    required this.stage,
+    required this.count,
+    required this.totalMicros,
+    required this.maxMicros,
+    required this.bytesIn,
+    required this.bytesOut,
+  });
+
+  /// The stage: "selection" (waiting on the clipboard owner), "decode",
+  /// "encode" (PNG), "serialize" (building the reply), "dart" (from
+  /// sending a paste event until Dart has handled it) or "total" (from the
+  /// paste request reaching the plugin until the reply is sent or the paste
+  /// event handled).
+  String stage;
+
+  /// Runs of the stage since the last reset.
+  int count;
+
+  /// Time spent in the stage, in microseconds.
+  int totalMicros;
+
+  /// Longest single run, in microseconds.
+  int maxMicros;
+
+  /// Bytes the stage consumed and produced.
+  int bytesIn;
+  int bytesOut;
+}
+
+/// Latency percentiles of one stage of the native paste pipeline for one
+/// kind of content, see [PasteInputHostApi.getPasteLatencies].
+class PasteLatencyStats {
+  PasteLatencyStats({
+    required this.stage,
+    required this.contentClass,
+    required this.count,
+    required this.p50Micros,
+    required this.p90Micros,
+    required this.p99Micros,
+    required this.maxMicros,
+  });
+
+  /// The stage, as in [PasteStageStats.stage].
+  String stage;
+
+  /// What was pasted: "text", "small-image" or "large-image" (at least
+  /// 1024 x 1024 pixels).
+  String contentClass;
+
+  /// Runs of the stage since the last reset.
+  int count;
+
+  /// Percentiles, in microseconds, within about 6% of the exact value.
+  int p50Micros;
+  int p90Micros;
+  int p99Micros;
+
+  /// Longest single run, in microseconds.
+  int maxMicros;
 }
 
 /// Host API for clipboard operations (Dart -> Native).
@@ -75,7 +405,14 @@ abstract class PasteInputHostApi {
   ///
   /// Returns an empty [ClipboardContent] if the clipboard is empty or
   /// contains only unsupported content types.
-  ClipboardContent getClipboardContent();
+  ///
+  /// Requests made while a read is in progress, or shortly after one
+  /// completed (see [PasteInputConfig.coalesceWindowMs]), share its result.
+  ///
+  /// [requestId] identifies the request for [cancelPaste]; 0 means the
+  /// request cannot be cancelled.
+  @async
+  ClipboardContent getClipboardContent(int requestId);
 
   /// Clears temporary files created during paste operations.
   ///
@@ -88,6 +425,104 @@ abstract class PasteInputHostApi {
   /// Useful for debugging and platform-specific behavior.
   /// Example: "Android 14", "iOS 17.0", "macOS 14.0"
   String getPlatformVersion();
+
+  /// Returns the clipboard change counter and the available MIME types.
+  ///
+  /// This is served from state the platform already tracks and transfers
+  /// no clipboard payload, so it is cheap enough to call while building UI
+  /// (e.g. to decide whether a paste button should be enabled).
+  @async
+  ClipboardProbe probeClipboard();
+
+  /// Applies tuning options to the native paste pipeline.
+  ///
+  /// On Linux and Windows the clipboard cache is shared by all Flutter
+  /// engines in the process, so the options apply to every engine.
+  void configure(PasteInputConfig config);
+
+  /// Hints that a paste is likely soon, e.g. because a text field gained
+  /// focus.
+  ///
+  /// Where supported (Linux), the clipboard is read and encoded in the
+  /// background at idle priority so that the next [getClipboardContent]
+  /// is served from the warm snapshot. Elsewhere this is a no-op.
+  void prefetchClipboard();
+
+  /// Cancels the [getClipboardContent] request with the given id.
+  ///
+  /// The request fails with the error code "cancelled". Native work that no
+  /// other request is waiting on is abandoned and its buffers released.
+  /// Unknown or already completed ids are ignored.
+  void cancelPaste(int requestId);
+
+  /// Releases natively cached clipboard data, as the platform does by
+  /// itself on low-memory warnings where it reports them (Linux).
+  ///
+  /// [level] is 0 (low), 1 (medium) or 2 (critical); higher levels drop
+  /// more, including data that is still fresh. Returns the number of bytes
+  /// released from the plugin's caches.
+  @async
+  int trimMemory(int level);
+
+  /// Replaces the clipboard content with [content].
+  ///
+  /// Fails with the error code "invalid-argument" if [content] is empty or
+  /// an image lacks its MIME type, and with "unsupported-format" if a
+  /// requested rendition cannot be produced on this platform.
+  @async
+  void setClipboardContent(ClipboardWrite content);
+
+  /// Lists the clipboard history, most recent first, without its content.
+  ///
+  /// Only Linux keeps a history; elsewhere the list is empty.
+  @async
+  List<ClipboardHistoryEntry> listClipboardHistory();
+
+  /// Returns the content of the history entry with the given [id].
+  ///
+  /// Fails with the error code "not-found" if the entry has been dropped
+  /// from the history, or never existed.
+  @async
+  ClipboardContent getClipboardHistoryEntry(int id);
+
+  /// Searches the text of the clipboard history for [query].
+  ///
+  /// Entries match if their text contains every whitespace-separated term
+  /// of [query], ignoring ASCII case. At most [maxResults] are returned,
+  /// those with the most occurrences first, then the most recent. Only
+  /// Linux keeps a history; elsewhere the list is empty.
+  @async
+  List<ClipboardHistoryMatch> searchClipboardHistory(String query, int maxResults);
+
+  /// Returns the time spent in each stage of the paste pipeline since the
+  /// last [resetPasteStats].
+  ///
+  /// Only Linux instruments its pipeline; elsewhere the list is empty.
+  @async
+  List<PasteStageStats> getPasteStats();
+
+  /// Zeroes the counters reported by [getPasteStats] and
+  /// [getPasteLatencies].
+  @async
+  void resetPasteStats();
+
+  /// Returns latency percentiles of each stage of the paste pipeline, and
+  /// end to end, per kind of content, since the last [resetPasteStats].
+  /// Combinations without runs are left out.
+  ///
+  /// Only Linux instruments its pipeline; elsewhere the list is empty.
+  @async
+  List<PasteLatencyStats> getPasteLatencies();
+
+  /// Writes the paste pipeline activity recorded since tracing was started
+  /// with [PasteInputConfig.traceFile] to [path] as Chrome trace JSON.
+  /// Recording goes on.
+  ///
+  /// Returns the number of events written, or fails with the error code
+  /// "write-failed" if the file cannot be written. Only Linux records a
+  /// trace; elsewhere no file is written and 0 is returned.
+  @async
+  int dumpPasteTrace(String path);
 }
 
 /// Flutter API for paste event notifications (Native -> Dart).
@@ -103,4 +538,8 @@ abstract class PasteInputFlutterApi {
   /// of the paste event. This allows Flutter to handle the pasted content
   /// immediately without additional clipboard reads.
   void onPasteDetected(ClipboardContent content);
+
+  /// Called periodically while a large selection is transferred for a
+  /// [PasteInputHostApi.getClipboardContent] request.
+  void onPasteProgress(PasteProgress progress);
 }
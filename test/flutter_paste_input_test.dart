@@ -1,3 +1,5 @@
+import 'dart:typed_data';
+
 import 'package:flutter_paste_input/flutter_paste_input.dart';
 import 'package:flutter_test/flutter_test.dart';
 
@@ -79,6 +81,69 @@ void main() {
     });
   });
 
+  group('RawClipboardItem', () {
+    test('metadata is optional', () {
+      final item = RawClipboardItem(
+        data: Uint8List(0),
+        mimeType: 'image/png',
+      );
+
+      expect(item.width, isNull);
+      expect(item.height, isNull);
+      expect(item.isAnimated, isFalse);
+    });
+
+    test('isAnimated uses frameCount', () {
+      final item = RawClipboardItem(
+        data: Uint8List(0),
+        mimeType: 'image/gif',
+        width: 32,
+        height: 16,
+        frameCount: 4,
+      );
+
+      expect(item.isAnimated, isTrue);
+      expect(item.width, equals(32));
+    });
+  });
+
+  group('PasteChannel.canPaste', () {
+    test('accepts text and images by default', () {
+      final probe = ClipboardProbe(changeCount: 1, mimeTypes: ['image/png']);
+
+      expect(PasteChannel.canPaste(probe), isTrue);
+    });
+
+    test('respects acceptedTypes', () {
+      final probe = ClipboardProbe(changeCount: 1, mimeTypes: ['text/plain']);
+
+      expect(
+        PasteChannel.canPaste(probe, acceptedTypes: {PasteType.image}),
+        isFalse,
+      );
+      expect(
+        PasteChannel.canPaste(probe, acceptedTypes: {PasteType.text}),
+        isTrue,
+      );
+    });
+
+    test('empty clipboard cannot be pasted', () {
+      final probe = ClipboardProbe(changeCount: 3, mimeTypes: []);
+
+      expect(PasteChannel.canPaste(probe), isFalse);
+    });
+  });
+
+  group('PasteChannel.newRequestId', () {
+    test('returns distinct non-zero ids', () {
+      final first = PasteChannel.instance.newRequestId();
+      final second = PasteChannel.instance.newRequestId();
+
+      expect(first, isNot(0));
+      expect(second, isNot(first));
+    });
+  });
+
   group('PasteType', () {
     test('PasteType values exist', () {
       expect(PasteType.values, contains(PasteType.text));
@@ -6,7 +6,9 @@
 #include <VersionHelpers.h>
 
 #include <codecvt>
+#include <cstring>
 #include <locale>
+#include <mutex>
 #include <sstream>
 
 #pragma comment(lib, "gdiplus.lib")
@@ -15,8 +17,45 @@ namespace flutter_paste_input {
 
 namespace {
 
-// GDI+ initialization token
+// GDI+ initialization token, shared by all plugin instances (one per
+// engine) and released when the last one is destroyed.
 ULONG_PTR gdiplusToken = 0;
+int gdiplusRefCount = 0;
+std::mutex gdiplusMutex;
+
+void AcquireGdiplus() {
+  std::lock_guard<std::mutex> lock(gdiplusMutex);
+  if (gdiplusRefCount++ == 0) {
+    Gdiplus::GdiplusStartupInput gdiplusStartupInput;
+    Gdiplus::GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, nullptr);
+  }
+}
+
+void ReleaseGdiplus() {
+  std::lock_guard<std::mutex> lock(gdiplusMutex);
+  if (--gdiplusRefCount == 0 && gdiplusToken != 0) {
+    Gdiplus::GdiplusShutdown(gdiplusToken);
+    gdiplusToken = 0;
+  }
+}
+
+constexpr int64_t kDefaultCoalesceWindowMs = 250;
+
+// Last content read, shared by all engines in the process and reused by
+// repeated pastes within the coalescing window while the clipboard sequence
+// number is unchanged. Engines may run on different threads.
+struct ContentCache {
+  std::mutex mutex;
+  std::optional<ClipboardContent> content;
+  DWORD sequence_number = 0;
+  ULONGLONG read_at = 0;
+  int64_t coalesce_window_ms = kDefaultCoalesceWindowMs;
+};
+
+ContentCache& SharedContentCache() {
+  static ContentCache* cache = new ContentCache();
+  return *cache;
+}
 
 // Convert wide string to UTF-8
 std::string WideToUtf8(const std::wstring& wide) {
@@ -27,6 +66,29 @@ std::string WideToUtf8(const std::wstring& wide) {
   return result;
 }
 
+std::wstring Utf8ToWide(const std::string& utf8) {
+  if (utf8.empty()) return std::wstring();
+  int size = MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), static_cast<int>(utf8.size()),
+                                 nullptr, 0);
+  std::wstring result(size, 0);
+  MultiByteToWideChar(CP_UTF8, 0, utf8.c_str(), static_cast<int>(utf8.size()),
+                      &result[0], size);
+  return result;
+}
+
+// Copies |size| bytes into a global the open clipboard takes over.
+bool SetClipboardBytes(UINT format, const void* bytes, size_t size) {
+  HGLOBAL global = GlobalAlloc(GMEM_MOVEABLE, size);
+  if (global == nullptr) return false;
+  memcpy(GlobalLock(global), bytes, size);
+  GlobalUnlock(global);
+  if (SetClipboardData(format, global) == nullptr) {
+    GlobalFree(global);
+    return false;
+  }
+  return true;
+}
+
 // Get CLSID for image encoder
 int GetEncoderClsid(const WCHAR* format, CLSID* pClsid) {
   UINT num = 0;
@@ -57,11 +119,9 @@ int GetEncoderClsid(const WCHAR* format, CLSID* pClsid) {
 void FlutterPasteInputPlugin::RegisterWithRegistrar(
     flutter::PluginRegistrarWindows *registrar) {
 
-  // Initialize GDI+
-  Gdiplus::GdiplusStartupInput gdiplusStartupInput;
-  Gdiplus::GdiplusStartup(&gdiplusToken, &gdiplusStartupInput, nullptr);
-
-  auto plugin = std::make_unique<FlutterPasteInputPlugin>(registrar->messenger());
+  flutter::FlutterView* view = registrar->GetView();
+  HWND window = view != nullptr ? GetAncestor(view->GetNativeWindow(), GA_ROOT) : nullptr;
+  auto plugin = std::make_unique<FlutterPasteInputPlugin>(registrar->messenger(), window);
 
   // Set up Pigeon API
   PasteInputHostApi::SetUp(registrar->messenger(), plugin.get());
@@ -69,18 +129,184 @@ void FlutterPasteInputPlugin::RegisterWithRegistrar(
   registrar->AddPlugin(std::move(plugin));
 }
 
-FlutterPasteInputPlugin::FlutterPasteInputPlugin(flutter::BinaryMessenger* messenger) {
+FlutterPasteInputPlugin::FlutterPasteInputPlugin(flutter::BinaryMessenger* messenger,
+                                                 HWND window)
+    : window_(window) {
+  AcquireGdiplus();
   flutter_api_ = std::make_unique<PasteInputFlutterApi>(messenger);
 }
 
 FlutterPasteInputPlugin::~FlutterPasteInputPlugin() {
-  if (gdiplusToken != 0) {
-    Gdiplus::GdiplusShutdown(gdiplusToken);
-    gdiplusToken = 0;
+  ReleaseGdiplus();
+}
+
+void FlutterPasteInputPlugin::GetClipboardContent(
+    int64_t request_id,
+    std::function<void(ErrorOr<ClipboardContent> reply)> result) {
+  result(ReadClipboardContentCoalesced());
+}
+
+std::optional<FlutterError> FlutterPasteInputPlugin::Configure(
+    const PasteInputConfig& config) {
+  if (config.coalesce_window_ms() != nullptr) {
+    if (*config.coalesce_window_ms() < 0) {
+      return FlutterError("invalid-argument", "coalesceWindowMs must not be negative.");
+    }
+    // The cache is process-wide, and so is its window.
+    ContentCache& cache = SharedContentCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.coalesce_window_ms = *config.coalesce_window_ms();
+  }
+  // Reads are synchronous on Windows, so nothing ever waits on one and
+  // maxPendingReads does not apply.
+  return std::nullopt;
+}
+
+std::optional<FlutterError> FlutterPasteInputPlugin::PrefetchClipboard() {
+  // Reading ahead would open the clipboard on the platform thread and lock
+  // other applications out of it, for a result that only lives for the
+  // coalescing window. Nothing to do.
+  return std::nullopt;
+}
+
+std::optional<FlutterError> FlutterPasteInputPlugin::CancelPaste(int64_t request_id) {
+  // Reads complete synchronously, before a cancellation can arrive.
+  return std::nullopt;
+}
+
+void FlutterPasteInputPlugin::TrimMemory(
+    int64_t level,
+    std::function<void(ErrorOr<int64_t> reply)> result) {
+  if (level < 0 || level > 2) {
+    result(FlutterError("invalid-argument", "level must be 0, 1 or 2."));
+    return;
   }
+  // The coalescing cache is the only native cache; it is cheap to rebuild,
+  // so every level drops it.
+  ContentCache& cache = SharedContentCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  int64_t released = 0;
+  if (cache.content.has_value()) {
+    for (const auto& value : cache.content->items()) {
+      const auto& item = std::any_cast<const ClipboardItem&>(
+          std::get<flutter::CustomEncodableValue>(value));
+      released += static_cast<int64_t>(item.data().size());
+    }
+    cache.content.reset();
+  }
+  result(released);
 }
 
-ErrorOr<ClipboardContent> FlutterPasteInputPlugin::GetClipboardContent() {
+ClipboardContent FlutterPasteInputPlugin::ReadClipboardContentCoalesced() {
+  ContentCache& cache = SharedContentCache();
+  // Held across the read: the clipboard can only be opened by one thread
+  // at a time anyway, and a second engine pasting meanwhile gets the result.
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  DWORD sequence_number = GetClipboardSequenceNumber();
+  ULONGLONG now = GetTickCount64();
+  if (cache.content.has_value() &&
+      sequence_number == cache.sequence_number &&
+      now - cache.read_at <= static_cast<ULONGLONG>(cache.coalesce_window_ms)) {
+    return *cache.content;
+  }
+
+  ClipboardContent content = ReadClipboardContent();
+  cache.content = content;
+  cache.sequence_number = sequence_number;
+  cache.read_at = GetTickCount64();
+  return content;
+}
+
+void FlutterPasteInputPlugin::SetClipboardContent(
+    const ClipboardWrite& content,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  const std::string* text = content.text();
+  const std::vector<uint8_t>* image = content.image();
+  if (image != nullptr && image->empty()) image = nullptr;
+  if (text == nullptr && image == nullptr) {
+    result(FlutterError("invalid-argument", "Nothing to copy."));
+    return;
+  }
+  const std::string* image_mime_type = content.image_mime_type();
+  if (image != nullptr && image_mime_type == nullptr) {
+    result(FlutterError("invalid-argument", "imageMimeType is required with image."));
+    return;
+  }
+
+  // Without an owner window, EmptyClipboard leaves the clipboard ownerless
+  // and SetClipboardData fails.
+  if (window_ == nullptr || !OpenClipboard(window_)) {
+    result(FlutterError("unavailable", "Could not open the clipboard."));
+    return;
+  }
+  EmptyClipboard();
+  bool stored = true;
+  if (text != nullptr) {
+    std::wstring wide = Utf8ToWide(*text);
+    stored = SetClipboardBytes(CF_UNICODETEXT, wide.c_str(),
+                               (wide.size() + 1) * sizeof(wchar_t)) && stored;
+  }
+  if (image != nullptr) {
+    // Applications look for PNG data under the registered "PNG" format.
+    // Only the image's own format is offered; renditions are not produced
+    // here.
+    std::wstring format_name =
+        *image_mime_type == "image/png" ? L"PNG" : Utf8ToWide(*image_mime_type);
+    UINT format = RegisterClipboardFormatW(format_name.c_str());
+    stored = format != 0 && SetClipboardBytes(format, image->data(), image->size()) && stored;
+  }
+  CloseClipboard();
+
+  if (!stored) {
+    result(FlutterError("unavailable", "Could not write to the clipboard."));
+    return;
+  }
+  result(std::nullopt);
+}
+
+// Only Linux keeps a clipboard history.
+void FlutterPasteInputPlugin::ListClipboardHistory(
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  result(flutter::EncodableList());
+}
+
+void FlutterPasteInputPlugin::GetClipboardHistoryEntry(
+    int64_t id,
+    std::function<void(ErrorOr<ClipboardContent> reply)> result) {
+  result(FlutterError("not-found", "No such clipboard history entry."));
+}
+
+void FlutterPasteInputPlugin::SearchClipboardHistory(
+    const std::string& query,
+    int64_t max_results,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  result(flutter::EncodableList());
+}
+
+// Only Linux instruments its paste pipeline.
+void FlutterPasteInputPlugin::GetPasteStats(
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  result(flutter::EncodableList());
+}
+
+void FlutterPasteInputPlugin::ResetPasteStats(
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  result(std::nullopt);
+}
+
+void FlutterPasteInputPlugin::GetPasteLatencies(
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  result(flutter::EncodableList());
+}
+
+void FlutterPasteInputPlugin::DumpPasteTrace(
+    const std::string& path,
+    std::function<void(ErrorOr<int64_t> reply)> result) {
+  // Only Linux records a trace.
+  result(static_cast<int64_t>(0));
+}
+
+ClipboardContent FlutterPasteInputPlugin::ReadClipboardContent() {
   flutter::EncodableList items;
 
   if (!OpenClipboard(nullptr)) {
@@ -89,9 +315,15 @@ ErrorOr<ClipboardContent> FlutterPasteInputPlugin::GetClipboardContent() {
 
   // Check for bitmap first
   if (IsClipboardFormatAvailable(CF_BITMAP) || IsClipboardFormatAvailable(CF_DIB)) {
-    std::vector<uint8_t> imageData = GetBitmapData();
+    BitmapInfo info;
+    std::vector<uint8_t> imageData = GetBitmapData(&info);
     if (!imageData.empty()) {
       ClipboardItem item(imageData, "image/png");
+      item.set_width(info.width);
+      item.set_height(info.height);
+      item.set_has_alpha(info.has_alpha);
+      item.set_frame_count(1);  // Re-encoded as a single PNG frame
+      item.set_original_byte_size(info.original_byte_size);
       items.push_back(flutter::CustomEncodableValue(item));
     }
   }
@@ -101,6 +333,7 @@ ErrorOr<ClipboardContent> FlutterPasteInputPlugin::GetClipboardContent() {
   if (!text.empty()) {
     std::vector<uint8_t> textBytes(text.begin(), text.end());
     ClipboardItem item(textBytes, "text/plain");
+    item.set_original_byte_size(static_cast<int64_t>(textBytes.size()));
     items.push_back(flutter::CustomEncodableValue(item));
   }
 
@@ -141,18 +374,28 @@ ErrorOr<std::string> FlutterPasteInputPlugin::GetPlatformVersion() {
   return version_stream.str();
 }
 
-void FlutterPasteInputPlugin::NotifyPasteDetected() {
-  auto result = GetClipboardContent();
-  if (!result.has_error()) {
-    flutter_api_->OnPasteDetected(
-      result.value(),
-      []() {},
-      [](const FlutterError& error) {}
-    );
+void FlutterPasteInputPlugin::ProbeClipboard(
+    std::function<void(ErrorOr<ClipboardProbe> reply)> result) {
+  // Neither call opens the clipboard or asks the owner for data.
+  flutter::EncodableList mime_types;
+  if (IsClipboardFormatAvailable(CF_UNICODETEXT) || IsClipboardFormatAvailable(CF_TEXT)) {
+    mime_types.push_back(flutter::EncodableValue("text/plain"));
+  }
+  if (IsClipboardFormatAvailable(CF_BITMAP) || IsClipboardFormatAvailable(CF_DIB)) {
+    mime_types.push_back(flutter::EncodableValue("image/png"));
   }
+  result(ClipboardProbe(static_cast<int64_t>(GetClipboardSequenceNumber()), mime_types));
 }
 
-std::vector<uint8_t> FlutterPasteInputPlugin::GetBitmapData() {
+void FlutterPasteInputPlugin::NotifyPasteDetected() {
+  flutter_api_->OnPasteDetected(
+    ReadClipboardContentCoalesced(),
+    []() {},
+    [](const FlutterError& error) {}
+  );
+}
+
+std::vector<uint8_t> FlutterPasteInputPlugin::GetBitmapData(BitmapInfo* info) {
   std::vector<uint8_t> result;
 
   HBITMAP hBitmap = (HBITMAP)GetClipboardData(CF_BITMAP);
@@ -162,6 +405,22 @@ std::vector<uint8_t> FlutterPasteInputPlugin::GetBitmapData() {
   Gdiplus::Bitmap* bitmap = Gdiplus::Bitmap::FromHBITMAP(hBitmap, nullptr);
   if (bitmap == nullptr) return result;
 
+  info->width = bitmap->GetWidth();
+  info->height = bitmap->GetHeight();
+  info->has_alpha = Gdiplus::IsAlphaPixelFormat(bitmap->GetPixelFormat()) != FALSE;
+
+  // The DIB is what the source application placed on the clipboard; fall
+  // back to the DDB size when only CF_BITMAP is available.
+  HANDLE hDib = IsClipboardFormatAvailable(CF_DIB) ? GetClipboardData(CF_DIB) : nullptr;
+  if (hDib != nullptr) {
+    info->original_byte_size = static_cast<int64_t>(GlobalSize(hDib));
+  } else {
+    BITMAP bm;
+    if (GetObject(hBitmap, sizeof(bm), &bm) != 0) {
+      info->original_byte_size = static_cast<int64_t>(bm.bmWidthBytes) * bm.bmHeight;
+    }
+  }
+
   CLSID pngClsid;
   if (GetEncoderClsid(L"image/png", &pngClsid) < 0) {
     delete bitmap;
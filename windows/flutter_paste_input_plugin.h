@@ -3,7 +3,10 @@
 
 #include <flutter/plugin_registrar_windows.h>
 
+#include <windows.h>
+
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -15,7 +18,8 @@ class FlutterPasteInputPlugin : public flutter::Plugin, public PasteInputHostApi
  public:
   static void RegisterWithRegistrar(flutter::PluginRegistrarWindows *registrar);
 
-  FlutterPasteInputPlugin(flutter::BinaryMessenger* messenger);
+  // |window| owns the clipboard while content set by the app is on it.
+  FlutterPasteInputPlugin(flutter::BinaryMessenger* messenger, HWND window);
 
   virtual ~FlutterPasteInputPlugin();
 
@@ -24,16 +28,62 @@ class FlutterPasteInputPlugin : public flutter::Plugin, public PasteInputHostApi
   FlutterPasteInputPlugin& operator=(const FlutterPasteInputPlugin&) = delete;
 
   // PasteInputHostApi implementation
-  ErrorOr<ClipboardContent> GetClipboardContent() override;
+  void GetClipboardContent(
+      int64_t request_id,
+      std::function<void(ErrorOr<ClipboardContent> reply)> result) override;
+  void SearchClipboardHistory(
+      const std::string& query,
+      int64_t max_results,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) override;
   std::optional<FlutterError> ClearTempFiles() override;
   ErrorOr<std::string> GetPlatformVersion() override;
+  void ProbeClipboard(
+      std::function<void(ErrorOr<ClipboardProbe> reply)> result) override;
+  std::optional<FlutterError> Configure(const PasteInputConfig& config) override;
+  std::optional<FlutterError> PrefetchClipboard() override;
+  std::optional<FlutterError> CancelPaste(int64_t request_id) override;
+  void TrimMemory(
+      int64_t level,
+      std::function<void(ErrorOr<int64_t> reply)> result) override;
+  void SetClipboardContent(
+      const ClipboardWrite& content,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
+  void ListClipboardHistory(
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) override;
+  void GetClipboardHistoryEntry(
+      int64_t id,
+      std::function<void(ErrorOr<ClipboardContent> reply)> result) override;
+  void GetPasteStats(
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) override;
+  void ResetPasteStats(
+      std::function<void(std::optional<FlutterError> reply)> result) override;
+  void GetPasteLatencies(
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result) override;
+  void DumpPasteTrace(
+      const std::string& path,
+      std::function<void(ErrorOr<int64_t> reply)> result) override;
 
   // Notify Flutter about a paste event
   void NotifyPasteDetected();
 
  private:
-  // Extract image data from clipboard
-  std::vector<uint8_t> GetBitmapData();
+  // Metadata of the clipboard bitmap, filled in by GetBitmapData.
+  struct BitmapInfo {
+    int64_t width = 0;
+    int64_t height = 0;
+    bool has_alpha = false;
+    int64_t original_byte_size = 0;
+  };
+
+  // Returns the process-wide cached content if it is still current,
+  // otherwise reads the clipboard and caches the result.
+  ClipboardContent ReadClipboardContentCoalesced();
+
+  // Reads all supported items from the clipboard.
+  ClipboardContent ReadClipboardContent();
+
+  // Extract image data from clipboard, re-encoded as PNG
+  std::vector<uint8_t> GetBitmapData(BitmapInfo* info);
 
   // Extract text from clipboard
   std::string GetTextData();
@@ -42,6 +92,7 @@ class FlutterPasteInputPlugin : public flutter::Plugin, public PasteInputHostApi
   std::wstring GetTempPath();
 
   std::unique_ptr<PasteInputFlutterApi> flutter_api_;
+  HWND window_;
 };
 
 }  // namespace flutter_paste_input
@@ -36,6 +36,22 @@ ClipboardItem::ClipboardItem(
  : data_(data),
     mime_type_(mime_type) {}
 
+ClipboardItem::ClipboardItem(
+  const std::vector<uint8_t>& data,
+  const std::string& mime_type,
+  const int64_t* width,
+  const int64_t* height,
+  const bool* has_alpha,
+  const int64_t* frame_count,
+  const int64_t* original_byte_size)
+ : data_(data),
+    mime_type_(mime_type),
+    width_(width ? std::optional<int64_t>(*width) : std::nullopt),
+    height_(height ? std::optional<int64_t>(*height) : std::nullopt),
+    has_alpha_(has_alpha ? std::optional<bool>(*has_alpha) : std::nullopt),
+    frame_count_(frame_count ? std::optional<int64_t>(*frame_count) : std::nullopt),
+    original_byte_size_(original_byte_size ? std::optional<int64_t>(*original_byte_size) : std::nullopt) {}
+
 const std::vector<uint8_t>& ClipboardItem::data() const {
   return data_;
 }
@@ -54,11 +70,81 @@ void ClipboardItem::set_mime_type(std::string_view value_arg) {
 }
 
 
+const int64_t* ClipboardItem::width() const {
+  return width_ ? &(*width_) : nullptr;
+}
+
+void ClipboardItem::set_width(const int64_t* value_arg) {
+  width_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void ClipboardItem::set_width(int64_t value_arg) {
+  width_ = value_arg;
+}
+
+
+const int64_t* ClipboardItem::height() const {
+  return height_ ? &(*height_) : nullptr;
+}
+
+void ClipboardItem::set_height(const int64_t* value_arg) {
+  height_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void ClipboardItem::set_height(int64_t value_arg) {
+  height_ = value_arg;
+}
+
+
+const bool* ClipboardItem::has_alpha() const {
+  return has_alpha_ ? &(*has_alpha_) : nullptr;
+}
+
+void ClipboardItem::set_has_alpha(const bool* value_arg) {
+  has_alpha_ = value_arg ? std::optional<bool>(*value_arg) : std::nullopt;
+}
+
+void ClipboardItem::set_has_alpha(bool value_arg) {
+  has_alpha_ = value_arg;
+}
+
+
+const int64_t* ClipboardItem::frame_count() const {
+  return frame_count_ ? &(*frame_count_) : nullptr;
+}
+
+void ClipboardItem::set_frame_count(const int64_t* value_arg) {
+  frame_count_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void ClipboardItem::set_frame_count(int64_t value_arg) {
+  frame_count_ = value_arg;
+}
+
+
+const int64_t* ClipboardItem::original_byte_size() const {
+  return original_byte_size_ ? &(*original_byte_size_) : nullptr;
+}
+
+void ClipboardItem::set_original_byte_size(const int64_t* value_arg) {
+  original_byte_size_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void ClipboardItem::set_original_byte_size(int64_t value_arg) {
+  original_byte_size_ = value_arg;
+}
+
+
 EncodableList ClipboardItem::ToEncodableList() const {
   EncodableList list;
-  list.reserve(2);
+  list.reserve(7);
   list.push_back(EncodableValue(data_));
   list.push_back(EncodableValue(mime_type_));
+  list.push_back(width_ ? EncodableValue(*width_) : EncodableValue());
+  list.push_back(height_ ? EncodableValue(*height_) : EncodableValue());
+  list.push_back(has_alpha_ ? EncodableValue(*has_alpha_) : EncodableValue());
+  list.push_back(frame_count_ ? EncodableValue(*frame_count_) : EncodableValue());
+  list.push_back(original_byte_size_ ? EncodableValue(*original_byte_size_) : EncodableValue());
   return list;
 }
 
@@ -66,33 +152,892 @@ ClipboardItem ClipboardItem::FromEncodableList(const EncodableList& list) {
   ClipboardItem decoded(
     std::get<std::vector<uint8_t>>(list[0]),
     std::get<std::string>(list[1]));
+  auto& encodable_width = list[2];
+  if (!encodable_width.IsNull()) {
+    decoded.set_width(std::get<int64_t>(encodable_width));
+  }
+  auto& encodable_height = list[3];
+  if (!encodable_height.IsNull()) {
+    decoded.set_height(std::get<int64_t>(encodable_height));
+  }
+  auto& encodable_has_alpha = list[4];
+  if (!encodable_has_alpha.IsNull()) {
+    decoded.set_has_alpha(std::get<bool>(encodable_has_alpha));
+  }
+  auto& encodable_frame_count = list[5];
+  if (!encodable_frame_count.IsNull()) {
+    decoded.set_frame_count(std::get<int64_t>(encodable_frame_count));
+  }
+  auto& encodable_original_byte_size = list[6];
+  if (!encodable_original_byte_size.IsNull()) {
+    decoded.set_original_byte_size(std::get<int64_t>(encodable_original_byte_size));
+  }
+  return decoded;
+}
+
+// ClipboardContent
+
+ClipboardContent::ClipboardContent(const EncodableList& items)
+ : items_(items) {}
+
+ClipboardContent::ClipboardContent(
+  const EncodableList& items,
+  const int64_t* peak_memory_bytes)
+ : items_(items),
+    peak_memory_bytes_(peak_memory_bytes ? std::optional<int64_t>(*peak_memory_bytes) : std::nullopt) {}
+
+const EncodableList& ClipboardContent::items() const {
+  return items_;
+}
+
+void ClipboardContent::set_items(const EncodableList& value_arg) {
+  items_ = value_arg;
+}
+
+
+const int64_t* ClipboardContent::peak_memory_bytes() const {
+  return peak_memory_bytes_ ? &(*peak_memory_bytes_) : nullptr;
+}
+
+void ClipboardContent::set_peak_memory_bytes(const int64_t* value_arg) {
+  peak_memory_bytes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void ClipboardContent::set_peak_memory_bytes(int64_t value_arg) {
+  peak_memory_bytes_ = value_arg;
+}
+
+
+EncodableList ClipboardContent::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(items_));
+  list.push_back(peak_memory_bytes_ ? EncodableValue(*peak_memory_bytes_) : EncodableValue());
+  return list;
+}
+
+ClipboardContent ClipboardContent::FromEncodableList(const EncodableList& list) {
+  ClipboardContent decoded(
+    std::get<EncodableList>(list[0]));
+  auto& encodable_peak_memory_bytes = list[1];
+  if (!encodable_peak_memory_bytes.IsNull()) {
+    decoded.set_peak_memory_bytes(std::get<int64_t>(encodable_peak_memory_bytes));
+  }
+  return decoded;
+}
+
+// ClipboardProbe
+
+ClipboardProbe::ClipboardProbe(
+  int64_t change_count,
+  const EncodableList& mime_types)
+ : change_count_(change_count),
+    mime_types_(mime_types) {}
+
+int64_t ClipboardProbe::change_count() const {
+  return change_count_;
+}
+
+void ClipboardProbe::set_change_count(int64_t value_arg) {
+  change_count_ = value_arg;
+}
+
+
+const EncodableList& ClipboardProbe::mime_types() const {
+  return mime_types_;
+}
+
+void ClipboardProbe::set_mime_types(const EncodableList& value_arg) {
+  mime_types_ = value_arg;
+}
+
+
+EncodableList ClipboardProbe::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(change_count_));
+  list.push_back(EncodableValue(mime_types_));
+  return list;
+}
+
+ClipboardProbe ClipboardProbe::FromEncodableList(const EncodableList& list) {
+  ClipboardProbe decoded(
+    std::get<int64_t>(list[0]),
+    std::get<EncodableList>(list[1]));
+  return decoded;
+}
+
+// PasteInputConfig
+
+PasteInputConfig::PasteInputConfig() {}
+
+PasteInputConfig::PasteInputConfig(
+  const int64_t* coalesce_window_ms,
+  const int64_t* max_pending_reads,
+  const int64_t* max_outstanding_events,
+  const int64_t* memory_budget_bytes,
+  const bool* downscale_over_budget_images,
+  const int64_t* max_transfer_bytes,
+  const int64_t* clipboard_store_max_bytes,
+  const int64_t* clipboard_store_time_budget_ms,
+  const int64_t* history_max_entries,
+  const int64_t* history_max_bytes,
+  const bool* persist_history,
+  const int64_t* history_max_disk_bytes,
+  const std::string* trace_file)
+ : coalesce_window_ms_(coalesce_window_ms ? std::optional<int64_t>(*coalesce_window_ms) : std::nullopt),
+    max_pending_reads_(max_pending_reads ? std::optional<int64_t>(*max_pending_reads) : std::nullopt),
+    max_outstanding_events_(max_outstanding_events ? std::optional<int64_t>(*max_outstanding_events) : std::nullopt),
+    memory_budget_bytes_(memory_budget_bytes ? std::optional<int64_t>(*memory_budget_bytes) : std::nullopt),
+    downscale_over_budget_images_(downscale_over_budget_images ? std::optional<bool>(*downscale_over_budget_images) : std::nullopt),
+    max_transfer_bytes_(max_transfer_bytes ? std::optional<int64_t>(*max_transfer_bytes) : std::nullopt),
+    clipboard_store_max_bytes_(clipboard_store_max_bytes ? std::optional<int64_t>(*clipboard_store_max_bytes) : std::nullopt),
+    clipboard_store_time_budget_ms_(clipboard_store_time_budget_ms ? std::optional<int64_t>(*clipboard_store_time_budget_ms) : std::nullopt),
+    history_max_entries_(history_max_entries ? std::optional<int64_t>(*history_max_entries) : std::nullopt),
+    history_max_bytes_(history_max_bytes ? std::optional<int64_t>(*history_max_bytes) : std::nullopt),
+    persist_history_(persist_history ? std::optional<bool>(*persist_history) : std::nullopt),
+    history_max_disk_bytes_(history_max_disk_bytes ? std::optional<int64_t>(*history_max_disk_bytes) : std::nullopt),
+    trace_file_(trace_file ? std::optional<std::string>(*trace_file) : std::nullopt) {}
+
+const int64_t* PasteInputConfig::coalesce_window_ms() const {
+  return coalesce_window_ms_ ? &(*coalesce_window_ms_) : nullptr;
+}
+
+void PasteInputConfig::set_coalesce_window_ms(const int64_t* value_arg) {
+  coalesce_window_ms_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_coalesce_window_ms(int64_t value_arg) {
+  coalesce_window_ms_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::max_pending_reads() const {
+  return max_pending_reads_ ? &(*max_pending_reads_) : nullptr;
+}
+
+void PasteInputConfig::set_max_pending_reads(const int64_t* value_arg) {
+  max_pending_reads_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_max_pending_reads(int64_t value_arg) {
+  max_pending_reads_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::max_outstanding_events() const {
+  return max_outstanding_events_ ? &(*max_outstanding_events_) : nullptr;
+}
+
+void PasteInputConfig::set_max_outstanding_events(const int64_t* value_arg) {
+  max_outstanding_events_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_max_outstanding_events(int64_t value_arg) {
+  max_outstanding_events_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::memory_budget_bytes() const {
+  return memory_budget_bytes_ ? &(*memory_budget_bytes_) : nullptr;
+}
+
+void PasteInputConfig::set_memory_budget_bytes(const int64_t* value_arg) {
+  memory_budget_bytes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_memory_budget_bytes(int64_t value_arg) {
+  memory_budget_bytes_ = value_arg;
+}
+
+
+const bool* PasteInputConfig::downscale_over_budget_images() const {
+  return downscale_over_budget_images_ ? &(*downscale_over_budget_images_) : nullptr;
+}
+
+void PasteInputConfig::set_downscale_over_budget_images(const bool* value_arg) {
+  downscale_over_budget_images_ = value_arg ? std::optional<bool>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_downscale_over_budget_images(bool value_arg) {
+  downscale_over_budget_images_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::max_transfer_bytes() const {
+  return max_transfer_bytes_ ? &(*max_transfer_bytes_) : nullptr;
+}
+
+void PasteInputConfig::set_max_transfer_bytes(const int64_t* value_arg) {
+  max_transfer_bytes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_max_transfer_bytes(int64_t value_arg) {
+  max_transfer_bytes_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::clipboard_store_max_bytes() const {
+  return clipboard_store_max_bytes_ ? &(*clipboard_store_max_bytes_) : nullptr;
+}
+
+void PasteInputConfig::set_clipboard_store_max_bytes(const int64_t* value_arg) {
+  clipboard_store_max_bytes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_clipboard_store_max_bytes(int64_t value_arg) {
+  clipboard_store_max_bytes_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::clipboard_store_time_budget_ms() const {
+  return clipboard_store_time_budget_ms_ ? &(*clipboard_store_time_budget_ms_) : nullptr;
+}
+
+void PasteInputConfig::set_clipboard_store_time_budget_ms(const int64_t* value_arg) {
+  clipboard_store_time_budget_ms_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_clipboard_store_time_budget_ms(int64_t value_arg) {
+  clipboard_store_time_budget_ms_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::history_max_entries() const {
+  return history_max_entries_ ? &(*history_max_entries_) : nullptr;
+}
+
+void PasteInputConfig::set_history_max_entries(const int64_t* value_arg) {
+  history_max_entries_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_history_max_entries(int64_t value_arg) {
+  history_max_entries_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::history_max_bytes() const {
+  return history_max_bytes_ ? &(*history_max_bytes_) : nullptr;
+}
+
+void PasteInputConfig::set_history_max_bytes(const int64_t* value_arg) {
+  history_max_bytes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_history_max_bytes(int64_t value_arg) {
+  history_max_bytes_ = value_arg;
+}
+
+
+const bool* PasteInputConfig::persist_history() const {
+  return persist_history_ ? &(*persist_history_) : nullptr;
+}
+
+void PasteInputConfig::set_persist_history(const bool* value_arg) {
+  persist_history_ = value_arg ? std::optional<bool>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_persist_history(bool value_arg) {
+  persist_history_ = value_arg;
+}
+
+
+const int64_t* PasteInputConfig::history_max_disk_bytes() const {
+  return history_max_disk_bytes_ ? &(*history_max_disk_bytes_) : nullptr;
+}
+
+void PasteInputConfig::set_history_max_disk_bytes(const int64_t* value_arg) {
+  history_max_disk_bytes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_history_max_disk_bytes(int64_t value_arg) {
+  history_max_disk_bytes_ = value_arg;
+}
+
+
+const std::string* PasteInputConfig::trace_file() const {
+  return trace_file_ ? &(*trace_file_) : nullptr;
+}
+
+void PasteInputConfig::set_trace_file(const std::string_view* value_arg) {
+  trace_file_ = value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void PasteInputConfig::set_trace_file(std::string_view value_arg) {
+  trace_file_ = value_arg;
+}
+
+
+EncodableList PasteInputConfig::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(13);
+  list.push_back(coalesce_window_ms_ ? EncodableValue(*coalesce_window_ms_) : EncodableValue());
+  list.push_back(max_pending_reads_ ? EncodableValue(*max_pending_reads_) : EncodableValue());
+  list.push_back(max_outstanding_events_ ? EncodableValue(*max_outstanding_events_) : EncodableValue());
+  list.push_back(memory_budget_bytes_ ? EncodableValue(*memory_budget_bytes_) : EncodableValue());
+  list.push_back(downscale_over_budget_images_ ? EncodableValue(*downscale_over_budget_images_) : EncodableValue());
+  list.push_back(max_transfer_bytes_ ? EncodableValue(*max_transfer_bytes_) : EncodableValue());
+  list.push_back(clipboard_store_max_bytes_ ? EncodableValue(*clipboard_store_max_bytes_) : EncodableValue());
+  list.push_back(clipboard_store_time_budget_ms_ ? EncodableValue(*clipboard_store_time_budget_ms_) : EncodableValue());
+  list.push_back(history_max_entries_ ? EncodableValue(*history_max_entries_) : EncodableValue());
+  list.push_back(history_max_bytes_ ? EncodableValue(*history_max_bytes_) : EncodableValue());
+  list.push_back(persist_history_ ? EncodableValue(*persist_history_) : EncodableValue());
+  list.push_back(history_max_disk_bytes_ ? EncodableValue(*history_max_disk_bytes_) : EncodableValue());
+  list.push_back(trace_file_ ? EncodableValue(*trace_file_) : EncodableValue());
+  return list;
+}
+
+PasteInputConfig PasteInputConfig::FromEncodableList(const EncodableList& list) {
+  PasteInputConfig decoded;
+  auto& encodable_coalesce_window_ms = list[0];
+  if (!encodable_coalesce_window_ms.IsNull()) {
+    decoded.set_coalesce_window_ms(std::get<int64_t>(encodable_coalesce_window_ms));
+  }
+  auto& encodable_max_pending_reads = list[1];
+  if (!encodable_max_pending_reads.IsNull()) {
+    decoded.set_max_pending_reads(std::get<int64_t>(encodable_max_pending_reads));
+  }
+  auto& encodable_max_outstanding_events = list[2];
+  if (!encodable_max_outstanding_events.IsNull()) {
+    decoded.set_max_outstanding_events(std::get<int64_t>(encodable_max_outstanding_events));
+  }
+  auto& encodable_memory_budget_bytes = list[3];
+  if (!encodable_memory_budget_bytes.IsNull()) {
+    decoded.set_memory_budget_bytes(std::get<int64_t>(encodable_memory_budget_bytes));
+  }
+  auto& encodable_downscale_over_budget_images = list[4];
+  if (!encodable_downscale_over_budget_images.IsNull()) {
+    decoded.set_downscale_over_budget_images(std::get<bool>(encodable_downscale_over_budget_images));
+  }
+  auto& encodable_max_transfer_bytes = list[5];
+  if (!encodable_max_transfer_bytes.IsNull()) {
+    decoded.set_max_transfer_bytes(std::get<int64_t>(encodable_max_transfer_bytes));
+  }
+  auto& encodable_clipboard_store_max_bytes = list[6];
+  if (!encodable_clipboard_store_max_bytes.IsNull()) {
+    decoded.set_clipboard_store_max_bytes(std::get<int64_t>(encodable_clipboard_store_max_bytes));
+  }
+  auto& encodable_clipboard_store_time_budget_ms = list[7];
+  if (!encodable_clipboard_store_time_budget_ms.IsNull()) {
+    decoded.set_clipboard_store_time_budget_ms(std::get<int64_t>(encodable_clipboard_store_time_budget_ms));
+  }
+  auto& encodable_history_max_entries = list[8];
+  if (!encodable_history_max_entries.IsNull()) {
+    decoded.set_history_max_entries(std::get<int64_t>(encodable_history_max_entries));
+  }
+  auto& encodable_history_max_bytes = list[9];
+  if (!encodable_history_max_bytes.IsNull()) {
+    decoded.set_history_max_bytes(std::get<int64_t>(encodable_history_max_bytes));
+  }
+  auto& encodable_persist_history = list[10];
+  if (!encodable_persist_history.IsNull()) {
+    decoded.set_persist_history(std::get<bool>(encodable_persist_history));
+  }
+  auto& encodable_history_max_disk_bytes = list[11];
+  if (!encodable_history_max_disk_bytes.IsNull()) {
+    decoded.set_history_max_disk_bytes(std::get<int64_t>(encodable_history_max_disk_bytes));
+  }
+  auto& encodable_trace_file = list[12];
+  if (!encodable_trace_file.IsNull()) {
+    decoded.set_trace_file(std::get<std::string>(encodable_trace_file));
+  }
+  return decoded;
+}
+
+// PasteProgress
+
+PasteProgress::PasteProgress(
+  int64_t request_id,
+  int64_t received_bytes)
+ : request_id_(request_id),
+    received_bytes_(received_bytes) {}
+
+PasteProgress::PasteProgress(
+  int64_t request_id,
+  int64_t received_bytes,
+  const int64_t* expected_bytes)
+ : request_id_(request_id),
+    received_bytes_(received_bytes),
+    expected_bytes_(expected_bytes ? std::optional<int64_t>(*expected_bytes) : std::nullopt) {}
+
+int64_t PasteProgress::request_id() const {
+  return request_id_;
+}
+
+void PasteProgress::set_request_id(int64_t value_arg) {
+  request_id_ = value_arg;
+}
+
+
+int64_t PasteProgress::received_bytes() const {
+  return received_bytes_;
+}
+
+void PasteProgress::set_received_bytes(int64_t value_arg) {
+  received_bytes_ = value_arg;
+}
+
+
+const int64_t* PasteProgress::expected_bytes() const {
+  return expected_bytes_ ? &(*expected_bytes_) : nullptr;
+}
+
+void PasteProgress::set_expected_bytes(const int64_t* value_arg) {
+  expected_bytes_ = value_arg ? std::optional<int64_t>(*value_arg) : std::nullopt;
+}
+
+void PasteProgress::set_expected_bytes(int64_t value_arg) {
+  expected_bytes_ = value_arg;
+}
+
+
+EncodableList PasteProgress::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(3);
+  list.push_back(EncodableValue(request_id_));
+  list.push_back(EncodableValue(received_bytes_));
+  list.push_back(expected_bytes_ ? EncodableValue(*expected_bytes_) : EncodableValue());
+  return list;
+}
+
+PasteProgress PasteProgress::FromEncodableList(const EncodableList& list) {
+  PasteProgress decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]));
+  auto& encodable_expected_bytes = list[2];
+  if (!encodable_expected_bytes.IsNull()) {
+    decoded.set_expected_bytes(std::get<int64_t>(encodable_expected_bytes));
+  }
   return decoded;
 }
 
-// ClipboardContent
+// ClipboardWrite
+
+ClipboardWrite::ClipboardWrite() {}
+
+ClipboardWrite::ClipboardWrite(
+  const std::string* text,
+  const std::vector<uint8_t>* image,
+  const std::string* image_mime_type,
+  const EncodableList* rendered_image_types)
+ : text_(text ? std::optional<std::string>(*text) : std::nullopt),
+    image_(image ? std::optional<std::vector<uint8_t>>(*image) : std::nullopt),
+    image_mime_type_(image_mime_type ? std::optional<std::string>(*image_mime_type) : std::nullopt),
+    rendered_image_types_(rendered_image_types ? std::optional<EncodableList>(*rendered_image_types) : std::nullopt) {}
+
+const std::string* ClipboardWrite::text() const {
+  return text_ ? &(*text_) : nullptr;
+}
+
+void ClipboardWrite::set_text(const std::string_view* value_arg) {
+  text_ = value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void ClipboardWrite::set_text(std::string_view value_arg) {
+  text_ = value_arg;
+}
+
+
+const std::vector<uint8_t>* ClipboardWrite::image() const {
+  return image_ ? &(*image_) : nullptr;
+}
+
+void ClipboardWrite::set_image(const std::vector<uint8_t>* value_arg) {
+  image_ = value_arg ? std::optional<std::vector<uint8_t>>(*value_arg) : std::nullopt;
+}
+
+void ClipboardWrite::set_image(const std::vector<uint8_t>& value_arg) {
+  image_ = value_arg;
+}
+
+
+const std::string* ClipboardWrite::image_mime_type() const {
+  return image_mime_type_ ? &(*image_mime_type_) : nullptr;
+}
+
+void ClipboardWrite::set_image_mime_type(const std::string_view* value_arg) {
+  image_mime_type_ = value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void ClipboardWrite::set_image_mime_type(std::string_view value_arg) {
+  image_mime_type_ = value_arg;
+}
+
+
+const EncodableList* ClipboardWrite::rendered_image_types() const {
+  return rendered_image_types_ ? &(*rendered_image_types_) : nullptr;
+}
+
+void ClipboardWrite::set_rendered_image_types(const EncodableList* value_arg) {
+  rendered_image_types_ = value_arg ? std::optional<EncodableList>(*value_arg) : std::nullopt;
+}
+
+void ClipboardWrite::set_rendered_image_types(const EncodableList& value_arg) {
+  rendered_image_types_ = value_arg;
+}
+
+
+EncodableList ClipboardWrite::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(text_ ? EncodableValue(*text_) : EncodableValue());
+  list.push_back(image_ ? EncodableValue(*image_) : EncodableValue());
+  list.push_back(image_mime_type_ ? EncodableValue(*image_mime_type_) : EncodableValue());
+  list.push_back(rendered_image_types_ ? EncodableValue(*rendered_image_types_) : EncodableValue());
+  return list;
+}
+
+ClipboardWrite ClipboardWrite::FromEncodableList(const EncodableList& list) {
+  ClipboardWrite decoded;
+  auto& encodable_text = list[0];
+  if (!encodable_text.IsNull()) {
+    decoded.set_text(std::get<std::string>(encodable_text));
+  }
+  auto& encodable_image = list[1];
+  if (!encodable_image.IsNull()) {
+    decoded.set_image(std::get<std::vector<uint8_t>>(encodable_image));
+  }
+  auto& encodable_image_mime_type = list[2];
+  if (!encodable_image_mime_type.IsNull()) {
+    decoded.set_image_mime_type(std::get<std::string>(encodable_image_mime_type));
+  }
+  auto& encodable_rendered_image_types = list[3];
+  if (!encodable_rendered_image_types.IsNull()) {
+    decoded.set_rendered_image_types(std::get<EncodableList>(encodable_rendered_image_types));
+  }
+  return decoded;
+}
+
+// ClipboardHistoryEntry
+
+ClipboardHistoryEntry::ClipboardHistoryEntry(
+  int64_t id,
+  int64_t captured_at_ms,
+  const EncodableList& mime_types,
+  int64_t byte_size)
+ : id_(id),
+    captured_at_ms_(captured_at_ms),
+    mime_types_(mime_types),
+    byte_size_(byte_size) {}
+
+int64_t ClipboardHistoryEntry::id() const {
+  return id_;
+}
+
+void ClipboardHistoryEntry::set_id(int64_t value_arg) {
+  id_ = value_arg;
+}
+
+
+int64_t ClipboardHistoryEntry::captured_at_ms() const {
+  return captured_at_ms_;
+}
+
+void ClipboardHistoryEntry::set_captured_at_ms(int64_t value_arg) {
+  captured_at_ms_ = value_arg;
+}
+
+
+const EncodableList& ClipboardHistoryEntry::mime_types() const {
+  return mime_types_;
+}
+
+void ClipboardHistoryEntry::set_mime_types(const EncodableList& value_arg) {
+  mime_types_ = value_arg;
+}
+
+
+int64_t ClipboardHistoryEntry::byte_size() const {
+  return byte_size_;
+}
+
+void ClipboardHistoryEntry::set_byte_size(int64_t value_arg) {
+  byte_size_ = value_arg;
+}
+
+
+EncodableList ClipboardHistoryEntry::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(EncodableValue(id_));
+  list.push_back(EncodableValue(captured_at_ms_));
+  list.push_back(EncodableValue(mime_types_));
+  list.push_back(EncodableValue(byte_size_));
+  return list;
+}
+
+ClipboardHistoryEntry ClipboardHistoryEntry::FromEncodableList(const EncodableList& list) {
+  ClipboardHistoryEntry decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<EncodableList>(list[2]),
+    std::get<int64_t>(list[3]));
+  return decoded;
+}
+
+// ClipboardHistoryMatch
+
+ClipboardHistoryMatch::ClipboardHistoryMatch(
+  int64_t id,
+  int64_t match_count,
+  const EncodableList& match_starts,
+  const EncodableList& match_ends)
+ : id_(id),
+    match_count_(match_count),
+    match_starts_(match_starts),
+    match_ends_(match_ends) {}
+
+int64_t ClipboardHistoryMatch::id() const {
+  return id_;
+}
+
+void ClipboardHistoryMatch::set_id(int64_t value_arg) {
+  id_ = value_arg;
+}
+
+
+int64_t ClipboardHistoryMatch::match_count() const {
+  return match_count_;
+}
+
+void ClipboardHistoryMatch::set_match_count(int64_t value_arg) {
+  match_count_ = value_arg;
+}
+
+
+const EncodableList& ClipboardHistoryMatch::match_starts() const {
+  return match_starts_;
+}
+
+void ClipboardHistoryMatch::set_match_starts(const EncodableList& value_arg) {
+  match_starts_ = value_arg;
+}
+
+
+const EncodableList& ClipboardHistoryMatch::match_ends() const {
+  return match_ends_;
+}
+
+void ClipboardHistoryMatch::set_match_ends(const EncodableList& value_arg) {
+  match_ends_ = value_arg;
+}
+
+
+EncodableList ClipboardHistoryMatch::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(EncodableValue(id_));
+  list.push_back(EncodableValue(match_count_));
+  list.push_back(EncodableValue(match_starts_));
+  list.push_back(EncodableValue(match_ends_));
+  return list;
+}
+
+ClipboardHistoryMatch ClipboardHistoryMatch::FromEncodableList(const EncodableList& list) {
+  ClipboardHistoryMatch decoded(
+    std::get<int64_t>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<EncodableList>(list[2]),
+    std::get<EncodableList>(list[3]));
+  return decoded;
+}
+
+// PasteStageStats
+
+PasteStageStats::PasteStageStats(
+  const std::string& stage,
+  int64_t count,
+  int64_t total_micros,
+  int64_t max_micros,
+  int64_t bytes_in,
+  int64_t bytes_out)
+ : stage_(stage),
+    count_(count),
+    total_micros_(total_micros),
+    max_micros_(max_micros),
+    bytes_in_(bytes_in),
+    bytes_out_(bytes_out) {}
+
+const std::string& PasteStageStats::stage() const {
+  return stage_;
+}
+
+void PasteStageStats::set_stage(std::string_view value_arg) {
+  stage_ = value_arg;
+}
+
+
+int64_t PasteStageStats::count() const {
+  return count_;
+}
+
+void PasteStageStats::set_count(int64_t value_arg) {
+  count_ = value_arg;
+}
+
+
+int64_t PasteStageStats::total_micros() const {
+  return total_micros_;
+}
+
+void PasteStageStats::set_total_micros(int64_t value_arg) {
+  total_micros_ = value_arg;
+}
+
+
+int64_t PasteStageStats::max_micros() const {
+  return max_micros_;
+}
+
+void PasteStageStats::set_max_micros(int64_t value_arg) {
+  max_micros_ = value_arg;
+}
+
+
+int64_t PasteStageStats::bytes_in() const {
+  return bytes_in_;
+}
+
+void PasteStageStats::set_bytes_in(int64_t value_arg) {
+  bytes_in_ = value_arg;
+}
+
+
+int64_t PasteStageStats::bytes_out() const {
+  return bytes_out_;
+}
+
+void PasteStageStats::set_bytes_out(int64_t value_arg) {
+  bytes_out_ = value_arg;
+}
+
+
+EncodableList PasteStageStats::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(6);
+  list.push_back(EncodableValue(stage_));
+  list.push_back(EncodableValue(count_));
+  list.push_back(EncodableValue(total_micros_));
+  list.push_back(EncodableValue(max_micros_));
+  list.push_back(EncodableValue(bytes_in_));
+  list.push_back(EncodableValue(bytes_out_));
+  return list;
+}
+
+PasteStageStats PasteStageStats::FromEncodableList(const EncodableList& list) {
+  PasteStageStats decoded(
+    std::get<std::string>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]));
+  return decoded;
+}
+
+// PasteLatencyStats
+
+PasteLatencyStats::PasteLatencyStats(
+  const std::string& stage,
+  const std::string& content_class,
+  int64_t count,
+  int64_t p50_micros,
+  int64_t p90_micros,
+  int64_t p99_micros,
+  int64_t max_micros)
+ : stage_(stage),
+    content_class_(content_class),
+    count_(count),
+    p50_micros_(p50_micros),
+    p90_micros_(p90_micros),
+    p99_micros_(p99_micros),
+    max_micros_(max_micros) {}
+
+const std::string& PasteLatencyStats::stage() const {
+  return stage_;
+}
+
+void PasteLatencyStats::set_stage(std::string_view value_arg) {
+  stage_ = value_arg;
+}
+
+
+const std::string& PasteLatencyStats::content_class() const {
+  return content_class_;
+}
+
+void PasteLatencyStats::set_content_class(std::string_view value_arg) {
+  content_class_ = value_arg;
+}
+
+
+int64_t PasteLatencyStats::count() const {
+  return count_;
+}
+
+void PasteLatencyStats::set_count(int64_t value_arg) {
+  count_ = value_arg;
+}
+
+
+int64_t PasteLatencyStats::p50_micros() const {
+  return p50_micros_;
+}
+
+void PasteLatencyStats::set_p50_micros(int64_t value_arg) {
+  p50_micros_ = value_arg;
+}
+
+
+int64_t PasteLatencyStats::p90_micros() const {
+  return p90_micros_;
+}
+
+void PasteLatencyStats::set_p90_micros(int64_t value_arg) {
+  p90_micros_ = value_arg;
+}
+
+
+int64_t PasteLatencyStats::p99_micros() const {
+  return p99_micros_;
+}
+
+void PasteLatencyStats::set_p99_micros(int64_t value_arg) {
+  p99_micros_ = value_arg;
+}
 
-ClipboardContent::ClipboardContent(const EncodableList& items)
- : items_(items) {}
 
-const EncodableList& ClipboardContent::items() const {
-  return items_;
+int64_t PasteLatencyStats::max_micros() const {
+  return max_micros_;
 }
 
-void ClipboardContent::set_items(const EncodableList& value_arg) {
-  items_ = value_arg;
+void PasteLatencyStats::set_max_micros(int64_t value_arg) {
+  max_micros_ = value_arg;
 }
 
 
-EncodableList ClipboardContent::ToEncodableList() const {
+EncodableList PasteLatencyStats::ToEncodableList() const {
   EncodableList list;
-  list.reserve(1);
-  list.push_back(EncodableValue(items_));
+  list.reserve(7);
+  list.push_back(EncodableValue(stage_));
+  list.push_back(EncodableValue(content_class_));
+  list.push_back(EncodableValue(count_));
+  list.push_back(EncodableValue(p50_micros_));
+  list.push_back(EncodableValue(p90_micros_));
+  list.push_back(EncodableValue(p99_micros_));
+  list.push_back(EncodableValue(max_micros_));
   return list;
 }
 
-ClipboardContent ClipboardContent::FromEncodableList(const EncodableList& list) {
-  ClipboardContent decoded(
-    std::get<EncodableList>(list[0]));
+PasteLatencyStats PasteLatencyStats::FromEncodableList(const EncodableList& list) {
+  PasteLatencyStats decoded(
+    std::get<std::string>(list[0]),
+    std::get<std::string>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]),
+    std::get<int64_t>(list[6]));
   return decoded;
 }
 
@@ -109,6 +1054,30 @@ EncodableValue PigeonInternalCodecSerializer::ReadValueOfType(
     case 130: {
         return CustomEncodableValue(ClipboardContent::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
+    case 131: {
+        return CustomEncodableValue(ClipboardProbe::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 132: {
+        return CustomEncodableValue(PasteInputConfig::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 133: {
+        return CustomEncodableValue(PasteProgress::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 134: {
+        return CustomEncodableValue(ClipboardWrite::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 135: {
+        return CustomEncodableValue(ClipboardHistoryEntry::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 136: {
+        return CustomEncodableValue(ClipboardHistoryMatch::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 137: {
+        return CustomEncodableValue(PasteStageStats::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 138: {
+        return CustomEncodableValue(PasteLatencyStats::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
     default:
       return flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
     }
@@ -128,6 +1097,46 @@ void PigeonInternalCodecSerializer::WriteValue(
       WriteValue(EncodableValue(std::any_cast<ClipboardContent>(*custom_value).ToEncodableList()), stream);
       return;
     }
+    if (custom_value->type() == typeid(ClipboardProbe)) {
+      stream->WriteByte(131);
+      WriteValue(EncodableValue(std::any_cast<ClipboardProbe>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PasteInputConfig)) {
+      stream->WriteByte(132);
+      WriteValue(EncodableValue(std::any_cast<PasteInputConfig>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PasteProgress)) {
+      stream->WriteByte(133);
+      WriteValue(EncodableValue(std::any_cast<PasteProgress>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(ClipboardWrite)) {
+      stream->WriteByte(134);
+      WriteValue(EncodableValue(std::any_cast<ClipboardWrite>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(ClipboardHistoryEntry)) {
+      stream->WriteByte(135);
+      WriteValue(EncodableValue(std::any_cast<ClipboardHistoryEntry>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(ClipboardHistoryMatch)) {
+      stream->WriteByte(136);
+      WriteValue(EncodableValue(std::any_cast<ClipboardHistoryMatch>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PasteStageStats)) {
+      stream->WriteByte(137);
+      WriteValue(EncodableValue(std::any_cast<PasteStageStats>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PasteLatencyStats)) {
+      stream->WriteByte(138);
+      WriteValue(EncodableValue(std::any_cast<PasteLatencyStats>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
   }
   flutter::StandardCodecSerializer::WriteValue(value, stream);
 }
@@ -154,14 +1163,22 @@ void PasteInputHostApi::SetUp(
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
         try {
-          ErrorOr<ClipboardContent> output = api->GetClipboardContent();
-          if (output.has_error()) {
-            reply(WrapError(output.error()));
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_request_id_arg = args.at(0);
+          if (encodable_request_id_arg.IsNull()) {
+            reply(WrapError("request_id_arg unexpectedly null."));
             return;
           }
-          EncodableList wrapped;
-          wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
-          reply(EncodableValue(std::move(wrapped)));
+          const int64_t request_id_arg = encodable_request_id_arg.LongValue();
+          api->GetClipboardContent(request_id_arg, [reply](ErrorOr<ClipboardContent>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
         } catch (const std::exception& exception) {
           reply(WrapError(exception.what()));
         }
@@ -212,6 +1229,344 @@ void PasteInputHostApi::SetUp(
       channel.SetMessageHandler(nullptr);
     }
   }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.probeClipboard" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->ProbeClipboard([reply](ErrorOr<ClipboardProbe>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.configure" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_config_arg = args.at(0);
+          if (encodable_config_arg.IsNull()) {
+            reply(WrapError("config_arg unexpectedly null."));
+            return;
+          }
+          const auto& config_arg = std::any_cast<const PasteInputConfig&>(std::get<CustomEncodableValue>(encodable_config_arg));
+          std::optional<FlutterError> output = api->Configure(config_arg);
+          if (output.has_value()) {
+            reply(WrapError(output.value()));
+            return;
+          }
+          EncodableList wrapped;
+          wrapped.push_back(EncodableValue());
+          reply(EncodableValue(std::move(wrapped)));
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.prefetchClipboard" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          std::optional<FlutterError> output = api->PrefetchClipboard();
+          if (output.has_value()) {
+            reply(WrapError(output.value()));
+            return;
+          }
+          EncodableList wrapped;
+          wrapped.push_back(EncodableValue());
+          reply(EncodableValue(std::move(wrapped)));
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.cancelPaste" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_request_id_arg = args.at(0);
+          if (encodable_request_id_arg.IsNull()) {
+            reply(WrapError("request_id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t request_id_arg = encodable_request_id_arg.LongValue();
+          std::optional<FlutterError> output = api->CancelPaste(request_id_arg);
+          if (output.has_value()) {
+            reply(WrapError(output.value()));
+            return;
+          }
+          EncodableList wrapped;
+          wrapped.push_back(EncodableValue());
+          reply(EncodableValue(std::move(wrapped)));
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.trimMemory" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_level_arg = args.at(0);
+          if (encodable_level_arg.IsNull()) {
+            reply(WrapError("level_arg unexpectedly null."));
+            return;
+          }
+          const int64_t level_arg = encodable_level_arg.LongValue();
+          api->TrimMemory(level_arg, [reply](ErrorOr<int64_t>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.setClipboardContent" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_content_arg = args.at(0);
+          if (encodable_content_arg.IsNull()) {
+            reply(WrapError("content_arg unexpectedly null."));
+            return;
+          }
+          const auto& content_arg = std::any_cast<const ClipboardWrite&>(std::get<CustomEncodableValue>(encodable_content_arg));
+          api->SetClipboardContent(content_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.listClipboardHistory" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->ListClipboardHistory([reply](ErrorOr<flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getClipboardHistoryEntry" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_id_arg = args.at(0);
+          if (encodable_id_arg.IsNull()) {
+            reply(WrapError("id_arg unexpectedly null."));
+            return;
+          }
+          const int64_t id_arg = encodable_id_arg.LongValue();
+          api->GetClipboardHistoryEntry(id_arg, [reply](ErrorOr<ClipboardContent>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.searchClipboardHistory" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_query_arg = args.at(0);
+          if (encodable_query_arg.IsNull()) {
+            reply(WrapError("query_arg unexpectedly null."));
+            return;
+          }
+          const auto& query_arg = std::get<std::string>(encodable_query_arg);
+          const auto& encodable_max_results_arg = args.at(1);
+          if (encodable_max_results_arg.IsNull()) {
+            reply(WrapError("max_results_arg unexpectedly null."));
+            return;
+          }
+          const int64_t max_results_arg = encodable_max_results_arg.LongValue();
+          api->SearchClipboardHistory(query_arg, max_results_arg, [reply](ErrorOr<flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteStats" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->GetPasteStats([reply](ErrorOr<flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.resetPasteStats" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->ResetPasteStats([reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.getPasteLatencies" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->GetPasteLatencies([reply](ErrorOr<flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_paste_input.PasteInputHostApi.dumpPasteTrace" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_path_arg = args.at(0);
+          if (encodable_path_arg.IsNull()) {
+            reply(WrapError("path_arg unexpectedly null."));
+            return;
+          }
+          const auto& path_arg = std::get<std::string>(encodable_path_arg);
+          api->DumpPasteTrace(path_arg, [reply](ErrorOr<int64_t>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
 }
 
 EncodableValue PasteInputHostApi::WrapError(std::string_view error_message) {
@@ -270,4 +1625,29 @@ void PasteInputFlutterApi::OnPasteDetected(
   });
 }
 
+void PasteInputFlutterApi::OnPasteProgress(
+  const PasteProgress& progress_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.flutter_paste_input.PasteInputFlutterApi.onPasteProgress" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    CustomEncodableValue(progress_arg),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
 }  // namespace flutter_paste_input
@@ -66,11 +66,21 @@ template<class T> class ErrorOr {
 // Generated class from Pigeon that represents data sent in messages.
 class ClipboardItem {
  public:
-  // Constructs an object setting all fields.
+  // Constructs an object setting all non-nullable fields.
   explicit ClipboardItem(
     const std::vector<uint8_t>& data,
     const std::string& mime_type);
 
+  // Constructs an object setting all fields.
+  explicit ClipboardItem(
+    const std::vector<uint8_t>& data,
+    const std::string& mime_type,
+    const int64_t* width,
+    const int64_t* height,
+    const bool* has_alpha,
+    const int64_t* frame_count,
+    const int64_t* original_byte_size);
+
   // Raw binary data of the clipboard item.
   //
   // For images, this contains the image bytes (PNG, JPEG, GIF, etc.).
@@ -89,6 +99,43 @@ class ClipboardItem {
   const std::string& mime_type() const;
   void set_mime_type(std::string_view value_arg);
 
+  // Width of the image in pixels.
+  //
+  // Only set for image items, and only when the platform knows the
+  // dimensions without decoding the bytes on the Dart side.
+  const int64_t* width() const;
+  void set_width(const int64_t* value_arg);
+  void set_width(int64_t value_arg);
+
+  // Height of the image in pixels.
+  //
+  // Only set for image items, see [width].
+  const int64_t* height() const;
+  void set_height(const int64_t* value_arg);
+  void set_height(int64_t value_arg);
+
+  // Whether the image has an alpha channel.
+  //
+  // Only set for image items.
+  const bool* has_alpha() const;
+  void set_has_alpha(const bool* value_arg);
+  void set_has_alpha(bool value_arg);
+
+  // Number of frames in the image (greater than 1 for animations).
+  //
+  // Only set for image items.
+  const int64_t* frame_count() const;
+  void set_frame_count(const int64_t* value_arg);
+  void set_frame_count(int64_t value_arg);
+
+  // Size in bytes of the clipboard representation the item was read from.
+  //
+  // For images that are re-encoded natively (e.g. a bitmap converted to
+  // PNG), this is the size of the source data rather than [data].
+  const int64_t* original_byte_size() const;
+  void set_original_byte_size(const int64_t* value_arg);
+  void set_original_byte_size(int64_t value_arg);
+
 
  private:
   static ClipboardItem FromEncodableList(const flutter::EncodableList& list);
@@ -98,6 +145,11 @@ class ClipboardItem {
   friend class PigeonInternalCodecSerializer;
   std::vector<uint8_t> data_;
   std::string mime_type_;
+  std::optional<int64_t> width_;
+  std::optional<int64_t> height_;
+  std::optional<bool> has_alpha_;
+  std::optional<int64_t> frame_count_;
+  std::optional<int64_t> original_byte_size_;
 
 };
 
@@ -110,15 +162,26 @@ class ClipboardItem {
 // Generated class from Pigeon that represents data sent in messages.
 class ClipboardContent {
  public:
-  // Constructs an object setting all fields.
+  // Constructs an object setting all non-nullable fields.
   explicit ClipboardContent(const flutter::EncodableList& items);
 
+  // Constructs an object setting all fields.
+  explicit ClipboardContent(
+    const flutter::EncodableList& items,
+    const int64_t* peak_memory_bytes);
+
   // List of clipboard items.
   //
   // May be empty if the clipboard is empty or contains unsupported content.
   const flutter::EncodableList& items() const;
   void set_items(const flutter::EncodableList& value_arg);
 
+  // Most bytes the platform held at once while reading, converting and
+  // sending this content (Linux).
+  const int64_t* peak_memory_bytes() const;
+  void set_peak_memory_bytes(const int64_t* value_arg);
+  void set_peak_memory_bytes(int64_t value_arg);
+
 
  private:
   static ClipboardContent FromEncodableList(const flutter::EncodableList& list);
@@ -127,6 +190,523 @@ class ClipboardContent {
   friend class PasteInputFlutterApi;
   friend class PigeonInternalCodecSerializer;
   flutter::EncodableList items_;
+  std::optional<int64_t> peak_memory_bytes_;
+
+};
+
+
+// Cheap summary of the clipboard state, obtained without reading any data.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class ClipboardProbe {
+ public:
+  // Constructs an object setting all fields.
+  explicit ClipboardProbe(
+    int64_t change_count,
+    const flutter::EncodableList& mime_types);
+
+  // Counter that increases every time the clipboard contents change.
+  //
+  // Only meaningful when compared with an earlier value from the same
+  // process; the absolute value is platform specific.
+  int64_t change_count() const;
+  void set_change_count(int64_t value_arg);
+
+  // MIME types currently offered by the clipboard owner.
+  //
+  // Text formats are reported as "text/plain" regardless of the
+  // platform's native name for them.
+  const flutter::EncodableList& mime_types() const;
+  void set_mime_types(const flutter::EncodableList& value_arg);
+
+
+ private:
+  static ClipboardProbe FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t change_count_;
+  flutter::EncodableList mime_types_;
+
+};
+
+
+// Tuning options for the native paste pipeline.
+//
+// Every field is optional; null leaves the current setting unchanged.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PasteInputConfig {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  PasteInputConfig();
+
+  // Constructs an object setting all fields.
+  explicit PasteInputConfig(
+    const int64_t* coalesce_window_ms,
+    const int64_t* max_pending_reads,
+    const int64_t* max_outstanding_events,
+    const int64_t* memory_budget_bytes,
+    const bool* downscale_over_budget_images,
+    const int64_t* max_transfer_bytes,
+    const int64_t* clipboard_store_max_bytes,
+    const int64_t* clipboard_store_time_budget_ms,
+    const int64_t* history_max_entries,
+    const int64_t* history_max_bytes,
+    const bool* persist_history,
+    const int64_t* history_max_disk_bytes,
+    const std::string* trace_file);
+
+  // How long, in milliseconds, a completed clipboard read is reused for
+  // further paste requests while the clipboard is unchanged.
+  //
+  // Requests arriving while a read is in flight always share it. This
+  // covers key repeat from a held-down Ctrl+V.
+  const int64_t* coalesce_window_ms() const;
+  void set_coalesce_window_ms(const int64_t* value_arg);
+  void set_coalesce_window_ms(int64_t value_arg);
+
+  // Maximum number of paste requests that may wait on an in-flight read.
+  //
+  // Further requests fail with the error code "busy".
+  const int64_t* max_pending_reads() const;
+  void set_max_pending_reads(const int64_t* value_arg);
+  void set_max_pending_reads(int64_t value_arg);
+
+  // Maximum number of [PasteInputFlutterApi.onPasteDetected] events sent
+  // before Dart has handled them (Linux).
+  //
+  // Events beyond the limit are held back and only the newest is kept, so
+  // a burst of pastes never queues several stale payloads.
+  const int64_t* max_outstanding_events() const;
+  void set_max_outstanding_events(const int64_t* value_arg);
+  void set_max_outstanding_events(int64_t value_arg);
+
+  // Upper bound, in bytes, on the native memory held by pastes in flight
+  // and by their results, shared by all engines in the process (Linux).
+  //
+  // An image paste that does not fit waits for earlier pastes to release
+  // their buffers. One that could never fit is downscaled (see
+  // [downscaleOverBudgetImages]) or fails with the error code
+  // "over-budget". 0 disables the limit; the default is 512 MiB.
+  const int64_t* memory_budget_bytes() const;
+  void set_memory_budget_bytes(const int64_t* value_arg);
+  void set_memory_budget_bytes(int64_t value_arg);
+
+  // Whether images too large for [memoryBudgetBytes] are downscaled rather
+  // than refused. Defaults to true.
+  const bool* downscale_over_budget_images() const;
+  void set_downscale_over_budget_images(const bool* value_arg);
+  void set_downscale_over_budget_images(bool value_arg);
+
+  // Largest clipboard selection, in bytes, that is transferred before the
+  // paste fails with the error code "too-large" (Linux, X11). 0 disables
+  // the limit; the default is 256 MiB.
+  const int64_t* max_transfer_bytes() const;
+  void set_max_transfer_bytes(const int64_t* value_arg);
+  void set_max_transfer_bytes(int64_t value_arg);
+
+  // Most bytes of content set with [PasteInputHostApi.setClipboardContent]
+  // handed to the clipboard manager when the app exits, so that it stays
+  // pasteable (Linux).
+  //
+  // Text is offered first, then the image as given, then rendered formats
+  // in order; each format that would exceed the limit is left out, so a
+  // compact rendered format is kept even when the original image is too
+  // large. 0 disables the limit; the default is 64 MiB.
+  const int64_t* clipboard_store_max_bytes() const;
+  void set_clipboard_store_max_bytes(const int64_t* value_arg);
+  void set_clipboard_store_max_bytes(int64_t value_arg);
+
+  // Time, in milliseconds, the app may spend at exit rendering formats not
+  // requested yet for the clipboard manager (Linux). Formats not rendered
+  // in time are left out; an encode still running at the deadline stops at
+  // its next output chunk. Decoding the source image, done once, is not
+  // interrupted. 0 disables the limit; the default is 1000.
+  const int64_t* clipboard_store_time_budget_ms() const;
+  void set_clipboard_store_time_budget_ms(const int64_t* value_arg);
+  void set_clipboard_store_time_budget_ms(int64_t value_arg);
+
+  // Most clipboard snapshots kept in the history (Linux).
+  //
+  // Every successful read is recorded; content already in the history
+  // moves to the front instead of being added again. 0 disables the
+  // history and drops what it holds; the default is 50.
+  const int64_t* history_max_entries() const;
+  void set_history_max_entries(const int64_t* value_arg);
+  void set_history_max_entries(int64_t value_arg);
+
+  // Upper bound, in bytes, on the memory held by the history (Linux).
+  //
+  // Text is kept compressed and counts with its compressed size. The
+  // oldest entries are dropped first. 0 disables the limit; the default
+  // is 32 MiB.
+  //
+  // With [persistHistory] set, entries over the limit are only dropped
+  // from memory and read back from disk when fetched.
+  const int64_t* history_max_bytes() const;
+  void set_history_max_bytes(const int64_t* value_arg);
+  void set_history_max_bytes(int64_t value_arg);
+
+  // Whether the history is kept on disk, under the user cache directory,
+  // so that it survives restarts (Linux).
+  //
+  // Off by default, as clipboard content may be sensitive. Turning it off
+  // deletes the files.
+  const bool* persist_history() const;
+  void set_persist_history(const bool* value_arg);
+  void set_persist_history(bool value_arg);
+
+  // Upper bound, in bytes, on the disk space used by a persisted history
+  // (Linux). The oldest entries are dropped first. 0 disables the limit;
+  // the default is 128 MiB.
+  const int64_t* history_max_disk_bytes() const;
+  void set_history_max_disk_bytes(const int64_t* value_arg);
+  void set_history_max_disk_bytes(int64_t value_arg);
+
+  // File the paste pipeline trace is written to when the app exits
+  // (Linux).
+  //
+  // Setting it starts recording the begin and end of every pipeline stage
+  // and worker thread job; an empty string stops recording. The file is
+  // Chrome trace JSON, for Perfetto or chrome://tracing. See also
+  // [PasteInputHostApi.dumpPasteTrace].
+  const std::string* trace_file() const;
+  void set_trace_file(const std::string_view* value_arg);
+  void set_trace_file(std::string_view value_arg);
+
+
+ private:
+  static PasteInputConfig FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::optional<int64_t> coalesce_window_ms_;
+  std::optional<int64_t> max_pending_reads_;
+  std::optional<int64_t> max_outstanding_events_;
+  std::optional<int64_t> memory_budget_bytes_;
+  std::optional<bool> downscale_over_budget_images_;
+  std::optional<int64_t> max_transfer_bytes_;
+  std::optional<int64_t> clipboard_store_max_bytes_;
+  std::optional<int64_t> clipboard_store_time_budget_ms_;
+  std::optional<int64_t> history_max_entries_;
+  std::optional<int64_t> history_max_bytes_;
+  std::optional<bool> persist_history_;
+  std::optional<int64_t> history_max_disk_bytes_;
+  std::optional<std::string> trace_file_;
+
+};
+
+
+// Progress of a large clipboard transfer for a pending
+// [PasteInputHostApi.getClipboardContent] request (Linux, X11).
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PasteProgress {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  explicit PasteProgress(
+    int64_t request_id,
+    int64_t received_bytes);
+
+  // Constructs an object setting all fields.
+  explicit PasteProgress(
+    int64_t request_id,
+    int64_t received_bytes,
+    const int64_t* expected_bytes);
+
+  // The id the request was made with.
+  int64_t request_id() const;
+  void set_request_id(int64_t value_arg);
+
+  // Bytes received from the clipboard owner so far.
+  int64_t received_bytes() const;
+  void set_received_bytes(int64_t value_arg);
+
+  // Size announced by the owner, if any. For incremental transfers this
+  // is only a lower bound.
+  const int64_t* expected_bytes() const;
+  void set_expected_bytes(const int64_t* value_arg);
+  void set_expected_bytes(int64_t value_arg);
+
+
+ private:
+  static PasteProgress FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t request_id_;
+  int64_t received_bytes_;
+  std::optional<int64_t> expected_bytes_;
+
+};
+
+
+// Content placed on the clipboard by
+// [PasteInputHostApi.setClipboardContent].
+//
+// Generated class from Pigeon that represents data sent in messages.
+class ClipboardWrite {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  ClipboardWrite();
+
+  // Constructs an object setting all fields.
+  explicit ClipboardWrite(
+    const std::string* text,
+    const std::vector<uint8_t>* image,
+    const std::string* image_mime_type,
+    const flutter::EncodableList* rendered_image_types);
+
+  // Plain text to offer.
+  const std::string* text() const;
+  void set_text(const std::string_view* value_arg);
+  void set_text(std::string_view value_arg);
+
+  // Encoded image to offer, in the format given by [imageMimeType].
+  const std::vector<uint8_t>* image() const;
+  void set_image(const std::vector<uint8_t>* value_arg);
+  void set_image(const std::vector<uint8_t>& value_arg);
+
+  // MIME type of [image], e.g. "image/png". Required with [image].
+  const std::string* image_mime_type() const;
+  void set_image_mime_type(const std::string_view* value_arg);
+  void set_image_mime_type(std::string_view value_arg);
+
+  // Further image formats to offer, e.g. "image/jpeg" or "image/bmp".
+  //
+  // On Linux each is rendered from [image] only when another application
+  // asks for it, and kept once rendered. Other platforms offer [image] in
+  // its own format only.
+  const flutter::EncodableList* rendered_image_types() const;
+  void set_rendered_image_types(const flutter::EncodableList* value_arg);
+  void set_rendered_image_types(const flutter::EncodableList& value_arg);
+
+
+ private:
+  static ClipboardWrite FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::optional<std::string> text_;
+  std::optional<std::vector<uint8_t>> image_;
+  std::optional<std::string> image_mime_type_;
+  std::optional<flutter::EncodableList> rendered_image_types_;
+
+};
+
+
+// Metadata of one clipboard history entry, see
+// [PasteInputHostApi.listClipboardHistory].
+//
+// Generated class from Pigeon that represents data sent in messages.
+class ClipboardHistoryEntry {
+ public:
+  // Constructs an object setting all fields.
+  explicit ClipboardHistoryEntry(
+    int64_t id,
+    int64_t captured_at_ms,
+    const flutter::EncodableList& mime_types,
+    int64_t byte_size);
+
+  // Identifies the entry for [PasteInputHostApi.getClipboardHistoryEntry].
+  // Ids are never reused within a process.
+  int64_t id() const;
+  void set_id(int64_t value_arg);
+
+  // When the content was last read from the clipboard, in milliseconds
+  // since the Unix epoch.
+  int64_t captured_at_ms() const;
+  void set_captured_at_ms(int64_t value_arg);
+
+  // MIME types of the entry's items, images first.
+  const flutter::EncodableList& mime_types() const;
+  void set_mime_types(const flutter::EncodableList& value_arg);
+
+  // Size of the content as it was pasted, before compression.
+  int64_t byte_size() const;
+  void set_byte_size(int64_t value_arg);
+
+
+ private:
+  static ClipboardHistoryEntry FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t id_;
+  int64_t captured_at_ms_;
+  flutter::EncodableList mime_types_;
+  int64_t byte_size_;
+
+};
+
+
+// A clipboard history entry matching a search, see
+// [PasteInputHostApi.searchClipboardHistory].
+//
+// Generated class from Pigeon that represents data sent in messages.
+class ClipboardHistoryMatch {
+ public:
+  // Constructs an object setting all fields.
+  explicit ClipboardHistoryMatch(
+    int64_t id,
+    int64_t match_count,
+    const flutter::EncodableList& match_starts,
+    const flutter::EncodableList& match_ends);
+
+  // The entry, as in [ClipboardHistoryEntry.id].
+  int64_t id() const;
+  void set_id(int64_t value_arg);
+
+  // Occurrences of the query's terms in the entry's text.
+  int64_t match_count() const;
+  void set_match_count(int64_t value_arg);
+
+  // Where matches start in the entry's text, in UTF-16 code units as Dart
+  // strings index them, in ascending order. At most 64 are reported.
+  const flutter::EncodableList& match_starts() const;
+  void set_match_starts(const flutter::EncodableList& value_arg);
+
+  // Where the matches in [matchStarts] end, exclusive.
+  const flutter::EncodableList& match_ends() const;
+  void set_match_ends(const flutter::EncodableList& value_arg);
+
+
+ private:
+  static ClipboardHistoryMatch FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  int64_t id_;
+  int64_t match_count_;
+  flutter::EncodableList match_starts_;
+  flutter::EncodableList match_ends_;
+
+};
+
+
+// Timings of one stage of the native paste pipeline, see
+// [PasteInputHostApi.getPasteStats].
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PasteStageStats {
+ public:
+  // Constructs an object setting all fields.
+  explicit PasteStageStats(
+    const std::string& stage,
+    int64_t count,
+    int64_t total_micros,
+    int64_t max_micros,
+    int64_t bytes_in,
+    int64_t bytes_out);
+
+  // The stage: "selection" (waiting on the clipboard owner), "decode",
+  // "encode" (PNG), "serialize" (building the reply), "dart" (from
+  // sending a paste event until Dart has handled it) or "total" (from the
+  // paste request reaching the plugin until the reply is sent or the paste
+  // event handled).
+  const std::string& stage() const;
+  void set_stage(std::string_view value_arg);
+
+  // Runs of the stage since the last reset.
+  int64_t count() const;
+  void set_count(int64_t value_arg);
+
+  // Time spent in the stage, in microseconds.
+  int64_t total_micros() const;
+  void set_total_micros(int64_t value_arg);
+
+  // Longest single run, in microseconds.
+  int64_t max_micros() const;
+  void set_max_micros(int64_t value_arg);
+
+  // Bytes the stage consumed and produced.
+  int64_t bytes_in() const;
+  void set_bytes_in(int64_t value_arg);
+
+  int64_t bytes_out() const;
+  void set_bytes_out(int64_t value_arg);
+
+
+ private:
+  static PasteStageStats FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string stage_;
+  int64_t count_;
+  int64_t total_micros_;
+  int64_t max_micros_;
+  int64_t bytes_in_;
+  int64_t bytes_out_;
+
+};
+
+
+// Latency percentiles of one stage of the native paste pipeline for one
+// kind of content, see [PasteInputHostApi.getPasteLatencies].
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PasteLatencyStats {
+ public:
+  // Constructs an object setting all fields.
+  explicit PasteLatencyStats(
+    const std::string& stage,
+    const std::string& content_class,
+    int64_t count,
+    int64_t p50_micros,
+    int64_t p90_micros,
+    int64_t p99_micros,
+    int64_t max_micros);
+
+  // The stage, as in [PasteStageStats.stage].
+  const std::string& stage() const;
+  void set_stage(std::string_view value_arg);
+
+  // What was pasted: "text", "small-image" or "large-image" (at least
+  // 1024 x 1024 pixels).
+  const std::string& content_class() const;
+  void set_content_class(std::string_view value_arg);
+
+  // Runs of the stage since the last reset.
+  int64_t count() const;
+  void set_count(int64_t value_arg);
+
+  // Percentiles, in microseconds, within about 6% of the exact value.
+  int64_t p50_micros() const;
+  void set_p50_micros(int64_t value_arg);
+
+  int64_t p90_micros() const;
+  void set_p90_micros(int64_t value_arg);
+
+  int64_t p99_micros() const;
+  void set_p99_micros(int64_t value_arg);
+
+  // Longest single run, in microseconds.
+  int64_t max_micros() const;
+  void set_max_micros(int64_t value_arg);
+
+
+ private:
+  static PasteLatencyStats FromEncodableList(const flutter::EncodableList& list);
+  flutter::EncodableList ToEncodableList() const;
+  friend class PasteInputHostApi;
+  friend class PasteInputFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string stage_;
+  std::string content_class_;
+  int64_t count_;
+  int64_t p50_micros_;
+  int64_t p90_micros_;
+  int64_t p99_micros_;
+  int64_t max_micros_;
 
 };
 
@@ -168,7 +748,15 @@ class PasteInputHostApi {
   //
   // Returns an empty [ClipboardContent] if the clipboard is empty or
   // contains only unsupported content types.
-  virtual ErrorOr<ClipboardContent> GetClipboardContent() = 0;
+  //
+  // Requests made while a read is in progress, or shortly after one
+  // completed (see [PasteInputConfig.coalesceWindowMs]), share its result.
+  //
+  // [requestId] identifies the request for [cancelPaste]; 0 means the
+  // request cannot be cancelled.
+  virtual void GetClipboardContent(
+    int64_t request_id,
+    std::function<void(ErrorOr<ClipboardContent> reply)> result) = 0;
   // Clears temporary files created during paste operations.
   //
   // Call this periodically to free up disk space. Paste operations may
@@ -179,6 +767,92 @@ class PasteInputHostApi {
   // Useful for debugging and platform-specific behavior.
   // Example: "Android 14", "iOS 17.0", "macOS 14.0"
   virtual ErrorOr<std::string> GetPlatformVersion() = 0;
+  // Returns the clipboard change counter and the available MIME types.
+  //
+  // This is served from state the platform already tracks and transfers
+  // no clipboard payload, so it is cheap enough to call while building UI
+  // (e.g. to decide whether a paste button should be enabled).
+  virtual void ProbeClipboard(std::function<void(ErrorOr<ClipboardProbe> reply)> result) = 0;
+  // Applies tuning options to the native paste pipeline.
+  //
+  // On Linux and Windows the clipboard cache is shared by all Flutter
+  // engines in the process, so the options apply to every engine.
+  virtual std::optional<FlutterError> Configure(const PasteInputConfig& config) = 0;
+  // Hints that a paste is likely soon, e.g. because a text field gained
+  // focus.
+  //
+  // Where supported (Linux), the clipboard is read and encoded in the
+  // background at idle priority so that the next [getClipboardContent]
+  // is served from the warm snapshot. Elsewhere this is a no-op.
+  virtual std::optional<FlutterError> PrefetchClipboard() = 0;
+  // Cancels the [getClipboardContent] request with the given id.
+  //
+  // The request fails with the error code "cancelled". Native work that no
+  // other request is waiting on is abandoned and its buffers released.
+  // Unknown or already completed ids are ignored.
+  virtual std::optional<FlutterError> CancelPaste(int64_t request_id) = 0;
+  // Releases natively cached clipboard data, as the platform does by
+  // itself on low-memory warnings where it reports them (Linux).
+  //
+  // [level] is 0 (low), 1 (medium) or 2 (critical); higher levels drop
+  // more, including data that is still fresh. Returns the number of bytes
+  // released from the plugin's caches.
+  virtual void TrimMemory(
+    int64_t level,
+    std::function<void(ErrorOr<int64_t> reply)> result) = 0;
+  // Replaces the clipboard content with [content].
+  //
+  // Fails with the error code "invalid-argument" if [content] is empty or
+  // an image lacks its MIME type, and with "unsupported-format" if a
+  // requested rendition cannot be produced on this platform.
+  virtual void SetClipboardContent(
+    const ClipboardWrite& content,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  // Lists the clipboard history, most recent first, without its content.
+  //
+  // Only Linux keeps a history; elsewhere the list is empty.
+  virtual void ListClipboardHistory(std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Returns the content of the history entry with the given [id].
+  //
+  // Fails with the error code "not-found" if the entry has been dropped
+  // from the history, or never existed.
+  virtual void GetClipboardHistoryEntry(
+    int64_t id,
+    std::function<void(ErrorOr<ClipboardContent> reply)> result) = 0;
+  // Searches the text of the clipboard history for [query].
+  //
+  // Entries match if their text contains every whitespace-separated term
+  // of [query], ignoring ASCII case. At most [maxResults] are returned,
+  // those with the most occurrences first, then the most recent. Only
+  // Linux keeps a history; elsewhere the list is empty.
+  virtual void SearchClipboardHistory(
+    const std::string& query,
+    int64_t max_results,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Returns the time spent in each stage of the paste pipeline since the
+  // last [resetPasteStats].
+  //
+  // Only Linux instruments its pipeline; elsewhere the list is empty.
+  virtual void GetPasteStats(std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Zeroes the counters reported by [getPasteStats] and
+  // [getPasteLatencies].
+  virtual void ResetPasteStats(std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  // Returns latency percentiles of each stage of the paste pipeline, and
+  // end to end, per kind of content, since the last [resetPasteStats].
+  // Combinations without runs are left out.
+  //
+  // Only Linux instruments its pipeline; elsewhere the list is empty.
+  virtual void GetPasteLatencies(std::function<void(ErrorOr<flutter::EncodableList> reply)> result) = 0;
+  // Writes the paste pipeline activity recorded since tracing was started
+  // with [PasteInputConfig.traceFile] to [path] as Chrome trace JSON.
+  // Recording goes on.
+  //
+  // Returns the number of events written, or fails with the error code
+  // "write-failed" if the file cannot be written. Only Linux records a
+  // trace; elsewhere no file is written and 0 is returned.
+  virtual void DumpPasteTrace(
+    const std::string& path,
+    std::function<void(ErrorOr<int64_t> reply)> result) = 0;
 
   // The codec used by PasteInputHostApi.
   static const flutter::StandardMessageCodec& GetCodec();
@@ -220,6 +894,12 @@ class PasteInputFlutterApi {
     const ClipboardContent& content,
     std::function<void(void)>&& on_success,
     std::function<void(const FlutterError&)>&& on_error);
+  // Called periodically while a large selection is transferred for a
+  // [PasteInputHostApi.getClipboardContent] request.
+  void OnPasteProgress(
+    const PasteProgress& progress,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
 
  private:
   flutter::BinaryMessenger* binary_messenger_;